@@ -3,12 +3,16 @@
 #endif()
 
 include(CheckCSourceRuns)
+include(CheckCSourceCompiles)
 
 option(ENABLE_SSE    "Enable compile-time SSE4.1 support." ON)
 option(ENABLE_AVX    "Enable compile-time AVX support."    ON)
 option(ENABLE_AVX2   "Enable compile-time AVX2 support."   ON)
 option(ENABLE_FMA    "Enable compile-time FMA support."    ON)
 option(ENABLE_AVX512 "Enable compile-time AVX512 support." ON)
+option(ENABLE_AVX512BW_TARGET "Build AVX512BW kernels selected at run-time." ON)
+option(ENABLE_PCLMUL_TARGET "Build PCLMULQDQ kernels selected at run-time." ON)
+option(ENABLE_AESNI_TARGET "Build AES-NI kernels selected at run-time." ON)
 
 if (ENABLE_SSE)
     #
@@ -170,7 +174,106 @@ if (ENABLE_SSE)
         endif()
     endif()
 
+    if (ENABLE_AVX512BW_TARGET)
+
+        #
+        # Check compiler for AVX512BW intrinsics in functions built for that target only. The CPU running the
+        # code is checked at run-time, so it does not need to support it
+        #
+        if (CMAKE_COMPILER_IS_GNUCC)
+            set(CMAKE_REQUIRED_FLAGS "")
+            check_c_source_compiles("
+          #include <immintrin.h>
+          #pragma GCC push_options
+          #pragma GCC target(\"avx2,avx512f,avx512bw\")
+          static void add(short *x)
+          {
+            __m512i a = _mm512_loadu_si512(x);
+            a = _mm512_permutexvar_epi16(a, _mm512_adds_epi8(a, a));
+            _mm512_storeu_si512(x, _mm512_mask_set1_epi16(a, 1, 0));
+          }
+          #pragma GCC pop_options
+          int main()
+          {
+            short x[32] = {0};
+            if (__builtin_cpu_supports(\"avx512bw\")) {
+              add(x);
+            }
+            return x[0];
+          }"
+                    HAVE_AVX512BW_TARGET)
+        endif()
+
+        if (HAVE_AVX512BW_TARGET)
+            message(STATUS "AVX512BW run-time selected kernels are enabled")
+        endif()
+    endif()
+
+    if (ENABLE_PCLMUL_TARGET)
+
+        #
+        # Check compiler for carry-less multiplication intrinsics in functions built for that target only
+        #
+        if (CMAKE_COMPILER_IS_GNUCC)
+            set(CMAKE_REQUIRED_FLAGS "")
+            check_c_source_compiles("
+          #include <immintrin.h>
+          #pragma GCC push_options
+          #pragma GCC target(\"ssse3,pclmul\")
+          static int mul(int a, int b)
+          {
+            __m128i x = _mm_clmulepi64_si128(_mm_cvtsi32_si128(a), _mm_cvtsi32_si128(b), 0x00);
+            return _mm_cvtsi128_si32(_mm_shuffle_epi8(x, x));
+          }
+          #pragma GCC pop_options
+          int main()
+          {
+            if (__builtin_cpu_supports(\"pclmul\")) {
+              return mul(1, 2);
+            }
+            return 0;
+          }"
+                    HAVE_PCLMUL_TARGET)
+        endif()
+
+        if (HAVE_PCLMUL_TARGET)
+            message(STATUS "PCLMUL run-time selected kernels are enabled")
+        endif()
+    endif()
+
+    if (ENABLE_AESNI_TARGET)
+
+        #
+        # Check compiler for AES round intrinsics in functions built for that target only
+        #
+        if (CMAKE_COMPILER_IS_GNUCC)
+            set(CMAKE_REQUIRED_FLAGS "")
+            check_c_source_compiles("
+          #include <immintrin.h>
+          #pragma GCC push_options
+          #pragma GCC target(\"sse4.1,aes\")
+          static int enc(int a, int b)
+          {
+            __m128i x = _mm_aesenc_si128(_mm_cvtsi32_si128(a), _mm_cvtsi32_si128(b));
+            return _mm_extract_epi32(_mm_aesenclast_si128(x, x), 1);
+          }
+          #pragma GCC pop_options
+          int main()
+          {
+            if (__builtin_cpu_supports(\"aes\")) {
+              return enc(1, 2);
+            }
+            return 0;
+          }"
+                    HAVE_AESNI_TARGET)
+        endif()
+
+        if (HAVE_AESNI_TARGET)
+            message(STATUS "AES-NI run-time selected kernels are enabled")
+        endif()
+    endif()
+
 
 endif()
 
-mark_as_advanced(HAVE_SSE, HAVE_AVX, HAVE_AVX2, HAVE_FMA, HAVE_AVX512)
+mark_as_advanced(HAVE_SSE, HAVE_AVX, HAVE_AVX2, HAVE_FMA, HAVE_AVX512, HAVE_AVX512BW_TARGET, HAVE_PCLMUL_TARGET, HAVE_AESNI_TARGET)
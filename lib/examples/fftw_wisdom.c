@@ -0,0 +1,201 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+/* Measures the FFTW plans of every transform the eNodeB and the UE create for
+ * each LTE bandwidth and saves the wisdom, so that they can load it at
+ * start-up instead of measuring. Covers OFDM (normal and extended CP), PSS/SSS
+ * synchronization, PRACH (preamble formats 0-3 and 4) and SC-FDMA transform
+ * precoding, with and without standard symbol sizes */
+
+#define TRACK_FRAME_SIZE 32
+
+char *output_file_name = NULL;
+int nof_prb = -1;
+
+const uint32_t prb_list[] = {6, 15, 25, 50, 75, 100};
+
+void usage(char *prog) {
+  printf("Usage: %s [opv]\n", prog);
+  printf("\t-o output_file [Default %s]\n", srslte_dft_wisdom_file());
+  printf("\t-p nof_prb [Default all]\n");
+  printf("\t-v srslte_verbose\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "opv")) != -1) {
+    switch(opt) {
+    case 'o':
+      output_file_name = argv[optind];
+      break;
+    case 'p':
+      nof_prb = atoi(argv[optind]);
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+int plan_ofdm(uint32_t prb, uint32_t symbol_sz) {
+  srslte_ofdm_t ofdm;
+  srslte_cp_t cp_list[2] = {SRSLTE_CP_NORM, SRSLTE_CP_EXT};
+  int ret = SRSLTE_ERROR;
+
+  cf_t *in  = srslte_vec_malloc(sizeof(cf_t) * SRSLTE_SF_LEN(symbol_sz));
+  cf_t *out = srslte_vec_malloc(sizeof(cf_t) * SRSLTE_SF_LEN(symbol_sz));
+  if (!in || !out) {
+    perror("malloc");
+    goto clean_exit;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (srslte_ofdm_tx_init(&ofdm, cp_list[i], in, out, prb)) {
+      goto clean_exit;
+    }
+    srslte_ofdm_tx_free(&ofdm);
+    if (srslte_ofdm_rx_init(&ofdm, cp_list[i], in, out, prb)) {
+      goto clean_exit;
+    }
+    srslte_ofdm_rx_free(&ofdm);
+  }
+  ret = SRSLTE_SUCCESS;
+
+clean_exit:
+  if (in) {
+    free(in);
+  }
+  if (out) {
+    free(out);
+  }
+  return ret;
+}
+
+int plan_sync(uint32_t symbol_sz) {
+  srslte_sync_t sync;
+  uint32_t sf_len = SRSLTE_SF_LEN(symbol_sz);
+
+  // Cell search and tracking, as done by ue_sync
+  if (srslte_sync_init(&sync, sf_len, sf_len, symbol_sz)) {
+    return SRSLTE_ERROR;
+  }
+  srslte_sync_free(&sync);
+  if (srslte_sync_init(&sync, sf_len, TRACK_FRAME_SIZE, symbol_sz)) {
+    return SRSLTE_ERROR;
+  }
+  srslte_sync_free(&sync);
+  if (srslte_sync_init(&sync, sf_len, SRSLTE_CP_LEN_NORM(1, symbol_sz), symbol_sz)) {
+    return SRSLTE_ERROR;
+  }
+  srslte_sync_free(&sync);
+  return SRSLTE_SUCCESS;
+}
+
+int plan_prach(uint32_t symbol_sz) {
+  srslte_prach_t prach;
+  int ret = SRSLTE_ERROR;
+
+  if (srslte_prach_init(&prach, symbol_sz)) {
+    return SRSLTE_ERROR;
+  }
+  // Configuration 0 is preamble format 0 and 48 is format 4
+  if (!srslte_prach_set_cell(&prach, symbol_sz, 0, 0, false, 1) &&
+      !srslte_prach_set_cell(&prach, symbol_sz, 48, 0, false, 1)) {
+    ret = SRSLTE_SUCCESS;
+  }
+  srslte_prach_free(&prach);
+  return ret;
+}
+
+int plan_precoding() {
+  srslte_dft_precoding_t precoding;
+
+  if (srslte_dft_precoding_init_tx(&precoding, SRSLTE_MAX_PRB)) {
+    return SRSLTE_ERROR;
+  }
+  srslte_dft_precoding_free(&precoding);
+  if (srslte_dft_precoding_init_rx(&precoding, SRSLTE_MAX_PRB)) {
+    return SRSLTE_ERROR;
+  }
+  srslte_dft_precoding_free(&precoding);
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  struct timeval t[3];
+
+  parse_args(argc, argv);
+  if (!output_file_name) {
+    output_file_name = (char*) srslte_dft_wisdom_file();
+  }
+
+  gettimeofday(&t[1], NULL);
+  if (plan_precoding()) {
+    fprintf(stderr, "Error planning SC-FDMA transform precoding\n");
+    exit(-1);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  printf("SC-FDMA: %.1f s\n", t[0].tv_sec + t[0].tv_usec * 1e-6);
+
+  for (uint32_t i = 0; i < sizeof(prb_list) / sizeof(uint32_t); i++) {
+    if (nof_prb > 0 && prb_list[i] != nof_prb) {
+      continue;
+    }
+    for (int standard = 1; standard >= 0; standard--) {
+      srslte_use_standard_symbol_size(standard);
+      uint32_t symbol_sz = (uint32_t) srslte_symbol_sz(prb_list[i]);
+
+      gettimeofday(&t[1], NULL);
+      if (plan_ofdm(prb_list[i], symbol_sz) || plan_sync(symbol_sz) || plan_prach(symbol_sz)) {
+        fprintf(stderr, "Error planning %d PRB, symbol size %d\n", prb_list[i], symbol_sz);
+        exit(-1);
+      }
+      gettimeofday(&t[2], NULL);
+      get_time_interval(t);
+      printf("%3d PRB, symbol size %4d: %.1f s\n", prb_list[i], symbol_sz, t[0].tv_sec + t[0].tv_usec * 1e-6);
+    }
+  }
+
+  if (srslte_dft_export_wisdom(output_file_name)) {
+    fprintf(stderr, "Error writing wisdom to %s\n", output_file_name);
+    exit(-1);
+  }
+  printf("Wisdom written to %s\n", output_file_name);
+  exit(0);
+}
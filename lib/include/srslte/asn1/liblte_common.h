@@ -110,6 +110,18 @@ typedef struct{
     uint8  msg[LIBLTE_MAX_MSG_SIZE_BYTES];
 }LIBLTE_BYTE_MSG_STRUCT;
 
+// Bits packed MSB first, eight per byte
+typedef struct{
+    uint32 N_bits;
+    uint8  msg[LIBLTE_MAX_MSG_SIZE_BYTES];
+}LIBLTE_PACKED_MSG_STRUCT;
+
+// Read/write position in packed bits, N_bits from the start of msg
+typedef struct{
+    uint8  *msg;
+    uint32  N_bits;
+}LIBLTE_BIT_PTR_STRUCT;
+
 
 /*******************************************************************************
                               DECLARATIONS
@@ -132,6 +144,72 @@ void liblte_value_2_bits(uint32   value,
 uint32 liblte_bits_2_value(uint8  **bits,
                            uint32   N_bits);
 
+/*********************************************************************
+    Name: liblte_bit_ptr_init
+
+    Description: Points to the first bit of a packed bit buffer
+*********************************************************************/
+void liblte_bit_ptr_init(LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint8                 *msg);
+
+/*********************************************************************
+    Name: liblte_value_2_bits
+
+    Description: Converts a value to a packed bit string. Bits after
+                 the written ones in the last byte are cleared
+*********************************************************************/
+void liblte_value_2_bits(uint32                 value,
+                         LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint32                 N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_2_value
+
+    Description: Converts a packed bit string to a value
+*********************************************************************/
+uint32 liblte_bits_2_value(LIBLTE_BIT_PTR_STRUCT *bits,
+                           uint32                 N_bits);
+
+/*********************************************************************
+    Name: liblte_bytes_2_bits
+
+    Description: Appends N_bits of a packed byte array to a packed
+                 bit string
+*********************************************************************/
+void liblte_bytes_2_bits(uint8                 *bytes,
+                         LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint32                 N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_2_bytes
+
+    Description: Reads N_bits of a packed bit string into a packed
+                 byte array
+*********************************************************************/
+void liblte_bits_2_bytes(LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint8                 *bytes,
+                         uint32                 N_bits);
+
+/*********************************************************************
+    Name: liblte_bit_array_2_bits
+
+    Description: Appends a bit array (one bit per byte) to a packed
+                 bit string
+*********************************************************************/
+void liblte_bit_array_2_bits(uint8                 *bit_array,
+                             LIBLTE_BIT_PTR_STRUCT *bits,
+                             uint32                 N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_2_bit_array
+
+    Description: Reads N_bits of a packed bit string into a bit array
+                 (one bit per byte)
+*********************************************************************/
+void liblte_bits_2_bit_array(LIBLTE_BIT_PTR_STRUCT *bits,
+                             uint8                 *bit_array,
+                             uint32                 N_bits);
+
 /*********************************************************************
     Name: liblte_pack
 
@@ -177,4 +255,19 @@ void liblte_align_up(uint8_t **ptr, uint32_t align);
 *********************************************************************/
 void liblte_align_up_zero(uint8_t **ptr, uint32_t align);
 
+/*********************************************************************
+    Name: liblte_align_up
+
+    Description: Aligns a packed bit position to a multibit boundary
+*********************************************************************/
+void liblte_align_up(LIBLTE_BIT_PTR_STRUCT *ptr, uint32_t align);
+
+/*********************************************************************
+    Name: liblte_align_up_zero
+
+    Description:  Aligns a packed bit position to a multibit boundary
+                  and zeros bits skipped
+*********************************************************************/
+void liblte_align_up_zero(LIBLTE_BIT_PTR_STRUCT *ptr, uint32_t align);
+
 #endif // SRSLTE_LIBLTE_COMMON_H
@@ -104,8 +104,8 @@ typedef struct{
 }LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg);
 
 /*********************************************************************
@@ -165,8 +165,8 @@ typedef struct{
 }LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info);
 
 /*********************************************************************
@@ -208,8 +208,8 @@ typedef struct{
 }LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg);
 
 /*********************************************************************
@@ -234,8 +234,8 @@ typedef struct{
 }LIBLTE_RRC_TMGI_R9_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tmgi_r9_ie(LIBLTE_RRC_TMGI_R9_STRUCT *tmgi,
-                                             uint8                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tmgi_r9_ie(uint8                    **ie_ptr,
+                                             LIBLTE_BIT_PTR_STRUCT     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tmgi_r9_ie(LIBLTE_BIT_PTR_STRUCT     *ie_ptr,
                                                LIBLTE_RRC_TMGI_R9_STRUCT *tmgi);
 
 /*********************************************************************
@@ -256,8 +256,8 @@ typedef struct{
 }LIBLTE_RRC_MBMS_SESSION_INFO_R9_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbms_session_info_r9_ie(LIBLTE_RRC_MBMS_SESSION_INFO_R9_STRUCT  *mbms_session_info,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbms_session_info_r9_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbms_session_info_r9_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_MBMS_SESSION_INFO_R9_STRUCT  *mbms_session_info);
 
 /*********************************************************************
@@ -293,8 +293,8 @@ typedef struct{
 }LIBLTE_RRC_PMCH_CONFIG_R9_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pmch_config_r9_ie(LIBLTE_RRC_PMCH_CONFIG_R9_STRUCT *pmch_cnfg,
-                                                    uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_config_r9_ie(uint8                           **ie_ptr,
+                                                    LIBLTE_BIT_PTR_STRUCT            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_config_r9_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                       LIBLTE_RRC_PMCH_CONFIG_R9_STRUCT *pmch_cnfg);
 
 /*********************************************************************
@@ -315,8 +315,8 @@ typedef struct{
 }LIBLTE_RRC_PMCH_INFO_R9_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pmch_info_r9_ie(LIBLTE_RRC_PMCH_INFO_R9_STRUCT  *pmch_info,
-                                                  uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_info_r9_ie(uint8                          **ie_ptr,
+                                                  LIBLTE_BIT_PTR_STRUCT           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_info_r9_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_PMCH_INFO_R9_STRUCT  *pmch_info);
 
 /*********************************************************************
@@ -330,10 +330,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_info_r9_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
-                                            uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
-                                              uint16  *rnti);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16                 rnti,
+                                            LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                              uint16                *rnti);
 
 /*********************************************************************
     IE Name: Dedicated Info CDMA2000
@@ -348,8 +348,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_BYTE_MSG_STRUCT  *ded_info_cdma2000,
-                                                             uint8                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8                  **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT   *ie_ptr,
                                                                LIBLTE_BYTE_MSG_STRUCT  *ded_info_cdma2000);
 
 /*********************************************************************
@@ -365,8 +365,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_BYTE_MSG_STRUCT  *ded_info_nas,
-                                                        uint8                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8                  **ie_ptr,
+                                                        LIBLTE_BIT_PTR_STRUCT   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(LIBLTE_BIT_PTR_STRUCT   *ie_ptr,
                                                           LIBLTE_BYTE_MSG_STRUCT  *ded_info_nas);
 
 /*********************************************************************
@@ -405,8 +405,8 @@ static const int8 liblte_rrc_filter_coefficient_num[LIBLTE_RRC_FILTER_COEFFICIEN
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFICIENT_ENUM   filter_coeff,
-                                                        uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8                              **ie_ptr,
+                                                        LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                           LIBLTE_RRC_FILTER_COEFFICIENT_ENUM  *filter_coeff);
 
 /*********************************************************************
@@ -421,10 +421,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
-                                          uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
-                                            uint8  *mmec);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8                  mmec,
+                                          LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                            uint8                 *mmec);
 
 /*********************************************************************
     IE Name: Neigh Cell Config
@@ -438,10 +438,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config,
-                                                       uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
-                                                         uint8  *neigh_cell_config);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8                  neigh_cell_config,
+                                                       LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                         uint8                 *neigh_cell_config);
 
 /*********************************************************************
     IE Name: Other Config
@@ -475,8 +475,8 @@ typedef struct{
 }LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg,
-                                                  uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8                             **ie_ptr,
+                                                  LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                     LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg);
 
 /*********************************************************************
@@ -491,10 +491,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
-                                                         uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
-                                                           uint32  *rand);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32                 rand,
+                                                         LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                           uint32                *rand);
 
 /*********************************************************************
     IE Name: RAT Type
@@ -523,8 +523,8 @@ static const char liblte_rrc_rat_type_text[LIBLTE_RRC_RAT_TYPE_N_ITEMS][20] = {
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_type,
-                                              uint8                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_ptr,
+                                              LIBLTE_BIT_PTR_STRUCT     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(LIBLTE_BIT_PTR_STRUCT     *ie_ptr,
                                                 LIBLTE_RRC_RAT_TYPE_ENUM  *rat_type);
 
 /*********************************************************************
@@ -539,10 +539,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_pt
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_transaction_id,
-                                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr,
-                                                                  uint8  *rrc_transaction_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8                  rrc_transaction_id,
+                                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                  uint8                 *rrc_transaction_id);
 
 /*********************************************************************
     IE Name: S-TMSI
@@ -562,8 +562,8 @@ typedef struct{
 }LIBLTE_RRC_S_TMSI_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
-                                            uint8                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
+                                            LIBLTE_BIT_PTR_STRUCT     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(LIBLTE_BIT_PTR_STRUCT     *ie_ptr,
                                               LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi);
 
 /*********************************************************************
@@ -708,9 +708,9 @@ typedef struct{
 }LIBLTE_RRC_PDCP_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params,
-                                                 uint8                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8                            **ie_ptr,
-                                                   LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params);
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(LIBLTE_BIT_PTR_STRUCT             *ie_ptr,
+                                                   LIBLTE_RRC_PDCP_PARAMS_STRUCT     *pdcp_params);
 
 typedef struct{
     bool tx_antenna_selection_supported;
@@ -718,8 +718,8 @@ typedef struct{
 }LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -733,8 +733,8 @@ typedef struct{
 }LIBLTE_RRC_RF_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *params,
-                                               uint8                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **ie_ptr,
+                                               LIBLTE_BIT_PTR_STRUCT        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(LIBLTE_BIT_PTR_STRUCT        *ie_ptr,
                                                  LIBLTE_RRC_RF_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -743,8 +743,8 @@ typedef struct{
 }LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info);
 
 typedef struct{
@@ -753,8 +753,8 @@ typedef struct{
 }LIBLTE_RRC_MEAS_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -769,8 +769,8 @@ typedef struct{
 }LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -786,8 +786,8 @@ typedef struct{
 }LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT  *ue_eutra_capability,
-                                                         LIBLTE_BIT_MSG_STRUCT                  *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT  *ue_eutra_capability);
 
 
@@ -894,8 +894,8 @@ typedef struct{
 }LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants);
 
 /*********************************************************************
@@ -924,8 +924,8 @@ static const double liblte_rrc_allowed_meas_bandwidth_num[LIBLTE_RRC_ALLOWED_MEA
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM   allowed_meas_bw,
-                                                            uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8                                  **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                               LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM  *allowed_meas_bw);
 
 /*********************************************************************
@@ -940,10 +940,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
-                                                  uint8  *hysteresis);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8                  hysteresis,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  uint8                 *hysteresis);
 
 /*********************************************************************
     IE Name: Location Info
@@ -1668,8 +1668,8 @@ typedef struct{
 }LIBLTE_RRC_MEAS_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg);
 
 /*********************************************************************
@@ -1687,8 +1687,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8
 // Meas Gap Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg);
 
 /*********************************************************************
@@ -1703,10 +1703,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
-                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
-                                               uint8  *meas_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8                  meas_id,
+                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                               uint8                 *meas_id);
 
 /*********************************************************************
     IE Name: Meas Id To Add Mod List
@@ -1724,8 +1724,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
 // Meas ID To Add Mod List structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list);
 
 /*********************************************************************
@@ -1742,8 +1742,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8
 // Meas Object CDMA2000 structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000);
 
 /*********************************************************************
@@ -1760,8 +1760,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8
 // Meas Object EUTRA structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra);
 
 /*********************************************************************
@@ -1778,8 +1778,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8
 // Meas Object GERAN struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran);
 
 /*********************************************************************
@@ -1793,10 +1793,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
-                                                    uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
-                                                      uint8  *meas_object_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8                  meas_object_id,
+                                                    LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                      uint8                 *meas_object_id);
 
 /*********************************************************************
     IE Name: Meas Object To Add Mod List
@@ -1813,8 +1813,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
 // Meas Object To Add Mod List structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                 uint8                                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8                                         **ie_ptr,
+                                                                 LIBLTE_BIT_PTR_STRUCT                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(LIBLTE_BIT_PTR_STRUCT                          *ie_ptr,
                                                                    LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list);
 
 /*********************************************************************
@@ -1833,8 +1833,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8
 // Meas Object UTRA structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra);
 
 /*********************************************************************
@@ -1867,8 +1867,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8
 // Quantity Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc);
 
 /*********************************************************************
@@ -1886,8 +1886,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8
 // Report Config EUTRA structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra);
 
 /*********************************************************************
@@ -1901,10 +1901,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
-                                                      uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
-                                                        uint8  *report_cnfg_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8                  report_cnfg_id,
+                                                      LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                        uint8                 *report_cnfg_id);
 
 /*********************************************************************
     IE Name: Report Config Inter RAT
@@ -1921,8 +1921,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
 // Report Config Inter RAT structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat);
 
 /*********************************************************************
@@ -1940,8 +1940,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8
 // Report Config To Add Mod List structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                   uint8                                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8                                           **ie_ptr,
+                                                                   LIBLTE_BIT_PTR_STRUCT                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(LIBLTE_BIT_PTR_STRUCT                            *ie_ptr,
                                                                      LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list);
 
 /*********************************************************************
@@ -1957,8 +1957,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_ENUM   report_int,
-                                                     uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8                           **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                        LIBLTE_RRC_REPORT_INTERVAL_ENUM  *report_int);
 
 /*********************************************************************
@@ -1973,10 +1973,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
-                                                  uint8  *rsrp_range);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8                  rsrp_range,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  uint8                 *rsrp_range);
 
 /*********************************************************************
     IE Name: RSRQ Range
@@ -1990,10 +1990,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
-                                                  uint8  *rsrq_range);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8                  rsrq_range,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  uint8                 *rsrq_range);
 
 /*********************************************************************
     IE Name: Time To Trigger
@@ -2011,8 +2011,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_ENUM   time_to_trigger,
-                                                     uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8                           **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                        LIBLTE_RRC_TIME_TO_TRIGGER_ENUM  *time_to_trigger);
 
 /*********************************************************************
@@ -2026,10 +2026,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_spect_em,
-                                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_ptr,
-                                                                    uint8  *add_spect_em);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8                  add_spect_em,
+                                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                    uint8                 *add_spect_em);
 
 /*********************************************************************
     IE Name: ARFCN value CDMA2000
@@ -2043,10 +2043,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_p
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
-                                                          uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
-                                                            uint16  *arfcn);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16                 arfcn,
+                                                          LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                            uint16                *arfcn);
 
 /*********************************************************************
     IE Name: ARFCN value EUTRA
@@ -2061,10 +2061,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
-                                                         uint16  *arfcn);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16                 arfcn,
+                                                       LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                         uint16                *arfcn);
 
 /*********************************************************************
     IE Name: ARFCN value GERAN
@@ -2078,10 +2078,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
-                                                         uint16  *arfcn);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16                 arfcn,
+                                                       LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                         uint16                *arfcn);
 
 /*********************************************************************
     IE Name: ARFCN value UTRA
@@ -2096,10 +2096,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
-                                                      uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
-                                                        uint16  *arfcn);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16                 arfcn,
+                                                      LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                        uint16                *arfcn);
 
 /*********************************************************************
     IE Name: Band Class CDMA2000
@@ -2115,8 +2115,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM   bc_cdma2000,
-                                                         uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8                               **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                            LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM  *bc_cdma2000);
 
 /*********************************************************************
@@ -2133,8 +2133,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM   bi_geran,
-                                                          uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8                                **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                             LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM  *bi_geran);
 
 /*********************************************************************
@@ -2150,8 +2150,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8
 // Carrier Freq CDMA2000 struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq);
 
 /*********************************************************************
@@ -2171,8 +2171,8 @@ typedef struct{
 }LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq);
 
 /*********************************************************************
@@ -2191,8 +2191,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8
 // Carrier Freqs GERAN structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs);
 
 /*********************************************************************
@@ -2208,8 +2208,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM   cdma2000_type,
-                                                   uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8                         **ie_ptr,
+                                                   LIBLTE_BIT_PTR_STRUCT          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                      LIBLTE_RRC_CDMA2000_TYPE_ENUM  *cdma2000_type);
 
 /*********************************************************************
@@ -2223,10 +2223,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
-                                                   uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
-                                                     uint32  *cell_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32                 cell_id,
+                                                   LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                     uint32                *cell_id);
 
 /*********************************************************************
     IE Name: Cell Index List
@@ -2242,8 +2242,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
 // Cell Index List struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list);
 
 /*********************************************************************
@@ -2260,10 +2260,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_resel_prio,
-                                                               uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
-                                                                 uint8  *cell_resel_prio);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8                  cell_resel_prio,
+                                                               LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                 uint8                 *cell_resel_prio);
 
 /*********************************************************************
     IE Name: CSFB Registration Param 1xRTT
@@ -2302,12 +2302,12 @@ typedef struct{
 }LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param,
-                                                                   uint8                                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8                                           **ie_ptr,
+                                                                   LIBLTE_BIT_PTR_STRUCT                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(LIBLTE_BIT_PTR_STRUCT                            *ie_ptr,
                                                                      LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param,
-                                                                        uint8                                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8                                                **ie_ptr,
+                                                                        LIBLTE_BIT_PTR_STRUCT                                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_BIT_PTR_STRUCT                                 *ie_ptr,
                                                                           LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param);
 
 /*********************************************************************
@@ -2327,8 +2327,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2348,8 +2348,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2370,8 +2370,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2391,8 +2391,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2407,10 +2407,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
-                                                  uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
-                                                    uint32  *csg_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32                 csg_id,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint32                *csg_id);
 
 /*********************************************************************
     IE Name: Mobility Control Info
@@ -2913,8 +2913,8 @@ typedef struct{
 }LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info);
 
 /*********************************************************************
@@ -2945,8 +2945,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8
 // Mobility State Parameters struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params);
 
 /*********************************************************************
@@ -2960,10 +2960,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
-                                                  uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
-                                                    uint16  *phys_cell_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16                 phys_cell_id,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint16                *phys_cell_id);
 
 /*********************************************************************
     IE Name: Phys Cell ID Range
@@ -2980,8 +2980,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
 // Phys Cell ID Range struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range);
 
 /*********************************************************************
@@ -3010,10 +3010,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
-                                                             uint16  *phys_cell_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16                 phys_cell_id,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint16                *phys_cell_id);
 
 /*********************************************************************
     IE Name: Phys Cell ID GERAN
@@ -3028,8 +3028,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
 // Phys Cell ID GERAN struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id);
 
 /*********************************************************************
@@ -3043,10 +3043,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
-                                                             uint16  *phys_cell_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16                 phys_cell_id,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint16                *phys_cell_id);
 
 /*********************************************************************
     IE Name: Phys Cell ID UTRA TDD
@@ -3059,10 +3059,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
-                                                           uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
-                                                             uint8  *phys_cell_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8                  phys_cell_id,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint8                 *phys_cell_id);
 
 /*********************************************************************
     IE Name: PLMN Identity
@@ -3078,8 +3078,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
 // PLMN Identity struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id,
-                                                   uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8                           **ie_ptr,
+                                                   LIBLTE_BIT_PTR_STRUCT            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                      LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id);
 
 /*********************************************************************
@@ -3095,8 +3095,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8
 // Pre Registration Info HRPD struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd,
-                                                                uint8                                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8                                        **ie_ptr,
+                                                                LIBLTE_BIT_PTR_STRUCT                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(LIBLTE_BIT_PTR_STRUCT                         *ie_ptr,
                                                                   LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd);
 
 /*********************************************************************
@@ -3112,10 +3112,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
-                                                  int8   *q_qual_min);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8                   q_qual_min,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  int8                  *q_qual_min);
 
 /*********************************************************************
     IE Name: Q Rx Lev Min
@@ -3129,10 +3129,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
-                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
-                                                    int16  *q_rx_lev_min);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16                  q_rx_lev_min,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    int16                 *q_rx_lev_min);
 
 /*********************************************************************
     IE Name: Q Offset Range
@@ -3150,8 +3150,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_ENUM   q_offset_range,
-                                                    uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8                          **ie_ptr,
+                                                    LIBLTE_BIT_PTR_STRUCT           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                       LIBLTE_RRC_Q_OFFSET_RANGE_ENUM  *q_offset_range);
 
 /*********************************************************************
@@ -3167,10 +3167,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_range_inter_rat,
-                                                              uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
-                                                                int8   *q_offset_range_inter_rat);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8                   q_offset_range_inter_rat,
+                                                              LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                int8                  *q_offset_range_inter_rat);
 
 /*********************************************************************
     IE Name: Reselection Threshold
@@ -3183,10 +3183,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
-                                                           uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
-                                                             uint8  *resel_thresh);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8                  resel_thresh,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint8                 *resel_thresh);
 
 /*********************************************************************
     IE Name: Reselection Threshold Q
@@ -3200,10 +3200,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thresh_q,
-                                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
-                                                               uint8  *resel_thresh_q);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8                  resel_thresh_q,
+                                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                               uint8                 *resel_thresh_q);
 
 /*********************************************************************
     IE Name: S Cell Index
@@ -3217,10 +3217,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
-                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
-                                                    uint8  *s_cell_idx);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8                  s_cell_idx,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint8                 *s_cell_idx);
 
 /*********************************************************************
     IE Name: Serv Cell Index
@@ -3234,10 +3234,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
-                                                     uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
-                                                       uint8  *serv_cell_idx);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8                  serv_cell_idx,
+                                                     LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                       uint8                 *serv_cell_idx);
 
 /*********************************************************************
     IE Name: Speed State Scale Factors
@@ -3255,8 +3255,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
 // Speed State Scale Factors struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors);
 
 /*********************************************************************
@@ -3290,8 +3290,8 @@ typedef struct{
 }LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000);
 
 /*********************************************************************
@@ -3306,10 +3306,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
-                                                        uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
-                                                          uint16  *tac);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16                 tac,
+                                                        LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                          uint16                *tac);
 
 /*********************************************************************
     IE Name: T Reselection
@@ -3323,10 +3323,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
-                                                   uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
-                                                     uint8  *t_resel);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8                  t_resel,
+                                                   LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                     uint8                 *t_resel);
 
 /*********************************************************************
     IE Name: Next Hop Chaining Count
@@ -3340,10 +3340,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_chaining_count,
-                                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
-                                                               uint8  *next_hop_chaining_count);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8                  next_hop_chaining_count,
+                                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                               uint8                 *next_hop_chaining_count);
 
 /*********************************************************************
     IE Name: Security Algorithm Config
@@ -3388,8 +3388,8 @@ typedef struct{
 }LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg);
 
 /*********************************************************************
@@ -3404,10 +3404,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
-                                                 uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
-                                                   uint16  *short_mac_i);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16                 short_mac_i,
+                                                 LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                   uint16                *short_mac_i);
 
 /*********************************************************************
     IE Name: Antenna Info
@@ -3464,12 +3464,12 @@ typedef struct{
 }LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM   antenna_ports_cnt,
-                                                         uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8                               **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                            LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM  *antenna_ports_cnt);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info);
 
 /*********************************************************************
@@ -3520,8 +3520,8 @@ typedef struct{
 }LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg);
 
 /*********************************************************************
@@ -3563,10 +3563,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
-                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
-                                                    uint8  *drb_id);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8                  drb_id,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint8                 *drb_id);
 
 /*********************************************************************
     IE Name: Logical Channel Config
@@ -3639,8 +3639,8 @@ typedef struct{
 }LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg);
 
 /*********************************************************************
@@ -3934,8 +3934,8 @@ typedef struct{
 }LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg);
 
 /*********************************************************************
@@ -3993,8 +3993,8 @@ typedef struct{
 }LIBLTE_RRC_PDCP_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg);
 
 /*********************************************************************
@@ -4025,12 +4025,12 @@ static const float liblte_rrc_pdsch_config_p_a_num[LIBLTE_RRC_PDSCH_CONFIG_P_A_N
 // PDSCH Config Common struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM   p_a,
-                                                            uint8                            **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8                            **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT             *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT             *ie_ptr,
                                                               LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM  *p_a);
 
 /*********************************************************************
@@ -4047,8 +4047,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8
 // PHICH Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config,
-                                                  uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8                          **ie_ptr,
+                                                  LIBLTE_BIT_PTR_STRUCT           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config);
 
 /*********************************************************************
@@ -4200,8 +4200,8 @@ typedef struct{
 }LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded);
 
 /*********************************************************************
@@ -4217,10 +4217,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
-                                           uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
-                                             int8   *p_max);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8                   p_max,
+                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                             int8                  *p_max);
 
 /*********************************************************************
     IE Name: PRACH Config
@@ -4236,17 +4236,17 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
 // PRACH Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg,
-                                                  uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8                          **ie_ptr,
+                                                  LIBLTE_BIT_PTR_STRUCT           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg);
-LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_idx,
-                                                            uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
-                                                              uint8  *prach_cnfg_idx);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8                  prach_cnfg_idx,
+                                                            LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                              uint8                 *prach_cnfg_idx);
 
 /*********************************************************************
     IE Name: Presence Antenna Port 1
@@ -4260,10 +4260,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
 // Enums
 // Structs
 // Functions
-LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_ant_port_1,
-                                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
-                                                               bool   *presence_ant_port_1);
+LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool                   presence_ant_port_1,
+                                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                               bool                  *presence_ant_port_1);
 
 /*********************************************************************
     IE Name: PUCCH Config
@@ -4280,12 +4280,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
 // PUCCH Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg);
 
 /*********************************************************************
@@ -4304,12 +4304,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8
 // PUSCH Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg);
 
 /*********************************************************************
@@ -4326,8 +4326,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8
 // RACH Config Common structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg);
 
 /*********************************************************************
@@ -4343,8 +4343,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8
 // RACH Config Dedicated struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg);
 
 /*********************************************************************
@@ -4414,12 +4414,12 @@ typedef struct{
 // RR Config Common struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg);
 
 /*********************************************************************
@@ -4920,8 +4920,8 @@ typedef struct{
 }LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg);
 
 /*********************************************************************
@@ -4937,8 +4937,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8
 // RLC Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg,
-                                                uint8                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        **ie_ptr,
+                                                LIBLTE_BIT_PTR_STRUCT         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(LIBLTE_BIT_PTR_STRUCT         *ie_ptr,
                                                   LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg);
 
 /*********************************************************************
@@ -4955,8 +4955,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        *
 // RLF Timers and Constants struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants,
-                                                              uint8                                      **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8                                      **ie_ptr,
+                                                              LIBLTE_BIT_PTR_STRUCT                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(LIBLTE_BIT_PTR_STRUCT                       *ie_ptr,
                                                                 LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants);
 
 /*********************************************************************
@@ -4985,8 +4985,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8
 // Scheduling Request Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg);
 
 /*********************************************************************
@@ -5004,12 +5004,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8
 // Sounding RS UL Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg);
 
 /*********************************************************************
@@ -5026,8 +5026,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8
 // SPS Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg,
-                                                uint8                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        **ie_ptr,
+                                                LIBLTE_BIT_PTR_STRUCT         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(LIBLTE_BIT_PTR_STRUCT         *ie_ptr,
                                                   LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg);
 
 /*********************************************************************
@@ -5045,8 +5045,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        *
 // TDD Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg,
-                                                uint8                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        **ie_ptr,
+                                                LIBLTE_BIT_PTR_STRUCT         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(LIBLTE_BIT_PTR_STRUCT         *ie_ptr,
                                                   LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg);
 
 /*********************************************************************
@@ -5063,8 +5063,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        *
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM   time_alignment_timer,
-                                                          uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8                                **ie_ptr,
+                                                          LIBLTE_BIT_PTR_STRUCT                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                             LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM  *time_alignment_timer);
 
 /*********************************************************************
@@ -5081,8 +5081,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8
 // TPC PDCCH Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg);
 
 /*********************************************************************
@@ -5114,8 +5114,8 @@ typedef struct{
 }LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info);
 
 /*********************************************************************
@@ -5134,12 +5134,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8
 // Uplink Power Control structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl,
-                                                                uint8                                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8                                        **ie_ptr,
+                                                                LIBLTE_BIT_PTR_STRUCT                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                         *ie_ptr,
                                                                   LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl);
 
 /*********************************************************************
@@ -5234,8 +5234,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2);
 
 /*********************************************************************
@@ -5325,8 +5325,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3);
 
 /*********************************************************************
@@ -5356,8 +5356,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4);
 
 /*********************************************************************
@@ -5406,8 +5406,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5);
 
 /*********************************************************************
@@ -5455,8 +5455,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6);
 
 /*********************************************************************
@@ -5492,8 +5492,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7);
 
 /*********************************************************************
@@ -5555,8 +5555,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8);
 
 /*********************************************************************
@@ -5578,8 +5578,8 @@ typedef struct{
 
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9);
 
 /*********************************************************************
@@ -5640,8 +5640,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13);
 
 /*******************************************************************************
@@ -5674,8 +5674,8 @@ typedef struct{
 }LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_information_transfer_msg(LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+                                                              LIBLTE_BIT_PTR_STRUCT                     *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_PTR_STRUCT                     *msg,
                                                                 LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer);
 
 /*********************************************************************
@@ -5695,8 +5695,8 @@ typedef struct{
 }LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_handover_preparation_transfer_msg(LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT *ul_handover_prep_transfer,
-                                                                       LIBLTE_BIT_MSG_STRUCT                              *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_handover_preparation_transfer_msg(LIBLTE_BIT_MSG_STRUCT                              *msg,
+                                                                       LIBLTE_BIT_PTR_STRUCT                              *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_handover_preparation_transfer_msg(LIBLTE_BIT_PTR_STRUCT                              *msg,
                                                                          LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT *ul_handover_prep_transfer);
 
 /*********************************************************************
@@ -5715,8 +5715,8 @@ typedef struct{
 }LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_information_response_msg(LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT *ue_info_resp,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_response_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+                                                              LIBLTE_BIT_PTR_STRUCT                     *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_response_msg(LIBLTE_BIT_PTR_STRUCT                     *msg,
                                                                 LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT *ue_info_resp);
 
 /*********************************************************************
@@ -5736,8 +5736,8 @@ typedef struct{
 }LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_information_request_msg(LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+                                                             LIBLTE_BIT_PTR_STRUCT                    *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_PTR_STRUCT                    *msg,
                                                                LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req);
 
 /*********************************************************************
@@ -5764,8 +5764,8 @@ typedef struct{
 }LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info,
-                                                                LIBLTE_BIT_MSG_STRUCT                       *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_MSG_STRUCT                       *msg,
+                                                                LIBLTE_BIT_PTR_STRUCT                       *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_PTR_STRUCT                       *msg,
                                                                   LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info);
 
 /*********************************************************************
@@ -5787,8 +5787,8 @@ typedef struct{
 }LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_enquiry_msg(LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry);
 
 /*********************************************************************
@@ -5909,8 +5909,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_1_msg(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1,
                                                               uint32                                  *N_bits_used);
 
@@ -5973,8 +5973,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_MSG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs,
-                                               LIBLTE_BIT_MSG_STRUCT          *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT          *msg,
+                                               LIBLTE_BIT_PTR_STRUCT          *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_PTR_STRUCT          *msg,
                                                  LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs);
 
 /*********************************************************************
@@ -5993,8 +5993,8 @@ typedef struct{
 }LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_failure_msg(LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure);
 
 /*********************************************************************
@@ -6013,8 +6013,8 @@ typedef struct{
 }LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_complete_msg(LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+                                                             LIBLTE_BIT_PTR_STRUCT                    *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_PTR_STRUCT                    *msg,
                                                                LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete);
 
 /*********************************************************************
@@ -6033,8 +6033,8 @@ typedef struct{
 }LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_command_msg(LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd);
 
 /*********************************************************************
@@ -6063,8 +6063,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_complete_msg(LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete,
-                                                                    LIBLTE_BIT_MSG_STRUCT                       *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT_MSG_STRUCT                       *msg,
+                                                                    LIBLTE_BIT_PTR_STRUCT                       *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT_PTR_STRUCT                       *msg,
                                                                       LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete);
 
 /*********************************************************************
@@ -6083,8 +6083,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_SETUP_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_msg(LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup,
-                                                           LIBLTE_BIT_MSG_STRUCT              *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_MSG_STRUCT              *msg,
+                                                           LIBLTE_BIT_PTR_STRUCT              *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_PTR_STRUCT              *msg,
                                                              LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup);
 
 /*********************************************************************
@@ -6135,8 +6135,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_REQUEST_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req,
-                                                             LIBLTE_BIT_MSG_STRUCT                *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+                                                             LIBLTE_BIT_PTR_STRUCT                *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                                LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req);
 
 /*********************************************************************
@@ -6166,8 +6166,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_RELEASE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_release_msg(LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release,
-                                                             LIBLTE_BIT_MSG_STRUCT                *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+                                                             LIBLTE_BIT_PTR_STRUCT                *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                                LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release);
 
 /*********************************************************************
@@ -6185,8 +6185,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_REJECT_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reject_msg(LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej,
-                                                            LIBLTE_BIT_MSG_STRUCT               *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_MSG_STRUCT               *msg,
+                                                            LIBLTE_BIT_PTR_STRUCT               *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_PTR_STRUCT               *msg,
                                                               LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej);
 
 /*********************************************************************
@@ -6222,8 +6222,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req,
-                                                                             LIBLTE_BIT_MSG_STRUCT                                *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(LIBLTE_BIT_MSG_STRUCT                                *msg,
+                                                                             LIBLTE_BIT_PTR_STRUCT                                *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(LIBLTE_BIT_PTR_STRUCT                                *msg,
                                                                                LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req);
 
 /*********************************************************************
@@ -6241,8 +6241,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_reject_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej,
-                                                                            LIBLTE_BIT_MSG_STRUCT                               *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LIBLTE_BIT_MSG_STRUCT                               *msg,
+                                                                            LIBLTE_BIT_PTR_STRUCT                               *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LIBLTE_BIT_PTR_STRUCT                               *msg,
                                                                               LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej);
 
 /*********************************************************************
@@ -6261,8 +6261,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_complete_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                 *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(LIBLTE_BIT_MSG_STRUCT                                 *msg,
+                                                                              LIBLTE_BIT_PTR_STRUCT                                 *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(LIBLTE_BIT_PTR_STRUCT                                 *msg,
                                                                                 LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete);
 
 /*********************************************************************
@@ -6282,8 +6282,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest,
-                                                                     LIBLTE_BIT_MSG_STRUCT                        *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BIT_MSG_STRUCT                        *msg,
+                                                                     LIBLTE_BIT_PTR_STRUCT                        *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BIT_PTR_STRUCT                        *msg,
                                                                        LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest);
 
 /*********************************************************************
@@ -6302,8 +6302,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg(LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                 *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(LIBLTE_BIT_MSG_STRUCT                                 *msg,
+                                                                              LIBLTE_BIT_PTR_STRUCT                                 *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(LIBLTE_BIT_PTR_STRUCT                                 *msg,
                                                                                 LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete);
 
 /*********************************************************************
@@ -6353,8 +6353,8 @@ typedef struct{
 }LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_msg(LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig,
-                                                                     LIBLTE_BIT_MSG_STRUCT                        *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BIT_MSG_STRUCT                        *msg,
+                                                                     LIBLTE_BIT_PTR_STRUCT                        *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BIT_PTR_STRUCT                        *msg,
                                                                        LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig);
 
 /*********************************************************************
@@ -6373,8 +6373,8 @@ typedef struct{
 }LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rn_reconfiguration_complete_msg(LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete,
-                                                                  LIBLTE_BIT_MSG_STRUCT                         *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_MSG_STRUCT                         *msg,
+                                                                  LIBLTE_BIT_PTR_STRUCT                         *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_PTR_STRUCT                         *msg,
                                                                     LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete);
 
 /*********************************************************************
@@ -6393,8 +6393,8 @@ typedef struct{
 }LIBLTE_RRC_RN_RECONFIGURATION_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rn_reconfiguration_msg(LIBLTE_RRC_RN_RECONFIGURATION_STRUCT *rn_reconfig,
-                                                         LIBLTE_BIT_MSG_STRUCT                *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+                                                         LIBLTE_BIT_PTR_STRUCT                *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                            LIBLTE_RRC_RN_RECONFIGURATION_STRUCT *rn_reconfig);
 
 /*********************************************************************
@@ -6428,8 +6428,8 @@ typedef struct{
 }LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_proximity_indication_msg(LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind,
-                                                           LIBLTE_BIT_MSG_STRUCT                  *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_MSG_STRUCT                  *msg,
+                                                           LIBLTE_BIT_PTR_STRUCT                  *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_PTR_STRUCT                  *msg,
                                                              LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind);
 
 /*********************************************************************
@@ -6503,8 +6503,8 @@ typedef struct{
 }LIBLTE_RRC_PAGING_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
-                                             LIBLTE_BIT_MSG_STRUCT    *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
+                                             LIBLTE_BIT_PTR_STRUCT    *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_PTR_STRUCT    *msg,
                                                LIBLTE_RRC_PAGING_STRUCT *page);
 
 /*********************************************************************
@@ -6524,8 +6524,8 @@ typedef struct{
 }LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_from_eutra_command_msg(LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT *mobility_from_eutra_cmd,
-                                                                  LIBLTE_BIT_MSG_STRUCT                         *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_from_eutra_command_msg(LIBLTE_BIT_MSG_STRUCT                         *msg,
+                                                                  LIBLTE_BIT_PTR_STRUCT                         *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_from_eutra_command_msg(LIBLTE_BIT_PTR_STRUCT                         *msg,
                                                                     LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT *mobility_from_eutra_cmd);
 
 /*********************************************************************
@@ -6543,8 +6543,8 @@ typedef struct{
     bool                                    have_plmn_identity_list;
 }LIBLTE_RRC_CGI_INFO_STRUCT;
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cgi_info_ie(LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_info,
-                                              uint8                      **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(uint8                      **ie_ptr,
+                                              LIBLTE_BIT_PTR_STRUCT       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(LIBLTE_BIT_PTR_STRUCT       *ie_ptr,
                                                 LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_info);
 
 typedef struct{
@@ -6554,8 +6554,8 @@ typedef struct{
     bool  have_rsrq;
 }LIBLTE_RRC_MEAS_RESULT_STRUCT;
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_ie(LIBLTE_RRC_MEAS_RESULT_STRUCT  *meas_result,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_MEAS_RESULT_STRUCT  *meas_result);
 
 typedef struct{
@@ -6565,8 +6565,8 @@ typedef struct{
     LIBLTE_RRC_MEAS_RESULT_STRUCT           meas_result;
 }LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT;
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_eutra_ie(LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT  *meas_result_eutra,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT  *meas_result_eutra);
 
 typedef struct{
@@ -6634,8 +6634,8 @@ typedef struct{
 }LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_measurement_report_msg(LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *meas_report,
-                                                         LIBLTE_BIT_MSG_STRUCT                *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+                                                         LIBLTE_BIT_PTR_STRUCT                *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                            LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *meas_report);
 
 /*********************************************************************
@@ -6675,7 +6675,7 @@ typedef struct{
 
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_configuration_r9_msg(LIBLTE_RRC_MBSFN_AREA_CONFIGURATION_R9_STRUCT *mbsfn_area_cnfg,
-                                                                  LIBLTE_BIT_MSG_STRUCT                         *msg);
+                                                                  LIBLTE_BIT_PTR_STRUCT                         *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_configuration_r9_msg(LIBLTE_RRC_MBSFN_AREA_CONFIGURATION_R9_STRUCT *msg,
                                                                     LIBLTE_RRC_PAGING_STRUCT                      *mbsfn_area_cnfg);
 
@@ -6704,8 +6704,8 @@ typedef struct{
 }LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_logged_measurements_configuration_msg(LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT *logged_measurements_config,
-                                                                        LIBLTE_BIT_MSG_STRUCT                               *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_logged_measurements_configuration_msg(LIBLTE_BIT_MSG_STRUCT                               *msg,
+                                                                        LIBLTE_BIT_PTR_STRUCT                               *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_logged_measurements_configuration_msg(LIBLTE_BIT_PTR_STRUCT                               *msg,
                                                                           LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT *logged_measurements_config);
 
 /*********************************************************************
@@ -6724,8 +6724,8 @@ typedef struct{
 }LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_handover_from_eutra_preparation_request_msg(LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT *handover_from_eutra_prep_req,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                     *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_handover_from_eutra_preparation_request_msg(LIBLTE_BIT_MSG_STRUCT                                     *msg,
+                                                                              LIBLTE_BIT_PTR_STRUCT                                     *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_handover_from_eutra_preparation_request_msg(LIBLTE_BIT_PTR_STRUCT                                     *msg,
                                                                                 LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT *handover_from_eutra_prep_req);
 
 /*********************************************************************
@@ -6755,8 +6755,8 @@ typedef struct{
 }LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_information_transfer_msg(LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+                                                              LIBLTE_BIT_PTR_STRUCT                     *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_PTR_STRUCT                     *msg,
                                                                 LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer);
 
 /*********************************************************************
@@ -6776,8 +6776,8 @@ typedef struct{
 }LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_parameters_response_cdma2000_msg(LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT *csfb_params_resp_cdma2000,
-                                                                        LIBLTE_BIT_MSG_STRUCT                               *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_response_cdma2000_msg(LIBLTE_BIT_MSG_STRUCT                               *msg,
+                                                                        LIBLTE_BIT_PTR_STRUCT                               *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_response_cdma2000_msg(LIBLTE_BIT_PTR_STRUCT                               *msg,
                                                                           LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT *csfb_params_resp_cdma2000);
 
 /*********************************************************************
@@ -6795,8 +6795,8 @@ typedef struct{
 }LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_parameters_request_cdma2000_msg(LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000,
-                                                                       LIBLTE_BIT_MSG_STRUCT                              *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_BIT_MSG_STRUCT                              *msg,
+                                                                       LIBLTE_BIT_PTR_STRUCT                              *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_BIT_PTR_STRUCT                              *msg,
                                                                          LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000);
 
 /*********************************************************************
@@ -6814,8 +6814,8 @@ typedef struct{
 }LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_counter_check_response_msg(LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT *counter_check_resp,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_counter_check_response_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+                                                             LIBLTE_BIT_PTR_STRUCT                    *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_counter_check_response_msg(LIBLTE_BIT_PTR_STRUCT                    *msg,
                                                                LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT *counter_check_resp);
 
 /*********************************************************************
@@ -6836,8 +6836,8 @@ typedef struct{
 }LIBLTE_RRC_COUNTER_CHECK_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_counter_check_msg(LIBLTE_RRC_COUNTER_CHECK_STRUCT *counter_check,
-                                                    LIBLTE_BIT_MSG_STRUCT           *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_counter_check_msg(LIBLTE_BIT_MSG_STRUCT           *msg,
+                                                    LIBLTE_BIT_PTR_STRUCT           *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_counter_check_msg(LIBLTE_BIT_PTR_STRUCT           *msg,
                                                       LIBLTE_RRC_COUNTER_CHECK_STRUCT *counter_check);
 
 /*********************************************************************
@@ -6870,6 +6870,11 @@ typedef struct{
     uint8                          sfn_div_4;
 }LIBLTE_RRC_MIB_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT  *mib,
+                                               LIBLTE_BYTE_MSG_STRUCT *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BYTE_MSG_STRUCT *msg,
+                                                 LIBLTE_RRC_MIB_STRUCT  *mib);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
                                                LIBLTE_BIT_MSG_STRUCT *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
@@ -6889,6 +6894,11 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
 // Structs
 typedef LIBLTE_RRC_SYS_INFO_MSG_STRUCT LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg,
+                                                 LIBLTE_BYTE_MSG_STRUCT           *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BYTE_MSG_STRUCT           *msg,
+                                                   LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg,
                                                  LIBLTE_BIT_MSG_STRUCT            *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT            *msg,
@@ -6908,6 +6918,11 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
 // Structs
 typedef LIBLTE_RRC_MBSFN_AREA_CONFIGURATION_R9_STRUCT LIBLTE_RRC_MCCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_mcch_msg(LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg,
+                                           LIBLTE_BYTE_MSG_STRUCT     *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BYTE_MSG_STRUCT     *msg,
+                                             LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mcch_msg(LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg,
                                            LIBLTE_BIT_MSG_STRUCT      *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
@@ -6927,6 +6942,11 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
 // Structs
 typedef LIBLTE_RRC_PAGING_STRUCT LIBLTE_RRC_PCCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
+                                           LIBLTE_BYTE_MSG_STRUCT     *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BYTE_MSG_STRUCT     *msg,
+                                             LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
                                            LIBLTE_BIT_MSG_STRUCT      *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
@@ -6966,6 +6986,11 @@ typedef struct{
     LIBLTE_RRC_DL_CCCH_MSG_TYPE_ENUM  msg_type;
 }LIBLTE_RRC_DL_CCCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
                                               LIBLTE_BIT_MSG_STRUCT         *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
@@ -7029,6 +7054,11 @@ typedef struct{
     LIBLTE_RRC_DL_DCCH_MSG_TYPE_ENUM  msg_type;
 }LIBLTE_RRC_DL_DCCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
                                               LIBLTE_BIT_MSG_STRUCT         *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
@@ -7062,6 +7092,11 @@ typedef struct{
     LIBLTE_RRC_UL_CCCH_MSG_TYPE_ENUM  msg_type;
 }LIBLTE_RRC_UL_CCCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
                                               LIBLTE_BIT_MSG_STRUCT         *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
@@ -7135,6 +7170,11 @@ typedef struct{
     LIBLTE_RRC_UL_DCCH_MSG_TYPE_ENUM  msg_type;
 }LIBLTE_RRC_UL_DCCH_MSG_STRUCT;
 // Functions
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg);
+// Bit array (one bit per byte) versions, N_bits is a whole number of bytes
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
                                               LIBLTE_BIT_MSG_STRUCT         *msg);
 LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
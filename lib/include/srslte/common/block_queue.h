@@ -63,6 +63,7 @@ public:
     pthread_mutex_init(&mutex, NULL);
     pthread_cond_init(&cv_empty, NULL);
     pthread_cond_init(&cv_full, NULL);
+    pthread_cond_init(&cv_exit, NULL);
     this->capacity = capacity;
     mutexed_callback = NULL;
     enable = true;
@@ -72,19 +73,18 @@ public:
     // Unlock threads waiting at push or pop
     pthread_mutex_lock(&mutex);
     enable = false;
-    pthread_cond_signal(&cv_full);
-    pthread_cond_signal(&cv_empty);
-    pthread_mutex_unlock(&mutex);
+    pthread_cond_broadcast(&cv_full);
+    pthread_cond_broadcast(&cv_empty);
 
     // Wait threads blocked in push/pop to exit
     while(num_threads>0) {
-      usleep(100);
+      pthread_cond_wait(&cv_exit, &mutex);
     }
     
-    // Wait them to exit and destroy cv and mutex
-    pthread_mutex_lock(&mutex);
+    // Destroy cv and mutex
     pthread_cond_destroy(&cv_full);
     pthread_cond_destroy(&cv_empty);
+    pthread_cond_destroy(&cv_exit);
     pthread_mutex_unlock(&mutex);
     pthread_mutex_destroy(&mutex);
   }
@@ -162,6 +162,9 @@ private:
     pthread_cond_signal(&cv_full);
   exit:
     num_threads--;
+    if (!enable && num_threads == 0) {
+      pthread_cond_signal(&cv_exit);
+    }
     pthread_mutex_unlock(&mutex);
     return ret;
   }
@@ -193,6 +196,9 @@ private:
     pthread_cond_signal(&cv_empty);
   exit:
     num_threads--;
+    if (!enable && num_threads == 0) {
+      pthread_cond_signal(&cv_exit);
+    }
     pthread_mutex_unlock(&mutex);
     return ret;
   }
@@ -201,6 +207,7 @@ private:
   pthread_mutex_t mutex;
   pthread_cond_t  cv_empty;
   pthread_cond_t  cv_full;
+  pthread_cond_t  cv_exit;
   call_mutexed_itf *mutexed_callback;
   int capacity;
   bool enable;
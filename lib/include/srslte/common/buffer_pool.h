@@ -28,8 +28,8 @@
 #define SRSLTE_BUFFER_POOL_H
 
 #include <pthread.h>
+#include <stdint.h>
 #include <vector>
-#include <stack>
 #include <map>
 #include <string>
 #include <algorithm>
@@ -41,6 +41,11 @@
 #include "srslte/common/log.h"
 #include "srslte/common/common.h"
 
+// Ownership flag per buffer, catches double and foreign deallocations
+#if defined(SRSLTE_BUFFER_POOL_LOG_ENABLED) || defined(DEBUG_MODE)
+#define SRSLTE_BUFFER_POOL_CHECK_OWNER
+#endif
+
 namespace srslte {
 
 /******************************************************************************
@@ -50,6 +55,12 @@ namespace srslte {
  * deallocate functions. Provides quick object creation and deletion as well
  * as object reuse. 
  * Singleton class of byte_buffer_t (but other pools of different type can be created)
+ *
+ * Free buffers are kept in a lock-free LIFO (Treiber stack) of buffer
+ * indices whose head carries an ABA tag. Each thread caches a small
+ * magazine of free buffers so that most allocate/deallocate calls do not
+ * touch shared state at all. Magazines are disabled for small pools, where
+ * buffers parked in idle threads could starve the others.
  *****************************************************************************/
 
 template <class buffer_t>
@@ -65,34 +76,54 @@ public:
     }
     pthread_mutex_init(&mutex, NULL);
     pthread_cond_init(&cv_not_empty, NULL);
+    nodes = new node_t[nof_buffers];
+    head = pack_head(0, NIL);
+    nof_free = 0;
+    nof_waiters = 0;
     for(uint32_t i=0;i<nof_buffers;i++) {
-      buffer_t *b = new buffer_t;
-      available.push(b);
+#ifdef SRSLTE_BUFFER_POOL_CHECK_OWNER
+      nodes[i].in_use = 0;
+#endif
+      nodes[i].next = (i + 1 < nof_buffers) ? (i + 1) : NIL;
+    }
+    if (nof_buffers > 0) {
+      head = pack_head(0, 0);
+      nof_free = nof_buffers;
     }
     capacity = nof_buffers; 
+    mag_size = std::min(capacity / MAG_POOL_RATIO, (uint32_t) MAG_MAX_SIZE);
+    if (mag_size < (uint32_t) MAG_MIN_SIZE) {
+      mag_size = 0;
+    }
+    // without a thread-specific key all threads use the global list
+    if (mag_size > 0 && pthread_key_create(&mag_key, magazine_release)) {
+      printf("Warning buffer pool could not create a thread-specific key, disabling magazines\n");
+      mag_size = 0;
+    }
   }
 
   ~buffer_pool() { 
     // this destructor assumes all buffers have been properly deallocated 
-    while(available.size()) {
-      delete available.top();
-      available.pop();
+    if (mag_size > 0) {
+      pthread_key_delete(mag_key);
     }
-
-    for (uint32_t i = 0; i < used.size(); i++) {
-      delete used[i];
+    for (uint32_t i = 0; i < magazines.size(); i++) {
+      delete magazines[i];
     }
+    delete [] nodes;
     pthread_cond_destroy(&cv_not_empty);
     pthread_mutex_destroy(&mutex);
   }
   
   void print_all_buffers()
   {
-    printf("%d buffers in queue\n", (int) used.size());
+    printf("%d buffers in queue\n", (int) (capacity - nof_available_pdus()));
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
     std::map<std::string, uint32_t> buffer_cnt;
-    for (uint32_t i=0;i<used.size();i++) {
-      buffer_cnt[strlen(used[i]->debug_name)?used[i]->debug_name:"Undefined"]++;
+    for (uint32_t i=0;i<capacity;i++) {
+      if (nodes[i].in_use) {
+        buffer_cnt[strlen(nodes[i].buf.debug_name)?nodes[i].buf.debug_name:"Undefined"]++;
+      }
     }
     std::map<std::string, uint32_t>::iterator it;
     for (it = buffer_cnt.begin(); it != buffer_cnt.end(); it++) {
@@ -101,83 +132,217 @@ public:
 #endif
   }
 
+  // Buffers parked in per-thread magazines are not counted
   uint32_t nof_available_pdus() {
-    return available.size();
+    return (uint32_t) __sync_fetch_and_add(&nof_free, 0);
   }
 
   bool is_almost_empty() {
-    return available.size() < capacity/20;
+    return nof_available_pdus() < capacity/20;
   }
 
   buffer_t* allocate(const char *debug_name = NULL, bool blocking = false) {
-    pthread_mutex_lock(&mutex);
-    buffer_t *b = NULL;
-
-    if (available.size() > 0) {
-      b = available.top();
-      used.push_back(b);
-      available.pop();
+    uint32_t idx = NIL;
 
-      if (is_almost_empty()) {
-        printf("Warning buffer pool capacity is %f %%\n", (float) 100 * available.size() / capacity);
+    magazine_t *mag = get_magazine();
+    if (mag) {
+      if (mag->count == 0) {
+        // refill half a magazine from the global list
+        while (mag->count < mag_size/2 && (idx = pop_global()) != NIL) {
+          mag->idx[mag->count++] = idx;
+        }
+        if (mag->count > 0 && is_almost_empty()) {
+          printf("Warning buffer pool capacity is %f %%\n", (float) 100 * nof_available_pdus() / capacity);
+        }
       }
-#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
-      if (debug_name) {
-        strncpy(b->debug_name, debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
-        b->debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN - 1] = 0;
+      idx = (mag->count > 0) ? mag->idx[--mag->count] : NIL;
+    } else {
+      idx = pop_global();
+      if (idx != NIL && is_almost_empty()) {
+        printf("Warning buffer pool capacity is %f %%\n", (float) 100 * nof_available_pdus() / capacity);
       }
-#endif
-    } else if (blocking) {
-      // blocking allocation
-      while(available.size() == 0) {
+    }
+
+    if (idx == NIL && blocking) {
+      // blocking allocation, do not print any warning
+      pthread_mutex_lock(&mutex);
+      __sync_fetch_and_add(&nof_waiters, 1);
+      while((idx = pop_global()) == NIL) {
         pthread_cond_wait(&cv_not_empty, &mutex);
       }
-
-      // retrieve the new buffer
-      b = available.top();
-      used.push_back(b);
-      available.pop();
-
-      // do not print any warning
+      __sync_fetch_and_sub(&nof_waiters, 1);
+      pthread_mutex_unlock(&mutex);
     }
-    else {
+
+    if (idx == NIL) {
       printf("Error - buffer pool is empty\n");
-      
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
       print_all_buffers();
 #endif
+      return NULL;
     }
 
-    pthread_mutex_unlock(&mutex);
+    buffer_t *b = &nodes[idx].buf;
+#ifdef SRSLTE_BUFFER_POOL_CHECK_OWNER
+    nodes[idx].in_use = 1;
+#endif
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    if (debug_name) {
+      strncpy(b->debug_name, debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
+      b->debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN - 1] = 0;
+    }
+#endif
     return b;
   }
   
   bool deallocate(buffer_t *b)
   {
-    bool ret = false; 
-    pthread_mutex_lock(&mutex);
-    typename std::vector<buffer_t*>::iterator elem = std::find(used.begin(), used.end(), b);
-    if (elem != used.end()) {
-      used.erase(elem); 
-      available.push(b);
-      ret = true; 
+    // nodes are contiguous, so the index follows from the address
+    uintptr_t offset = (uintptr_t) b - (uintptr_t) &nodes[0].buf;
+    if (b == NULL || (uintptr_t) b < (uintptr_t) &nodes[0].buf || offset % sizeof(node_t) != 0 ||
+        offset / sizeof(node_t) >= capacity) {
+      return false;
+    }
+    uint32_t idx = (uint32_t) (offset / sizeof(node_t));
+#ifdef SRSLTE_BUFFER_POOL_CHECK_OWNER
+    if (!__sync_bool_compare_and_swap(&nodes[idx].in_use, 1, 0)) {
+      return false;
+    }
+#endif
+
+    magazine_t *mag = get_magazine();
+    if (mag && __sync_fetch_and_add(&nof_waiters, 0) == 0) {
+      if (mag->count == mag_size) {
+        // return the older half of the magazine to the global list
+        uint32_t n = mag_size/2;
+        push_global(mag->idx, n);
+        mag->count -= n;
+        memmove(mag->idx, &mag->idx[n], mag->count * sizeof(uint32_t));
+      }
+      mag->idx[mag->count++] = idx;
+    } else {
+      push_global(&idx, 1);
     }
-    pthread_cond_signal(&cv_not_empty);
-    pthread_mutex_unlock(&mutex);
-    return ret; 
+    return true;
   }
 
   
 private:  
-  static const int       POOL_SIZE = 4096;
-  std::stack<buffer_t*>  available;
-  std::vector<buffer_t*> used; 
-  pthread_mutex_t        mutex;
-  pthread_cond_t         cv_not_empty;
+  static const int       POOL_SIZE      = 4096;
+  static const int       MAG_MAX_SIZE   = 32;
+  static const int       MAG_MIN_SIZE   = 4;
+  static const int       MAG_POOL_RATIO = 64;
+  static const uint32_t  NIL            = 0xFFFFFFFF;
+
+  // Bookkeeping goes first: the tail of large buffers is only paged in when used
+  typedef struct {
+    volatile uint32_t next;
+#ifdef SRSLTE_BUFFER_POOL_CHECK_OWNER
+    volatile uint32_t in_use;
+#endif
+    buffer_t          buf;
+  } node_t;
+
+  typedef struct {
+    buffer_pool *pool;
+    uint32_t     count;
+    uint32_t     idx[MAG_MAX_SIZE];
+  } magazine_t;
+
+  static uint64_t pack_head(uint32_t tag, uint32_t idx) {
+    return ((uint64_t) tag << 32) | idx;
+  }
+
+  uint32_t pop_global() {
+    uint64_t old_head, new_head;
+    uint32_t idx;
+    do {
+      old_head = head;
+      idx      = (uint32_t) old_head;
+      if (idx == NIL) {
+        return NIL;
+      }
+      // next may be stale if idx was popped meanwhile, the tag makes the CAS fail
+      new_head = pack_head((uint32_t) (old_head >> 32) + 1, nodes[idx].next);
+    } while (!__sync_bool_compare_and_swap(&head, old_head, new_head));
+    __sync_fetch_and_sub(&nof_free, 1);
+    return idx;
+  }
+
+  // Pushes n buffers with a single CAS
+  void push_global(uint32_t *idx, uint32_t n) {
+    uint64_t old_head, new_head;
+    for (uint32_t i = 0; i + 1 < n; i++) {
+      nodes[idx[i]].next = idx[i + 1];
+    }
+    do {
+      old_head = head;
+      nodes[idx[n - 1]].next = (uint32_t) old_head;
+      new_head = pack_head((uint32_t) (old_head >> 32) + 1, idx[0]);
+    } while (!__sync_bool_compare_and_swap(&head, old_head, new_head));
+    __sync_fetch_and_add(&nof_free, n);
+
+    if (__sync_fetch_and_add(&nof_waiters, 0) > 0) {
+      pthread_mutex_lock(&mutex);
+      pthread_cond_broadcast(&cv_not_empty);
+      pthread_mutex_unlock(&mutex);
+    }
+  }
+
+  magazine_t* get_magazine() {
+    if (mag_size == 0) {
+      return NULL;
+    }
+    magazine_t *mag = (magazine_t*) pthread_getspecific(mag_key);
+    if (mag == NULL) {
+      mag = new magazine_t;
+      mag->pool  = this;
+      mag->count = 0;
+      if (pthread_setspecific(mag_key, mag)) {
+        delete mag;
+        return NULL;
+      }
+      pthread_mutex_lock(&mutex);
+      magazines.push_back(mag);
+      pthread_mutex_unlock(&mutex);
+    }
+    return mag;
+  }
+
+  // Called on thread exit: hands the cached buffers back to the global list
+  static void magazine_release(void *arg) {
+    magazine_t  *mag  = (magazine_t*) arg;
+    buffer_pool *pool = mag->pool;
+    if (mag->count > 0) {
+      pool->push_global(mag->idx, mag->count);
+    }
+    pthread_mutex_lock(&pool->mutex);
+    pool->magazines.erase(std::find(pool->magazines.begin(), pool->magazines.end(), mag));
+    pthread_mutex_unlock(&pool->mutex);
+    delete mag;
+  }
+
+  node_t                  *nodes;
+  volatile uint64_t        head;
+  volatile uint32_t        nof_free;
+  volatile uint32_t        nof_waiters;
+  pthread_key_t            mag_key;
+  uint32_t                 mag_size;
+  std::vector<magazine_t*> magazines;
+  pthread_mutex_t          mutex;
+  pthread_cond_t           cv_not_empty;
   uint32_t capacity;
 };
 
 
+/******************************************************************************
+ * Byte buffer pool
+ *
+ * Holds one buffer_pool per byte buffer size class. allocate() always hands
+ * out a buffer of SRSLTE_MAX_BUFFER_SIZE_BYTES, allocate_bytes() the smallest
+ * class that fits the requested payload, or a larger one if that class is
+ * exhausted. deallocate() finds the owning pool from the buffer capacity.
+ *****************************************************************************/
 class byte_buffer_pool {
 public: 
   // Singleton static methods
@@ -186,14 +351,44 @@ public:
   static void                cleanup(void); 
   byte_buffer_pool(int capacity = -1) {
     log = NULL;
-    pool = new buffer_pool<byte_buffer_t>(capacity);
+    small_pool = new buffer_pool<small_buffer_t>(capacity);
+    mtu_pool   = new buffer_pool<mtu_buffer_t>(capacity);
+    pool       = new buffer_pool<max_buffer_t>(capacity);
   }
   ~byte_buffer_pool() {
+    delete small_pool;
+    delete mtu_pool;
     delete pool; 
   }
   byte_buffer_t* allocate(const char *debug_name = NULL, bool blocking = false) {
     return pool->allocate(debug_name, blocking);
   }
+  // Allocates a buffer with at least nof_bytes of tailroom after the default headroom
+  byte_buffer_t* allocate_bytes(uint32_t nof_bytes, const char *debug_name = NULL, bool blocking = false) {
+    byte_buffer_t *b = NULL;
+    bool fits_small  = nof_bytes <= SRSLTE_SMALL_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+    bool fits_mtu    = nof_bytes <= SRSLTE_MTU_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+    // fall back to larger classes first, only block in the smallest one that fits
+    if (fits_small && small_pool->nof_available_pdus() > 0) {
+      b = small_pool->allocate(debug_name);
+    }
+    if (b == NULL && fits_mtu && mtu_pool->nof_available_pdus() > 0) {
+      b = mtu_pool->allocate(debug_name);
+    }
+    if (b == NULL && (pool->nof_available_pdus() > 0 || !blocking)) {
+      b = pool->allocate(debug_name);
+    }
+    if (b == NULL && blocking) {
+      if (fits_small) {
+        b = small_pool->allocate(debug_name, true);
+      } else if (fits_mtu) {
+        b = mtu_pool->allocate(debug_name, true);
+      } else {
+        b = pool->allocate(debug_name, true);
+      }
+    }
+    return b;
+  }
   void set_log(srslte::log *log) {
     this->log = log;
   }
@@ -202,7 +397,19 @@ public:
       return;
     }
     b->reset();
-    if (!pool->deallocate(b)) {
+    bool found = false;
+    switch (b->get_capacity()) {
+      case SRSLTE_SMALL_BUFFER_SIZE_BYTES:
+        found = small_pool->deallocate(static_cast<small_buffer_t*>(b));
+        break;
+      case SRSLTE_MTU_BUFFER_SIZE_BYTES:
+        found = mtu_pool->deallocate(static_cast<mtu_buffer_t*>(b));
+        break;
+      case SRSLTE_MAX_BUFFER_SIZE_BYTES:
+        found = pool->deallocate(static_cast<max_buffer_t*>(b));
+        break;
+    }
+    if (!found) {
       if (log) {
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
         log->error("Deallocating PDU: Addr=0x%lx, name=%s not found in pool\n", (uint64_t) b, b->debug_name);
@@ -220,11 +427,22 @@ public:
     b = NULL;
   }
   void print_all_buffers() {
+    small_pool->print_all_buffers();
+    mtu_pool->print_all_buffers();
     pool->print_all_buffers();
   }
+  uint32_t nof_available_pdus() {
+    return pool->nof_available_pdus();
+  }
 private:
+  typedef sized_byte_buffer_t<SRSLTE_SMALL_BUFFER_SIZE_BYTES> small_buffer_t;
+  typedef sized_byte_buffer_t<SRSLTE_MTU_BUFFER_SIZE_BYTES>   mtu_buffer_t;
+  typedef sized_byte_buffer_t<SRSLTE_MAX_BUFFER_SIZE_BYTES>   max_buffer_t;
+
   srslte::log *log;
-  buffer_pool<byte_buffer_t> *pool; 
+  buffer_pool<small_buffer_t> *small_pool;
+  buffer_pool<mtu_buffer_t>   *mtu_pool;
+  buffer_pool<max_buffer_t>   *pool; 
 };
 
 
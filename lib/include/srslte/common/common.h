@@ -32,6 +32,7 @@
 *******************************************************************************/
 
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 /*******************************************************************************
@@ -70,10 +71,14 @@
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
 #define pool_allocate (pool->allocate(__PRETTY_FUNCTION__))
 #define pool_allocate_blocking (pool->allocate(__PRETTY_FUNCTION__, true))
+#define pool_allocate_bytes(n) (pool->allocate_bytes(n, __PRETTY_FUNCTION__))
+#define pool_allocate_bytes_blocking(n) (pool->allocate_bytes(n, __PRETTY_FUNCTION__, true))
 #define SRSLTE_BUFFER_POOL_LOG_NAME_LEN 128
 #else
 #define pool_allocate (pool->allocate())
 #define pool_allocate_blocking (pool->allocate(NULL, true))
+#define pool_allocate_bytes(n) (pool->allocate_bytes(n))
+#define pool_allocate_bytes_blocking(n) (pool->allocate_bytes(n, NULL, true))
 #endif
 
 #define ZERO_OBJECT(x) memset(&(x), 0x0, sizeof((x)))
@@ -110,33 +115,38 @@ static const char error_text[ERROR_N_ITEMS][20] = { "None",
  * Generic buffers with headroom to accommodate packet headers and custom
  * copy constructors & assignment operators for quick copying. Byte buffer
  * holds a next pointer to support linked lists.
+ *
+ * The storage of a byte buffer is not part of the object. Stand-alone
+ * buffers own a heap array of SRSLTE_MAX_BUFFER_SIZE_BYTES, pooled buffers
+ * are sized_byte_buffer_t of one of the size classes below. The storage is
+ * not cleared, copies only move the payload.
+ *
+ * N_bytes is kept right in front of the storage, so that the storage of a
+ * SRSLTE_MAX_BUFFER_SIZE_BYTES buffer can be handed to the liblte codecs as a
+ * LIBLTE_BYTE_MSG_STRUCT (see liblte_msg()). The smaller size classes are
+ * shorter than LIBLTE_MAX_MSG_SIZE_BYTES and can not be used that way.
  *****************************************************************************/
+
+// Size classes, all with the same headroom
+#define SRSLTE_SMALL_BUFFER_SIZE_BYTES (SRSLTE_BUFFER_HEADER_OFFSET + 512)
+#define SRSLTE_MTU_BUFFER_SIZE_BYTES   (SRSLTE_BUFFER_HEADER_OFFSET + 2048)
+
 class byte_buffer_t{
 public:
-    uint32_t    N_bytes;
-    uint8_t     buffer[SRSLTE_MAX_BUFFER_SIZE_BYTES];
+    uint32_t   &N_bytes;
+    uint8_t    *buffer;
     uint8_t    *msg;
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
     char        debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN];
 #endif
 
-    byte_buffer_t():N_bytes(0)
+    byte_buffer_t():N_bytes(*new_storage(SRSLTE_MAX_BUFFER_SIZE_BYTES))
     {
-      bzero(buffer, SRSLTE_MAX_BUFFER_SIZE_BYTES);
-#ifdef ENABLE_TIMESTAMP
-      timestamp_is_set = false;
-#endif
-      msg = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
-      next = NULL; 
-#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
-      bzero(debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
-#endif
+      init(SRSLTE_MAX_BUFFER_SIZE_BYTES, true);
     }
-    byte_buffer_t(const byte_buffer_t& buf)
+    byte_buffer_t(const byte_buffer_t& buf):N_bytes(*new_storage(SRSLTE_MAX_BUFFER_SIZE_BYTES))
     {
-      bzero(buffer, SRSLTE_MAX_BUFFER_SIZE_BYTES);
-      msg = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
-      next = NULL;
+      init(SRSLTE_MAX_BUFFER_SIZE_BYTES, true);
       // copy actual contents
       N_bytes = buf.N_bytes;
       memcpy(msg, buf.msg, N_bytes);
@@ -146,13 +156,25 @@ public:
       // avoid self assignment
       if (&buf == this)
         return *this;
-      bzero(buffer, SRSLTE_MAX_BUFFER_SIZE_BYTES);
       msg = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
       next = NULL;
+      N_bytes = 0;
+      // a smaller size class can not hold a larger payload, leave it empty rather than truncated
+      if (buf.N_bytes > get_tailroom()) {
+        fprintf(stderr, "Error copying %d bytes into a byte buffer with %d bytes of tailroom\n",
+                buf.N_bytes, get_tailroom());
+        return *this;
+      }
       N_bytes = buf.N_bytes;
       memcpy(msg, buf.msg, N_bytes);
       return *this;
     }
+    ~byte_buffer_t()
+    {
+      if (owns_storage) {
+        delete [] &N_bytes;
+      }
+    }
     void reset()
     {
       msg       = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
@@ -168,7 +190,23 @@ public:
     // Returns the remaining space from what is reported to be the length of msg
     uint32_t get_tailroom()
     {
-      return (sizeof(buffer) - (msg-buffer) - N_bytes);
+      return (capacity - (msg-buffer) - N_bytes);
+    }
+    // Size of the storage, this identifies the size class
+    uint32_t get_capacity()
+    {
+      return capacity;
+    }
+    // Storage seen as a LIBLTE_BYTE_MSG_STRUCT, valid while msg is at the default headroom and
+    // only for SRSLTE_MAX_BUFFER_SIZE_BYTES buffers. Returns NULL for the shorter size classes,
+    // which the liblte codecs reject with LIBLTE_ERROR_INVALID_INPUTS
+    void* liblte_msg()
+    {
+      if (capacity < SRSLTE_MAX_BUFFER_SIZE_BYTES) {
+        fprintf(stderr, "Error buffer of %d bytes is too short for a liblte message\n", capacity);
+        return NULL;
+      }
+      return &N_bytes;
     }
     long get_latency_us()
     {
@@ -191,15 +229,59 @@ public:
 #endif
     }
 
+protected:
+    // Used by sized_byte_buffer_t, storage is N_bytes followed by capacity_ bytes
+    byte_buffer_t(uint32_t *storage, uint32_t capacity_):N_bytes(*storage)
+    {
+      init(capacity_, false);
+    }
+
 private:
+    static uint32_t* new_storage(uint32_t capacity_)
+    {
+      return new uint32_t[1 + (capacity_ + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
+    }
+    void init(uint32_t capacity_, bool owns_storage_)
+    {
+      buffer       = (uint8_t*) (&N_bytes + 1);
+      capacity     = capacity_;
+      owns_storage = owns_storage_;
+      N_bytes      = 0;
+#ifdef ENABLE_TIMESTAMP
+      timestamp_is_set = false;
+#endif
+      msg = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
+      next = NULL; 
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+      bzero(debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
+#endif
+    }
 
 #ifdef ENABLE_TIMESTAMP
     struct timeval timestamp[3];
     bool           timestamp_is_set; 
 #endif
+    uint32_t       capacity;
+    bool           owns_storage;
     byte_buffer_t *next;
 };
 
+// Byte buffer with inline storage, this is what the buffer pools hold
+template <uint32_t capacity_>
+class sized_byte_buffer_t : public byte_buffer_t {
+public:
+    sized_byte_buffer_t() : byte_buffer_t(&storage.N_bytes, capacity_) {}
+private:
+    // copies must go through byte_buffer_t
+    sized_byte_buffer_t(const sized_byte_buffer_t& buf);
+    sized_byte_buffer_t & operator= (const sized_byte_buffer_t & buf);
+
+    struct {
+      uint32_t N_bytes;
+      uint8_t  buffer[capacity_];
+    } storage;
+};
+
 struct bit_buffer_t{
     uint32_t    N_bits;
     uint8_t     buffer[SRSLTE_MAX_BUFFER_SIZE_BITS];
@@ -0,0 +1,445 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         lockfree_queue.h
+ *  Description:  Bounded lock-free ring buffer queues with the same interface
+ *                as block_queue: spsc_queue (single producer, single
+ *                consumer) and mpsc_queue (multiple producers, single
+ *                consumer). Non-blocking operations never take a lock.
+ *                Blocking push/pop sleep on a futex, and the other side only
+ *                enters the kernel when there is a thread actually waiting.
+ *                Capacity is rounded up to a power of two.
+ *****************************************************************************/
+
+
+#ifndef SRSLTE_LOCKFREE_QUEUE_H
+#define SRSLTE_LOCKFREE_QUEUE_H
+
+#include <limits.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#define SRSLTE_QUEUE_CACHE_LINE 64
+
+// Orders the accesses to the ring cells with respect to the index updates.
+// x86 does not reorder stores with stores nor loads with loads.
+#if defined(__i386__) || defined(__x86_64__)
+#define SRSLTE_QUEUE_BARRIER() asm volatile("" ::: "memory")
+#else
+#define SRSLTE_QUEUE_BARRIER() __sync_synchronize()
+#endif
+
+namespace srslte {
+
+/******************************************************************************
+ * Futex event
+ *
+ * A waiter registers itself with prepare_wait(), checks its condition again
+ * and then sleeps with wait() until notify() changes the sequence number.
+ * notify() is a memory barrier plus a load when nobody is waiting. It wakes
+ * a single waiter, and the following calls do not enter the kernel until
+ * that waiter has run again.
+ *****************************************************************************/
+class queue_event
+{
+public:
+  queue_event() : seq(0), nof_waiters(0), pending(0) {}
+
+  int32_t prepare_wait() {
+    __sync_fetch_and_add(&nof_waiters, 1);
+    __sync_lock_test_and_set(&pending, 0);
+    __sync_synchronize();
+    return seq;
+  }
+  void wait(int32_t val) {
+    syscall(SYS_futex, &seq, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+  }
+  void end_wait() {
+    __sync_fetch_and_sub(&nof_waiters, 1);
+    __sync_lock_test_and_set(&pending, 0);
+  }
+  void notify() {
+    __sync_synchronize();
+    if (nof_waiters > 0 && __sync_bool_compare_and_swap(&pending, 0, 1)) {
+      wake(1);
+    }
+  }
+  void wake_all() {
+    wake(INT_MAX);
+  }
+  bool has_waiters() {
+    return __sync_fetch_and_add(&nof_waiters, 0) > 0;
+  }
+
+private:
+  void wake(int n) {
+    __sync_fetch_and_add(&seq, 1);
+    syscall(SYS_futex, &seq, FUTEX_WAKE_PRIVATE, n, NULL, NULL, 0);
+  }
+
+  volatile int32_t seq;
+  volatile int32_t nof_waiters;
+  volatile int32_t pending; // A wake-up was issued and no waiter has re-armed
+};
+
+/******************************************************************************
+ * Common part of the lock-free queues: blocking operations on top of the
+ * try_push/try_pop of the derived class. If the queue is created with
+ * blocking=false the producers do not notify and blocking calls poll with
+ * sched_yield() instead.
+ *****************************************************************************/
+template<typename myobj, class queue_t>
+class ring_queue
+{
+public:
+  // Blocks while the queue is full. Returns false if the queue is destroyed
+  bool push(const myobj& value) {
+    queue_t *q = static_cast<queue_t*>(this);
+    while (enable) {
+      if (q->try_push(value)) {
+        return true;
+      }
+      if (!blocking) {
+        sched_yield();
+        continue;
+      }
+      int32_t s = not_full.prepare_wait();
+      if (q->try_push(value)) {
+        not_full.end_wait();
+        return true;
+      }
+      if (enable) {
+        not_full.wait(s);
+      }
+      not_full.end_wait();
+    }
+    return false;
+  }
+
+  myobj wait_pop() { // blocking pop
+    myobj value = myobj();
+    queue_t *q = static_cast<queue_t*>(this);
+    while (enable) {
+      if (q->try_pop(&value)) {
+        break;
+      }
+      if (!blocking) {
+        sched_yield();
+        continue;
+      }
+      int32_t s = not_empty.prepare_wait();
+      if (q->try_pop(&value)) {
+        not_empty.end_wait();
+        break;
+      }
+      if (enable) {
+        not_empty.wait(s);
+      }
+      not_empty.end_wait();
+    }
+    return value;
+  }
+
+  bool empty() {
+    return static_cast<queue_t*>(this)->size() == 0;
+  }
+
+  void clear() { // remove all items, consumer side
+    while (static_cast<queue_t*>(this)->try_pop(NULL));
+  }
+
+protected:
+  ring_queue(bool blocking_) : enable(true), blocking(blocking_) {}
+
+  // Wakes up the threads blocked in push/pop and waits for them to leave.
+  // Must be called by the destructor of the derived class before freeing
+  // the ring.
+  void disable() {
+    enable = false;
+    while (not_empty.has_waiters() || not_full.has_waiters()) {
+      not_empty.wake_all();
+      not_full.wake_all();
+      sched_yield();
+    }
+  }
+
+  void pushed() {
+    if (blocking) {
+      not_empty.notify();
+    }
+  }
+  void popped() {
+    if (blocking) {
+      not_full.notify();
+    }
+  }
+
+  static uint32_t ring_size(uint32_t capacity) {
+    uint32_t size = 1;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    return size;
+  }
+
+  queue_event   not_empty;
+  queue_event   not_full;
+  volatile bool enable;
+  bool          blocking;
+};
+
+/******************************************************************************
+ * Single-producer/single-consumer queue
+ *
+ * Each side owns one free-running index and keeps a cached copy of the
+ * other one, so the shared cache lines are only read when the queue looks
+ * full or empty.
+ *****************************************************************************/
+template<typename myobj>
+class spsc_queue : public ring_queue<myobj, spsc_queue<myobj> >
+{
+public:
+  spsc_queue(uint32_t capacity = 128, bool blocking = true) : ring_queue<myobj, spsc_queue<myobj> >(blocking) {
+    buf = NULL;
+    head = tail = 0;
+    head_cache = tail_cache = 0;
+    alloc(capacity);
+  }
+  ~spsc_queue() {
+    this->disable();
+    delete [] buf;
+  }
+
+  // Only while the queue is empty and not being used by other threads
+  bool resize(uint32_t capacity) {
+    if (tail != head) {
+      return false;
+    }
+    delete [] buf;
+    head = tail = 0;
+    head_cache = tail_cache = 0;
+    alloc(capacity);
+    return true;
+  }
+
+  bool try_push(const myobj& value) {
+    uint32_t t = tail;
+    if (t - head_cache > mask) {
+      head_cache = head;
+      if (t - head_cache > mask) {
+        return false;
+      }
+    }
+    SRSLTE_QUEUE_BARRIER();
+    buf[t & mask] = value;
+    SRSLTE_QUEUE_BARRIER();
+    tail = t + 1;
+    this->pushed();
+    return true;
+  }
+
+  bool try_pop(myobj *value) {
+    uint32_t h = head;
+    if (h == tail_cache) {
+      tail_cache = tail;
+      if (h == tail_cache) {
+        return false;
+      }
+    }
+    SRSLTE_QUEUE_BARRIER();
+    if (value) {
+      *value = buf[h & mask];
+    }
+    SRSLTE_QUEUE_BARRIER();
+    head = h + 1;
+    this->popped();
+    return true;
+  }
+
+  // Consumer side only
+  myobj front() {
+    if (head == tail) {
+      return myobj();
+    }
+    SRSLTE_QUEUE_BARRIER();
+    return buf[head & mask];
+  }
+
+  size_t size() {
+    return (size_t) (tail - head);
+  }
+
+  uint32_t max_size() {
+    return mask + 1;
+  }
+
+private:
+  void alloc(uint32_t capacity) {
+    uint32_t size = this->ring_size(capacity > 0 ? capacity : 1);
+    buf  = new myobj[size];
+    mask = size - 1;
+  }
+
+  myobj             *buf;
+  uint32_t           mask;
+  uint8_t            pad0[SRSLTE_QUEUE_CACHE_LINE];
+  volatile uint32_t  head;        // Written by the consumer
+  uint32_t           tail_cache;
+  uint8_t            pad1[SRSLTE_QUEUE_CACHE_LINE];
+  volatile uint32_t  tail;        // Written by the producer
+  uint32_t           head_cache;
+  uint8_t            pad2[SRSLTE_QUEUE_CACHE_LINE];
+};
+
+/******************************************************************************
+ * Multi-producer/single-consumer queue
+ *
+ * Bounded queue with a sequence number per cell (D. Vyukov). Producers
+ * claim a cell with a CAS on the tail and publish it by updating the cell
+ * sequence, so a slow producer never blocks the others. Pops must not run
+ * concurrently; callers with several reader threads serialize them.
+ *****************************************************************************/
+template<typename myobj>
+class mpsc_queue : public ring_queue<myobj, mpsc_queue<myobj> >
+{
+public:
+  mpsc_queue(uint32_t capacity = 128, bool blocking = true) : ring_queue<myobj, mpsc_queue<myobj> >(blocking) {
+    cells = NULL;
+    alloc(capacity);
+  }
+  ~mpsc_queue() {
+    this->disable();
+    delete [] cells;
+  }
+
+  // Only while the queue is empty and not being used by other threads
+  bool resize(uint32_t capacity) {
+    if (tail != head) {
+      return false;
+    }
+    delete [] cells;
+    alloc(capacity);
+    return true;
+  }
+
+  bool try_push(const myobj& value) {
+    cell_t  *c;
+    uint32_t pos = tail;
+    while (true) {
+      c = &cells[pos & mask];
+      uint32_t seq = c->seq;
+      SRSLTE_QUEUE_BARRIER();
+      int32_t dif = (int32_t) (seq - pos);
+      if (dif == 0) {
+        uint32_t old = __sync_val_compare_and_swap(&tail, pos, pos + 1);
+        if (old == pos) {
+          break;
+        }
+        pos = old;
+      } else if (dif < 0) {
+        return false; // full
+      } else {
+        pos = tail;
+      }
+    }
+    c->data = value;
+    SRSLTE_QUEUE_BARRIER();
+    c->seq = pos + 1;
+    this->pushed();
+    return true;
+  }
+
+  bool try_pop(myobj *value) {
+    uint32_t pos = head;
+    cell_t  *c   = &cells[pos & mask];
+    if ((int32_t) (c->seq - (pos + 1)) < 0) {
+      return false;
+    }
+    SRSLTE_QUEUE_BARRIER();
+    if (value) {
+      *value = c->data;
+    }
+    SRSLTE_QUEUE_BARRIER();
+    c->seq = pos + mask + 1;
+    head   = pos + 1;
+    this->popped();
+    return true;
+  }
+
+  // Consumer side only. Returns a default object if the head cell is not
+  // published yet
+  myobj front() {
+    cell_t *c = &cells[head & mask];
+    if (c->seq != head + 1) {
+      return myobj();
+    }
+    SRSLTE_QUEUE_BARRIER();
+    return c->data;
+  }
+
+  // Claimed cells count, it may include cells still being written
+  size_t size() {
+    int32_t n = (int32_t) (tail - head);
+    return n > 0 ? (size_t) n : 0;
+  }
+
+  uint32_t max_size() {
+    return mask + 1;
+  }
+
+private:
+  typedef struct {
+    volatile uint32_t seq;
+    myobj             data;
+  } cell_t;
+
+  void alloc(uint32_t capacity) {
+    uint32_t size = this->ring_size(capacity > 0 ? capacity : 1);
+    cells = new cell_t[size];
+    for (uint32_t i = 0; i < size; i++) {
+      cells[i].seq = i;
+    }
+    mask = size - 1;
+    head = tail = 0;
+  }
+
+  cell_t            *cells;
+  uint32_t           mask;
+  uint8_t            pad0[SRSLTE_QUEUE_CACHE_LINE];
+  volatile uint32_t  head;        // Written by the consumer
+  uint8_t            pad1[SRSLTE_QUEUE_CACHE_LINE];
+  volatile uint32_t  tail;        // Claimed by the producers
+  uint8_t            pad2[SRSLTE_QUEUE_CACHE_LINE];
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_LOCKFREE_QUEUE_H
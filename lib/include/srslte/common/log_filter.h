@@ -41,6 +41,7 @@
 #include "srslte/phy/common/timestamp.h"
 #include "srslte/common/log.h"
 #include "srslte/common/logger.h"
+#include "srslte/common/logger_binary.h"
 #include "srslte/common/logger_stdout.h"
 
 namespace srslte {
@@ -85,6 +86,10 @@ private:
   logger *logger_h;
   bool    do_tti;
 
+  // Set when logger_h is a logger_binary, messages are then not formatted here
+  logger_binary *binary_h;
+  uint16_t       binary_layer_id;
+
   time_itf      *time_src;
   time_format_t time_format;
 
@@ -92,6 +97,8 @@ private:
 
   void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, const char *msg);
   void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, const char *msg, const uint8_t *hex, int size);
+  void binary_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, const char *msg, va_list args,
+                  const uint8_t *hex = NULL, int size = 0, bool is_hex = false);
   void all_log_line(srslte::LOG_LEVEL_ENUM level, uint32_t tti, std::string file, int line, char *msg);
   std::string now_time();
   std::string hex_string(const uint8_t *hex, int size);
@@ -0,0 +1,140 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        logger_binary.h
+ * Description: Binary log object. Producers do not format their messages,
+ *              they write the address of the format string, a timestamp
+ *              and the raw arguments into a lock-free ring owned by the
+ *              calling thread. A background thread drains the rings into
+ *              a binary file, which is rendered offline with decode().
+ *              Multiple producers (one ring each), single consumer. If a
+ *              ring is full, the entry is dropped and counted.
+ *****************************************************************************/
+
+#ifndef SRSLTE_LOGGER_BINARY_H
+#define SRSLTE_LOGGER_BINARY_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <set>
+#include <string>
+#include <vector>
+#include "srslte/common/logger.h"
+#include "srslte/common/threads.h"
+
+#define LOGGER_BINARY_RING_SIZE  (1024*1024) // Per thread, power of two
+#define LOGGER_BINARY_MAX_ENTRY  4096        // Header, arguments and hex dump
+#define LOGGER_BINARY_MAX_STRING 256         // Longest %s argument kept
+#define LOGGER_BINARY_POLL_US    1000
+
+namespace srslte {
+
+typedef std::string* str_ptr;
+
+// Entry flags, they carry the log_filter settings needed to render the line
+#define LOGGER_BINARY_FLAG_TTI         0x01
+#define LOGGER_BINARY_FLAG_SHOW_LAYER  0x02
+#define LOGGER_BINARY_FLAG_LEVEL_SHORT 0x04
+#define LOGGER_BINARY_FLAG_EPOCH       0x08
+#define LOGGER_BINARY_FLAG_TIME_SRC    0x10
+#define LOGGER_BINARY_FLAG_HEX         0x20
+#define LOGGER_BINARY_FLAG_ADD_STRING  0x40
+#define LOGGER_BINARY_FLAG_RAW         0x80 // Plain text line, no prefix
+
+// Fixed part of an entry. It is followed by the arguments, the hex dump and
+// the prepended string (16 bit length and characters). Host byte order.
+typedef struct {
+  uint64_t fmt_id;   // Address of the format string
+  int64_t  secs;
+  uint32_t usecs;
+  uint32_t tti;
+  uint16_t layer_id;
+  uint16_t args_len;
+  uint16_t hex_len;
+  uint8_t  level;
+  uint8_t  flags;
+} logger_binary_entry_t;
+
+class logger_binary : public thread, public logger
+{
+public:
+  logger_binary();
+  ~logger_binary();
+  void init(std::string file, uint32_t ring_size_ = LOGGER_BINARY_RING_SIZE);
+  void stop();
+
+  // Implementation of log_out, the line is stored as a raw entry
+  void log(str_ptr msg);
+  void log(const char *msg);
+
+  // Interface for log_filter
+  uint16_t register_layer(std::string name);
+  void     log_entry(logger_binary_entry_t *entry, const char *fmt, va_list args,
+                     const uint8_t *hex, int hex_len, const std::string *add_string);
+
+  uint64_t get_nof_dropped();
+
+  // Renders a binary log file into the text the log_filter would have written
+  static bool decode(FILE *in, FILE *out);
+
+private:
+  typedef struct {
+    uint8_t          *buf;
+    uint32_t          size;
+    volatile uint32_t wpos;     // Free running, written by the owner thread
+    volatile uint32_t rpos;     // Free running, written by the consumer
+    volatile uint32_t dropped;
+    uint32_t          reported;
+    volatile bool     closed;   // Owner thread exited
+  } ring_t;
+
+  void      run_thread();
+  ring_t*   get_ring();
+  void      push(const uint8_t *data, uint32_t len);
+  uint32_t  drain();
+  void      write_entry(const uint8_t *data, uint32_t len);
+  void      write_text(const char *text);
+
+  static void ring_release(void *ring);
+
+  FILE*                    logfile;
+  volatile bool            is_running;
+  uint32_t                 ring_size;
+  pthread_key_t            ring_key;
+  pthread_mutex_t          mutex;
+  std::vector<ring_t*>     rings;
+  std::vector<std::string> layers;
+  uint32_t                 nof_layers_written;
+  std::set<uint64_t>       fmts_written;
+  uint64_t                 nof_dropped;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_LOGGER_BINARY_H
@@ -29,18 +29,21 @@
 
 #include <stdint.h>
 #include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 
 namespace srslte {
 
 class mac_pcap
 {
 public: 
-  mac_pcap() {enable_write=false; ue_id=0; pcap_file = NULL; };
+  mac_pcap() {enable_write=false; ue_id=0; };
   void enable(bool en);
-  void open(const char *filename, uint32_t ue_id = 0);
+  void open(const char *filename, uint32_t ue_id = 0, int max_file_size = -1, int max_file_time = -1);
   void close();
 
   void set_ue_id(uint16_t ue_id);
+  // Records dropped because the writer could not keep up
+  uint64_t get_nof_dropped();
 
   void write_ul_crnti(uint8_t *pdu, uint32_t pdu_len_bytes, uint16_t crnti, uint32_t reTX, uint32_t tti);
   void write_dl_crnti(uint8_t *pdu, uint32_t pdu_len_bytes, uint16_t crnti, bool crc_ok, uint32_t tti);
@@ -54,7 +57,7 @@ public:
   
 private:
   bool enable_write; 
-  FILE *pcap_file; 
+  pcap_writer writer;
   uint32_t ue_id;
   void pack_and_write(uint8_t* pdu, uint32_t pdu_len_bytes, uint32_t reTX, bool crc_ok, uint32_t tti,
                               uint16_t crnti_, uint8_t direction, uint8_t rnti_type);
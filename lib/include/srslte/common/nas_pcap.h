@@ -2,20 +2,21 @@
 #define SRSLTE_NAS_PCAP_H
 
 #include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 
 namespace srslte {
 
 class nas_pcap
 {
 public:
-    nas_pcap() {enable_write=false; ue_id=0; pcap_file = NULL; }
+    nas_pcap() {enable_write=false; ue_id=0; }
     void enable();
-    void open(const char *filename, uint32_t ue_id=0);
+    void open(const char *filename, uint32_t ue_id=0, int max_file_size=-1, int max_file_time=-1);
     void close();
     void write_nas(uint8_t *pdu, uint32_t pdu_len_bytes);
 private:
     bool enable_write;
-    FILE *pcap_file;
+    pcap_writer writer;
     uint32_t ue_id;
     void pack_and_write(uint8_t* pdu, uint32_t pdu_len_bytes);
 };
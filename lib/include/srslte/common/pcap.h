@@ -37,6 +37,9 @@
 #define RLC_LTE_DLT  149 // UDP needs to be selected as protocol
 #define S1AP_LTE_DLT  150 
 
+/* Longest context header written before a PDU */
+#define LTE_PCAP_MAX_CONTEXT 256
+
 /* This structure gets written to the start of the file */
 typedef struct pcap_hdr_s {
         unsigned int   magic_number;   /* magic number */
@@ -211,21 +214,12 @@ inline void LTE_PCAP_Close(FILE *fd)
  * API functions for writing MAC-LTE PCAP files                           *
  **************************************************************************/
 
-/* Write an individual PDU (PCAP packet header + mac-context + mac-pdu) */
-inline int LTE_PCAP_MAC_WritePDU(FILE *fd, MAC_Context_Info_t *context,
-                                 const unsigned char *PDU, unsigned int length)
+/* Fill the MAC context header that precedes the PDU, returns its length */
+inline int LTE_PCAP_MAC_PackContext(MAC_Context_Info_t *context, uint8_t *context_header)
 {
-    pcaprec_hdr_t packet_header;
-    char context_header[256];
     int offset = 0;
     uint16_t tmp16;
 
-    /* Can't write if file wasn't successfully opened */
-    if (fd == NULL) {
-        printf("Error: Can't write to empty file handle\n");
-        return 0;
-    }
-
     /*****************************************************************/
     /* Context information (same as written by UDP heuristic clients */
     context_header[offset++] = context->radioType;
@@ -259,6 +253,24 @@ inline int LTE_PCAP_MAC_WritePDU(FILE *fd, MAC_Context_Info_t *context,
     /* Data tag immediately preceding PDU */
     context_header[offset++] = MAC_LTE_PAYLOAD_TAG;
 
+    return offset;
+}
+
+/* Write an individual PDU (PCAP packet header + mac-context + mac-pdu) */
+inline int LTE_PCAP_MAC_WritePDU(FILE *fd, MAC_Context_Info_t *context,
+                                 const unsigned char *PDU, unsigned int length)
+{
+    pcaprec_hdr_t packet_header;
+    uint8_t context_header[LTE_PCAP_MAX_CONTEXT];
+    int offset;
+
+    /* Can't write if file wasn't successfully opened */
+    if (fd == NULL) {
+        printf("Error: Can't write to empty file handle\n");
+        return 0;
+    }
+
+    offset = LTE_PCAP_MAC_PackContext(context, context_header);
 
     /****************************************************************/
     /* PCAP Header                                                  */
@@ -318,23 +330,14 @@ inline int LTE_PCAP_NAS_WritePDU(FILE *fd, NAS_Context_Info_t *context,
  * API functions for writing RLC-LTE PCAP files                           *
  **************************************************************************/
 
-/* Write an individual RLC PDU (PCAP packet header + UDP header + rlc-context + rlc-pdu) */
-inline int LTE_PCAP_RLC_WritePDU(FILE *fd, RLC_Context_Info_t *context,
-                                 const unsigned char *PDU, unsigned int length)
+/* Fill the dummy UDP header and the RLC context that precede the PDU,
+ * returns their length */
+inline int LTE_PCAP_RLC_PackContext(RLC_Context_Info_t *context, unsigned int length,
+                                    uint8_t *context_header)
 {
-    pcaprec_hdr_t packet_header;
-    char context_header[256];
     int offset = 0;
     uint16_t tmp16;
 
-    /* Can't write if file wasn't successfully opened */
-    if (fd == NULL) {
-        printf("Error: Can't write to empty file handle\n");
-        return 0;
-    }
-
-    /*****************************************************************/
-
     // Add dummy UDP header, start with src and dest port
     context_header[offset++] = 0xde;
     context_header[offset++] = 0xad;
@@ -386,6 +389,25 @@ inline int LTE_PCAP_RLC_WritePDU(FILE *fd, RLC_Context_Info_t *context,
     // Now the actual PDU
     context_header[offset++] = RLC_LTE_PAYLOAD_TAG;
 
+    return offset;
+}
+
+/* Write an individual RLC PDU (PCAP packet header + UDP header + rlc-context + rlc-pdu) */
+inline int LTE_PCAP_RLC_WritePDU(FILE *fd, RLC_Context_Info_t *context,
+                                 const unsigned char *PDU, unsigned int length)
+{
+    pcaprec_hdr_t packet_header;
+    uint8_t context_header[LTE_PCAP_MAX_CONTEXT];
+    int offset;
+
+    /* Can't write if file wasn't successfully opened */
+    if (fd == NULL) {
+        printf("Error: Can't write to empty file handle\n");
+        return 0;
+    }
+
+    offset = LTE_PCAP_RLC_PackContext(context, length, context_header);
+
     // PCAP header
     struct timeval t;
     gettimeofday(&t, NULL);
@@ -0,0 +1,124 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/******************************************************************************
+ * File:        pcap_writer.h
+ * Description: Asynchronous pcap file writer. Producers copy each record
+ *              (pcap record header, context header and PDU) into a
+ *              lock-free ring owned by the calling thread. A background
+ *              thread gathers the rings into a large buffer and writes it
+ *              to disk in one call. Files can be rotated by size and time.
+ *              If a ring is full, the record is dropped and counted.
+ *****************************************************************************/
+
+#ifndef SRSLTE_PCAP_WRITER_H
+#define SRSLTE_PCAP_WRITER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include "srslte/common/pcap.h"
+#include "srslte/common/threads.h"
+
+#define PCAP_WRITER_RING_SIZE  (1024*1024) // Per thread, power of two
+#define PCAP_WRITER_BATCH_SIZE (256*1024)  // Bytes gathered per write
+#define PCAP_WRITER_SNAPLEN    65535       // Longer records are truncated
+#define PCAP_WRITER_POLL_US    1000
+
+namespace srslte {
+
+class pcap_writer : public thread
+{
+public:
+  pcap_writer();
+  ~pcap_writer();
+
+  /* max_file_size is in kilobytes and max_file_time in seconds, a new file
+   * <filename>.N is started when either is exceeded. Zero or negative
+   * values disable rotation.
+   */
+  bool open(uint32_t dlt, std::string filename, int max_file_size = -1, int max_file_time = -1,
+            uint32_t ring_size_ = PCAP_WRITER_RING_SIZE);
+  void close();
+  bool is_open();
+
+  // Copies a record, the timestamp is taken here. Safe from any thread.
+  void write(const uint8_t *context, uint32_t context_len, const uint8_t *pdu, uint32_t pdu_len);
+
+  uint64_t get_nof_written();
+  uint64_t get_nof_dropped();
+  uint64_t get_nof_truncated();
+  uint32_t get_nof_files();
+
+private:
+  typedef struct {
+    uint8_t          *buf;
+    uint32_t          size;
+    volatile uint32_t wpos;     // Free running, written by the owner thread
+    volatile uint32_t rpos;     // Free running, written by the consumer
+    volatile uint32_t dropped;
+    volatile bool     closed;   // Owner thread exited
+  } ring_t;
+
+  void      run_thread();
+  ring_t*   get_ring();
+  uint32_t  drain();
+  void      append(const uint8_t *data, uint32_t len);
+  void      flush();
+  bool      open_file();
+  void      rotate();
+
+  static void ring_release(void *ring);
+
+  FILE*                 pcap_file;
+  std::string           filename;
+  uint32_t              dlt;
+  int64_t               max_file_bytes;
+  int64_t               max_file_secs;
+  int64_t               cur_file_bytes;
+  time_t                cur_file_start;
+  uint32_t              name_idx;
+
+  volatile bool         is_running;
+  uint32_t              ring_size;
+  pthread_key_t         ring_key;
+  pthread_mutex_t       mutex;
+  std::vector<ring_t*>  rings;
+  uint8_t              *batch;
+  uint32_t              batch_len;
+
+  uint64_t              nof_written;
+  uint64_t              nof_dropped;   // From rings already released
+  volatile uint32_t     nof_truncated;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_PCAP_WRITER_H
@@ -28,7 +28,7 @@
 #define SRSLTE_PDU_QUEUE_H
 
 #include "srslte/common/log.h"
-#include "srslte/common/block_queue.h"
+#include "srslte/common/lockfree_queue.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/timers.h"
 #include "srslte/common/pdu.h"
@@ -52,7 +52,7 @@ public:
       virtual void process_pdu(uint8_t *buff, uint32_t len, channel_t channel, uint32_t tstamp) = 0;
   };
 
-  pdu_queue(uint32_t pool_size = DEFAULT_POOL_SIZE) : pool(pool_size), callback(NULL), log_h(NULL) {}
+  pdu_queue(uint32_t pool_size = DEFAULT_POOL_SIZE) : pdu_q(pool_size), pool(pool_size), callback(NULL), log_h(NULL) {}
   void init(process_callback *callback, log* log_h_);
 
   uint8_t* request(uint32_t len);
@@ -76,7 +76,8 @@ private:
 
   } pdu_t; 
   
-  block_queue<pdu_t*> pdu_q; 
+  // PHY workers push, the MAC thread pops. Never full, it holds the whole pool
+  mpsc_queue<pdu_t*>  pdu_q;
   buffer_pool<pdu_t>  pool;
   
   process_callback   *callback;   
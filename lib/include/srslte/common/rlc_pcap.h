@@ -29,15 +29,16 @@
 
 #include <stdint.h>
 #include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 
 namespace srslte {
 
 class rlc_pcap
 {
 public: 
-  rlc_pcap() {enable_write=false; ue_id=0; pcap_file = NULL; };
+  rlc_pcap() {enable_write=false; ue_id=0; };
   void enable(bool en);
-  void open(const char *filename, uint32_t ue_id = 0);
+  void open(const char *filename, uint32_t ue_id = 0, int max_file_size = -1, int max_file_time = -1);
   void close();
 
   void set_ue_id(uint16_t ue_id);
@@ -47,7 +48,7 @@ public:
   
 private:
   bool enable_write; 
-  FILE *pcap_file; 
+  pcap_writer writer;
   uint32_t ue_id;
   void pack_and_write(uint8_t* pdu,
                       uint32_t pdu_len_bytes,
@@ -0,0 +1,323 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         rnti_table.h
+ *  Description:  Dense RNTI-indexed table, a replacement for
+ *                std::map<uint16_t, T> on the TTI path. The MAC allocates
+ *                C-RNTIs sequentially, so the low bits of the RNTI are used
+ *                directly as the slot index and collisions are resolved by
+ *                linear probing. Entries are allocated once on insertion and
+ *                never move: pointers and references stay valid until the
+ *                entry is erased, and slot indices stay valid until the table
+ *                grows. Iteration is in slot order, not in RNTI order.
+ *                Erasing does not invalidate iterators to other entries, so
+ *                the map idiom erase(it++) can be used. Inserting may grow
+ *                the table, which invalidates all iterators.
+ *                Not thread safe, the caller provides the locking.
+ *****************************************************************************/
+
+
+#ifndef SRSLTE_RNTI_TABLE_H
+#define SRSLTE_RNTI_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iterator>
+#include <utility>
+
+#define SRSLTE_RNTI_TABLE_DEFAULT_SIZE 64 // Power of two
+
+namespace srslte {
+
+template<typename T>
+class rnti_table
+{
+public:
+  typedef uint16_t                    key_type;
+  typedef T                           mapped_type;
+  typedef std::pair<const uint16_t,T> value_type;
+
+  template<typename V, typename table_t>
+  class iter
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef V                         value_type;
+    typedef ptrdiff_t                 difference_type;
+    typedef V*                        pointer;
+    typedef V&                        reference;
+
+    iter() : table(NULL), idx(0) {}
+    iter(table_t *table_, uint32_t idx_) : table(table_), idx(idx_) {}
+    // Allows converting an iterator to a const_iterator
+    template<typename V2, typename table2_t>
+    iter(const iter<V2,table2_t> &other) : table(other.table), idx(other.idx) {}
+
+    V& operator*()  const { return *table->nodes[idx]; }
+    V* operator->() const { return table->nodes[idx]; }
+    iter& operator++() {
+      idx = table->next_used(idx + 1);
+      return *this;
+    }
+    iter operator++(int) {
+      iter tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    bool operator==(const iter &other) const { return idx == other.idx && table == other.table; }
+    bool operator!=(const iter &other) const { return !(*this == other); }
+
+    // Slot occupied by the entry
+    uint32_t index() const { return idx; }
+
+  private:
+    template<typename V2, typename table2_t> friend class iter;
+    friend class rnti_table;
+    table_t *table;
+    uint32_t idx;
+  };
+
+  typedef iter<value_type, rnti_table>             iterator;
+  typedef iter<const value_type, const rnti_table> const_iterator;
+
+  explicit rnti_table(uint32_t capacity_ = SRSLTE_RNTI_TABLE_DEFAULT_SIZE) {
+    alloc(capacity_);
+  }
+  rnti_table(const rnti_table &other) {
+    alloc(other.capacity);
+    copy_from(other);
+  }
+  rnti_table& operator=(const rnti_table &other) {
+    if (this != &other) {
+      clear();
+      free_slots();
+      alloc(other.capacity);
+      copy_from(other);
+    }
+    return *this;
+  }
+  ~rnti_table() {
+    clear();
+    free_slots();
+  }
+
+  iterator find(uint16_t rnti) {
+    return iterator(this, lookup(rnti));
+  }
+  const_iterator find(uint16_t rnti) const {
+    return const_iterator(this, lookup(rnti));
+  }
+  size_t count(uint16_t rnti) const {
+    return lookup(rnti) < capacity ? 1 : 0;
+  }
+
+  // Inserts a default constructed entry if the RNTI is not present
+  T& operator[](uint16_t rnti) {
+    uint32_t i = lookup(rnti);
+    if (i == capacity) {
+      i = insert_slot(rnti);
+      nodes[i] = new value_type(rnti, T());
+    }
+    return nodes[i]->second;
+  }
+
+  std::pair<iterator,bool> insert(const value_type &value) {
+    uint32_t i = lookup(value.first);
+    if (i < capacity) {
+      return std::make_pair(iterator(this, i), false);
+    }
+    i = insert_slot(value.first);
+    nodes[i] = new value_type(value);
+    return std::make_pair(iterator(this, i), true);
+  }
+
+  size_t erase(uint16_t rnti) {
+    uint32_t i = lookup(rnti);
+    if (i == capacity) {
+      return 0;
+    }
+    erase_slot(i);
+    return 1;
+  }
+  void erase(iterator it) {
+    erase_slot(it.idx);
+  }
+
+  void clear() {
+    for (uint32_t i = 0; i < capacity; i++) {
+      if (state[i] == SLOT_USED) {
+        delete nodes[i];
+        nodes[i] = NULL;
+      }
+      state[i] = SLOT_EMPTY;
+    }
+    nof_used    = 0;
+    nof_deleted = 0;
+  }
+
+  size_t size()  const { return nof_used; }
+  bool   empty() const { return nof_used == 0; }
+
+  iterator       begin()       { return iterator(this, next_used(0)); }
+  iterator       end()         { return iterator(this, capacity); }
+  const_iterator begin() const { return const_iterator(this, next_used(0)); }
+  const_iterator end()   const { return const_iterator(this, capacity); }
+
+private:
+  enum {
+    SLOT_EMPTY = 0,
+    SLOT_USED,
+    SLOT_DELETED
+  };
+
+  void alloc(uint32_t capacity_) {
+    capacity = 1;
+    while (capacity < capacity_) {
+      capacity <<= 1;
+    }
+    mask        = capacity - 1;
+    keys        = new uint16_t[capacity];
+    state       = new uint8_t[capacity];
+    nodes       = new value_type*[capacity];
+    nof_used    = 0;
+    nof_deleted = 0;
+    memset(state, SLOT_EMPTY, capacity);
+    memset(nodes, 0, capacity * sizeof(value_type*));
+  }
+
+  void free_slots() {
+    delete [] keys;
+    delete [] state;
+    delete [] nodes;
+  }
+
+  // Keeps the slot of every entry, so indices are the same in the copy
+  void copy_from(const rnti_table &other) {
+    for (uint32_t i = 0; i < capacity; i++) {
+      state[i] = other.state[i];
+      keys[i]  = other.keys[i];
+      if (state[i] == SLOT_USED) {
+        nodes[i] = new value_type(*other.nodes[i]);
+      }
+    }
+    nof_used    = other.nof_used;
+    nof_deleted = other.nof_deleted;
+  }
+
+  // Returns the slot holding rnti or capacity if it is not present
+  uint32_t lookup(uint16_t rnti) const {
+    uint32_t i = rnti & mask;
+    for (uint32_t n = 0; n < capacity && state[i] != SLOT_EMPTY; n++) {
+      if (state[i] == SLOT_USED && keys[i] == rnti) {
+        return i;
+      }
+      i = (i + 1) & mask;
+    }
+    return capacity;
+  }
+
+  // Reserves a slot for an RNTI known not to be present. Deleted slots are
+  // reused. The load, counting deleted slots, is kept under one half so
+  // probe sequences stay short.
+  uint32_t insert_slot(uint16_t rnti) {
+    if (2 * (nof_used + nof_deleted + 1) > capacity) {
+      rehash(2 * (nof_used + 1) > capacity / 2 ? 2 * capacity : capacity);
+    }
+    uint32_t i = rnti & mask;
+    while (state[i] == SLOT_USED) {
+      i = (i + 1) & mask;
+    }
+    if (state[i] == SLOT_DELETED) {
+      nof_deleted--;
+    }
+    state[i] = SLOT_USED;
+    keys[i]  = rnti;
+    nof_used++;
+    return i;
+  }
+
+  void erase_slot(uint32_t i) {
+    delete nodes[i];
+    nodes[i] = NULL;
+    state[i] = SLOT_DELETED;
+    nof_used--;
+    nof_deleted++;
+    // A deleted run followed by an empty slot ends no probe sequence
+    if (state[(i + 1) & mask] == SLOT_EMPTY) {
+      while (state[i] == SLOT_DELETED) {
+        state[i] = SLOT_EMPTY;
+        nof_deleted--;
+        i = (i - 1) & mask;
+      }
+    }
+  }
+
+  // Moves the entries (not the values) to a table of new_capacity slots
+  void rehash(uint32_t new_capacity) {
+    uint16_t    *old_keys  = keys;
+    uint8_t     *old_state = state;
+    value_type **old_nodes = nodes;
+    uint32_t     old_cap   = capacity;
+    alloc(new_capacity);
+    for (uint32_t j = 0; j < old_cap; j++) {
+      if (old_state[j] == SLOT_USED) {
+        uint32_t i = old_keys[j] & mask;
+        while (state[i] == SLOT_USED) {
+          i = (i + 1) & mask;
+        }
+        state[i] = SLOT_USED;
+        keys[i]  = old_keys[j];
+        nodes[i] = old_nodes[j];
+        nof_used++;
+      }
+    }
+    delete [] old_keys;
+    delete [] old_state;
+    delete [] old_nodes;
+  }
+
+  uint32_t next_used(uint32_t i) const {
+    while (i < capacity && state[i] != SLOT_USED) {
+      i++;
+    }
+    return i;
+  }
+
+  uint16_t    *keys;
+  uint8_t     *state;
+  value_type **nodes;
+  uint32_t     capacity;
+  uint32_t     mask;
+  uint32_t     nof_used;
+  uint32_t     nof_deleted;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_RNTI_TABLE_H
@@ -2,20 +2,21 @@
 #define SRSLTE_S1AP_PCAP_H
 
 #include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 
 namespace srslte {
 
 class s1ap_pcap
 {
 public:
-    s1ap_pcap() {enable_write=false; pcap_file = NULL; }
+    s1ap_pcap() {enable_write=false; }
     void enable();
-    void open(const char *filename);
+    void open(const char *filename, int max_file_size=-1, int max_file_time=-1);
     void close();
     void write_s1ap(uint8_t *pdu, uint32_t pdu_len_bytes);
 private:
     bool enable_write;
-    FILE *pcap_file;
+    pcap_writer writer;
 };
 
 } //namespace srslte
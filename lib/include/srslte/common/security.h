@@ -148,6 +148,44 @@ uint8_t security_128_eea2(uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *msg_out);
 
+/******************************************************************************
+ * EEA2/EIA2 with an expanded key
+ *
+ * The AES key schedule and the CMAC subkeys are computed once by
+ * security_aes_init() and reused for every PDU. Blocks are encrypted with
+ * AES-NI when the CPU supports it, or with a table based implementation.
+ *****************************************************************************/
+
+typedef struct {
+  uint8_t  rk[11][16];  // Round keys, byte order of FIPS-197
+  uint32_t rk_w[44];    // Same round keys as big endian words
+  uint8_t  k1[16];      // CMAC subkeys
+  uint8_t  k2[16];
+  bool     aesni;
+} security_aes_ctx_t;
+
+void security_aes_init(security_aes_ctx_t *ctx,
+                       uint8_t            *key);
+
+bool security_aesni_supported();
+
+uint8_t security_128_eia2( security_aes_ctx_t *ctx,
+                           uint32_t            count,
+                           uint32_t            bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len,
+                           uint8_t            *mac);
+
+// msg_out may be equal to msg
+uint8_t security_128_eea2( security_aes_ctx_t *ctx,
+                           uint32_t            count,
+                           uint8_t             bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len,
+                           uint8_t            *msg_out);
+
 /******************************************************************************
  * Authentication
  *****************************************************************************/
@@ -71,4 +71,33 @@ void snow3g_f8( u8 *key, u32 count, u32 bearer, u32 dir, \
 u8* snow3g_f9( u8* key, u32 count, u32 fresh, u32 dir, \
                  u8 *data, u64 length);
 
+/* Word-oriented engine.
+* The state lives in the caller, so these functions can run in several
+* threads at once. MULalpha, DIValpha, S1 and S2 are table lookups, the LFSR
+* is a circular buffer and the f9 multiplications in GF(2^64) use PCLMULQDQ
+* when the CPU supports it.
+*/
+
+typedef struct {
+	u32 s[16];   /* LFSR, s[(base + i) % 16] holds s_i */
+	u32 base;
+	u32 r1, r2, r3;
+} snow3g_state_t;
+
+/* Same as snow3g_initialize() followed by the first clocks of
+* snow3g_generate_keystream().
+*/
+void snow3g_state_init(snow3g_state_t *st, u32 k[4], u32 IV[4]);
+
+/* Generates the next n keystream words, can be called repeatedly. */
+void snow3g_state_keystream(snow3g_state_t *st, u32 n, u32 *ks);
+
+/* f8 from in to out (may be equal), length in bits. */
+void snow3g_f8_words( u8 *key, u32 count, u32 bearer, u32 dir, \
+                      u8 *in, u8 *out, u32 length );
+
+/* f9, the 32-bit MAC is written to mac. */
+void snow3g_f9_words( u8 *key, u32 count, u32 fresh, u32 dir, \
+                      u8 *data, u64 length, u8 *mac );
+
 #endif // SRSLTE_SNOW_3G_H
\ No newline at end of file
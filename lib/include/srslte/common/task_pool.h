@@ -0,0 +1,126 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         task_pool.h
+ *  Description:  Pool of threads executing short tasks with work stealing.
+ *                Each thread of the pool and each external thread submitting
+ *                work (a helper) owns a slot with a task deque. The owner
+ *                pushes and pops at the back of its deque, idle threads steal
+ *                from the front of the others. A helper waiting for a group
+ *                of tasks runs tasks meanwhile. Tasks receive the slot of the
+ *                thread running them, so per-thread state can be indexed.
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSLTE_TASK_POOL_H
+#define SRSLTE_TASK_POOL_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <vector>
+
+#include "srslte/common/lockfree_queue.h"
+#include "srslte/common/threads.h"
+
+#define SRSLTE_TASK_POOL_MAX_TASKS 256 // Per slot, power of two
+
+namespace srslte {
+
+class task_pool
+{
+public:
+  typedef void (*task_func_t)(void *arg, uint32_t slot);
+
+  // Tasks waited together
+  class group
+  {
+  public:
+    group() : pending(0) {}
+    bool done() { return __sync_fetch_and_add(&pending, 0) == 0; }
+  private:
+    friend class task_pool;
+    volatile int32_t pending;
+  };
+
+  task_pool();
+  ~task_pool();
+
+  // Slots 0..nof_threads-1 belong to the pool threads, the next nof_helpers to
+  // the external threads, which must use a different one each
+  bool     init(uint32_t nof_threads, uint32_t nof_helpers, int prio = -1);
+  void     stop();
+  uint32_t get_nof_threads();
+  uint32_t get_nof_slots();
+  uint32_t get_helper_slot(uint32_t helper_idx);
+
+  // Runs the task in the calling thread if the slot deque is full
+  void     push(uint32_t slot, group *g, task_func_t func, void *arg);
+  // Runs pending tasks until all the tasks of the group have finished
+  void     wait(uint32_t slot, group *g);
+
+private:
+  typedef struct {
+    task_func_t func;
+    void       *arg;
+    group      *grp;
+  } task_t;
+
+  typedef struct {
+    pthread_spinlock_t lock;
+    uint32_t           front;
+    uint32_t           back;
+    task_t            *tasks;
+    uint8_t            pad[SRSLTE_QUEUE_CACHE_LINE];
+  } slot_t;
+
+  class worker : public thread
+  {
+  public:
+    void setup(task_pool *parent_, uint32_t slot_) { parent = parent_; slot = slot_; }
+  private:
+    void run_thread() { parent->run_worker(slot); }
+    task_pool *parent;
+    uint32_t   slot;
+  };
+
+  void run_worker(uint32_t slot);
+  bool pop(uint32_t slot, task_t *task);
+  bool steal(uint32_t slot, task_t *task);
+  bool get_task(uint32_t slot, task_t *task);
+  void run_task(uint32_t slot, task_t *task);
+
+  std::vector<slot_t>  slots;
+  std::vector<worker*> workers;
+  uint32_t             nof_threads;
+  volatile int32_t     nof_queued;
+  volatile bool        running;
+  queue_event          work_available;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_TASK_POOL_H
@@ -56,6 +56,7 @@ public:
   thread() {
     _thread = 0;
   }
+  virtual ~thread() {}
   bool start(int prio = -1) {
     return threads_new_rt_prio(&_thread, thread_function_entry, this, prio);    
   }
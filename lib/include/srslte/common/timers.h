@@ -29,6 +29,9 @@
  *  File:         timers.h
  *  Description:  Manually incremented timers. Call a callback function upon
  *                expiry.
+ *                Running timers are kept in a hierarchical timing wheel, so
+ *                that step_all() only visits the timers that expire and
+ *                start/stop are O(1). Free ids are kept in a free list.
  *  Reference:
  *****************************************************************************/
 
@@ -37,9 +40,16 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <pthread.h>
 #include <vector>
 #include <time.h>
 
+// Wheel levels: 256 ticks in the first one and 64 slots in each of the others,
+// which covers 2^26 ticks. Later expiries are parked in the last level.
+#define SRSLTE_TIMERS_L0_BITS  8
+#define SRSLTE_TIMERS_LN_BITS  6
+#define SRSLTE_TIMERS_LEVELS   4
+
 namespace srslte {
   
 class timer_callback 
@@ -50,33 +60,35 @@ class timer_callback
   
 class timers
 {
+  // Node of the intrusive, circular wheel slot lists
+  struct wheel_node {
+    wheel_node *prev;
+    wheel_node *next;
+  };
+
 public:
-  class timer
+  class timer : private wheel_node
   {
   public:
-    timer(uint32_t id_=0) {id = id_; counter = 0; timeout = 0; running = false; callback = NULL; }
-    void set(timer_callback *callback_, uint32_t timeout_) {
-      callback = callback_; 
-      timeout = timeout_; 
-      reset();
+    timer(uint32_t id_=0) {
+      id = id_; counter = 0; timeout = 0; running = false; callback = NULL;
+      wheel = NULL; start = 0; expires = 0; prev = NULL; next = NULL;
     }
+    void set(timer_callback *callback_, uint32_t timeout_);
     bool is_running() {
-      return (counter < timeout) && running; 
+      return (value() < timeout) && running; 
     }
     bool is_expired() {
-      return (timeout > 0) && (counter >= timeout);
+      return (timeout > 0) && (value() >= timeout);
     }
     uint32_t get_timeout() {
       return timeout; 
     }
-    void reset() {
-      counter = 0; 
-    }
-    uint32_t value() {
-      return counter;
-    }
+    void reset();
+    uint32_t value();
+    // Only for timers that do not belong to a timers object, those are stepped by step_all()
     void step() {
-      if (running) {
+      if (running && !wheel) {
         counter++;
         if (is_expired()) {
           running = false; 
@@ -86,34 +98,81 @@ public:
         }        
       }
     }
-    void stop() {
-      running = false; 
-    }
-    void run() {
-      running = true; 
-    }
+    void stop();
+    void run();
     uint32_t id; 
   private: 
+    friend class timers;
+    void schedule();
+
     timer_callback *callback; 
     uint32_t timeout; 
-    uint32_t counter; 
+    uint32_t counter;   // Elapsed ticks while stopped
     bool running; 
+
+    timers  *wheel;     // Owner, NULL for a standalone timer
+    uint32_t start;     // Tick at which counter was 0, while running
+    uint32_t expires;   // Tick at which the timer fires, while in the wheel
   };
   
   timers(uint32_t nof_timers_) : timer_list(nof_timers_),used_timers(nof_timers_) {
     nof_timers = nof_timers_; 
-    next_timer = 0;
     nof_used_timers = 0;
+    now = 0;
+    pthread_mutex_init(&mutex, NULL);
     for (uint32_t i=0;i<nof_timers;i++) {
       timer_list[i].id = i;
+      timer_list[i].wheel = this;
       used_timers[i] = false;
     }
+    // ids are handed out lowest first
+    free_ids.reserve(nof_timers);
+    for (uint32_t i=nof_timers;i>0;i--) {
+      free_ids.push_back(i-1);
+    }
+    for (uint32_t i=0;i<SRSLTE_TIMERS_LEVELS;i++) {
+      for (uint32_t j=0;j<(1u<<SRSLTE_TIMERS_L0_BITS);j++) {
+        slots[i][j].prev = &slots[i][j];
+        slots[i][j].next = &slots[i][j];
+      }
+    }
+  }
+  ~timers() {
+    pthread_mutex_destroy(&mutex);
   }
   
   void step_all() {
-    for (uint32_t i=0;i<nof_timers;i++) {
-      get(i)->step();
+    pthread_mutex_lock(&mutex);
+    now++;
+    uint32_t idx = now & ((1u<<SRSLTE_TIMERS_L0_BITS)-1);
+    // Entering a new round of a level, spread its next slot over the lower levels
+    for (uint32_t l=1;l<SRSLTE_TIMERS_LEVELS && idx == 0;l++) {
+      idx = (now >> (SRSLTE_TIMERS_L0_BITS + (l-1)*SRSLTE_TIMERS_LN_BITS)) & ((1u<<SRSLTE_TIMERS_LN_BITS)-1);
+      cascade(l, idx);
     }
+    idx = now & ((1u<<SRSLTE_TIMERS_L0_BITS)-1);
+
+    // Expired timers may stop or restart others from their callback, take them out of the slot first
+    wheel_node expired;
+    splice(&slots[0][idx], &expired);
+    while (expired.next != &expired) {
+      timer *t = static_cast<timer*>(expired.next);
+      unlink(t);
+      if (t->expires != now) {
+        insert(t);
+        continue;
+      }
+      t->counter = now - t->start;
+      t->running = false;
+      timer_callback *callback = t->callback;
+      if (callback) {
+        // callbacks take their own locks and may use the timers
+        pthread_mutex_unlock(&mutex);
+        callback->timer_expired(t->id);
+        pthread_mutex_lock(&mutex);
+      }
+    }
+    pthread_mutex_unlock(&mutex);
   }
   void stop_all() {
     for (uint32_t i=0;i<nof_timers;i++) {
@@ -139,38 +198,175 @@ public:
     }
   }
   void release_id(uint32_t i) {
-    if (nof_used_timers > 0 && i < nof_timers) {
+    pthread_mutex_lock(&mutex);
+    if (nof_used_timers > 0 && i < nof_timers && used_timers[i]) {
       used_timers[i] = false;
+      free_ids.push_back(i);
       nof_used_timers--;
     } else {
       fprintf(stderr, "Error releasing timer id=%d: nof_used_timers=%d, nof_timers=%d\n", i, nof_used_timers, nof_timers);
     }
+    pthread_mutex_unlock(&mutex);
   }
   uint32_t get_unique_id() {
-    if (nof_used_timers >= nof_timers) {
+    uint32_t i = 0;
+    pthread_mutex_lock(&mutex);
+    if (free_ids.empty()) {
       fprintf(stderr, "Error getting unique timer id: no more timers available\n");
-      return 0;
     } else {
-      for (uint32_t i=0;i<nof_timers;i++) {
-        if (!used_timers[i]) {
-          used_timers[i] = true;
-          nof_used_timers++;
-          return i;
-        }
-      }
-      fprintf(stderr, "Error getting unique timer id: no more timers available but nof_used_timers=%d, nof_timers=%d\n",
-              nof_used_timers, nof_timers);
-      return 0;
+      i = free_ids.back();
+      free_ids.pop_back();
+      used_timers[i] = true;
+      nof_used_timers++;
     }
+    pthread_mutex_unlock(&mutex);
+    return i;
   }
 private:
-  uint32_t next_timer;
+  static void unlink(wheel_node *n) {
+    if (n->next) {
+      n->prev->next = n->next;
+      n->next->prev = n->prev;
+      n->prev = NULL;
+      n->next = NULL;
+    }
+  }
+  static void splice(wheel_node *from, wheel_node *to) {
+    if (from->next == from) {
+      to->prev = to;
+      to->next = to;
+    } else {
+      to->next       = from->next;
+      to->prev       = from->prev;
+      to->next->prev = to;
+      to->prev->next = to;
+      from->prev     = from;
+      from->next     = from;
+    }
+  }
+  // Places a timer by the number of ticks left, relative to the last step
+  void insert(timer *t) {
+    uint32_t delta = t->expires - now;
+    uint32_t e     = t->expires;
+    uint32_t level = 0;
+    uint32_t idx;
+    uint32_t bits  = SRSLTE_TIMERS_L0_BITS;
+    while (level < SRSLTE_TIMERS_LEVELS-1 && delta >= (1u<<bits)) {
+      level++;
+      bits += SRSLTE_TIMERS_LN_BITS;
+    }
+    if (level == 0) {
+      idx = e & ((1u<<SRSLTE_TIMERS_L0_BITS)-1);
+    } else {
+      if (delta >= (1u<<bits)) {
+        e = now + (1u<<bits) - 1;
+      }
+      idx = (e >> (bits - SRSLTE_TIMERS_LN_BITS)) & ((1u<<SRSLTE_TIMERS_LN_BITS)-1);
+    }
+    wheel_node *head = &slots[level][idx];
+    t->next          = head;
+    t->prev          = head->prev;
+    head->prev->next = t;
+    head->prev       = t;
+  }
+  void cascade(uint32_t level, uint32_t idx) {
+    wheel_node list;
+    splice(&slots[level][idx], &list);
+    while (list.next != &list) {
+      timer *t = static_cast<timer*>(list.next);
+      unlink(t);
+      insert(t);
+    }
+  }
+
   uint32_t nof_used_timers;
   uint32_t nof_timers;
-  std::vector<timer>   timer_list;
-  std::vector<bool>    used_timers;
+  uint32_t now;
+  pthread_mutex_t       mutex;
+  std::vector<timer>    timer_list;
+  std::vector<bool>     used_timers;
+  std::vector<uint32_t> free_ids;
+  wheel_node            slots[SRSLTE_TIMERS_LEVELS][1u<<SRSLTE_TIMERS_L0_BITS];
 };
 
+/* The timers of a timers object do not count, the elapsed ticks are the
+ * difference between the current tick and the tick at which they started.
+ */
+inline void timers::timer::set(timer_callback *callback_, uint32_t timeout_) {
+  if (wheel) {
+    pthread_mutex_lock(&wheel->mutex);
+  }
+  callback = callback_;
+  timeout  = timeout_;
+  counter  = 0;
+  if (wheel && running) {
+    start = wheel->now;
+    schedule();
+  }
+  if (wheel) {
+    pthread_mutex_unlock(&wheel->mutex);
+  }
+}
+
+inline void timers::timer::reset() {
+  if (wheel) {
+    pthread_mutex_lock(&wheel->mutex);
+  }
+  counter = 0;
+  if (wheel && running) {
+    start = wheel->now;
+    schedule();
+  }
+  if (wheel) {
+    pthread_mutex_unlock(&wheel->mutex);
+  }
+}
+
+inline uint32_t timers::timer::value() {
+  if (wheel && running) {
+    return wheel->now - start;
+  }
+  return counter;
+}
+
+inline void timers::timer::stop() {
+  if (wheel) {
+    pthread_mutex_lock(&wheel->mutex);
+    if (running) {
+      counter = wheel->now - start;
+      unlink(this);
+    }
+  }
+  running = false;
+  if (wheel) {
+    pthread_mutex_unlock(&wheel->mutex);
+  }
+}
+
+inline void timers::timer::run() {
+  if (wheel) {
+    pthread_mutex_lock(&wheel->mutex);
+    if (!running) {
+      start   = wheel->now - counter;
+      running = true;
+      schedule();
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+  } else {
+    running = true;
+  }
+}
+
+// Called with the wheel locked. Fires on the first step at which counter reaches timeout
+inline void timers::timer::schedule() {
+  unlink(this);
+  if (timeout > 0) {
+    uint32_t elapsed = wheel->now - start;
+    expires = wheel->now + (timeout > elapsed ? timeout - elapsed : 1);
+    wheel->insert(this);
+  }
+}
+
 } // namespace srslte
   
 #endif // SRSLTE_TIMERS_H
@@ -50,6 +50,7 @@ typedef struct {
   rf_metrics_t    rf;
   phy_metrics_t   phy[ENB_METRICS_MAX_USERS];
   mac_metrics_t   mac[ENB_METRICS_MAX_USERS];
+  mac_softbuffer_metrics_t mac_softbuffer;
   rrc_metrics_t   rrc; 
   s1ap_metrics_t  s1ap;
   bool            running;
@@ -0,0 +1,71 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/**********************************************************************************************
+ *  File:         ch_fading.h
+ *
+ *  Description:  Flat Rayleigh fading channel object. The gain is a sum of sinusoids with the
+ *                Doppler shifts of a Clarke (Jakes) model, so it is a deterministic function of
+ *                time for a given seed and the same channel is seen by all the blocks of samples
+ *                of a link, whatever their order. The gain is updated every
+ *                SRSLTE_CH_FADING_STEP samples.
+ *
+ *  Reference:    Y. R. Zheng, C. Xiao, "Simulation models with correct statistical properties
+ *                for Rayleigh fading channels", IEEE Trans. Commun., 2003
+ *********************************************************************************************/
+
+#include <complex.h>
+#include <stdint.h>
+
+#include "srslte/config.h"
+
+#ifndef SRSLTE_CH_FADING_H
+#define SRSLTE_CH_FADING_H
+
+#define SRSLTE_CH_FADING_NOF_SINUSOIDS 16
+#define SRSLTE_CH_FADING_STEP          64
+
+typedef struct SRSLTE_API {
+  float doppler_hz;
+  float w[SRSLTE_CH_FADING_NOF_SINUSOIDS];   // Angular Doppler shift of each sinusoid (rad/s)
+  float phi[SRSLTE_CH_FADING_NOF_SINUSOIDS]; // Initial phase of each sinusoid
+} srslte_ch_fading_t;
+
+SRSLTE_API int srslte_ch_fading_init(srslte_ch_fading_t *q,
+                                     float doppler_hz,
+                                     uint32_t seed);
+
+SRSLTE_API cf_t srslte_ch_fading_gain(srslte_ch_fading_t *q,
+                                      double time_s);
+
+SRSLTE_API void srslte_ch_fading_execute(srslte_ch_fading_t *q,
+                                         const cf_t *input,
+                                         cf_t *output,
+                                         uint32_t len,
+                                         double time_s,
+                                         double srate);
+
+#endif // SRSLTE_CH_FADING_H
@@ -29,6 +29,7 @@
 #define SRSLTE_DFT_H
  
 #include <stdbool.h>
+#include <stdint.h>
 #include "srslte/config.h"
 
 /**********************************************************************************************
@@ -46,6 +47,15 @@
  *                norm   - Normalizes output (by sqrt(len) for complex, len for real).
  *                dc     - Handles insertion and removal of null DC carrier internally.
  *
+ *                Plans are cached process-wide: objects planning the same transform
+ *                share the FFTW plan and only keep their own buffers.
+ *
+ *                srslte_dft_load() reads the wisdom file given by the environment
+ *                variable SRSLTE_FFTW_WISDOM or the system one generated by
+ *                srslte_fftw_wisdom. If it is found, transforms missing in it are
+ *                estimated instead of measured, so start-up time does not depend
+ *                on planning.
+ *
  *  Reference:
  *********************************************************************************************/
 
@@ -77,6 +87,12 @@ SRSLTE_API void srslte_dft_load();
 
 SRSLTE_API void srslte_dft_exit();
 
+SRSLTE_API const char *srslte_dft_wisdom_file();
+
+SRSLTE_API int srslte_dft_export_wisdom(const char *filename);
+
+SRSLTE_API uint32_t srslte_dft_nof_cached_plans();
+
 SRSLTE_API int srslte_dft_plan(srslte_dft_plan_t *plan,
                                int dft_points, 
                                srslte_dft_dir_t dir,                         
@@ -108,6 +108,13 @@ typedef struct {
   uint8_t                *data[SRSLTE_MAX_TB];
 } srslte_enb_dl_pdsch_t; 
 
+/* Scratch state to encode one PDSCH into the subframe of an srslte_enb_dl_t object. One per thread lets the PDSCH
+ * of different users of a subframe be encoded concurrently */
+typedef struct SRSLTE_API {
+  srslte_pdsch_t     pdsch;
+  srslte_pdsch_cfg_t pdsch_cfg;
+} srslte_enb_dl_pdsch_encoder_t;
+
 typedef struct {
   uint16_t rnti; 
   uint8_t  ack;
@@ -186,6 +193,25 @@ SRSLTE_API int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q,
                                        uint8_t *data[SRSLTE_MAX_CODEWORDS],
                                        srslte_mimo_type_t mimo_type);
 
+SRSLTE_API int srslte_enb_dl_pdsch_encoder_init(srslte_enb_dl_pdsch_encoder_t *q,
+                                                uint32_t max_prb);
+
+SRSLTE_API void srslte_enb_dl_pdsch_encoder_free(srslte_enb_dl_pdsch_encoder_t *q);
+
+SRSLTE_API int srslte_enb_dl_pdsch_encoder_set_cell(srslte_enb_dl_pdsch_encoder_t *q,
+                                                    srslte_cell_t cell);
+
+SRSLTE_API int srslte_enb_dl_put_pdsch_encoder(srslte_enb_dl_t *q,
+                                               srslte_enb_dl_pdsch_encoder_t *encoder,
+                                               float rho_a,
+                                               srslte_ra_dl_grant_t *grant,
+                                               srslte_softbuffer_tx_t *softbuffer[SRSLTE_MAX_CODEWORDS],
+                                               uint16_t rnti,
+                                               int rv_idx[SRSLTE_MAX_CODEWORDS],
+                                               uint32_t sf_idx,
+                                               uint8_t *data[SRSLTE_MAX_CODEWORDS],
+                                               srslte_mimo_type_t mimo_type);
+
 SRSLTE_API int srslte_enb_dl_put_pmch(srslte_enb_dl_t *q, 
                                       srslte_ra_dl_grant_t *grant,  
                                       srslte_softbuffer_tx_t *softbuffer,
@@ -38,8 +38,20 @@
 #define SRSLTE_CRC_H
 
 #include "srslte/config.h"
+#include <stdbool.h>
 #include <stdint.h>
 
+/* Engines used to compute the CRC of packed buffers. AUTO uses carry-less
+ * multiplication for long buffers if the CPU supports it and slicing-by-8
+ * otherwise */
+typedef enum SRSLTE_API {
+  SRSLTE_CRC_AUTO = 0,
+  SRSLTE_CRC_BYTE,
+  SRSLTE_CRC_SLICE8,
+  SRSLTE_CRC_PCLMUL,
+  SRSLTE_CRC_NOF_ENGINES
+} srslte_crc_engine_t;
+
 typedef struct SRSLTE_API {
   uint64_t table[256];
   int polynom;
@@ -48,6 +60,12 @@ typedef struct SRSLTE_API {
   uint64_t crcmask;
   uint64_t crchighbit;
   uint32_t srslte_crc_out;
+
+  // Polynomial and tables scaled to 32 bits, the checksum is in the MSBs
+  srslte_crc_engine_t engine;
+  uint32_t polynom32;
+  uint32_t table8[8][256];
+  uint64_t clmul_k[8];
 } srslte_crc_t;
 
 SRSLTE_API int srslte_crc_init(srslte_crc_t *h, 
@@ -57,6 +75,11 @@ SRSLTE_API int srslte_crc_init(srslte_crc_t *h,
 SRSLTE_API int srslte_crc_set_init(srslte_crc_t *h, 
                                    uint64_t init_value);
 
+SRSLTE_API int srslte_crc_set_engine(srslte_crc_t *h,
+                                     srslte_crc_engine_t engine);
+
+SRSLTE_API bool srslte_crc_pclmul_supported();
+
 SRSLTE_API uint32_t srslte_crc_attach(srslte_crc_t *h, 
                                       uint8_t *data, 
                                       int len);
@@ -79,6 +102,13 @@ static inline uint64_t srslte_crc_checksum_get(srslte_crc_t *h) {
   return (h->crcinit  & h->crcmask);
 }
 
+/* Same as calling srslte_crc_checksum_put_byte() for each byte */
+SRSLTE_API void srslte_crc_checksum_put_bytes(srslte_crc_t *h,
+                                              const uint8_t *data,
+                                              uint32_t nof_bytes);
+
+/* Checksum of len bits packed in bytes, MSB first. If len is not a multiple
+ * of 8, the last bits are taken from the MSBs of the last byte */
 SRSLTE_API uint32_t srslte_crc_checksum_byte(srslte_crc_t *h, 
                                              uint8_t *data, 
                                              int len); 
@@ -60,8 +60,11 @@
 #include "srslte/phy/fec/turbodecoder_impl.h"
 #undef LLR_IS_16BIT
 
-#define SRSLTE_TDEC_NOF_AUTO_MODES_8  2
-#define SRSLTE_TDEC_NOF_AUTO_MODES_16 3
+#define SRSLTE_TDEC_NOF_AUTO_MODES_8  3
+#define SRSLTE_TDEC_NOF_AUTO_MODES_16 4
+
+// One interleaver per number of sub-blocks: 1, 8, 16, 32 and 64
+#define SRSLTE_TDEC_NOF_INTERLEAVERS  5
 
 typedef enum {SRSLTE_TDEC_8, SRSLTE_TDEC_16} srslte_tdec_llr_type_t;
 
@@ -95,7 +98,7 @@ typedef struct SRSLTE_API {
   uint32_t current_long_cb;
   uint32_t current_inter_idx;
   int current_cbidx;
-  srslte_tc_interl_t interleaver[4][SRSLTE_NOF_TC_CB_SIZES];
+  srslte_tc_interl_t interleaver[SRSLTE_TDEC_NOF_INTERLEAVERS][SRSLTE_NOF_TC_CB_SIZES];
   int n_iter;
 } srslte_tdec_t;
 
@@ -115,6 +118,8 @@ SRSLTE_API int srslte_tdec_new_cb(srslte_tdec_t * h,
 
 SRSLTE_API int srslte_tdec_get_nof_iterations(srslte_tdec_t * h);
 
+SRSLTE_API bool srslte_tdec_avx512_supported();
+
 SRSLTE_API uint32_t srslte_tdec_autoimp_get_subblocks(uint32_t long_cb);
 
 SRSLTE_API uint32_t srslte_tdec_autoimp_get_subblocks_8bit(uint32_t long_cb);
@@ -178,12 +178,119 @@
   }
 
 
+#else
+
+#ifdef WINIMP_IS_AVX512_16
+
+  #ifndef LV_HAVE_AVX512BW_TARGET
+  #error "Selected AVX512 window decoder but instruction set not supported"
+  #endif
+
+  #include <immintrin.h>
+
+  #define WINIMP avx512_16
+  #define nof_blocks 32
+
+  #define llr_t int16_t
+
+  #define simd_type_t  __m512i
+  #define simd_load    _mm512_loadu_si512
+  #define simd_store   _mm512_storeu_si512
+  #define simd_add     _mm512_adds_epi16
+  #define simd_sub     _mm512_subs_epi16
+  #define simd_max     _mm512_max_epi16
+  #define simd_set1    _mm512_set1_epi16
+  #define simd_insert(v, x, pos) _mm512_mask_set1_epi16(v, (__mmask32) 1 << (pos), x)
+  #define simd_shuffle(v, dir)   dir(v)
+  #define move_right   simd_move_right_512_16
+  #define move_left    simd_move_left_512_16
+
+  #define normalize_period 2
+  #define win_overlap_len  40
+
+  #define INF 10000
+
+  // Unlike the 256-bit shuffles, the permutations cross the 128-bit lanes
+  static const int16_t tdec_win_512_16_right[32] = {1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,
+                                                    17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,31};
+  static const int16_t tdec_win_512_16_left[32]  = {0,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,
+                                                    15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30};
+
+  inline static simd_type_t simd_move_right_512_16(simd_type_t v) {
+    return _mm512_permutexvar_epi16(_mm512_loadu_si512(tdec_win_512_16_right), v);
+  }
+
+  inline static simd_type_t simd_move_left_512_16(simd_type_t v) {
+    return _mm512_permutexvar_epi16(_mm512_loadu_si512(tdec_win_512_16_left), v);
+  }
+
+#else
+
+#ifdef WINIMP_IS_AVX512_8
+
+  #ifndef LV_HAVE_AVX512BW_TARGET
+  #error "Selected AVX512 window decoder but instruction set not supported"
+  #endif
+
+  #include <immintrin.h>
+
+  #define WINIMP avx512_8
+  #define nof_blocks 64
+
+  #define llr_t int8_t
+
+  #define simd_type_t  __m512i
+  #define simd_load    _mm512_loadu_si512
+  #define simd_store   _mm512_storeu_si512
+  #define simd_add     _mm512_adds_epi8
+  #define simd_sub     _mm512_subs_epi8
+  #define simd_max     _mm512_max_epi8
+  #define simd_set1    _mm512_set1_epi8
+  #define simd_insert(v, x, pos) _mm512_mask_set1_epi8(v, (__mmask64) 1 << (pos), x)
+  #define simd_shuffle(v, dir)   dir(v)
+  #define move_right   simd_move_right_512_8
+  #define move_left    simd_move_left_512_8
+  #define simd_rb_shift simd_rb_shift_512
+
+  #define INF 0
+
+  #define normalize_max
+  #define normalize_period 1
+  #define win_overlap_len  40
+  #define use_saturated_add
+  #define divide_output 1
+
+  static const int16_t tdec_win_512_8_right[32] = {1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,
+                                                   17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,31};
+  static const int16_t tdec_win_512_8_left[32]  = {0,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,
+                                                   15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30};
+
+  /* Byte permutations need AVX512-VBMI, so bytes are moved within and across 16-bit words instead. The edge
+   * byte is not kept, the decoder overwrites it */
+  inline static simd_type_t simd_move_right_512_8(simd_type_t v) {
+    simd_type_t next = _mm512_permutexvar_epi16(_mm512_loadu_si512(tdec_win_512_8_right), v);
+    return _mm512_or_si512(_mm512_srli_epi16(v, 8), _mm512_slli_epi16(next, 8));
+  }
+
+  inline static simd_type_t simd_move_left_512_8(simd_type_t v) {
+    simd_type_t prev = _mm512_permutexvar_epi16(_mm512_loadu_si512(tdec_win_512_8_left), v);
+    return _mm512_or_si512(_mm512_slli_epi16(v, 8), _mm512_srli_epi16(prev, 8));
+  }
+
+  inline static simd_type_t simd_rb_shift_512(simd_type_t v, const int l) {
+    __m512i low = _mm512_srai_epi16(_mm512_slli_epi16(v,8), l+8);
+    __m512i hi  = _mm512_srai_epi16(v,l);
+    return _mm512_mask_blend_epi8(0x5555555555555555ULL, hi, low);
+  }
+
 #else
   #error "Unknown WINIMP value"
 #endif
 #endif
 #endif
 #endif
+#endif
+#endif
 
 typedef struct SRSLTE_API {
   uint32_t max_long_cb;
@@ -659,6 +766,21 @@ void MAKE_FUNC(extract_input)(llr_t *input, llr_t *systematic, llr_t *app2, llr_
     INSERT8_INPUT(parity1, 24, 2);
 #endif
 
+#if nof_blocks >= 64
+    INSERT8_INPUT(syst,    32, 0);
+    INSERT8_INPUT(parity0, 32, 1);
+    INSERT8_INPUT(parity1, 32, 2);
+    INSERT8_INPUT(syst,    40, 0);
+    INSERT8_INPUT(parity0, 40, 1);
+    INSERT8_INPUT(parity1, 40, 2);
+    INSERT8_INPUT(syst,    48, 0);
+    INSERT8_INPUT(parity0, 48, 1);
+    INSERT8_INPUT(parity1, 48, 2);
+    INSERT8_INPUT(syst,    56, 0);
+    INSERT8_INPUT(parity0, 56, 1);
+    INSERT8_INPUT(parity1, 56, 2);
+#endif
+
     simd_store(systPtr++,    syst);
     simd_store(parity0Ptr++, parity0);
     simd_store(parity1Ptr++, parity1);
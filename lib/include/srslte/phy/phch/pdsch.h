@@ -87,6 +87,9 @@ typedef struct SRSLTE_API {
   // This is to generate the scrambling seq for multiple CRNTIs
   srslte_pdsch_user_t **users;
 
+  // Sequences of another PDSCH object, used instead of users when set
+  srslte_pdsch_user_t **shared_users;
+
   srslte_sequence_t tmp_seq;
 
   srslte_sch_t dl_sch;
@@ -114,6 +117,9 @@ SRSLTE_API int srslte_pdsch_set_rnti(srslte_pdsch_t *q,
 SRSLTE_API void srslte_pdsch_set_power_allocation(srslte_pdsch_t *q,
                                                   float rho_a);
 
+SRSLTE_API void srslte_pdsch_set_shared_users(srslte_pdsch_t *q,
+                                              srslte_pdsch_t *owner);
+
 SRSLTE_API int srslte_pdsch_enable_csi(srslte_pdsch_t *q,
                                        bool enable);
 
@@ -53,6 +53,45 @@
 #define SRSLTE_TX_NULL 100
 #endif
 
+/* Deferred decoding of the code blocks of a transport block. When a
+ * transport block and an executor are armed with srslte_sch_set_async(), the
+ * decoder only rate dematches the code blocks into the softbuffer and hands
+ * them to the executor, which may run srslte_sch_decode_cb() for each of them
+ * on any thread. Once all have returned, srslte_sch_tb_finish() checks the
+ * transport block CRC.
+ */
+struct srslte_sch_tb_s;
+
+typedef struct SRSLTE_API {
+  struct srslte_sch_tb_s *tb;
+  uint32_t cb_idx;
+  uint32_t nof_iterations;
+} srslte_sch_cb_t;
+
+typedef struct srslte_sch_tb_s {
+  srslte_softbuffer_rx_t *softbuffer;
+  srslte_cbsegm_t cb_segm;
+  uint8_t *data;
+  bool llr_is_8bit;
+  uint32_t max_iterations;
+  bool pending;       // Code blocks were handed to the executor
+  uint32_t nof_cb;
+  srslte_sch_cb_t cb[SRSLTE_MAX_CODEBLOCKS];
+} srslte_sch_tb_t;
+
+typedef struct SRSLTE_API {
+  void *arg;
+  void (*run)(void *arg, srslte_sch_tb_t *tb);
+} srslte_sch_executor_t;
+
+/* Decoder state of a thread running code blocks */
+typedef struct SRSLTE_API {
+  srslte_tdec_t decoder;
+  srslte_crc_t crc_tb;
+  srslte_crc_t crc_cb;
+  uint8_t *data;
+} srslte_sch_cb_decoder_t;
+
 /* DL-SCH AND UL-SCH common functions */
 typedef struct SRSLTE_API {
   
@@ -76,6 +115,9 @@ typedef struct SRSLTE_API {
   srslte_crc_t crc_cb;
   
   srslte_uci_cqi_pusch_t uci_cqi;
+
+  srslte_sch_executor_t *executor;
+  srslte_sch_tb_t *async_tb;
   
 } srslte_sch_t;
 #include "srslte/phy/phch/pmch.h"
@@ -90,6 +132,20 @@ SRSLTE_API void srslte_sch_set_max_noi(srslte_sch_t *q,
 
 SRSLTE_API uint32_t srslte_sch_last_noi(srslte_sch_t *q);
 
+SRSLTE_API void srslte_sch_set_async(srslte_sch_t *q,
+                                     srslte_sch_executor_t *executor,
+                                     srslte_sch_tb_t *tb);
+
+SRSLTE_API int srslte_sch_tb_finish(srslte_sch_t *q,
+                                    srslte_sch_tb_t *tb);
+
+SRSLTE_API int srslte_sch_cb_decoder_init(srslte_sch_cb_decoder_t *q);
+
+SRSLTE_API void srslte_sch_cb_decoder_free(srslte_sch_cb_decoder_t *q);
+
+SRSLTE_API bool srslte_sch_decode_cb(srslte_sch_cb_decoder_t *q,
+                                     srslte_sch_cb_t *cb);
+
 SRSLTE_API int srslte_dlsch_encode(srslte_sch_t *q, 
                                    srslte_pdsch_cfg_t *cfg,
                                    srslte_softbuffer_tx_t *softbuffer,
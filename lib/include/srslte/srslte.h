@@ -60,6 +60,7 @@
 #include "srslte/phy/resampling/resample_arb.h"
 
 #include "srslte/phy/channel/ch_awgn.h"
+#include "srslte/phy/channel/ch_fading.h"
 
 #include "srslte/phy/fec/viterbi.h"
 #include "srslte/phy/fec/convcoder.h"
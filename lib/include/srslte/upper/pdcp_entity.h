@@ -108,6 +108,8 @@ private:
   uint32_t            tx_count;
   uint8_t             k_enc[32];
   uint8_t             k_int[32];
+  security_aes_ctx_t  aes_enc;  // Expanded keys for EEA2/EIA2
+  security_aes_ctx_t  aes_int;
 
   CIPHERING_ALGORITHM_ID_ENUM cipher_algo;
   INTEGRITY_ALGORITHM_ID_ENUM integ_algo;
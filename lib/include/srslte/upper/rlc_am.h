@@ -34,9 +34,7 @@
 #include "srslte/upper/rlc_tx_queue.h"
 #include "srslte/common/timeout.h"
 #include "srslte/upper/rlc_common.h"
-#include <map>
-#include <deque>
-#include <list>
+#include <vector>
 
 namespace srslte {
 
@@ -45,10 +43,14 @@ namespace srslte {
 struct rlc_amd_rx_pdu_t{
   rlc_amd_pdu_header_t  header;
   byte_buffer_t         *buf;
+  rlc_amd_rx_pdu_t      *next; // Next segment of the same PDU
 };
 
+// Segments of a PDU in order of SO, linked through rlc_amd_rx_pdu_t::next
 struct rlc_amd_rx_pdu_segments_t{
-  std::list<rlc_amd_rx_pdu_t> segments;
+  rlc_amd_rx_pdu_t *head;
+  rlc_amd_rx_pdu_t *tail;
+  uint32_t          count;
 };
 
 struct rlc_amd_tx_pdu_t{
@@ -65,6 +67,179 @@ struct rlc_amd_retx_t{
   uint32_t  so_end;
 };
 
+/****************************************************************************
+ * Free list of window entries. Released entries are kept for reuse, so the
+ * data path stops allocating once the windows have been filled.
+ ***************************************************************************/
+template <class T>
+class rlc_am_pool
+{
+public:
+  rlc_am_pool() {}
+  ~rlc_am_pool()
+  {
+    for (uint32_t i = 0; i < entries.size(); i++) {
+      delete entries[i];
+    }
+  }
+  T* allocate()
+  {
+    if (free_entries.empty()) {
+      entries.push_back(new T());
+      return entries.back();
+    }
+    T *entry = free_entries.back();
+    free_entries.pop_back();
+    return entry;
+  }
+  void deallocate(T *entry)
+  {
+    free_entries.push_back(entry);
+  }
+
+private:
+  rlc_am_pool(const rlc_am_pool&);
+  rlc_am_pool& operator=(const rlc_am_pool&);
+
+  std::vector<T*> entries;
+  std::vector<T*> free_entries;
+};
+
+/****************************************************************************
+ * Tx/Rx window indexed by SN modulo RLC_AM_WINDOW_SIZE. The SNs held by a
+ * window never span more than the window size, so each one has its own slot.
+ * The SN is stored with the entry to tell it apart from the same slot one
+ * window earlier or later.
+ ***************************************************************************/
+template <class T>
+class rlc_am_window
+{
+public:
+  rlc_am_window() : count(0)
+  {
+    for (uint32_t i = 0; i < RLC_AM_WINDOW_SIZE; i++) {
+      slots[i] = NULL;
+      sns[i]   = 0;
+    }
+  }
+  bool has_sn(uint32_t sn)
+  {
+    uint32_t i = sn % RLC_AM_WINDOW_SIZE;
+    return slots[i] != NULL && sns[i] == sn;
+  }
+  // Entry of a SN in the window, check has_sn() first
+  T& operator[](uint32_t sn)
+  {
+    return *slots[sn % RLC_AM_WINDOW_SIZE];
+  }
+  // Adds a SN to the window. An entry already in its slot is reused.
+  T& add_pdu(uint32_t sn)
+  {
+    uint32_t i = sn % RLC_AM_WINDOW_SIZE;
+    if (slots[i] == NULL) {
+      slots[i] = pool.allocate();
+      count++;
+    }
+    sns[i] = sn;
+    return *slots[i];
+  }
+  void remove_pdu(uint32_t sn)
+  {
+    if (has_sn(sn)) {
+      uint32_t i = sn % RLC_AM_WINDOW_SIZE;
+      pool.deallocate(slots[i]);
+      slots[i] = NULL;
+      count--;
+    }
+  }
+  // Entry in slot i, NULL if the slot is free. Used to walk the window.
+  T* slot(uint32_t i)
+  {
+    return slots[i];
+  }
+  uint32_t size()
+  {
+    return count;
+  }
+  bool empty()
+  {
+    return count == 0;
+  }
+  void clear()
+  {
+    for (uint32_t i = 0; i < RLC_AM_WINDOW_SIZE; i++) {
+      if (slots[i] != NULL) {
+        pool.deallocate(slots[i]);
+        slots[i] = NULL;
+      }
+    }
+    count = 0;
+  }
+
+private:
+  T*             slots[RLC_AM_WINDOW_SIZE];
+  uint32_t       sns[RLC_AM_WINDOW_SIZE];
+  uint32_t       count;
+  rlc_am_pool<T> pool;
+};
+
+/****************************************************************************
+ * Retransmission queue. It holds each SN of the Tx window at most once, so a
+ * ring of RLC_AM_WINDOW_SIZE entries can not overflow.
+ ***************************************************************************/
+class rlc_am_retx_queue
+{
+public:
+  rlc_am_retx_queue() : rpos(0), count(0) {}
+  bool empty()
+  {
+    return count == 0;
+  }
+  uint32_t size()
+  {
+    return count;
+  }
+  rlc_amd_retx_t& front()
+  {
+    return queue[rpos];
+  }
+  void pop_front()
+  {
+    if (count > 0) {
+      rpos = (rpos + 1) % RLC_AM_WINDOW_SIZE;
+      count--;
+    }
+  }
+  bool push_back(const rlc_amd_retx_t &retx)
+  {
+    if (count >= RLC_AM_WINDOW_SIZE) {
+      return false;
+    }
+    queue[(rpos + count) % RLC_AM_WINDOW_SIZE] = retx;
+    count++;
+    return true;
+  }
+  bool has_sn(uint32_t sn)
+  {
+    for (uint32_t i = 0; i < count; i++) {
+      if (queue[(rpos + i) % RLC_AM_WINDOW_SIZE].sn == sn) {
+        return true;
+      }
+    }
+    return false;
+  }
+  void clear()
+  {
+    rpos  = 0;
+    count = 0;
+  }
+
+private:
+  rlc_amd_retx_t queue[RLC_AM_WINDOW_SIZE];
+  uint32_t       rpos;
+  uint32_t       count;
+};
+
 
 class rlc_am : public rlc_common
 {
@@ -137,7 +312,6 @@ private:
 
     void debug_state();
 
-    bool retx_queue_has_sn(uint32_t sn);
     int  required_buffer_size(rlc_amd_retx_t retx);
     void retransmit_random_pdu();
 
@@ -194,8 +368,8 @@ private:
     uint32_t               status_prohibit_timer_id;
 
     // Tx windows
-    std::map<uint32_t, rlc_amd_tx_pdu_t>          tx_window;
-    std::deque<rlc_amd_retx_t>                    retx_queue;
+    rlc_am_window<rlc_amd_tx_pdu_t>               tx_window;
+    rlc_am_retx_queue                             retx_queue;
 
     // Mutexes
     pthread_mutex_t     mutex;
@@ -238,6 +412,8 @@ private:
     void debug_state();
     void print_rx_segments();
     bool add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rlc_amd_rx_pdu_t *segment);
+    void push_segment(rlc_amd_rx_pdu_segments_t *pdu, rlc_amd_rx_pdu_t *segment);
+    void clear_segments(rlc_amd_rx_pdu_segments_t *pdu);
 
     rlc_am                    *parent;
     byte_buffer_pool          *pool;
@@ -268,8 +444,9 @@ private:
     pthread_mutex_t     mutex;
 
     // Rx windows
-    std::map<uint32_t, rlc_amd_rx_pdu_t>          rx_window;
-    std::map<uint32_t, rlc_amd_rx_pdu_segments_t> rx_segments;
+    rlc_am_window<rlc_amd_rx_pdu_t>               rx_window;
+    rlc_am_window<rlc_amd_rx_pdu_segments_t>      rx_segments;
+    rlc_am_pool<rlc_amd_rx_pdu_t>                 segment_pool;
 
     // Metrics
     uint32_t            num_rx_bytes;
@@ -82,6 +82,7 @@ private:
 
   // Thread-safe queues for MAC messages
   rlc_tx_queue    ul_queue;
+  pthread_mutex_t mutex; // Serializes the queue readers
 };
 
 } // namespace srsue
@@ -27,62 +27,69 @@
 /******************************************************************************
  *  File:         rlc_tx_queue.h
  *  Description:  Queue used in RLC TM/UM/AM TX queues.
- *                Uses a blocking queue with bounded capacity to block higher layers
- *                when pushing Uplink traffic
+ *                Uses a lock-free multi-producer queue with bounded capacity
+ *                to block higher layers when pushing Uplink traffic. Reads
+ *                (read, try_read, size_tail_bytes) must be serialized by the
+ *                RLC entity.
  *  Reference:
  *****************************************************************************/
 
 #ifndef SRSLTE_MSG_QUEUE_H
 #define SRSLTE_MSG_QUEUE_H
 
-#include "srslte/common/block_queue.h"
+#include "srslte/common/lockfree_queue.h"
 #include "srslte/common/common.h"
 #include <pthread.h>
 
 namespace srslte {
 
-class rlc_tx_queue : public block_queue<byte_buffer_t*>::call_mutexed_itf
+class rlc_tx_queue
 {
 public:
   rlc_tx_queue(int capacity = 128) : queue(capacity) {
     unread_bytes = 0;
-    queue.set_mutexed_itf(this);
-  }
-  // increase/decrease unread_bytes inside push/pop mutexed operations
-  void pushing(byte_buffer_t *msg) {
-    unread_bytes += msg->N_bytes;
-  }
-  void popping(byte_buffer_t *msg) {
-    if (unread_bytes > msg->N_bytes) {
-      unread_bytes -= msg->N_bytes;
-    } else {
-      unread_bytes = 0;
-    }
   }
   void write(byte_buffer_t *msg)
   {
-    queue.push(msg);
+    // Count the bytes before the SDU becomes visible to the reader
+    pushing(msg);
+    if (!queue.push(msg)) {
+      popping(msg);
+    }
   }
 
   bool try_write(byte_buffer_t *msg)
   {
-    return queue.try_push(msg);
+    pushing(msg);
+    if (!queue.try_push(msg)) {
+      popping(msg);
+      return false;
+    }
+    return true;
   }
 
   void read(byte_buffer_t **msg)
   {
     byte_buffer_t *m = queue.wait_pop();
+    if (m) {
+      popping(m);
+    }
     *msg = m;
   }
 
   bool try_read(byte_buffer_t **msg)
   {
-    return queue.try_pop(msg);
+    if (queue.try_pop(msg)) {
+      popping(*msg);
+      return true;
+    }
+    return false;
   }
 
-  void resize(uint32_t capacity)
+  // Only possible while the queue is empty, returns false otherwise
+  bool resize(uint32_t capacity)
   {
-    queue.resize(capacity);
+    return queue.resize(capacity);
   }
   uint32_t size()
   {
@@ -96,11 +103,9 @@ public:
 
   uint32_t size_tail_bytes()
   {
-    if (!queue.empty()) {
-      byte_buffer_t *m = queue.front();
-      if (m) {
-        return m->N_bytes;
-      }
+    byte_buffer_t *m = queue.front();
+    if (m) {
+      return m->N_bytes;
     }
     return 0; 
   }
@@ -111,10 +116,19 @@ public:
   }
 
 private:
-  bool                        is_empty() { return queue.empty(); }
+  void pushing(byte_buffer_t *msg) {
+    __sync_fetch_and_add(&unread_bytes, msg->N_bytes);
+  }
+  void popping(byte_buffer_t *msg) {
+    uint32_t old_bytes, new_bytes;
+    do {
+      old_bytes = unread_bytes;
+      new_bytes = old_bytes > msg->N_bytes ? old_bytes - msg->N_bytes : 0;
+    } while (!__sync_bool_compare_and_swap(&unread_bytes, old_bytes, new_bytes));
+  }
 
-  block_queue<byte_buffer_t*> queue;
-  uint32_t                    unread_bytes;
+  mpsc_queue<byte_buffer_t*>  queue;
+  volatile uint32_t           unread_bytes;
 };
 
 } // namespace srslte
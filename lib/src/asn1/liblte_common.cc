@@ -100,19 +100,8 @@ uint32 liblte_bits_2_value(uint8  **bits,
 void liblte_pack(LIBLTE_BIT_MSG_STRUCT  *bits,
                  LIBLTE_BYTE_MSG_STRUCT *bytes)
 {
-    uint8_t* bit_ptr = bits->msg;
-    uint32_t i;
-
-    for(i=0; i<bits->N_bits/8; i++)
-    {
-        bytes->msg[i] = liblte_bits_2_value(&bit_ptr, 8);
-    }
-    bytes->N_bytes = bits->N_bits/8;
-    if(bits->N_bits%8 > 0)
-    {
-        bytes->msg[bytes->N_bytes] = liblte_bits_2_value(&bit_ptr, bits->N_bits%8);
-        bytes->N_bytes++;
-    }
+    liblte_pack(bits->msg, bits->N_bits, bytes->msg);
+    bytes->N_bytes = (bits->N_bits+7)/8;
 }
 
 /*********************************************************************
@@ -123,13 +112,7 @@ void liblte_pack(LIBLTE_BIT_MSG_STRUCT  *bits,
 void liblte_unpack(LIBLTE_BYTE_MSG_STRUCT *bytes,
                    LIBLTE_BIT_MSG_STRUCT  *bits)
 {
-    uint8_t *bit_ptr = bits->msg;
-    uint32_t i;
-
-    for(i=0; i<bytes->N_bytes; i++)
-    {
-        liblte_value_2_bits(bytes->msg[i], &bit_ptr, 8);
-    }
+    liblte_unpack(bytes->msg, bytes->N_bytes, bits->msg);
     bits->N_bits = bytes->N_bytes*8;
 }
 
@@ -145,7 +128,9 @@ void liblte_pack(uint8_t *bits,  uint32_t n_bits, uint8_t *bytes)
 
     for(i=0; i<n_bits/8; i++)
     {
-        bytes[i] = liblte_bits_2_value(&bit_ptr, 8);
+        bytes[i] = (bit_ptr[0] << 7) | (bit_ptr[1] << 6) | (bit_ptr[2] << 5) | (bit_ptr[3] << 4) |
+                   (bit_ptr[4] << 3) | (bit_ptr[5] << 2) | (bit_ptr[6] << 1) | (bit_ptr[7]);
+        bit_ptr += 8;
     }
     if(n_bits%8 > 0)
     {
@@ -160,12 +145,14 @@ void liblte_pack(uint8_t *bits,  uint32_t n_bits, uint8_t *bytes)
 *********************************************************************/
 void liblte_unpack(uint8_t *bytes, uint32_t n_bytes, uint8_t *bits)
 {
-    uint8_t *bit_ptr = bits;
-    uint32_t i;
+    uint32_t i, j;
 
     for(i=0; i<n_bytes; i++)
     {
-        liblte_value_2_bits(bytes[i], &bit_ptr, 8);
+        for(j=0; j<8; j++)
+        {
+            bits[8*i+j] = (bytes[i] >> (7-j)) & 0x1;
+        }
     }
 }
 
@@ -196,3 +183,206 @@ void liblte_align_up_zero(uint8_t **ptr, uint32_t align)
     (*ptr)++;
   }
 }
+
+/*********************************************************************
+    Name: liblte_bit_ptr_init
+
+    Description: Points to the first bit of a packed bit buffer
+*********************************************************************/
+void liblte_bit_ptr_init(LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint8                 *msg)
+{
+    bits->msg    = msg;
+    bits->N_bits = 0;
+}
+
+/*********************************************************************
+    Name: liblte_value_2_bits
+
+    Description: Converts a value to a packed bit string. Bits after
+                 the written ones in the last byte are cleared
+*********************************************************************/
+void liblte_value_2_bits(uint32                 value,
+                         LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint32                 N_bits)
+{
+    uint8  *byte   = &bits->msg[bits->N_bits/8];
+    uint32  offset = bits->N_bits%8;
+    uint32  n;
+
+    bits->N_bits += N_bits;
+    while(N_bits > 0)
+    {
+        n       = (N_bits < 8-offset) ? N_bits : 8-offset;
+        N_bits -= n;
+        *byte   = (*byte & (uint8)(0xFF00 >> offset)) |
+                  (((value >> N_bits) & ((1 << n)-1)) << (8-offset-n));
+        offset  = 0;
+        byte++;
+    }
+}
+
+/*********************************************************************
+    Name: liblte_bits_2_value
+
+    Description: Converts a packed bit string to a value
+*********************************************************************/
+uint32 liblte_bits_2_value(LIBLTE_BIT_PTR_STRUCT *bits,
+                           uint32                 N_bits)
+{
+    uint8  *byte   = &bits->msg[bits->N_bits/8];
+    uint32  offset = bits->N_bits%8;
+    uint32  value  = 0;
+    uint32  n;
+
+    bits->N_bits += N_bits;
+    while(N_bits > 0)
+    {
+        n       = (N_bits < 8-offset) ? N_bits : 8-offset;
+        N_bits -= n;
+        value   = (value << n) | ((*byte >> (8-offset-n)) & ((1 << n)-1));
+        offset  = 0;
+        byte++;
+    }
+
+    return(value);
+}
+
+/*********************************************************************
+    Name: liblte_bytes_2_bits
+
+    Description: Appends N_bits of a packed byte array to a packed
+                 bit string
+*********************************************************************/
+void liblte_bytes_2_bits(uint8                 *bytes,
+                         LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint32                 N_bits)
+{
+    uint32 i;
+
+    if(bits->N_bits%8 == 0)
+    {
+        memcpy(&bits->msg[bits->N_bits/8], bytes, N_bits/8);
+        bits->N_bits += (N_bits/8)*8;
+    }else{
+        for(i=0; i<N_bits/8; i++)
+        {
+            liblte_value_2_bits(bytes[i], bits, 8);
+        }
+    }
+    if(N_bits%8 > 0)
+    {
+        liblte_value_2_bits(bytes[N_bits/8] >> (8-N_bits%8), bits, N_bits%8);
+    }
+}
+
+/*********************************************************************
+    Name: liblte_bits_2_bytes
+
+    Description: Reads N_bits of a packed bit string into a packed
+                 byte array
+*********************************************************************/
+void liblte_bits_2_bytes(LIBLTE_BIT_PTR_STRUCT *bits,
+                         uint8                 *bytes,
+                         uint32                 N_bits)
+{
+    uint32 i;
+
+    if(bits->N_bits%8 == 0)
+    {
+        memcpy(bytes, &bits->msg[bits->N_bits/8], N_bits/8);
+        bits->N_bits += (N_bits/8)*8;
+    }else{
+        for(i=0; i<N_bits/8; i++)
+        {
+            bytes[i] = liblte_bits_2_value(bits, 8);
+        }
+    }
+    if(N_bits%8 > 0)
+    {
+        bytes[N_bits/8] = liblte_bits_2_value(bits, N_bits%8) << (8-N_bits%8);
+    }
+}
+
+/*********************************************************************
+    Name: liblte_bit_array_2_bits
+
+    Description: Appends a bit array (one bit per byte) to a packed
+                 bit string
+*********************************************************************/
+void liblte_bit_array_2_bits(uint8                 *bit_array,
+                             LIBLTE_BIT_PTR_STRUCT *bits,
+                             uint32                 N_bits)
+{
+    uint32 value;
+    uint32 n;
+    uint32 i;
+
+    while(N_bits > 0)
+    {
+        n     = (N_bits < 8) ? N_bits : 8;
+        value = 0;
+        for(i=0; i<n; i++)
+        {
+            value = (value << 1) | (bit_array[i] & 0x01);
+        }
+        liblte_value_2_bits(value, bits, n);
+        bit_array += n;
+        N_bits    -= n;
+    }
+}
+
+/*********************************************************************
+    Name: liblte_bits_2_bit_array
+
+    Description: Reads N_bits of a packed bit string into a bit array
+                 (one bit per byte)
+*********************************************************************/
+void liblte_bits_2_bit_array(LIBLTE_BIT_PTR_STRUCT *bits,
+                             uint8                 *bit_array,
+                             uint32                 N_bits)
+{
+    uint32 value;
+    uint32 n;
+    uint32 i;
+
+    while(N_bits > 0)
+    {
+        n     = (N_bits < 8) ? N_bits : 8;
+        value = liblte_bits_2_value(bits, n);
+        for(i=0; i<n; i++)
+        {
+            bit_array[i] = (value >> (n-1-i)) & 0x01;
+        }
+        bit_array += n;
+        N_bits    -= n;
+    }
+}
+
+/*********************************************************************
+    Name: liblte_align_up
+
+    Description: Aligns a packed bit position to a multibit boundary
+*********************************************************************/
+void liblte_align_up(LIBLTE_BIT_PTR_STRUCT *ptr, uint32_t align)
+{
+  ptr->N_bits = ((ptr->N_bits + align - 1) / align) * align;
+}
+
+/*********************************************************************
+    Name: liblte_align_up_zero
+
+    Description:  Aligns a packed bit position to a multibit boundary
+                  and zeros bits skipped
+*********************************************************************/
+void liblte_align_up_zero(LIBLTE_BIT_PTR_STRUCT *ptr, uint32_t align)
+{
+  uint32_t n = (align - ptr->N_bits % align) % align;
+
+  while(n > 0)
+  {
+    uint32_t n_zero = (n < 32) ? n : 32;
+    liblte_value_2_bits(0, ptr, n_zero);
+    n -= n_zero;
+  }
+}
@@ -79,7 +79,6 @@
                               GLOBAL VARIABLES
 *******************************************************************************/
 
-LIBLTE_BIT_MSG_STRUCT global_msg;
 
 /*******************************************************************************
                               HELPERS
@@ -116,7 +115,7 @@ static void liblte_rrc_log_print(const char *format, ...) {
 /*********************************************************************
     Description: Simply consume non-critical extensions for rel > r8
 *********************************************************************/
-void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, uint8 **ie_ptr)
+void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
   uint32 i=0;
   uint32 elem_flags=0;
@@ -144,7 +143,7 @@ void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, uint8
                 elem_len = 0;
             }
         }
-        liblte_bits_2_value(ie_ptr, 8*elem_len);
+        ie_ptr->N_bits += 8*elem_len;
       }
       elem_flags = elem_flags >> 1;
     }
@@ -161,6 +160,20 @@ void liblte_rrc_warning_not_handled(bool opt, const char *func_name)
   }
 }
 
+/*********************************************************************
+    Description: Converts the input of the bit array versions of the
+                 channel message functions to packed bytes
+*********************************************************************/
+static void liblte_rrc_bit_msg_2_byte_msg(LIBLTE_BIT_MSG_STRUCT  *bits,
+                                          LIBLTE_BYTE_MSG_STRUCT *bytes)
+{
+    LIBLTE_BIT_PTR_STRUCT bytes_ptr;
+
+    liblte_bit_ptr_init(&bytes_ptr, bytes->msg);
+    liblte_bit_array_2_bits(bits->msg, &bytes_ptr, bits->N_bits);
+    bytes->N_bytes = (bits->N_bits+7)/8;
+}
+
 /*******************************************************************************
                               INFORMATION ELEMENT FUNCTIONS
 *******************************************************************************/
@@ -174,7 +187,7 @@ void liblte_rrc_warning_not_handled(bool opt, const char *func_name)
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -190,7 +203,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -218,7 +231,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -242,7 +255,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -280,7 +293,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -302,7 +315,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBF
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -334,7 +347,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tmgi_r9_ie(LIBLTE_RRC_TMGI_R9_STRUCT *tmgi,
-                                             uint8                    **ie_ptr)
+                                             LIBLTE_BIT_PTR_STRUCT     *ie_ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -354,7 +367,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tmgi_r9_ie(LIBLTE_RRC_TMGI_R9_STRUCT *tmgi,
 
   return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tmgi_r9_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tmgi_r9_ie(LIBLTE_BIT_PTR_STRUCT     *ie_ptr,
                                                LIBLTE_RRC_TMGI_R9_STRUCT *tmgi)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -384,7 +397,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tmgi_r9_ie(uint8                    **ie_ptr
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbms_session_info_r9_ie(LIBLTE_RRC_MBMS_SESSION_INFO_R9_STRUCT  *mbms_session_info,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -406,7 +419,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbms_session_info_r9_ie(LIBLTE_RRC_MBMS_SESSIO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbms_session_info_r9_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbms_session_info_r9_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_MBMS_SESSION_INFO_R9_STRUCT  *mbms_session_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -441,7 +454,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbms_session_info_r9_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pmch_config_r9_ie(LIBLTE_RRC_PMCH_CONFIG_R9_STRUCT *pmch_cnfg,
-                                                    uint8                           **ie_ptr)
+                                                    LIBLTE_BIT_PTR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -460,7 +473,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pmch_config_r9_ie(LIBLTE_RRC_PMCH_CONFIG_R9_ST
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_config_r9_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_config_r9_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                       LIBLTE_RRC_PMCH_CONFIG_R9_STRUCT *pmch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -492,7 +505,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_config_r9_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pmch_info_r9_ie(LIBLTE_RRC_PMCH_INFO_R9_STRUCT  *pmch_info,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_PTR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32 i;
@@ -514,7 +527,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pmch_info_r9_ie(LIBLTE_RRC_PMCH_INFO_R9_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_info_r9_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_info_r9_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_PMCH_INFO_R9_STRUCT  *pmch_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -547,8 +560,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pmch_info_r9_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
-                                            uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16                 rnti,
+                                            LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -561,8 +574,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
-                                              uint16  *rnti)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                              uint16                *rnti)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -585,8 +598,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_BYTE_MSG_STRUCT  *ded_info_cdma2000,
-                                                             uint8                         **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_BYTE_MSG_STRUCT         *ded_info_cdma2000,
+                                                             LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -616,8 +629,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_BYTE_MSG_STR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8                         **ie_ptr,
-                                                               LIBLTE_BYTE_MSG_STRUCT  *ded_info_cdma2000)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
+                                                               LIBLTE_BYTE_MSG_STRUCT         *ded_info_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -657,8 +670,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_BYTE_MSG_STRUCT  *ded_info_nas,
-                                                        uint8                         **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_BYTE_MSG_STRUCT         *ded_info_nas,
+                                                        LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -688,8 +701,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_BYTE_MSG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8                         **ie_ptr,
-                                                          LIBLTE_BYTE_MSG_STRUCT  *ded_info_nas)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
+                                                          LIBLTE_BYTE_MSG_STRUCT         *ded_info_nas)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -729,7 +742,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFICIENT_ENUM   filter_coeff,
-                                                        uint8                              **ie_ptr)
+                                                        LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -745,7 +758,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                           LIBLTE_RRC_FILTER_COEFFICIENT_ENUM  *filter_coeff)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -774,8 +787,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
-                                          uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8                  mmec,
+                                          LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -788,8 +801,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
-                                            uint8  *mmec)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                            uint8                 *mmec)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -812,8 +825,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config,
-                                                       uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8                  neigh_cell_config,
+                                                       LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -826,8 +839,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
-                                                         uint8  *neigh_cell_config)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                         uint8                 *neigh_cell_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -850,7 +863,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg,
-                                                  uint8                             **ie_ptr)
+                                                  LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -885,7 +898,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                     LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -932,8 +945,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
-                                                         uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32                 rand,
+                                                         LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -946,8 +959,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
-                                                           uint32  *rand)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                           uint32                *rand)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -972,7 +985,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_type,
-                                              uint8                    **ie_ptr)
+                                              LIBLTE_BIT_PTR_STRUCT     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -988,7 +1001,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_typ
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(LIBLTE_BIT_PTR_STRUCT     *ie_ptr,
                                                 LIBLTE_RRC_RAT_TYPE_ENUM  *rat_type)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1017,8 +1030,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_pt
 
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_transaction_id,
-                                                                uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8                  rrc_transaction_id,
+                                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1031,8 +1044,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_tran
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr,
-                                                                  uint8  *rrc_transaction_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                  uint8                 *rrc_transaction_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1057,7 +1070,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
-                                            uint8                    **ie_ptr)
+                                            LIBLTE_BIT_PTR_STRUCT     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1072,7 +1085,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(LIBLTE_BIT_PTR_STRUCT     *ie_ptr,
                                               LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1108,7 +1121,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1139,7 +1152,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1174,7 +1187,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1190,7 +1203,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAM
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1208,7 +1221,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *params,
-                                               uint8                       **ie_ptr)
+                                               LIBLTE_BIT_PTR_STRUCT        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1229,7 +1242,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *par
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(LIBLTE_BIT_PTR_STRUCT        *ie_ptr,
                                                  LIBLTE_RRC_RF_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1252,7 +1265,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **i
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1275,7 +1288,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1300,7 +1313,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1320,7 +1333,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1342,7 +1355,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1357,7 +1370,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1381,15 +1394,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT *ue_eutra_capability,
-                                                         LIBLTE_BIT_MSG_STRUCT                 *msg)
+                                                         LIBLTE_BIT_PTR_STRUCT                 *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(ue_eutra_capability   != NULL &&
        msg                   != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Option indicator - featureGroupIndicators
         liblte_value_2_bits(ue_eutra_capability->feature_group_indicator_present, &msg_ptr, 1);
@@ -1410,15 +1423,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAP
           liblte_value_2_bits(ue_eutra_capability->feature_group_indicator, &msg_ptr, 32);
         liblte_rrc_pack_inter_rat_params_ie(&ue_eutra_capability->inter_rat_params, &msg_ptr);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                            LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT *ue_eutra_capability)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1464,7 +1477,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1486,7 +1499,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMER
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1522,7 +1535,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM   allowed_meas_bw,
-                                                            uint8                                  **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1535,7 +1548,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_M
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                               LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM  *allowed_meas_bw)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1559,8 +1572,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
-                                                uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8                  hysteresis,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1574,8 +1587,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
-                                                  uint8  *hysteresis)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  uint8                 *hysteresis)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1612,7 +1625,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1741,7 +1754,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1880,7 +1893,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1909,7 +1922,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1948,8 +1961,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
-                                             uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8                  meas_id,
+                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1962,8 +1975,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
-                                               uint8  *meas_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                               uint8                 *meas_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1989,7 +2002,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2017,7 +2030,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2056,7 +2069,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2124,7 +2137,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2201,7 +2214,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2302,7 +2315,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2410,7 +2423,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2443,7 +2456,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2485,8 +2498,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
-                                                    uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8                  meas_object_id,
+                                                    LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2499,8 +2512,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
-                                                      uint8  *meas_object_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                      uint8                 *meas_object_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2524,7 +2537,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                 uint8                                         **ie_ptr)
+                                                                 LIBLTE_BIT_PTR_STRUCT                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2564,7 +2577,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8                                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(LIBLTE_BIT_PTR_STRUCT                          *ie_ptr,
                                                                    LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2615,7 +2628,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2690,7 +2703,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2787,7 +2800,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2836,7 +2849,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2908,7 +2921,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3017,7 +3030,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3136,8 +3149,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
-                                                      uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8                  report_cnfg_id,
+                                                      LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3150,8 +3163,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
-                                                        uint8  *report_cnfg_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                        uint8                 *report_cnfg_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3175,7 +3188,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3263,7 +3276,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3362,7 +3375,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                   uint8                                           **ie_ptr)
+                                                                   LIBLTE_BIT_PTR_STRUCT                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3394,7 +3407,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_RE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8                                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(LIBLTE_BIT_PTR_STRUCT                            *ie_ptr,
                                                                      LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3436,7 +3449,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_ENUM   report_int,
-                                                     uint8                           **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3449,7 +3462,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                        LIBLTE_RRC_REPORT_INTERVAL_ENUM  *report_int)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3473,8 +3486,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
-                                                uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8                  rsrp_range,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3487,8 +3500,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
-                                                  uint8  *rsrp_range)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  uint8                 *rsrp_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3511,8 +3524,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
-                                                uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8                  rsrq_range,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3525,8 +3538,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
-                                                  uint8  *rsrq_range)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  uint8                 *rsrq_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3552,7 +3565,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_ENUM   time_to_trigger,
-                                                     uint8                           **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3565,7 +3578,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                        LIBLTE_RRC_TIME_TO_TRIGGER_ENUM  *time_to_trigger)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3588,8 +3601,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_spect_em,
-                                                                  uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8                  add_spect_em,
+                                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3602,8 +3615,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_sp
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_ptr,
-                                                                    uint8  *add_spect_em)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                    uint8                 *add_spect_em)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3626,8 +3639,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_p
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
-                                                          uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16                 arfcn,
+                                                          LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3640,8 +3653,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
-                                                            uint16  *arfcn)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                            uint16                *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3665,8 +3678,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16                 arfcn,
+                                                       LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3679,8 +3692,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
-                                                         uint16  *arfcn)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                         uint16                *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3703,8 +3716,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16                 arfcn,
+                                                       LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3717,8 +3730,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
-                                                         uint16  *arfcn)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                         uint16                *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3742,8 +3755,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
-                                                      uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16                 arfcn,
+                                                      LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3756,8 +3769,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
-                                                        uint16  *arfcn)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                        uint16                *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3781,7 +3794,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM   bc_cdma2000,
-                                                         uint8                               **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3797,7 +3810,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                            LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM  *bc_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3825,7 +3838,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM   bi_geran,
-                                                          uint8                                **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3838,7 +3851,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICA
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                             LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM  *bi_geran)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3862,7 +3875,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3877,7 +3890,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3903,7 +3916,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3918,7 +3931,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3944,7 +3957,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3974,7 +3987,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQ
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4014,7 +4027,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM   cdma2000_type,
-                                                   uint8                         **ie_ptr)
+                                                   LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4027,7 +4040,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                      LIBLTE_RRC_CDMA2000_TYPE_ENUM  *cdma2000_type)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4050,8 +4063,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
-                                                   uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32                 cell_id,
+                                                   LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4064,8 +4077,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
-                                                     uint32  *cell_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                     uint32                *cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4089,7 +4102,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -4111,7 +4124,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4145,8 +4158,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_resel_prio,
-                                                               uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8                  cell_resel_prio,
+                                                               LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4159,8 +4172,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_rese
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
-                                                                 uint8  *cell_resel_prio)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                 uint8                 *cell_resel_prio)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4185,7 +4198,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param,
-                                                                   uint8                                           **ie_ptr)
+                                                                   LIBLTE_BIT_PTR_STRUCT                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4211,7 +4224,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CS
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8                                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(LIBLTE_BIT_PTR_STRUCT                            *ie_ptr,
                                                                      LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4239,7 +4252,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param,
-                                                                        uint8                                                **ie_ptr)
+                                                                        LIBLTE_BIT_PTR_STRUCT                                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4253,7 +4266,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_R
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8                                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_BIT_PTR_STRUCT                                 *ie_ptr,
                                                                           LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4278,7 +4291,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4293,7 +4306,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4319,7 +4332,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4334,7 +4347,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4360,7 +4373,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4376,7 +4389,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4403,7 +4416,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4422,7 +4435,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4450,8 +4463,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
-                                                  uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32                 csg_id,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4464,8 +4477,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
-                                                    uint32  *csg_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint32                *csg_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4489,7 +4502,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4566,7 +4579,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4663,7 +4676,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4680,7 +4693,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4706,8 +4719,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
-                                                  uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16                 phys_cell_id,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4720,8 +4733,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
-                                                    uint16  *phys_cell_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint16                *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4745,7 +4758,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              opt;
@@ -4769,7 +4782,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4812,8 +4825,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16                 phys_cell_id,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4826,8 +4839,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
-                                                             uint16  *phys_cell_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint16                *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4850,7 +4863,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4865,7 +4878,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4889,8 +4902,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16                 phys_cell_id,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4903,8 +4916,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
-                                                             uint16  *phys_cell_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint16                *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4926,8 +4939,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
-                                                           uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8                  phys_cell_id,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4940,8 +4953,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
-                                                             uint8  *phys_cell_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint8                 *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4964,7 +4977,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id,
-                                                   uint8                           **ie_ptr)
+                                                   LIBLTE_BIT_PTR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint8             mcc_opt = true;
@@ -5004,7 +5017,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(LIBLTE_BIT_PTR_STRUCT            *ie_ptr,
                                                      LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5054,7 +5067,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd,
-                                                                uint8                                        **ie_ptr)
+                                                                LIBLTE_BIT_PTR_STRUCT                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -5092,7 +5105,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_R
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8                                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(LIBLTE_BIT_PTR_STRUCT                         *ie_ptr,
                                                                   LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5139,8 +5152,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
-                                                uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8                   q_qual_min,
+                                                LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5153,8 +5166,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
-                                                  int8   *q_qual_min)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                  int8                  *q_qual_min)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5177,8 +5190,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
-                                                  uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16                  q_rx_lev_min,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5191,8 +5204,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
-                                                    int16  *q_rx_lev_min)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    int16                 *q_rx_lev_min)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5218,7 +5231,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_ENUM   q_offset_range,
-                                                    uint8                          **ie_ptr)
+                                                    LIBLTE_BIT_PTR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5231,7 +5244,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_EN
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                       LIBLTE_RRC_Q_OFFSET_RANGE_ENUM  *q_offset_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5256,8 +5269,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_range_inter_rat,
-                                                              uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8                   q_offset_range_inter_rat,
+                                                              LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5270,8 +5283,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_r
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
-                                                                int8   *q_offset_range_inter_rat)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                                int8                  *q_offset_range_inter_rat)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5293,8 +5306,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
-                                                           uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8                  resel_thresh,
+                                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5307,8 +5320,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
-                                                             uint8  *resel_thresh)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                             uint8                 *resel_thresh)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5331,8 +5344,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thresh_q,
-                                                             uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8                  resel_thresh_q,
+                                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5345,8 +5358,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thres
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
-                                                               uint8  *resel_thresh_q)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                               uint8                 *resel_thresh_q)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5369,8 +5382,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
-                                                  uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8                  s_cell_idx,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5383,8 +5396,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
-                                                    uint8  *s_cell_idx)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint8                 *s_cell_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5407,8 +5420,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
-                                                     uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8                  serv_cell_idx,
+                                                     LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5421,8 +5434,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
-                                                       uint8  *serv_cell_idx)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                       uint8                 *serv_cell_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5447,7 +5460,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5462,7 +5475,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5497,7 +5510,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5520,7 +5533,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5553,8 +5566,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
-                                                        uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16                 tac,
+                                                        LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5567,8 +5580,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
-                                                          uint16  *tac)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                          uint16                *tac)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5591,8 +5604,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
-                                                   uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8                  t_resel,
+                                                   LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5605,8 +5618,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
-                                                     uint8  *t_resel)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                     uint8                 *t_resel)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5629,8 +5642,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_chaining_count,
-                                                             uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8                  next_hop_chaining_count,
+                                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5643,8 +5656,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_ch
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
-                                                               uint8  *next_hop_chaining_count)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                               uint8                 *next_hop_chaining_count)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5668,7 +5681,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5690,7 +5703,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5722,8 +5735,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
-                                                 uint8  **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16                 short_mac_i,
+                                                 LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5736,8 +5749,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
-                                                   uint16  *short_mac_i)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                   uint16                *short_mac_i)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5761,7 +5774,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM   antenna_ports_cnt,
-                                                         uint8                               **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5774,7 +5787,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                            LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM  *antenna_ports_cnt)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5790,7 +5803,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5843,7 +5856,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_I
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5906,7 +5919,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5964,7 +5977,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6051,8 +6064,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
-                                                  uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8                  drb_id,
+                                                  LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6065,8 +6078,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
-                                                    uint8  *drb_id)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                    uint8                 *drb_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6089,7 +6102,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6122,7 +6135,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6170,7 +6183,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              ext = false;
@@ -6307,7 +6320,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6458,7 +6471,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6518,7 +6531,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6593,7 +6606,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6608,7 +6621,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6625,7 +6638,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM   p_a,
-                                                            uint8                            **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6638,7 +6651,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8                            **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT             *ie_ptr,
                                                               LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM  *p_a)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6662,7 +6675,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_PTR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6677,7 +6690,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6703,7 +6716,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              ext = false;
@@ -6795,7 +6808,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSIC
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6901,8 +6914,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8
 
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
-                                           uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8                   p_max,
+                                           LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6915,8 +6928,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
-                                             int8   *p_max)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                             int8                  *p_max)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6940,7 +6953,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6958,7 +6971,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6978,7 +6991,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_PTR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7003,7 +7016,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(LIBLTE_BIT_PTR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7029,8 +7042,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_idx,
-                                                            uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8                  prach_cnfg_idx,
+                                                            LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7043,8 +7056,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_i
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
-                                                              uint8  *prach_cnfg_idx)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                              uint8                 *prach_cnfg_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7067,8 +7080,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
 
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_ant_port_1,
-                                                             uint8 **ie_ptr)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool                   presence_ant_port_1,
+                                                             LIBLTE_BIT_PTR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7081,8 +7094,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_an
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
-                                                               bool   *presence_ant_port_1)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(LIBLTE_BIT_PTR_STRUCT *ie_ptr,
+                                                               bool                  *presence_ant_port_1)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7106,7 +7119,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7123,7 +7136,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7142,7 +7155,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7174,7 +7187,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7218,7 +7231,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7242,7 +7255,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7268,7 +7281,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7289,7 +7302,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7320,7 +7333,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7359,7 +7372,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                           LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7415,7 +7428,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7430,7 +7443,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7458,7 +7471,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7492,7 +7505,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7530,7 +7543,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7613,7 +7626,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7710,7 +7723,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -7886,7 +7899,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                  *ie_ptr,
                                                            LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8076,7 +8089,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_PTR_STRUCT         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8145,7 +8158,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *r
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(LIBLTE_BIT_PTR_STRUCT         *ie_ptr,
                                                   LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8227,7 +8240,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants,
-                                                              uint8                                      **ie_ptr)
+                                                              LIBLTE_BIT_PTR_STRUCT                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8251,7 +8264,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8                                      **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(LIBLTE_BIT_PTR_STRUCT                       *ie_ptr,
                                                                 LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8294,7 +8307,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR_STRUCT                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8320,7 +8333,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(LIBLTE_BIT_PTR_STRUCT                        *ie_ptr,
                                                                  LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8357,7 +8370,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8385,7 +8398,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONF
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(LIBLTE_BIT_PTR_STRUCT                   *ie_ptr,
                                                             LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8415,7 +8428,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8453,7 +8466,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8502,7 +8515,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_PTR_STRUCT         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -8587,7 +8600,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *s
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(LIBLTE_BIT_PTR_STRUCT         *ie_ptr,
                                                   LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8687,7 +8700,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_PTR_STRUCT         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8702,7 +8715,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *t
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(LIBLTE_BIT_PTR_STRUCT         *ie_ptr,
                                                   LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8728,7 +8741,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM   time_alignment_timer,
-                                                          uint8                                **ie_ptr)
+                                                          LIBLTE_BIT_PTR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8741,7 +8754,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(LIBLTE_BIT_PTR_STRUCT                 *ie_ptr,
                                                             LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM  *time_alignment_timer)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8766,7 +8779,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8795,7 +8808,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(LIBLTE_BIT_PTR_STRUCT               *ie_ptr,
                                                         LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8834,7 +8847,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8852,7 +8865,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(LIBLTE_BIT_PTR_STRUCT              *ie_ptr,
                                                        LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8884,7 +8897,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8909,7 +8922,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(LIBLTE_BIT_PTR_STRUCT                      *ie_ptr,
                                                                LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8936,7 +8949,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl,
-                                                                uint8                                        **ie_ptr)
+                                                                LIBLTE_BIT_PTR_STRUCT                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8972,7 +8985,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_PO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8                                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(LIBLTE_BIT_PTR_STRUCT                         *ie_ptr,
                                                                   LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9019,7 +9032,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9117,7 +9130,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9231,7 +9244,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9315,7 +9328,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9414,7 +9427,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9472,7 +9485,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9543,7 +9556,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9623,7 +9636,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9723,7 +9736,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9805,7 +9818,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9900,7 +9913,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9962,7 +9975,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10039,7 +10052,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_RRC_NEIGH_CELL_CDMA2000_STRUCT *neigh_cell_list;
     LIBLTE_ERROR_ENUM                      err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10195,7 +10208,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8)
 {
     LIBLTE_RRC_NEIGH_CELL_CDMA2000_STRUCT *neigh_cell_list;
@@ -10375,7 +10388,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -10404,7 +10417,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(LIBLTE_BIT_PTR_STRUCT                    *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10476,7 +10489,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -10502,7 +10515,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(LIBLTE_BIT_PTR_STRUCT                     *ie_ptr,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10547,15 +10560,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_information_transfer_msg(LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg)
+                                                              LIBLTE_BIT_PTR_STRUCT                     *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(ul_info_transfer != NULL &&
        msg              != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -10578,24 +10591,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_information_transfer_msg(LIBLTE_RRC_UL_INFO
                                                        &msg_ptr);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_PTR_STRUCT                     *msg,
                                                                 LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg              != NULL &&
        ul_info_transfer != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -10655,15 +10668,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_MSG_S
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_information_request_msg(LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg)
+                                                             LIBLTE_BIT_PTR_STRUCT                    *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(ue_info_req != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(ue_info_req->rrc_transaction_id,
@@ -10684,24 +10697,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_information_request_msg(LIBLTE_RRC_UE_INFOR
         // RLF report required
         liblte_value_2_bits(ue_info_req->rlf_report_req, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_PTR_STRUCT                    *msg,
                                                                LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg         != NULL &&
        ue_info_req != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -10739,16 +10752,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info,
-                                                                LIBLTE_BIT_MSG_STRUCT                       *msg)
+                                                                LIBLTE_BIT_PTR_STRUCT                       *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
 
     if(ue_capability_info != NULL &&
        msg                != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(ue_capability_info->rrc_transaction_id,
@@ -10771,8 +10784,11 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CA
             liblte_value_2_bits(ue_capability_info->ue_capability_rat[i].rat_type, &msg_ptr, 3);
 
             // Octet string
-            LIBLTE_BIT_MSG_STRUCT  tmp;
-            liblte_rrc_pack_ue_eutra_capability_ie(&ue_capability_info->ue_capability_rat[i].eutra_capability, &tmp);
+            LIBLTE_PACKED_MSG_STRUCT  tmp;
+            LIBLTE_BIT_PTR_STRUCT     tmp_ptr;
+            liblte_bit_ptr_init(&tmp_ptr, tmp.msg);
+            liblte_rrc_pack_ue_eutra_capability_ie(&ue_capability_info->ue_capability_rat[i].eutra_capability, &tmp_ptr);
+            tmp.N_bits = tmp_ptr.N_bits;
 
             uint32 pad     = 8 - tmp.N_bits%8;
             uint32 n_bytes = (tmp.N_bits+pad) / 8;
@@ -10788,34 +10804,29 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CA
                 // FIXME: Unlikely to have more than 16K of octets
             }
 
-            for(i=0; i<tmp.N_bits; i++)
-            {
-                *msg_ptr = tmp.msg[i];
-                msg_ptr++;
-            }
-
-            msg_ptr += pad;
+            liblte_bytes_2_bits(tmp.msg, &msg_ptr, tmp.N_bits);
+            liblte_value_2_bits(0, &msg_ptr, pad);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_MSG_STRUCT                       *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_PTR_STRUCT                       *msg,
                                                                   LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
 
     if(msg                != NULL &&
        ue_capability_info != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -10872,16 +10883,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_MSG
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_enquiry_msg(LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
 
     if(ue_cap_enquiry != NULL &&
        msg            != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(ue_cap_enquiry->rrc_transaction_id,
@@ -10903,25 +10914,25 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_enquiry_msg(LIBLTE_RRC_UE_CAPABI
             liblte_rrc_pack_rat_type_ie(ue_cap_enquiry->ue_capability_request[i], &msg_ptr);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry)
 {
   LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-  uint8             *msg_ptr;
+  LIBLTE_BIT_PTR_STRUCT  msg_ptr;
   uint32             i;
 
   if(msg         != NULL &&
      ue_cap_enquiry != NULL)
   {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
       // RRC Transaction ID
       liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -10961,21 +10972,21 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_1_msg(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
-    uint32             j;
-    uint8              non_crit_ext_opt        = false;
-    uint8              csg_id_opt              = false;
-    uint8              q_rx_lev_min_offset_opt = false;
-    uint8              extension               = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
+    uint32                 j;
+    uint8                  non_crit_ext_opt        = false;
+    uint8                  csg_id_opt              = false;
+    uint8                  q_rx_lev_min_offset_opt = false;
+    uint8                  extension               = false;
 
     if(sib1 != NULL &&
        msg  != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Optional indicators
         liblte_value_2_bits(sib1->p_max_present, &msg_ptr, 1);
@@ -11045,33 +11056,33 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_1_msg(LIBLTE_RRC_SYS_INFO_
         // Non Critical Extension
         // FIXME
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1,
                                                               uint32                                  *N_bits_used)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
-    uint32             j;
-    bool               tdd_config_opt;
-    bool               non_crit_ext_opt;
-    bool               csg_id_opt;
-    bool               q_rx_lev_min_offset_opt;
-    bool               extension;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
+    uint32                 j;
+    bool                   tdd_config_opt;
+    bool                   non_crit_ext_opt;
+    bool                   csg_id_opt;
+    bool                   q_rx_lev_min_offset_opt;
+    bool                   extension;
 
     if(msg         != NULL &&
        sib1        != NULL &&
        N_bits_used != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Optional indicators
         sib1->p_max_present = liblte_bits_2_value(&msg_ptr, 1);
@@ -11154,7 +11165,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
         liblte_rrc_consume_noncrit_extension(non_crit_ext_opt, __func__, &msg_ptr);
 
         // N_bits_used
-        *N_bits_used = msg_ptr - (msg->msg);
+        *N_bits_used = msg_ptr.N_bits - msg->N_bits;
 
         err = LIBLTE_SUCCESS;
     }
@@ -11170,19 +11181,19 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs,
-                                               LIBLTE_BIT_MSG_STRUCT          *msg)
+                                               LIBLTE_BIT_PTR_STRUCT          *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8             *length_ptr;
-    uint32             length;
-    uint32             pad_bits;
-    uint32             i;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    LIBLTE_BIT_PTR_STRUCT  length_ptr;
+    uint32                 length;
+    uint32                 pad_bits;
+    uint32                 i;
 
     if(sibs != NULL &&
        msg  != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Critical extensions choice
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -11252,16 +11263,22 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                     err = LIBLTE_ERROR_INVALID_INPUTS;
                     break;
                 }
-                length   = ((msg_ptr - length_ptr) / 8) - 1;
-                pad_bits = (msg_ptr - length_ptr) % 8;
+                length   = ((msg_ptr.N_bits - length_ptr.N_bits) / 8) - 1;
+                pad_bits = (msg_ptr.N_bits - length_ptr.N_bits) % 8;
                 if(0 != pad_bits)
                 {
                     length++;
                 }
                 if(length < 128)
                 {
+                    // Rewrite the length in place, keeping the SIB bits in its last byte
+                    LIBLTE_BIT_PTR_STRUCT tail_ptr = length_ptr;
+                    tail_ptr.N_bits += 8;
+                    uint32 N_tail = (8 - tail_ptr.N_bits%8)%8;
+                    uint32 tail   = liblte_bits_2_value(&tail_ptr, N_tail);
                     liblte_value_2_bits(0,      &length_ptr, 1);
                     liblte_value_2_bits(length, &length_ptr, 7);
+                    liblte_value_2_bits(tail,   &length_ptr, N_tail);
                 }else{
                     msg_ptr = length_ptr;
                     liblte_value_2_bits(0,      &msg_ptr, 2);
@@ -11288,26 +11305,26 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
             }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT          *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_PTR_STRUCT          *msg,
                                                  LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8             *head_ptr;
-    uint32             i;
-    uint32             length_determinant_octets;
-    uint8              non_crit_ext_opt;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    LIBLTE_BIT_PTR_STRUCT  head_ptr;
+    uint32                 i;
+    uint32                 length_determinant_octets;
+    uint8                  non_crit_ext_opt;
 
     if(msg  != NULL &&
        sibs != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Critical extensions choice
         if(0 == liblte_bits_2_value(&msg_ptr, 1))
@@ -11392,7 +11409,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
                         err = LIBLTE_ERROR_INVALID_INPUTS;
                         break;
                     }
-                    liblte_bits_2_value(&msg_ptr, (msg_ptr - head_ptr) % 8);
+                    liblte_bits_2_value(&msg_ptr, (msg_ptr.N_bits - head_ptr.N_bits) % 8);
                 }
 
                 if(LIBLTE_SUCCESS != err)
@@ -11420,15 +11437,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_failure_msg(LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(security_mode_failure != NULL &&
        msg                   != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(security_mode_failure->rrc_transaction_id,
@@ -11440,24 +11457,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_failure_msg(LIBLTE_RRC_SECURITY_
         // Optional indicator
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                   != NULL &&
        security_mode_failure != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -11486,15 +11503,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_complete_msg(LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg)
+                                                             LIBLTE_BIT_PTR_STRUCT                    *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(security_mode_complete != NULL &&
        msg                    != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(security_mode_complete->rrc_transaction_id,
@@ -11506,24 +11523,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_complete_msg(LIBLTE_RRC_SECURITY
         // Optional indicator
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_PTR_STRUCT                    *msg,
                                                                LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                    != NULL &&
        security_mode_complete != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -11551,15 +11568,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_command_msg(LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_PTR_STRUCT                   *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(security_mode_cmd != NULL &&
        msg               != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(security_mode_cmd->rrc_transaction_id,
@@ -11581,24 +11598,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_command_msg(LIBLTE_RRC_SECURITY_
         liblte_rrc_pack_security_algorithm_config_ie(&security_mode_cmd->sec_algs,
                                                      &msg_ptr);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_PTR_STRUCT                   *msg,
                                                               LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg               != NULL &&
        security_mode_cmd != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -11639,15 +11656,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_complete_msg(LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete,
-                                                                    LIBLTE_BIT_MSG_STRUCT                       *msg)
+                                                                    LIBLTE_BIT_PTR_STRUCT                       *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_setup_complete != NULL &&
        msg                != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_setup_complete->rrc_transaction_id,
@@ -11689,24 +11706,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_complete_msg(LIBLTE_RRC_C
         liblte_rrc_pack_dedicated_info_nas_ie(&con_setup_complete->dedicated_info_nas,
                                               &msg_ptr);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT_MSG_STRUCT                       *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT_PTR_STRUCT                       *msg,
                                                                       LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                != NULL &&
        con_setup_complete != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -11764,15 +11781,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_msg(LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup,
-                                                           LIBLTE_BIT_MSG_STRUCT              *msg)
+                                                           LIBLTE_BIT_PTR_STRUCT              *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_setup != NULL &&
        msg       != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_setup->rrc_transaction_id,
@@ -11790,24 +11807,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_msg(LIBLTE_RRC_CONNECTION
         // Radio Resource Config Dedicated
         liblte_rrc_pack_rr_config_dedicated_ie(&con_setup->rr_cnfg, &msg_ptr);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_MSG_STRUCT              *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_PTR_STRUCT              *msg,
                                                              LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg       != NULL &&
        con_setup != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -11842,16 +11859,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_MSG_STRU
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req,
-                                                             LIBLTE_BIT_MSG_STRUCT                *msg)
+                                                             LIBLTE_BIT_PTR_STRUCT                *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(con_req != NULL &&
        msg     != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -11875,8 +11892,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTI
         // Spare
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
         
@@ -11886,16 +11903,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                                LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg     != NULL &&
        con_req != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension Choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -11932,15 +11949,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_release_msg(LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release,
-                                                             LIBLTE_BIT_MSG_STRUCT                *msg)
+                                                             LIBLTE_BIT_PTR_STRUCT                *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_release != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_release->rrc_transaction_id,
@@ -11960,24 +11977,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_release_msg(LIBLTE_RRC_CONNECTI
         // Release cause
         liblte_value_2_bits(con_release->release_cause, &msg_ptr, 2);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                                LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg         != NULL &&
        con_release != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -12013,15 +12030,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reject_msg(LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej,
-                                                            LIBLTE_BIT_MSG_STRUCT               *msg)
+                                                            LIBLTE_BIT_PTR_STRUCT               *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_rej != NULL &&
        msg     != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -12035,24 +12052,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reject_msg(LIBLTE_RRC_CONNECTIO
         // Wait Time
         liblte_value_2_bits(con_rej->wait_time - 1, &msg_ptr, 4);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_MSG_STRUCT               *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_PTR_STRUCT               *msg,
                                                               LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg     != NULL &&
        con_rej != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -12083,16 +12100,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req,
-                                                                             LIBLTE_BIT_MSG_STRUCT                                *msg)
+                                                                             LIBLTE_BIT_PTR_STRUCT                                *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(con_reest_req != NULL &&
        msg           != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -12110,8 +12127,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIB
             // Spare
             liblte_value_2_bits(0, &msg_ptr, 2);
 
-            // Fill in the number of bits used
-            msg->N_bits = msg_ptr - msg->msg;
+            // Advance past the bits used
+            *msg = msg_ptr;
 
             err = LIBLTE_SUCCESS;
         }
@@ -12119,16 +12136,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIB
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(LIBLTE_BIT_MSG_STRUCT                                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(LIBLTE_BIT_PTR_STRUCT                                *msg,
                                                                                LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg           != NULL &&
        con_reest_req != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension Choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -12158,15 +12175,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(L
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_reject_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej,
-                                                                            LIBLTE_BIT_MSG_STRUCT                               *msg)
+                                                                            LIBLTE_BIT_PTR_STRUCT                               *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_reest_rej != NULL &&
        msg           != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -12174,24 +12191,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_reject_msg(LIBL
         // Optional indicator
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LIBLTE_BIT_MSG_STRUCT                               *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LIBLTE_BIT_PTR_STRUCT                               *msg,
                                                                               LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg           != NULL &&
        con_reest_rej != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -12216,15 +12233,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LI
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_complete_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                 *msg)
+                                                                              LIBLTE_BIT_PTR_STRUCT                                 *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_reest_complete != NULL &&
        msg                != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reest_complete->rrc_transaction_id,
@@ -12236,24 +12253,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_complete_msg(LI
         // Optional indicator
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(LIBLTE_BIT_MSG_STRUCT                                 *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(LIBLTE_BIT_PTR_STRUCT                                 *msg,
                                                                                 LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                != NULL &&
        con_reest_complete != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -12281,15 +12298,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest,
-                                                                     LIBLTE_BIT_MSG_STRUCT                        *msg)
+                                                                     LIBLTE_BIT_PTR_STRUCT                        *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_reest != NULL &&
        msg       != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reest->rrc_transaction_id,
@@ -12310,24 +12327,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_msg(LIBLTE_RRC_
         // Next Hop Chaining Count
         liblte_rrc_pack_next_hop_chaining_count_ie(con_reest->next_hop_chaining_count, &msg_ptr);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BIT_MSG_STRUCT                        *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BIT_PTR_STRUCT                        *msg,
                                                                        LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg       != NULL &&
        con_reest != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -12365,15 +12382,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BI
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg(LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                 *msg)
+                                                                              LIBLTE_BIT_PTR_STRUCT                                 *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(con_reconfig_complete != NULL &&
        msg                   != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reconfig_complete->rrc_transaction_id,
@@ -12385,24 +12402,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg(LI
         // Optional indicator
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(LIBLTE_BIT_MSG_STRUCT                                 *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(LIBLTE_BIT_PTR_STRUCT                                 *msg,
                                                                                 LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                   != NULL &&
        con_reconfig_complete != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -12430,16 +12447,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_msg(LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig,
-                                                                     LIBLTE_BIT_MSG_STRUCT                        *msg)
+                                                                     LIBLTE_BIT_PTR_STRUCT                        *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
 
     if(con_reconfig != NULL &&
        msg          != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reconfig->rrc_transaction_id, &msg_ptr);
@@ -12528,26 +12545,26 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_msg(LIBLTE_RRC_
             }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BIT_MSG_STRUCT                        *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BIT_PTR_STRUCT                        *msg,
                                                                        LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
-    bool               ded_info_nas_list_present;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
+    bool                   ded_info_nas_list_present;
 
     if(msg          != NULL &&
        con_reconfig != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr, &con_reconfig->rrc_transaction_id);
@@ -12652,15 +12669,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BI
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rn_reconfiguration_complete_msg(LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete,
-                                                                  LIBLTE_BIT_MSG_STRUCT                         *msg)
+                                                                  LIBLTE_BIT_PTR_STRUCT                         *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(rn_reconfig_complete != NULL &&
        msg                  != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(rn_reconfig_complete->rrc_transaction_id,
@@ -12676,24 +12693,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rn_reconfiguration_complete_msg(LIBLTE_RRC_RN_
         liblte_value_2_bits(0, &msg_ptr, 1);
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_MSG_STRUCT                         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_PTR_STRUCT                         *msg,
                                                                     LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                  != NULL &&
        rn_reconfig_complete != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -12737,15 +12754,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_M
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_proximity_indication_msg(LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind,
-                                                           LIBLTE_BIT_MSG_STRUCT                  *msg)
+                                                           LIBLTE_BIT_PTR_STRUCT                  *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(proximity_ind != NULL &&
        msg           != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -12775,24 +12792,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_proximity_indication_msg(LIBLTE_RRC_PROXIMITY_
                                                 &msg_ptr);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_MSG_STRUCT                  *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_PTR_STRUCT                  *msg,
                                                              LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg           != NULL &&
        proximity_ind != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -12838,17 +12855,17 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_MSG_STRU
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
-                                             LIBLTE_BIT_MSG_STRUCT    *msg)
+                                             LIBLTE_BIT_PTR_STRUCT    *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
-    uint32             j;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
+    uint32                 j;
 
     if(page != NULL &&
        msg  != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Optional indicators
         if(page->paging_record_list_size != 0)
@@ -12931,25 +12948,25 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
             }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_PTR_STRUCT    *msg,
                                                LIBLTE_RRC_PAGING_STRUCT *page)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
-    uint32             j;
-    uint8              paging_record_list_present;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
+    uint32                 j;
+    uint8                  paging_record_list_present;
 
     if(msg  != NULL &&
        page != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Optional indicators
         paging_record_list_present             = liblte_bits_2_value(&msg_ptr, 1);
@@ -13058,7 +13075,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cgi_info_ie(LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_info,
-                                              uint8                      **ie_ptr)
+                                              LIBLTE_BIT_PTR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13080,7 +13097,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cgi_info_ie(LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_i
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(uint8                      **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(LIBLTE_BIT_PTR_STRUCT       *ie_ptr,
                                                 LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13104,7 +13121,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(uint8                      **ie_
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_ie(LIBLTE_RRC_MEAS_RESULT_STRUCT  *meas_result,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13130,7 +13147,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_ie(LIBLTE_RRC_MEAS_RESULT_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(LIBLTE_BIT_PTR_STRUCT          *ie_ptr,
                                                    LIBLTE_RRC_MEAS_RESULT_STRUCT  *meas_result)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13162,7 +13179,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_eutra_ie(LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT  *meas_result_eutra,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13181,7 +13198,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_eutra_ie(LIBLTE_RRC_MEAS_RESULT_EU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(LIBLTE_BIT_PTR_STRUCT                *ie_ptr,
                                                          LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT  *meas_result_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13203,15 +13220,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_measurement_report_msg(LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *meas_report,
-                                                         LIBLTE_BIT_MSG_STRUCT                *msg)
+                                                         LIBLTE_BIT_PTR_STRUCT                *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(meas_report != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         //MeasurementReport
         liblte_value_2_bits(0, &msg_ptr, 1); //critical extensions
@@ -13240,24 +13257,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_measurement_report_msg(LIBLTE_RRC_MEASUREMENT_
           }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_PTR_STRUCT                *msg,
                                                            LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *meas_report)
 {
-    LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg      != NULL &&
        meas_report != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         //MeasurementReport
         bool crit_ext = liblte_bits_2_value(&msg_ptr, 1); //critical extensions
@@ -13306,16 +13323,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_MSG_STRUCT
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_configuration_r9_msg(LIBLTE_RRC_MBSFN_AREA_CONFIGURATION_R9_STRUCT *mbsfn_area_cnfg,
-                                                                  LIBLTE_BIT_MSG_STRUCT                         *msg)
+                                                                  LIBLTE_BIT_PTR_STRUCT                         *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
 
     if(mbsfn_area_cnfg != NULL &&
        msg             != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Non-critical extension
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -13335,26 +13352,26 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_configuration_r9_msg(LIBLTE_RRC_MBS
             liblte_rrc_pack_pmch_info_r9_ie(&mbsfn_area_cnfg->pmch_infolist_r9[i], &msg_ptr);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_configuration_r9_msg(LIBLTE_BIT_MSG_STRUCT                         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_configuration_r9_msg(LIBLTE_BIT_PTR_STRUCT                         *msg,
                                                                     LIBLTE_RRC_MBSFN_AREA_CONFIGURATION_R9_STRUCT *mbsfn_area_cnfg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             i;
-    bool               ext;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 i;
+    bool                   ext;
 
     if(msg             != NULL &&
        mbsfn_area_cnfg != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Non-critical extension
         ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -13422,15 +13439,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_configuration_r9_msg(LIBLTE_BIT_M
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_information_transfer_msg(LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg)
+                                                              LIBLTE_BIT_PTR_STRUCT                     *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(dl_info_transfer != NULL &&
        msg              != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(dl_info_transfer->rrc_transaction_id,
@@ -13457,24 +13474,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_information_transfer_msg(LIBLTE_RRC_DL_INFO
                                                        &msg_ptr);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_PTR_STRUCT                     *msg,
                                                                 LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg              != NULL &&
        dl_info_transfer != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // RRC Transaction ID
         liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
@@ -13529,15 +13546,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_MSG_S
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_parameters_request_cdma2000_msg(LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000,
-                                                                       LIBLTE_BIT_MSG_STRUCT                              *msg)
+                                                                       LIBLTE_BIT_PTR_STRUCT                              *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(csfb_params_req_cdma2000 != NULL &&
        msg                      != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         liblte_value_2_bits(0, &msg_ptr, 1);
@@ -13545,24 +13562,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_parameters_request_cdma2000_msg(LIBLTE_RR
         // Optional indicator
         liblte_value_2_bits(0, &msg_ptr, 1);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        // Advance past the bits used
+        *msg = msg_ptr;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_BIT_MSG_STRUCT                              *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_BIT_PTR_STRUCT                              *msg,
                                                                          LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg                      != NULL &&
        csfb_params_req_cdma2000 != NULL)
     {
-        msg_ptr = msg->msg;
+        msg_ptr = *msg;
 
         // Extension choice
         bool ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -13608,16 +13625,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_
 
     Document Reference: 36.331 v10.0.0 Sections 6.2.1 and 6.2.2
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
-                                               LIBLTE_BIT_MSG_STRUCT *msg)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT  *mib,
+                                               LIBLTE_BYTE_MSG_STRUCT *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(mib != NULL &&
        msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // DL Bandwidth
         liblte_value_2_bits(mib->dl_bw, &msg_ptr, 3);
@@ -13631,24 +13648,23 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
         // Spare
         liblte_value_2_bits(0, &msg_ptr, 10);
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        msg->N_bytes = msg_ptr.N_bits/8;
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
-                                                 LIBLTE_RRC_MIB_STRUCT *mib)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BYTE_MSG_STRUCT *msg,
+                                                 LIBLTE_RRC_MIB_STRUCT  *mib)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
 
     if(msg != NULL &&
        mib != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // DL Bandwidth
         mib->dl_bw = (LIBLTE_RRC_DL_BANDWIDTH_ENUM)liblte_bits_2_value(&msg_ptr, 3);
@@ -13664,6 +13680,35 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
+                                               LIBLTE_BIT_MSG_STRUCT *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_bcch_bch_msg(mib, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
+                                                 LIBLTE_RRC_MIB_STRUCT *mib)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_bcch_bch_msg(&bytes, mib);
+    }
+
+    return(err);
+}
 
 /*********************************************************************
     Message Name: BCCH DLSCH Message
@@ -13675,16 +13720,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg,
-                                                 LIBLTE_BIT_MSG_STRUCT            *msg)
+                                                 LIBLTE_BYTE_MSG_STRUCT           *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(bcch_dlsch_msg != NULL &&
        msg            != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -13695,46 +13740,39 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUC
             liblte_value_2_bits(1, &msg_ptr, 1);
 
             err = liblte_rrc_pack_sys_info_block_type_1_msg((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
-                                                            &global_msg);
-            if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-                msg->N_bits = global_msg.N_bits + 2;
-            }else{
-                msg->N_bits = 0;
-                err         = LIBLTE_ERROR_INVALID_INPUTS;
-            }
+                                                            &msg_ptr);
         }else{
             // SIB1 Choice
             liblte_value_2_bits(0, &msg_ptr, 1);
 
             err = liblte_rrc_pack_sys_info_msg(bcch_dlsch_msg,
-                                               &global_msg);
-            if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-                msg->N_bits = global_msg.N_bits + 2;
-            }else{
-                msg->N_bits = 0;
-                err         = LIBLTE_ERROR_INVALID_INPUTS;
-            }
+                                               &msg_ptr);
+        }
+
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+        {
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
+        }else{
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT            *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BYTE_MSG_STRUCT           *msg,
                                                    LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             N_bits_used;
-    uint8              ext;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 N_bits_used;
+    uint8                  ext;
 
     if(msg            != NULL &&
        bcch_dlsch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -13744,22 +13782,13 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
         {
             bcch_dlsch_msg->N_sibs           = 1;
             bcch_dlsch_msg->sibs[0].sib_type = LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1;
-            if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-                global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
-                err               = liblte_rrc_unpack_sys_info_block_type_1_msg(&global_msg,
-                                                                                (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
-                                                                                &N_bits_used);
-                msg_ptr += N_bits_used;
-            }
+            err = liblte_rrc_unpack_sys_info_block_type_1_msg(&msg_ptr,
+                                                              (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
+                                                              &N_bits_used);
+            msg_ptr.N_bits += N_bits_used;
         }else{
-            if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-                err = liblte_rrc_unpack_sys_info_msg(&global_msg,
-                                                     bcch_dlsch_msg);
-            }
+            err = liblte_rrc_unpack_sys_info_msg(&msg_ptr,
+                                                 bcch_dlsch_msg);
         }
         
         liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
@@ -13767,6 +13796,35 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg,
+                                                 LIBLTE_BIT_MSG_STRUCT            *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_bcch_dlsch_msg(bcch_dlsch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT            *msg,
+                                                   LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_bcch_dlsch_msg(&bytes, bcch_dlsch_msg);
+    }
+
+    return(err);
+}
 
 /*********************************************************************
     Message Name: MCCH Message
@@ -13778,55 +13836,80 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mcch_msg(LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg,
-                                           LIBLTE_BIT_MSG_STRUCT      *msg)
+                                           LIBLTE_BYTE_MSG_STRUCT     *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(mcch_msg != NULL &&
        msg      != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // MCCH choice
         liblte_value_2_bits(0, &msg_ptr, 1);
 
         err = liblte_rrc_pack_mbsfn_area_configuration_r9_msg(mcch_msg,
-                                                              &global_msg);
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
+                                                              &msg_ptr);
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 1;
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
         }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BYTE_MSG_STRUCT     *msg,
                                              LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             N_bits_used;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 N_bits_used;
 
     if(msg      != NULL &&
        mcch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // MCCH choice
         liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);
 
-        if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
-        {
-            memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-            err = liblte_rrc_unpack_mbsfn_area_configuration_r9_msg(&global_msg,
-                                                                    mcch_msg);
-        }
+        err = liblte_rrc_unpack_mbsfn_area_configuration_r9_msg(&msg_ptr,
+                                                                mcch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_mcch_msg(LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg,
+                                           LIBLTE_BIT_MSG_STRUCT      *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_mcch_msg(mcch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
+                                             LIBLTE_RRC_MCCH_MSG_STRUCT *mcch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_mcch_msg(&bytes, mcch_msg);
     }
 
     return(err);
@@ -13842,55 +13925,80 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
-                                           LIBLTE_BIT_MSG_STRUCT      *msg)
+                                           LIBLTE_BYTE_MSG_STRUCT     *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(pcch_msg != NULL &&
        msg      != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Paging choice
         liblte_value_2_bits(0, &msg_ptr, 1);
 
         err = liblte_rrc_pack_paging_msg(pcch_msg,
-                                         &global_msg);
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
+                                         &msg_ptr);
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 1;
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
         }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BYTE_MSG_STRUCT     *msg,
                                              LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint32             N_bits_used;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint32                 N_bits_used;
 
     if(msg      != NULL &&
        pcch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Paging choice
         liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);
 
-        if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
-        {
-            memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-            err = liblte_rrc_unpack_paging_msg(&global_msg,
-                                               pcch_msg);
-        }
+        err = liblte_rrc_unpack_paging_msg(&msg_ptr,
+                                           pcch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
+                                           LIBLTE_BIT_MSG_STRUCT      *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_pcch_msg(pcch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
+                                             LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_pcch_msg(&bytes, pcch_msg);
     }
 
     return(err);
@@ -13906,16 +14014,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(dl_ccch_msg != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -13926,41 +14034,41 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_
         if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST == dl_ccch_msg->msg_type)
         {
             err = liblte_rrc_pack_rrc_connection_reestablishment_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *)&dl_ccch_msg->msg,
-                                                                     &global_msg);
+                                                                     &msg_ptr);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST_REJ == dl_ccch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reestablishment_reject_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *)&dl_ccch_msg->msg,
-                                                                            &global_msg);
+                                                                            &msg_ptr);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REJ == dl_ccch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reject_msg((LIBLTE_RRC_CONNECTION_REJECT_STRUCT *)&dl_ccch_msg->msg,
-                                                            &global_msg);
+                                                            &msg_ptr);
         }else{ // LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP == dl_ccch_msg->msg_type
             err = liblte_rrc_pack_rrc_connection_setup_msg((LIBLTE_RRC_CONNECTION_SETUP_STRUCT *)&dl_ccch_msg->msg,
-                                                           &global_msg);
+                                                           &msg_ptr);
         }
 
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 3))
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 3;
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
         }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
                                                 LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext;
 
     if(msg         != NULL &&
        dl_ccch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -13969,20 +14077,18 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         dl_ccch_msg->msg_type = (LIBLTE_RRC_DL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST == dl_ccch_msg->msg_type)
         {
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_msg(&msg_ptr,
                                                                        (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *)&dl_ccch_msg->msg);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST_REJ == dl_ccch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(&msg_ptr,
                                                                               (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *)&dl_ccch_msg->msg);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REJ == dl_ccch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reject_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reject_msg(&msg_ptr,
                                                               (LIBLTE_RRC_CONNECTION_REJECT_STRUCT *)&dl_ccch_msg->msg);
         }else{ // LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP == dl_ccch_msg->msg_type
-            err = liblte_rrc_unpack_rrc_connection_setup_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_setup_msg(&msg_ptr,
                                                              (LIBLTE_RRC_CONNECTION_SETUP_STRUCT *)&dl_ccch_msg->msg);
         }
         
@@ -13991,6 +14097,35 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_dl_ccch_msg(&bytes, dl_ccch_msg);
+    }
+
+    return(err);
+}
 
 /*********************************************************************
     Message Name: DL DCCH Message
@@ -14002,16 +14137,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(dl_dcch_msg != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -14024,70 +14159,70 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_
         {
             printf("NOT HANDLING CSFB PARAMETERS RESPONSE CDMA2000\n");
 //            err = liblte_rrc_pack_csfb_parameters_response_cdma2000_msg((LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT *)&dl_dcch_msg->msg,
-//                                                                        &global_msg);
+//                                                                        &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_DL_INFO_TRANSFER == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_dl_information_transfer_msg((LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *)&dl_dcch_msg->msg,
-                                                              &global_msg);
+                                                              &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_HANDOVER_FROM_EUTRA_PREP_REQ == dl_dcch_msg->msg_type){
             printf("NOT HANDLING HANDOVER FROM EUTRA PREPARATION REQUEST\n");
 //            err = liblte_rrc_pack_handover_from_eutra_preparation_request_msg((LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT *)&dl_dcch_msg->msg,
-//                                                                              &global_msg);
+//                                                                              &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_MOBILITY_FROM_EUTRA_COMMAND == dl_dcch_msg->msg_type){
             printf("NOT HANDLING MOBILITY FROM EUTRA COMMAND\n");
 //            err = liblte_rrc_pack_mobility_from_eutra_command_msg((LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT *)&dl_dcch_msg->msg,
-//                                                                  &global_msg);
+//                                                                  &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reconfiguration_msg((LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg,
-                                                                     &global_msg);
+                                                                     &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RELEASE == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_release_msg((LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *)&dl_dcch_msg->msg,
-                                                             &global_msg);
+                                                             &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_SECURITY_MODE_COMMAND == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_security_mode_command_msg((LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *)&dl_dcch_msg->msg,
-                                                            &global_msg);
+                                                            &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_CAPABILITY_ENQUIRY == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_ue_capability_enquiry_msg((LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *)&dl_dcch_msg->msg,
-                                                            &global_msg);
+                                                            &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_COUNTER_CHECK == dl_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK\n");
 //            err = liblte_rrc_pack_counter_check_msg((LIBLTE_RRC_COUNTER_CHECK_STRUCT *)&dl_dcch_msg->msg,
-//                                                    &global_msg);
+//                                                    &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_INFO_REQ == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_ue_information_request_msg((LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *)&dl_dcch_msg->msg,
-                                                             &global_msg);
+                                                             &msg_ptr);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_LOGGED_MEASUREMENTS_CONFIG == dl_dcch_msg->msg_type){
             printf("NOT HANDLING LOGGED MEASUREMENTS CONFIGURATION\n");
 //            err = liblte_rrc_pack_logged_measurements_configuration_msg((LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT *)&dl_dcch_msg->msg,
-//                                                                        &global_msg);
+//                                                                        &msg_ptr);
         }else{ // LIBLTE_RRC_DL_DCCH_MSG_TYPE_RN_RECONFIG == dl_dcch_msg->msg_type
             printf("NOT HANDLING RN RECONFIGURATION\n");
 //            err = liblte_rrc_pack_rn_reconfiguration_msg((LIBLTE_RRC_RN_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg,
-//                                                         &global_msg);
+//                                                         &msg_ptr);
         }
 
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 5))
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 5;
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
         }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
                                                 LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext;
 
     if(msg         != NULL &&
        dl_dcch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -14096,50 +14231,48 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         dl_dcch_msg->msg_type = (LIBLTE_RRC_DL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_CSFB_PARAMS_RESP_CDMA2000 == dl_dcch_msg->msg_type)
         {
             printf("NOT HANDLING CSFB PARAMETERS RESPONSE CDMA2000\n");
-//            err = liblte_rrc_unpack_csfb_parameters_response_cdma2000_msg(&global_msg,
+//            err = liblte_rrc_unpack_csfb_parameters_response_cdma2000_msg(&msg_ptr,
 //                                                                          (LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_DL_INFO_TRANSFER == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_dl_information_transfer_msg(&global_msg,
+            err = liblte_rrc_unpack_dl_information_transfer_msg(&msg_ptr,
                                                                 (LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_HANDOVER_FROM_EUTRA_PREP_REQ == dl_dcch_msg->msg_type){
             printf("NOT HANDLING HANDOVER FROM EUTRA PREPARATION REQUEST\n");
-//            err = liblte_rrc_unpack_handover_from_eutra_preparation_request_msg(&global_msg,
+//            err = liblte_rrc_unpack_handover_from_eutra_preparation_request_msg(&msg_ptr,
 //                                                                                (LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_MOBILITY_FROM_EUTRA_COMMAND == dl_dcch_msg->msg_type){
             printf("NOT HANDLING MOBILITY FROM EUTRA COMMAND\n");
-//            err = liblte_rrc_unpack_mobility_from_eutra_command_msg(&global_msg,
+//            err = liblte_rrc_unpack_mobility_from_eutra_command_msg(&msg_ptr,
 //                                                                    (LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reconfiguration_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reconfiguration_msg(&msg_ptr,
                                                                        (LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RELEASE == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_release_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_release_msg(&msg_ptr,
                                                                (LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_SECURITY_MODE_COMMAND == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_security_mode_command_msg(&global_msg,
+            err = liblte_rrc_unpack_security_mode_command_msg(&msg_ptr,
                                                               (LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_CAPABILITY_ENQUIRY == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_ue_capability_enquiry_msg(&global_msg,
+            err = liblte_rrc_unpack_ue_capability_enquiry_msg(&msg_ptr,
                                                               (LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_COUNTER_CHECK == dl_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK\n");
-//            err = liblte_rrc_unpack_counter_check_msg(&global_msg,
+//            err = liblte_rrc_unpack_counter_check_msg(&msg_ptr,
 //                                                      (LIBLTE_RRC_COUNTER_CHECK_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_INFO_REQ == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_ue_information_request_msg(&global_msg,
+            err = liblte_rrc_unpack_ue_information_request_msg(&msg_ptr,
                                                                (LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_LOGGED_MEASUREMENTS_CONFIG == dl_dcch_msg->msg_type){
             printf("NOT HANDLING LOGGED MEASUREMENTS CONFIGURATION\n");
-//            err = liblte_rrc_unpack_logged_measurements_configuration_msg(&global_msg,
+//            err = liblte_rrc_unpack_logged_measurements_configuration_msg(&msg_ptr,
 //                                                                          (LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT *)&dl_dcch_msg->msg);
         }else{ // LIBLTE_RRC_DL_DCCH_MSG_TYPE_RN_RECONFIG == dl_dcch_msg->msg_type
             printf("NOT HANDLING RN RECONFIGURATION\n");
-//            err = liblte_rrc_unpack_rn_reconfiguration_msg(&global_msg,
+//            err = liblte_rrc_unpack_rn_reconfiguration_msg(&msg_ptr,
 //                                                           (LIBLTE_RRC_RN_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg);
         }
         
@@ -14148,6 +14281,35 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_dl_dcch_msg(&bytes, dl_dcch_msg);
+    }
+
+    return(err);
+}
 
 /*********************************************************************
     Message Name: UL CCCH Message
@@ -14159,16 +14321,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(ul_ccch_msg != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -14179,35 +14341,35 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_
         if(LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REEST_REQ == ul_ccch_msg->msg_type)
         {
             err = liblte_rrc_pack_rrc_connection_reestablishment_request_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *)&ul_ccch_msg->msg,
-                                                                             &global_msg);
+                                                                             &msg_ptr);
         }else{ // LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REQ == ul_ccch_msg->msg_type
             err = liblte_rrc_pack_rrc_connection_request_msg((LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *)&ul_ccch_msg->msg,
-                                                             &global_msg);
+                                                             &msg_ptr);
         }
 
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 2;
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
         }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
                                                 LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext;
 
     if(msg         != NULL &&
        ul_ccch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -14216,14 +14378,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         ul_ccch_msg->msg_type = (LIBLTE_RRC_UL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REEST_REQ == ul_ccch_msg->msg_type)
         {
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(&msg_ptr,
                                                                                (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *)&ul_ccch_msg->msg);
         }else{ // LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REQ == ul_ccch_msg->msg_type
-            err = liblte_rrc_unpack_rrc_connection_request_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_request_msg(&msg_ptr,
                                                                (LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *)&ul_ccch_msg->msg);
         }
         
@@ -14232,6 +14392,35 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_ul_ccch_msg(ul_ccch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_ul_ccch_msg(&bytes, ul_ccch_msg);
+    }
+
+    return(err);
+}
 
 /*********************************************************************
     Message Name: UL DCCH Message
@@ -14243,16 +14432,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext     = false;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext     = false;
 
     if(ul_dcch_msg != NULL &&
        msg         != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         liblte_value_2_bits(ext, &msg_ptr, 1);
@@ -14264,74 +14453,74 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_
         if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_CSFB_PARAMS_REQ_CDMA2000 == ul_dcch_msg->msg_type)
         {
             err = liblte_rrc_pack_csfb_parameters_request_cdma2000_msg((LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *)&ul_dcch_msg->msg,
-                                                                       &global_msg);
+                                                                       &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_MEASUREMENT_REPORT == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_measurement_report_msg((LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *)&ul_dcch_msg->msg,
-                                                         &global_msg);
+                                                         &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_RECONFIG_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg((LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                              &global_msg);
+                                                                              &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_REEST_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reestablishment_complete_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                              &global_msg);
+                                                                              &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_SETUP_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_setup_complete_msg((LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                    &global_msg);
+                                                                    &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_security_mode_complete_msg((LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                             &global_msg);
+                                                             &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_FAILURE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_security_mode_failure_msg((LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *)&ul_dcch_msg->msg,
-                                                            &global_msg);
+                                                            &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_CAPABILITY_INFO == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_ue_capability_information_msg((LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *)&ul_dcch_msg->msg,
-                                                                &global_msg);
+                                                                &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_HANDOVER_PREP_TRANSFER == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UL HANDOVER PREPARATION TRANSFER\n");
 //            err = liblte_rrc_pack_ul_handover_preparation_transfer_msg((LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg,
-//                                                                       &global_msg);
+//                                                                       &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_INFO_TRANSFER == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_ul_information_transfer_msg((LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg,
-                                                              &global_msg);
+                                                              &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_COUNTER_CHECK_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK RESPONSE\n");
 //            err = liblte_rrc_pack_counter_check_response_msg((LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT *)&ul_dcch_msg->msg,
-//                                                             &global_msg);
+//                                                             &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_INFO_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UE INFORMATION RESPONSE\n");
 //            err = liblte_rrc_pack_ue_information_response_msg((LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT *)&ul_dcch_msg->msg,
-//                                                              &global_msg);
+//                                                              &msg_ptr);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_PROXIMITY_IND == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_proximity_indication_msg((LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *)&ul_dcch_msg->msg,
-                                                           &global_msg);
+                                                           &msg_ptr);
         }else{ // LIBLTE_RRC_UL_DCCH_MSG_TYPE_RN_RECONFIG_COMPLETE == ul_dcch_msg->msg_type
             err = liblte_rrc_pack_rn_reconfiguration_complete_msg((LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                  &global_msg);
+                                                                  &msg_ptr);
         }
 
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 5))
+        if(msg_ptr.N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 5;
+            liblte_align_up_zero(&msg_ptr, 8);
+            msg->N_bytes = msg_ptr.N_bits/8;
         }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+            msg->N_bytes = 0;
+            err          = LIBLTE_ERROR_INVALID_INPUTS;
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
                                                 LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr;
-    uint8              ext;
+    LIBLTE_ERROR_ENUM      err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_PTR_STRUCT  msg_ptr;
+    uint8                  ext;
 
     if(msg         != NULL &&
        ul_dcch_msg != NULL)
     {
-        msg_ptr = msg->msg;
+        liblte_bit_ptr_init(&msg_ptr, msg->msg);
 
         // Extension indicator
         ext = liblte_bits_2_value(&msg_ptr, 1);
@@ -14340,54 +14529,52 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         ul_dcch_msg->msg_type = (LIBLTE_RRC_UL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_CSFB_PARAMS_REQ_CDMA2000 == ul_dcch_msg->msg_type)
         {
-            err = liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(&global_msg,
+            err = liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(&msg_ptr,
                                                                          (LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_MEASUREMENT_REPORT == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_measurement_report_msg(&global_msg,
+            err = liblte_rrc_unpack_measurement_report_msg(&msg_ptr,
                                                            (LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_RECONFIG_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(&msg_ptr,
                                                                                 (LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_REEST_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(&msg_ptr,
                                                                                 (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_SETUP_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_setup_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_setup_complete_msg(&msg_ptr,
                                                                       (LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_security_mode_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_security_mode_complete_msg(&msg_ptr,
                                                                (LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_FAILURE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_security_mode_failure_msg(&global_msg,
+            err = liblte_rrc_unpack_security_mode_failure_msg(&msg_ptr,
                                                               (LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_CAPABILITY_INFO == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UE CAPABILITY INFO\n");
-//            err = liblte_rrc_unpack_ue_capability_information_msg(&global_msg,
+//            err = liblte_rrc_unpack_ue_capability_information_msg(&msg_ptr,
 //                                                                 (LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_HANDOVER_PREP_TRANSFER == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UL HANDOVER PREPARATION TRANSFER\n");
-//            err = liblte_rrc_unpack_ul_handover_preparation_transfer_msg(&global_msg,
+//            err = liblte_rrc_unpack_ul_handover_preparation_transfer_msg(&msg_ptr,
 //                                                                         (LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_INFO_TRANSFER == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_ul_information_transfer_msg(&global_msg,
+            err = liblte_rrc_unpack_ul_information_transfer_msg(&msg_ptr,
                                                                 (LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_COUNTER_CHECK_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK RESPONSE\n");
-//            err = liblte_rrc_unpack_counter_check_response_msg(&global_msg,
+//            err = liblte_rrc_unpack_counter_check_response_msg(&msg_ptr,
 //                                                               (LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_INFO_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UE INFORMATION RESPONSE\n");
-//            err = liblte_rrc_unpack_ue_information_response_msg(&global_msg,
+//            err = liblte_rrc_unpack_ue_information_response_msg(&msg_ptr,
 //                                                                (LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_PROXIMITY_IND == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_proximity_indication_msg(&global_msg,
+            err = liblte_rrc_unpack_proximity_indication_msg(&msg_ptr,
                                                              (LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *)&ul_dcch_msg->msg);
         }else{ // LIBLTE_RRC_UL_DCCH_MSG_TYPE_RN_RECONFIG_COMPLETE == ul_dcch_msg->msg_type
-            err = liblte_rrc_unpack_rn_reconfiguration_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rn_reconfiguration_complete_msg(&msg_ptr,
                                                                     (LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }
         
@@ -14397,3 +14584,32 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        bytes.N_bytes = 0;
+        err           = liblte_rrc_pack_ul_dcch_msg(ul_dcch_msg, &bytes);
+        liblte_unpack(&bytes, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg)
+{
+    LIBLTE_ERROR_ENUM      err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT bytes;
+
+    if(msg != NULL)
+    {
+        liblte_rrc_bit_msg_2_byte_msg(msg, &bytes);
+        err = liblte_rrc_unpack_ul_dcch_msg(&bytes, ul_dcch_msg);
+    }
+
+    return(err);
+}
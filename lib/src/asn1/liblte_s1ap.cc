@@ -43,7 +43,7 @@ static void liblte_log_print(const char *format, ...) {
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
   LIBLTE_S1AP_CRITICALITY_ENUM                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -58,7 +58,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CRITICALITY_ENUM                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -79,7 +79,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
   LIBLTE_S1AP_LOCAL_STRUCT                                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -98,7 +98,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LOCAL_STRUCT                                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -122,7 +122,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -145,7 +145,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -173,7 +173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -192,7 +192,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -215,7 +215,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -230,7 +230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -250,7 +250,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
   LIBLTE_S1AP_PRESENCE_ENUM                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -265,7 +265,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRESENCE_ENUM                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -285,7 +285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -304,7 +304,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -327,7 +327,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -346,7 +346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -369,7 +369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -390,7 +390,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -416,7 +416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -437,7 +437,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -463,7 +463,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -488,7 +488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -519,7 +519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -545,7 +545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -577,7 +577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
 // lb:0, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -603,7 +603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -635,7 +635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
 // lb:None, ub:None
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -669,7 +669,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -707,7 +707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -728,7 +728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -754,7 +754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -775,7 +775,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -802,7 +802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -828,7 +828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -859,7 +859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
   LIBLTE_S1AP_BITRATE_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -883,7 +883,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_BITRATE_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -909,7 +909,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -932,7 +932,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -960,7 +960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -983,7 +983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1011,7 +1011,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1034,7 +1034,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1062,7 +1062,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1071,10 +1071,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
   {
     // Static bit string - CellIdentity
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -1082,7 +1079,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1092,10 +1089,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
   {
     // Static bit string - CellIdentity
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -1107,7 +1101,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1128,17 +1122,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1159,10 +1150,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1173,7 +1161,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1194,17 +1182,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1225,10 +1210,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1239,7 +1221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1262,7 +1244,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1290,7 +1272,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1311,17 +1293,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1342,10 +1321,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1356,7 +1332,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1377,17 +1353,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1408,10 +1381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1422,7 +1392,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
   LIBLTE_S1AP_CNDOMAIN_ENUM                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1437,7 +1407,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CNDOMAIN_ENUM                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1457,7 +1427,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1469,17 +1439,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CORRELATION_ID_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_CORRELATION_ID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1492,10 +1459,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CORRELATION_ID_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_CORRELATION_ID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1506,7 +1470,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1529,7 +1493,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1557,7 +1521,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1580,7 +1544,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1608,7 +1572,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1631,7 +1595,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1659,7 +1623,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1671,17 +1635,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_EMERGENCYAREAID_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_EMERGENCYAREAID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1694,10 +1655,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_EMERGENCYAREAID_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_EMERGENCYAREAID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1709,7 +1667,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
   LIBLTE_S1AP_MACROENB_ID_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1718,10 +1676,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
   {
     // Static bit string - macroENB-ID
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -1729,7 +1684,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MACROENB_ID_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1739,10 +1694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
   {
     // Static bit string - macroENB-ID
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -1756,7 +1708,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1765,10 +1717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
   {
     // Static bit string - homeENB-ID
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_HOMEENB_ID_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_HOMEENB_ID_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -1776,7 +1725,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1786,10 +1735,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
   {
     // Static bit string - homeENB-ID
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_HOMEENB_ID_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_HOMEENB_ID_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -1802,7 +1748,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
   LIBLTE_S1AP_ENB_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1835,7 +1781,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENB_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1873,7 +1819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
   LIBLTE_S1AP_ENBNAME_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1892,17 +1838,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
     liblte_value_2_bits(ie->n_octets-1, ptr, 8);
     liblte_align_up_zero(ptr, 8);
 
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENBNAME_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1922,10 +1865,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
     ie->n_octets = liblte_bits_2_value(ptr, 8) + 1;
     liblte_align_up(ptr, 8);
 
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1936,7 +1876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1951,17 +1891,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
 
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_ENCRYPTIONALGORITHMS_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_ENCRYPTIONALGORITHMS_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1977,10 +1914,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
       return LIBLTE_ERROR_DECODE_FAIL;
     }
 
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_ENCRYPTIONALGORITHMS_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_ENCRYPTIONALGORITHMS_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -1991,7 +1925,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2014,7 +1948,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2042,7 +1976,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2061,7 +1995,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2084,7 +2018,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2107,7 +2041,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2135,7 +2069,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2158,7 +2092,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2186,7 +2120,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
   LIBLTE_S1AP_HFN_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2210,7 +2144,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_HFN_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2236,7 +2170,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
   LIBLTE_S1AP_IMSI_STRUCT                                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2263,17 +2197,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_IMSI_STRUCT                                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2294,10 +2225,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2308,7 +2236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2316,17 +2244,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
      ptr != NULL)
   {
     // Static bit string - InterfacesToTrace
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_INTERFACESTOTRACE_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_INTERFACESTOTRACE_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2335,10 +2260,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
      ptr != NULL)
   {
     // Static bit string - InterfacesToTrace
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_INTERFACESTOTRACE_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_INTERFACESTOTRACE_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2349,7 +2271,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
   LIBLTE_S1AP_LAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2361,17 +2283,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_LAC_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_LAC_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2384,10 +2303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_LAC_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_LAC_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2398,7 +2314,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2419,17 +2335,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2450,10 +2363,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2464,7 +2374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2485,17 +2395,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2516,10 +2423,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2530,7 +2434,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
   LIBLTE_S1AP_LHN_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2551,17 +2455,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LHN_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2582,10 +2483,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2596,7 +2494,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2611,7 +2509,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2631,7 +2529,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2654,7 +2552,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2682,7 +2580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2705,7 +2603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2733,7 +2631,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2756,7 +2654,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2784,7 +2682,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2792,17 +2690,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
      ptr != NULL)
   {
     // Static bit string - MeasurementsToActivate
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2811,10 +2706,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
      ptr != NULL)
   {
     // Static bit string - MeasurementsToActivate
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2825,7 +2717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2833,17 +2725,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
      ptr != NULL)
   {
     // Static bit string - MessageIdentifier
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MESSAGEIDENTIFIER_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MESSAGEIDENTIFIER_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2852,10 +2741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
      ptr != NULL)
   {
     // Static bit string - MessageIdentifier
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MESSAGEIDENTIFIER_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_MESSAGEIDENTIFIER_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2866,7 +2752,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
   LIBLTE_S1AP_MMENAME_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2885,17 +2771,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
     liblte_value_2_bits(ie->n_octets-1, ptr, 8);
     liblte_align_up_zero(ptr, 8);
 
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MMENAME_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2915,10 +2798,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
     ie->n_octets = liblte_bits_2_value(ptr, 8) + 1;
     liblte_align_up(ptr, 8);
 
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2929,7 +2809,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2941,17 +2821,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MME_GROUP_ID_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MME_GROUP_ID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2964,10 +2841,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MME_GROUP_ID_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_MME_GROUP_ID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -2978,7 +2852,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3002,7 +2876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3028,7 +2902,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3049,17 +2923,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3080,10 +2951,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -3094,7 +2962,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
   LIBLTE_S1AP_NAS_PDU_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3115,17 +2983,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_NAS_PDU_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3146,10 +3011,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -3160,7 +3022,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3181,17 +3043,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3212,10 +3071,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -3226,7 +3082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3245,7 +3101,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3268,7 +3124,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3291,7 +3147,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3319,7 +3175,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3342,7 +3198,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3370,7 +3226,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
   LIBLTE_S1AP_PDCP_SN_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3389,7 +3245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PDCP_SN_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3412,7 +3268,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3424,17 +3280,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_PORT_NUMBER_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_PORT_NUMBER_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3447,10 +3300,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_PORT_NUMBER_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_PORT_NUMBER_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -3461,7 +3311,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3476,7 +3326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3496,7 +3346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3519,7 +3369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3547,7 +3397,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3556,10 +3406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
   {
     // Static bit string - ReceiveStatusofULPDCPSDUs
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -3567,7 +3414,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3577,10 +3424,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
   {
     // Static bit string - ReceiveStatusofULPDCPSDUs
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -3592,7 +3436,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3611,7 +3455,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3634,7 +3478,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
   LIBLTE_S1AP_RAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3646,17 +3490,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_RAC_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_RAC_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3669,10 +3510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_RAC_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_RAC_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -3683,7 +3521,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3698,7 +3536,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3718,7 +3556,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3741,7 +3579,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3769,7 +3607,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
   LIBLTE_S1AP_RNC_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3788,7 +3626,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RNC_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3811,7 +3649,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3834,7 +3672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3862,7 +3700,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3881,7 +3719,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3904,7 +3742,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3927,7 +3765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3955,7 +3793,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3976,17 +3814,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4007,10 +3842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4021,7 +3853,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4044,7 +3876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4072,7 +3904,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4093,17 +3925,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4124,10 +3953,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4138,7 +3964,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4157,7 +3983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4180,7 +4006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4203,7 +4029,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4231,7 +4057,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4252,17 +4078,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4283,10 +4106,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4297,7 +4117,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4313,7 +4133,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4334,7 +4154,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4353,7 +4173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4376,7 +4196,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4397,10 +4217,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
     liblte_align_up_zero(ptr, 8);
     
     // Bits
-    uint32_t i;
-    for(i=0;i<ie->n_bits;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, ie->n_bits);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -4408,7 +4225,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4430,10 +4247,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
     liblte_align_up(ptr, 8);
 
     // Bits
-    uint32_t i;
-    for(i=0;i<ie->n_bits;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, ie->n_bits);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -4445,7 +4259,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4468,7 +4282,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4496,7 +4310,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4512,7 +4326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4533,7 +4347,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4554,17 +4368,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4585,10 +4396,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4599,7 +4407,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4611,17 +4419,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_WARNINGTYPE_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_WARNINGTYPE_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4634,10 +4439,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_WARNINGTYPE_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_WARNINGTYPE_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4648,7 +4450,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4669,17 +4471,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4700,10 +4499,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4714,7 +4510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4737,7 +4533,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4765,7 +4561,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4788,7 +4584,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4816,7 +4612,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4839,7 +4635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4867,7 +4663,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4888,17 +4684,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4919,10 +4712,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -4933,7 +4723,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4956,7 +4746,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4984,7 +4774,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
   LIBLTE_S1AP_CI_STRUCT                                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4996,17 +4786,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CI_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_CI_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CI_STRUCT                                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5019,10 +4806,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CI_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_CI_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -5033,7 +4817,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5056,7 +4840,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5084,7 +4868,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5099,7 +4883,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5119,7 +4903,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5127,17 +4911,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
      ptr != NULL)
   {
     // Static bit string - DataCodingScheme
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_DATACODINGSCHEME_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_DATACODINGSCHEME_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5146,10 +4927,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
      ptr != NULL)
   {
     // Static bit string - DataCodingScheme
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_DATACODINGSCHEME_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_DATACODINGSCHEME_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -5161,7 +4939,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5187,7 +4965,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5219,7 +4997,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5245,7 +5023,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5276,7 +5054,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5300,7 +5078,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5326,7 +5104,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5348,7 +5126,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5375,7 +5153,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5413,7 +5191,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5456,7 +5234,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5475,7 +5253,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5499,7 +5277,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
 // lb:1, ub:4096
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5525,7 +5303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5556,7 +5334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
   LIBLTE_S1AP_GTP_TEID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5568,17 +5346,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_GTP_TEID_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_GTP_TEID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GTP_TEID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5591,10 +5366,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_GTP_TEID_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_GTP_TEID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -5605,7 +5377,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5628,7 +5400,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5656,7 +5428,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5679,7 +5451,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5707,7 +5479,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5722,17 +5494,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
 
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5748,10 +5517,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
       return LIBLTE_ERROR_DECODE_FAIL;
     }
 
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -5762,7 +5528,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5788,7 +5554,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5819,7 +5585,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5842,7 +5608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5870,7 +5636,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5885,7 +5651,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5905,7 +5671,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5928,7 +5694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5956,7 +5722,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5979,7 +5745,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6007,7 +5773,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6030,7 +5796,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6058,7 +5824,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6067,10 +5833,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
   {
     // Static bit string - MobilityInformation
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MOBILITYINFORMATION_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MOBILITYINFORMATION_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -6078,7 +5841,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6088,10 +5851,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
   {
     // Static bit string - MobilityInformation
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MOBILITYINFORMATION_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_MOBILITYINFORMATION_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -6103,7 +5863,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
   LIBLTE_S1AP_MME_CODE_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6115,17 +5875,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MME_CODE_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MME_CODE_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MME_CODE_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6138,10 +5895,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MME_CODE_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_MME_CODE_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -6152,7 +5906,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6173,17 +5927,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6204,10 +5955,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -6218,7 +5966,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6237,7 +5985,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6260,7 +6008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6289,7 +6037,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6323,7 +6071,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6342,7 +6090,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6365,7 +6113,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6380,7 +6128,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6400,7 +6148,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
   LIBLTE_S1AP_QCI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6419,7 +6167,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_QCI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6442,7 +6190,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6465,7 +6213,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6493,7 +6241,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6516,7 +6264,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6544,7 +6292,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6565,17 +6313,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6596,10 +6341,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -6610,7 +6352,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6629,7 +6371,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6652,7 +6394,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
   LIBLTE_S1AP_SECURITYKEY_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6661,10 +6403,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
   {
     // Static bit string - SecurityKey
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -6672,7 +6411,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SECURITYKEY_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6682,10 +6421,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
   {
     // Static bit string - SecurityKey
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -6697,7 +6433,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6705,17 +6441,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
      ptr != NULL)
   {
     // Static bit string - SerialNumber
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_SERIALNUMBER_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_SERIALNUMBER_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6724,10 +6457,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
      ptr != NULL)
   {
     // Static bit string - SerialNumber
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_SERIALNUMBER_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_SERIALNUMBER_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -6738,7 +6468,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6759,17 +6489,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6790,10 +6517,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -6804,7 +6528,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6827,7 +6551,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6856,7 +6580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6882,7 +6606,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6913,7 +6637,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6935,7 +6659,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6962,7 +6686,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
   LIBLTE_S1AP_TAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6974,17 +6698,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_TAC_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_TAC_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6997,10 +6718,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_TAC_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_TAC_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7012,7 +6730,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7038,7 +6756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7069,7 +6787,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
   LIBLTE_S1AP_TBCD_STRING_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7081,17 +6799,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_TBCD_STRING_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_TBCD_STRING_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TBCD_STRING_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7104,10 +6819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_TBCD_STRING_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_TBCD_STRING_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7118,7 +6830,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7139,17 +6851,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7170,10 +6879,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7184,7 +6890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7200,7 +6906,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7221,7 +6927,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7240,7 +6946,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7263,7 +6969,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7275,17 +6981,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_E_UTRAN_TRACE_ID_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_E_UTRAN_TRACE_ID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7298,10 +7001,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_E_UTRAN_TRACE_ID_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_E_UTRAN_TRACE_ID_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7312,7 +7012,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7335,7 +7035,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7363,7 +7063,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7398,7 +7098,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7438,7 +7138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7473,7 +7173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7513,7 +7213,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7521,17 +7221,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
      ptr != NULL)
   {
     // Static bit string - UEIdentityIndexValue
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7540,10 +7237,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
      ptr != NULL)
   {
     // Static bit string - UEIdentityIndexValue
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7554,7 +7248,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7589,7 +7283,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7629,7 +7323,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7652,7 +7346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7680,7 +7374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7692,17 +7386,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_WARNINGSECURITYINFO_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_WARNINGSECURITYINFO_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7715,10 +7406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_WARNINGSECURITYINFO_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_WARNINGSECURITYINFO_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7730,7 +7418,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7756,7 +7444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7787,7 +7475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7810,7 +7498,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7838,7 +7526,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7861,7 +7549,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7889,7 +7577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7910,17 +7598,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7941,10 +7626,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -7955,7 +7637,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7970,7 +7652,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7990,7 +7672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8025,7 +7707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8065,7 +7747,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8103,7 +7785,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8147,7 +7829,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
 // lb:1, ub:2
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8173,7 +7855,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8204,7 +7886,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8228,7 +7910,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8255,7 +7937,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
 // lb:1, ub:4096
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8281,7 +7963,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8312,7 +7994,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8355,7 +8037,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8403,7 +8085,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8427,7 +8109,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8453,7 +8135,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8468,7 +8150,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8488,7 +8170,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8509,17 +8191,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8540,10 +8219,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -8554,7 +8230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8585,7 +8261,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8621,7 +8297,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8656,7 +8332,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8696,7 +8372,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8729,7 +8405,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8767,7 +8443,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
   LIBLTE_S1AP_M_TMSI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8779,17 +8455,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_M_TMSI_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_M_TMSI_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M_TMSI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8802,10 +8475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_M_TMSI_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_M_TMSI_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -8816,7 +8486,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8837,17 +8507,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8868,10 +8535,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -8882,7 +8546,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8894,17 +8558,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
       liblte_align_up_zero(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_PLMNIDENTITY_OCTET_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, LIBLTE_S1AP_PLMNIDENTITY_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8917,10 +8578,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
       liblte_align_up(ptr, 8);
     }
     // Octets
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_PLMNIDENTITY_OCTET_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, LIBLTE_S1AP_PLMNIDENTITY_OCTET_STRING_LEN*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -8931,7 +8589,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8945,10 +8603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
     liblte_align_up_zero(ptr, 8);
     
     // Bits
-    uint32_t i;
-    for(i=0;i<ie->n_bits;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, ie->n_bits);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -8956,7 +8611,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8971,10 +8626,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
     liblte_align_up(ptr, 8);
 
     // Bits
-    uint32_t i;
-    for(i=0;i<ie->n_bits;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, ie->n_bits);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -8986,7 +8638,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9021,7 +8673,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9061,7 +8713,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9082,17 +8734,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9113,10 +8762,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -9128,7 +8774,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9144,7 +8790,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9166,7 +8812,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9201,7 +8847,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9242,7 +8888,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9268,7 +8914,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9299,7 +8945,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9334,7 +8980,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9374,7 +9020,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
   LIBLTE_S1AP_TAI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9409,7 +9055,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9449,7 +9095,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9480,7 +9126,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9516,7 +9162,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9547,7 +9193,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9583,7 +9229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9614,7 +9260,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9650,7 +9296,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9678,7 +9324,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9711,7 +9357,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9749,7 +9395,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9792,7 +9438,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9825,7 +9471,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9863,7 +9509,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9904,7 +9550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9951,7 +9597,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
 // lb:1, ub:6
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
   LIBLTE_S1AP_BPLMNS_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9977,7 +9623,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_BPLMNS_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10008,7 +9654,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
   LIBLTE_S1AP_CAUSE_STRUCT                                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10053,7 +9699,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CAUSE_STRUCT                                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10103,7 +9749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10142,7 +9788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10186,7 +9832,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
   LIBLTE_S1AP_CGI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10232,7 +9878,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CGI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10283,7 +9929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10318,7 +9964,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10359,7 +10005,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10385,7 +10031,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10416,7 +10062,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10451,7 +10097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10492,7 +10138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
 // lb:1, ub:15
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
   LIBLTE_S1AP_EPLMNS_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10518,7 +10164,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EPLMNS_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10549,7 +10195,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_E_RABITEM_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10584,7 +10230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABITEM_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10624,7 +10270,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10659,7 +10305,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10699,7 +10345,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10734,7 +10380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10774,7 +10420,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10809,7 +10455,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10849,7 +10495,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
   LIBLTE_S1AP_LAI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10884,7 +10530,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LAI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10924,7 +10570,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10959,7 +10605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11000,7 +10646,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11026,7 +10672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11057,7 +10703,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11080,7 +10726,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11108,7 +10754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11131,7 +10777,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11159,7 +10805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11175,7 +10821,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11197,7 +10843,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11223,7 +10869,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11254,7 +10900,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11282,7 +10928,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11316,7 +10962,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
 // lb:1, ub:32
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11342,7 +10988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11373,7 +11019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11408,7 +11054,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11449,7 +11095,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11475,7 +11121,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11506,7 +11152,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11537,7 +11183,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11573,7 +11219,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11608,7 +11254,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11648,7 +11294,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11669,17 +11315,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11700,10 +11343,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -11715,7 +11355,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
 // lb:1, ub:2048
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11741,7 +11381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11772,7 +11412,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11807,7 +11447,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11848,7 +11488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11874,7 +11514,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11905,7 +11545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11942,7 +11582,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11984,7 +11624,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12019,7 +11659,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12059,7 +11699,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12094,7 +11734,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12134,7 +11774,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12165,7 +11805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12201,7 +11841,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12236,7 +11876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12277,7 +11917,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
 // lb:1, ub:32
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12303,7 +11943,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12334,7 +11974,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
   LIBLTE_S1AP_CSG_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12343,10 +11983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
   {
     // Static bit string - CSG-Id
     liblte_align_up_zero(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CSG_ID_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_CSG_ID_BIT_STRING_LEN);
     liblte_align_up_zero(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -12354,7 +11991,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CSG_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12364,10 +12001,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
   {
     // Static bit string - CSG-Id
     liblte_align_up(ptr, 8);
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_CSG_ID_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_CSG_ID_BIT_STRING_LEN);
     liblte_align_up(ptr, 8);
     err = LIBLTE_SUCCESS;
   }
@@ -12379,7 +12013,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12410,7 +12044,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12446,7 +12080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12469,7 +12103,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12497,7 +12131,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12528,7 +12162,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12565,7 +12199,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12581,26 +12215,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabinformationlistitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABINFORMATIONLISTITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -12608,7 +12241,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12651,7 +12284,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12677,7 +12310,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12708,7 +12341,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
   LIBLTE_S1AP_GUMMEI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12747,7 +12380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GUMMEI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12791,7 +12424,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12824,7 +12457,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12862,7 +12495,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12883,17 +12516,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12914,10 +12544,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -12928,7 +12555,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12943,7 +12570,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12963,7 +12590,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13002,7 +12629,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13046,7 +12673,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
   LIBLTE_S1AP_S_TMSI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13081,7 +12708,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_S_TMSI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13122,7 +12749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13148,7 +12775,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13180,7 +12807,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13206,7 +12833,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13237,7 +12864,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13286,7 +12913,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13340,7 +12967,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13381,7 +13008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13427,7 +13054,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13460,7 +13087,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13498,7 +13125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13544,7 +13171,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13596,7 +13223,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13622,7 +13249,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13654,7 +13281,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13680,7 +13307,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13711,7 +13338,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13742,7 +13369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13779,7 +13406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13805,7 +13432,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13837,7 +13464,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
   LIBLTE_S1AP_ECGILIST_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13863,7 +13490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ECGILIST_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13894,7 +13521,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13929,7 +13556,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13969,7 +13596,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14008,7 +13635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14053,7 +13680,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
   LIBLTE_S1AP_E_RABLIST_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14069,26 +13696,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -14096,7 +13722,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABLIST_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14139,7 +13765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14165,7 +13791,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14196,7 +13822,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14204,17 +13830,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
      ptr != NULL)
   {
     // Static bit string - MDT-Location-Info
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MDT_LOCATION_INFO_BIT_STRING_LEN;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 1);
-    }
+    liblte_bit_array_2_bits(ie->buffer, ptr, LIBLTE_S1AP_MDT_LOCATION_INFO_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14223,10 +13846,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
      ptr != NULL)
   {
     // Static bit string - MDT-Location-Info
-    uint32_t i;
-    for(i=0;i<LIBLTE_S1AP_MDT_LOCATION_INFO_BIT_STRING_LEN;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 1);
-    }
+    liblte_bits_2_bit_array(ptr, ie->buffer, LIBLTE_S1AP_MDT_LOCATION_INFO_BIT_STRING_LEN);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -14237,7 +13857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14270,7 +13890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14309,7 +13929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14330,17 +13950,14 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
     }
     
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      liblte_value_2_bits(ie->buffer[i], ptr, 8);
-    }
+    liblte_bytes_2_bits(ie->buffer, ptr, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14361,10 +13978,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
     }
 
     // Octets
-    uint32_t i;
-    for(i=0;i<ie->n_octets;i++) {
-      ie->buffer[i] = liblte_bits_2_value(ptr, 8);
-    }
+    liblte_bits_2_bytes(ptr, ie->buffer, ie->n_octets*8);
     err = LIBLTE_SUCCESS;
   }
   return err;
@@ -14376,7 +13990,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14413,7 +14027,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14456,7 +14070,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14482,7 +14096,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14513,7 +14127,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14544,7 +14158,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14580,7 +14194,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14615,7 +14229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14655,7 +14269,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
   LIBLTE_S1AP_TARGETID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14692,7 +14306,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TARGETID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14734,7 +14348,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14771,7 +14385,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14813,7 +14427,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14851,7 +14465,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14895,7 +14509,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14921,7 +14535,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14952,7 +14566,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
   LIBLTE_S1AP_CELLTYPE_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14983,7 +14597,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLTYPE_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15020,7 +14634,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15046,7 +14660,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15078,7 +14692,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15104,7 +14718,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15135,7 +14749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15177,7 +14791,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15224,7 +14838,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15263,7 +14877,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15307,7 +14921,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15345,7 +14959,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15389,7 +15003,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15415,7 +15029,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15446,7 +15060,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15481,7 +15095,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15521,7 +15135,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15552,7 +15166,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15589,7 +15203,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15605,26 +15219,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_bearers_subjecttostatustransfer_item(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -15632,7 +15245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15675,7 +15288,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15701,7 +15314,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15733,7 +15346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15759,7 +15372,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15790,7 +15403,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15849,7 +15462,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15913,7 +15526,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15950,7 +15563,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15992,7 +15605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16026,7 +15639,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16066,7 +15679,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16092,7 +15705,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16123,7 +15736,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16146,7 +15759,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16175,7 +15788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16201,7 +15814,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16232,7 +15845,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16285,7 +15898,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16343,7 +15956,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16378,7 +15991,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16418,7 +16031,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16467,7 +16080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16521,7 +16134,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
   LIBLTE_S1AP_MDTMODE_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16554,7 +16167,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MDTMODE_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16592,7 +16205,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16645,7 +16258,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16704,7 +16317,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16730,7 +16343,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16761,7 +16374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16800,7 +16413,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16845,7 +16458,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16871,7 +16484,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16902,7 +16515,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16939,7 +16552,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16981,7 +16594,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17012,7 +16625,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17048,7 +16661,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17091,7 +16704,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17139,7 +16752,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17176,7 +16789,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17218,7 +16831,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
   LIBLTE_S1AP_SONINFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17251,7 +16864,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SONINFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17289,7 +16902,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17328,7 +16941,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17372,7 +16985,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17395,7 +17008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17423,7 +17036,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17452,7 +17065,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17487,7 +17100,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17513,7 +17126,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17544,7 +17157,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17603,7 +17216,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17667,7 +17280,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17710,7 +17323,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17758,7 +17371,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17825,7 +17438,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17897,7 +17510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17932,7 +17545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17972,7 +17585,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18011,7 +17624,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18055,7 +17668,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18094,7 +17707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18138,7 +17751,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18185,7 +17798,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18237,7 +17850,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18276,7 +17889,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18320,7 +17933,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18359,7 +17972,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18403,7 +18016,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18434,7 +18047,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18470,7 +18083,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18501,7 +18114,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18537,7 +18150,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18587,7 +18200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18642,7 +18255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18681,7 +18294,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18725,7 +18338,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_TAIITEM_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18756,7 +18369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAIITEM_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18793,7 +18406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18809,26 +18422,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -18836,7 +18448,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18879,7 +18491,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18895,26 +18507,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -18922,7 +18533,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18964,7 +18575,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18988,7 +18599,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19017,7 +18628,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
   LIBLTE_S1AP_RESETTYPE_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19050,7 +18661,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_RESETTYPE_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19089,7 +18700,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19105,26 +18716,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabdataforwardingitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABDATAFORWARDINGITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19132,7 +18742,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19175,7 +18785,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19191,26 +18801,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobesetupitemhoreq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMHOREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19218,7 +18827,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19261,7 +18870,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19277,26 +18886,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabadmitteditem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABADMITTEDITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19304,7 +18912,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19347,7 +18955,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19363,26 +18971,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobeswitcheddlitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDDLITEM,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19390,7 +18997,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19433,7 +19040,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19449,26 +19056,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobeswitchedulitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDULITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19476,7 +19082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19519,7 +19125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19535,26 +19141,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobesetupitembearersureq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMBEARERSUREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19562,7 +19167,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19605,7 +19210,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19621,26 +19226,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsetupitembearersures(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABSETUPITEMBEARERSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19648,7 +19252,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19691,7 +19295,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19707,26 +19311,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBEMODIFIEDITEMBEARERMODREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19734,7 +19337,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19777,7 +19380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19793,26 +19396,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabmodifyitembearermodres(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABMODIFYITEMBEARERMODRES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19820,7 +19422,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19863,7 +19465,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19879,26 +19481,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABRELEASEITEMBEARERRELCOMP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19906,7 +19507,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19949,7 +19550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19965,26 +19566,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMCTXTSUREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19992,7 +19592,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20035,7 +19635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20051,26 +19651,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsetupitemctxtsures(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABSETUPITEMCTXTSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -20078,7 +19677,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20121,7 +19720,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
   LIBLTE_S1AP_TAILIST_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20137,26 +19736,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_taiitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TAIITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -20164,7 +19762,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_TAILIST_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20207,7 +19805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20223,26 +19821,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPITEMHOREQACK,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -20250,7 +19847,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20292,7 +19889,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20313,8 +19910,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20322,7 +19919,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20360,7 +19957,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20381,8 +19978,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20390,7 +19987,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20428,7 +20025,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20449,8 +20046,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20458,7 +20055,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20496,7 +20093,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20517,8 +20114,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20526,7 +20123,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20564,7 +20161,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20585,8 +20182,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20594,7 +20191,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20632,7 +20229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20653,8 +20250,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20662,7 +20259,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20700,7 +20297,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20721,8 +20318,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20730,7 +20327,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20768,7 +20365,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20789,8 +20386,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20798,7 +20395,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20836,7 +20433,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20857,8 +20454,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20866,7 +20463,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20904,7 +20501,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20925,8 +20522,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20934,7 +20531,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20972,7 +20569,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20993,8 +20590,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21002,7 +20599,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21040,7 +20637,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21061,8 +20658,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21070,7 +20667,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21108,7 +20705,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21129,8 +20726,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21138,7 +20735,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21176,7 +20773,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21197,8 +20794,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21206,7 +20803,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21244,7 +20841,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21265,8 +20862,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21274,7 +20871,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21312,7 +20909,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21333,8 +20930,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21342,7 +20939,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21380,7 +20977,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21401,8 +20998,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21410,7 +21007,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21448,7 +21045,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21469,8 +21066,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21478,7 +21075,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21516,7 +21113,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21537,8 +21134,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21546,7 +21143,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21584,7 +21181,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21605,8 +21202,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21614,7 +21211,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21652,7 +21249,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21673,8 +21270,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21682,7 +21279,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21720,7 +21317,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21741,8 +21338,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21750,7 +21347,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21788,7 +21385,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21809,8 +21406,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21818,7 +21415,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21856,7 +21453,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21877,8 +21474,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21886,7 +21483,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21924,7 +21521,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21945,8 +21542,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21954,7 +21551,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21992,7 +21589,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22013,8 +21610,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22022,7 +21619,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22060,7 +21657,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22081,8 +21678,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22090,7 +21687,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22128,7 +21725,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22149,8 +21746,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22158,7 +21755,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22196,7 +21793,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22217,8 +21814,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22226,7 +21823,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22264,7 +21861,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22285,8 +21882,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22294,7 +21891,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22332,7 +21929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22353,8 +21950,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22362,7 +21959,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22400,7 +21997,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22421,8 +22018,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22430,7 +22027,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22468,7 +22065,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22489,8 +22086,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22498,7 +22095,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22536,7 +22133,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22557,8 +22154,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22566,7 +22163,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22604,7 +22201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22625,8 +22222,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22634,7 +22231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22672,7 +22269,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22693,8 +22290,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22702,7 +22299,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22740,7 +22337,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22761,8 +22358,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22770,7 +22367,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22808,7 +22405,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22829,8 +22426,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22838,7 +22435,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22876,7 +22473,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22897,8 +22494,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22906,7 +22503,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22944,7 +22541,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22965,8 +22562,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22974,7 +22571,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23012,7 +22609,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23033,8 +22630,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23042,7 +22639,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23080,7 +22677,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23101,8 +22698,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23110,7 +22707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23148,7 +22745,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23169,8 +22766,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23178,7 +22775,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23216,7 +22813,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23237,8 +22834,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23246,7 +22843,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23284,7 +22881,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23305,8 +22902,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23314,7 +22911,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23352,7 +22949,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23373,8 +22970,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23382,7 +22979,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23420,7 +23017,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23441,8 +23038,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23450,7 +23047,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23488,7 +23085,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23509,8 +23106,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23518,7 +23115,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23556,7 +23153,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23577,8 +23174,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23586,7 +23183,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23624,7 +23221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23645,8 +23242,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23654,7 +23251,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23692,7 +23289,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23713,8 +23310,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23722,7 +23319,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23760,7 +23357,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23781,8 +23378,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ex
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23790,7 +23387,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ex
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23828,7 +23425,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23849,8 +23446,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23858,7 +23455,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23896,7 +23493,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23917,8 +23514,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23926,7 +23523,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23964,7 +23561,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23985,8 +23582,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23994,7 +23591,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24032,7 +23629,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24053,8 +23650,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24062,7 +23659,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24100,7 +23697,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24121,8 +23718,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24130,7 +23727,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24168,7 +23765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24189,8 +23786,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24198,7 +23795,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24236,7 +23833,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24257,8 +23854,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24266,7 +23863,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24304,7 +23901,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24325,8 +23922,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24334,7 +23931,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24372,7 +23969,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24395,26 +23992,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MobilityInformation
     if(msg->MobilityInformation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mobilityinformation(&msg->MobilityInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MOBILITYINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24423,7 +24019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24475,7 +24071,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24496,25 +24092,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABInformationListItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabinformationlistitem(&msg->E_RABInformationListItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABINFORMATIONLISTITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -24522,7 +24117,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24572,7 +24167,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24597,45 +24192,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Time_UE_StayedInCell_EnhancedGranularity
     if(msg->Time_UE_StayedInCell_EnhancedGranularity_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(&msg->Time_UE_StayedInCell_EnhancedGranularity, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - HO_Cause
     if(msg->HO_Cause_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cause(&msg->HO_Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_HO_CAUSE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24644,7 +24237,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24703,7 +24296,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24726,26 +24319,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Time_Synchronization_Info
     if(msg->Time_Synchronization_Info_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timesynchronizationinfo(&msg->Time_Synchronization_Info, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TIME_SYNCHRONIZATION_INFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24754,7 +24346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24806,7 +24398,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24833,64 +24425,61 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - ULCOUNTValueExtended
     if(msg->ULCOUNTValueExtended_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_countvalueextended(&msg->ULCOUNTValueExtended, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ULCOUNTVALUEEXTENDED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - DLCOUNTValueExtended
     if(msg->DLCOUNTValueExtended_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_countvalueextended(&msg->DLCOUNTValueExtended, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_DLCOUNTVALUEEXTENDED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ReceiveStatusOfULPDCPSDUsExtended
     if(msg->ReceiveStatusOfULPDCPSDUsExtended_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_receivestatusofulpdcpsdusextended(&msg->ReceiveStatusOfULPDCPSDUsExtended, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_RECEIVESTATUSOFULPDCPSDUSEXTENDED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24899,7 +24488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24965,7 +24554,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24986,25 +24575,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabitem(&msg->E_RABItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -25012,7 +24600,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25062,7 +24650,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25085,26 +24673,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - SignallingBasedMDTPLMNList
     if(msg->SignallingBasedMDTPLMNList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdtplmnlist(&msg->SignallingBasedMDTPLMNList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SIGNALLINGBASEDMDTPLMNLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25113,7 +24700,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25165,7 +24752,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25188,26 +24775,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - eNBX2ExtendedTransportLayerAddresses
     if(msg->eNBX2ExtendedTransportLayerAddresses_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enbx2exttlas(&msg->eNBX2ExtendedTransportLayerAddresses, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ENBX2EXTENDEDTRANSPORTLAYERADDRESSES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25216,7 +24802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25268,7 +24854,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25289,25 +24875,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Bearers_SubjectToStatusTransfer_Item
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_bearers_subjecttostatustransfer_item(&msg->Bearers_SubjectToStatusTransfer_Item, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -25315,7 +24900,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25365,7 +24950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25394,83 +24979,79 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - M3Configuration
     if(msg->M3Configuration_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_m3configuration(&msg->M3Configuration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_M3CONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - M4Configuration
     if(msg->M4Configuration_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_m4configuration(&msg->M4Configuration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_M4CONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - M5Configuration
     if(msg->M5Configuration_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_m5configuration(&msg->M5Configuration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_M5CONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - MDT_Location_Info
     if(msg->MDT_Location_Info_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdt_location_info(&msg->MDT_Location_Info, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MDT_LOCATION_INFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25479,7 +25060,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25549,7 +25130,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25572,26 +25153,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - x2TNLConfigurationInfo
     if(msg->x2TNLConfigurationInfo_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_x2tnlconfigurationinfo(&msg->x2TNLConfigurationInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_X2TNLCONFIGURATIONINFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25600,7 +25180,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25651,7 +25231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25674,26 +25254,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MDTConfiguration
     if(msg->MDTConfiguration_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdt_configuration(&msg->MDTConfiguration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MDTCONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25702,7 +25281,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25754,7 +25333,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25791,261 +25370,247 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - HandoverType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_handovertype(&msg->HandoverType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_HANDOVERTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TargetID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_targetid(&msg->TargetID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TARGETID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Direct_Forwarding_Path_Availability
     if(msg->Direct_Forwarding_Path_Availability_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_direct_forwarding_path_availability(&msg->Direct_Forwarding_Path_Availability, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_DIRECT_FORWARDING_PATH_AVAILABILITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SRVCCHOIndication
     if(msg->SRVCCHOIndication_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_srvcchoindication(&msg->SRVCCHOIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SRVCCHOINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - Source_ToTarget_TransparentContainer
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_source_totarget_transparentcontainer(&msg->Source_ToTarget_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SOURCE_TOTARGET_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Source_ToTarget_TransparentContainer_Secondary
     if(msg->Source_ToTarget_TransparentContainer_Secondary_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_source_totarget_transparentcontainer(&msg->Source_ToTarget_TransparentContainer_Secondary, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SOURCE_TOTARGET_TRANSPARENTCONTAINER_SECONDARY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - MSClassmark2
     if(msg->MSClassmark2_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_msclassmark2(&msg->MSClassmark2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MSCLASSMARK2,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - MSClassmark3
     if(msg->MSClassmark3_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_msclassmark3(&msg->MSClassmark3, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MSCLASSMARK3,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - PS_ServiceNotAvailable
     if(msg->PS_ServiceNotAvailable_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ps_servicenotavailable(&msg->PS_ServiceNotAvailable, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_PS_SERVICENOTAVAILABLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26054,7 +25619,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26183,7 +25748,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26204,8 +25769,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26213,7 +25778,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26251,7 +25816,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26274,77 +25839,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26353,7 +25914,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26420,7 +25981,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26443,26 +26004,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Data_Forwarding_Not_Possible
     if(msg->Data_Forwarding_Not_Possible_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_data_forwarding_not_possible(&msg->Data_Forwarding_Not_Possible, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_DATA_FORWARDING_NOT_POSSIBLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26471,7 +26031,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26523,7 +26083,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26544,8 +26104,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26553,7 +26113,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26591,7 +26151,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26612,8 +26172,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26621,7 +26181,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26659,7 +26219,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26682,60 +26242,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26744,7 +26301,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26806,7 +26363,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26831,113 +26388,107 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Tunnel_Information_for_BBF
     if(msg->Tunnel_Information_for_BBF_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_tunnelinformation(&msg->Tunnel_Information_for_BBF, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TUNNEL_INFORMATION_FOR_BBF,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26946,7 +26497,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27025,7 +26576,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27046,8 +26597,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27055,7 +26606,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27093,7 +26644,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27114,8 +26665,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27123,7 +26674,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27161,7 +26712,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27184,77 +26735,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27263,7 +26810,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27330,7 +26877,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27351,59 +26898,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -27411,7 +26955,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27471,7 +27015,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27494,60 +27038,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27556,7 +27097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27618,7 +27159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27643,45 +27184,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Correlation_ID
     if(msg->Correlation_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SIPTO_Correlation_ID
     if(msg->SIPTO_Correlation_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->SIPTO_Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SIPTO_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27690,7 +27229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27749,7 +27288,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27770,8 +27309,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27779,7 +27318,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27817,7 +27356,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27840,26 +27379,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - TransportInformation
     if(msg->TransportInformation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportinformation(&msg->TransportInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TRANSPORTINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27868,7 +27406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27920,7 +27458,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27941,8 +27479,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27950,7 +27488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27988,7 +27526,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28013,96 +27551,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABToBeReleasedList
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rablist(&msg->E_RABToBeReleasedList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBERELEASEDLIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NAS_PDU
     if(msg->NAS_PDU_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_NAS_PDU,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28111,7 +27644,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28185,7 +27718,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28206,8 +27739,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28215,7 +27748,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28253,7 +27786,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28276,77 +27809,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABReleasedList
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rablist(&msg->E_RABReleasedList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABRELEASEDLIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UserLocationInformation
     if(msg->UserLocationInformation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_userlocationinformation(&msg->UserLocationInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_USERLOCATIONINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28355,7 +27884,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28422,7 +27951,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28447,45 +27976,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Correlation_ID
     if(msg->Correlation_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SIPTO_Correlation_ID
     if(msg->SIPTO_Correlation_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->SIPTO_Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SIPTO_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28494,7 +28021,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28553,7 +28080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28574,8 +28101,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28583,7 +28110,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28621,7 +28148,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28644,77 +28171,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28723,7 +28246,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28790,7 +28313,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28811,8 +28334,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28820,7 +28343,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28858,7 +28381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28881,77 +28404,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - GWContextReleaseIndication
     if(msg->GWContextReleaseIndication_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gwcontextreleaseindication(&msg->GWContextReleaseIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GWCONTEXTRELEASEINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28960,7 +28479,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29027,7 +28546,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29048,42 +28567,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - UE_S1AP_IDs
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ue_s1ap_ids(&msg->UE_S1AP_IDs, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UE_S1AP_IDS,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -29091,7 +28608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29146,7 +28663,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29171,79 +28688,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - UserLocationInformation
     if(msg->UserLocationInformation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_userlocationinformation(&msg->UserLocationInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_USERLOCATIONINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29252,7 +28765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29321,7 +28834,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29358,193 +28871,183 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SecurityKey
     if(msg->SecurityKey_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_securitykey(&msg->SecurityKey, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SECURITYKEY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SubscriberProfileIDforRFP
     if(msg->SubscriberProfileIDforRFP_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_subscriberprofileidforrfp(&msg->SubscriberProfileIDforRFP, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SUBSCRIBERPROFILEIDFORRFP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSFallbackIndicator
     if(msg->CSFallbackIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csfallbackindicator(&msg->CSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - UESecurityCapabilities
     if(msg->UESecurityCapabilities_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - RegisteredLAI
     if(msg->RegisteredLAI_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lai(&msg->RegisteredLAI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_REGISTEREDLAI,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - AdditionalCSFallbackIndicator
     if(msg->AdditionalCSFallbackIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_additionalcsfallbackindicator(&msg->AdditionalCSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ADDITIONALCSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29553,7 +29056,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29663,7 +29166,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29686,60 +29189,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29748,7 +29248,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29810,7 +29310,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29833,77 +29333,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29912,7 +29408,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29979,7 +29475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30002,60 +29498,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UERadioCapability
     if(msg->UERadioCapability_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueradiocapability(&msg->UERadioCapability, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UERADIOCAPABILITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30064,7 +29557,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30126,7 +29619,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30149,77 +29642,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - VoiceSupportMatchIndicator
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_voicesupportmatchindicator(&msg->VoiceSupportMatchIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_VOICESUPPORTMATCHINDICATOR,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30228,7 +29717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30295,7 +29784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30320,96 +29809,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NAS_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - HandoverRestrictionList
     if(msg->HandoverRestrictionList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_handoverrestrictionlist(&msg->HandoverRestrictionList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_HANDOVERRESTRICTIONLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SubscriberProfileIDforRFP
     if(msg->SubscriberProfileIDforRFP_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_subscriberprofileidforrfp(&msg->SubscriberProfileIDforRFP, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SUBSCRIBERPROFILEIDFORRFP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30418,7 +29902,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30492,7 +29976,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30533,282 +30017,267 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NAS_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - RRC_Establishment_Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_rrc_establishment_cause(&msg->RRC_Establishment_Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_RRC_ESTABLISHMENT_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - S_TMSI
     if(msg->S_TMSI_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_s_tmsi(&msg->S_TMSI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_S_TMSI,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - GUMMEI_ID
     if(msg->GUMMEI_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->GUMMEI_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GUMMEI_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - GW_TransportLayerAddress
     if(msg->GW_TransportLayerAddress_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - RelayNode_Indicator
     if(msg->RelayNode_Indicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_relaynode_indicator(&msg->RelayNode_Indicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_RELAYNODE_INDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - GUMMEIType
     if(msg->GUMMEIType_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummeitype(&msg->GUMMEIType, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GUMMEITYPE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - Tunnel_Information_for_BBF
     if(msg->Tunnel_Information_for_BBF_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_tunnelinformation(&msg->Tunnel_Information_for_BBF, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TUNNEL_INFORMATION_FOR_BBF,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SIPTO_L_GW_TransportLayerAddress
     if(msg->SIPTO_L_GW_TransportLayerAddress_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->SIPTO_L_GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SIPTO_L_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30817,7 +30286,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30957,7 +30426,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30984,149 +30453,141 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NAS_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - GW_TransportLayerAddress
     if(msg->GW_TransportLayerAddress_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SIPTO_L_GW_TransportLayerAddress
     if(msg->SIPTO_L_GW_TransportLayerAddress_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->SIPTO_L_GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SIPTO_L_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -31135,7 +30596,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31226,7 +30687,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31247,76 +30708,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NAS_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -31324,7 +30781,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31389,7 +30846,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31410,25 +30867,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&msg->UE_associatedLogicalS1_ConnectionItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -31436,7 +30892,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31486,7 +30942,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31507,25 +30963,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&msg->UE_associatedLogicalS1_ConnectionItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -31533,7 +30988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31583,7 +31038,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31612,83 +31067,79 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     if(msg->MME_UE_S1AP_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - eNB_UE_S1AP_ID
     if(msg->eNB_UE_S1AP_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - Cause
     if(msg->Cause_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CAUSE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -31697,7 +31148,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31770,7 +31221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31795,96 +31246,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Global_ENB_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_global_enb_id(&msg->Global_ENB_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_GLOBAL_ENB_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNBname
     if(msg->eNBname_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enbname(&msg->eNBname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ENBNAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SupportedTAs
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_supportedtas(&msg->SupportedTAs, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SUPPORTEDTAS,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - DefaultPagingDRX
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_pagingdrx(&msg->DefaultPagingDRX, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_DEFAULTPAGINGDRX,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CSG_IdList
     if(msg->CSG_IdList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_idlist(&msg->CSG_IdList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_IDLIST,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -31893,7 +31339,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31967,7 +31413,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31994,98 +31440,93 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MMEname
     if(msg->MMEname_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mmename(&msg->MMEname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MMENAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ServedGUMMEIs
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_servedgummeis(&msg->ServedGUMMEIs, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SERVEDGUMMEIS,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - RelativeMMECapacity
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_relativemmecapacity(&msg->RelativeMMECapacity, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_RELATIVEMMECAPACITY,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - MMERelaySupportIndicator
     if(msg->MMERelaySupportIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mmerelaysupportindicator(&msg->MMERelaySupportIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MMERELAYSUPPORTINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32094,7 +31535,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32170,7 +31611,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32195,62 +31636,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TimeToWait
     if(msg->TimeToWait_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timetowait(&msg->TimeToWait, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TIMETOWAIT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32259,7 +31697,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32323,7 +31761,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32352,83 +31790,79 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - eNBname
     if(msg->eNBname_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enbname(&msg->eNBname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ENBNAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SupportedTAs
     if(msg->SupportedTAs_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_supportedtas(&msg->SupportedTAs, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SUPPORTEDTAS,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSG_IdList
     if(msg->CSG_IdList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_idlist(&msg->CSG_IdList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_IDLIST,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - DefaultPagingDRX
     if(msg->DefaultPagingDRX_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_pagingdrx(&msg->DefaultPagingDRX, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_DEFAULTPAGINGDRX,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32437,7 +31871,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32510,7 +31944,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32533,26 +31967,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32561,7 +31994,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32613,7 +32046,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32638,62 +32071,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TimeToWait
     if(msg->TimeToWait_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timetowait(&msg->TimeToWait, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TIMETOWAIT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32702,7 +32132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32766,7 +32196,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32793,64 +32223,61 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MMEname
     if(msg->MMEname_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mmename(&msg->MMEname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MMENAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ServedGUMMEIs
     if(msg->ServedGUMMEIs_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_servedgummeis(&msg->ServedGUMMEIs, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SERVEDGUMMEIS,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - RelativeMMECapacity
     if(msg->RelativeMMECapacity_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_relativemmecapacity(&msg->RelativeMMECapacity, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_RELATIVEMMECAPACITY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32859,7 +32286,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32925,7 +32352,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32948,26 +32375,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32976,7 +32402,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33028,7 +32454,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33053,62 +32479,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TimeToWait
     if(msg->TimeToWait_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timetowait(&msg->TimeToWait, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TIMETOWAIT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -33117,7 +32540,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33181,7 +32604,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33210,168 +32633,159 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - cdma2000RATType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000rattype(&msg->cdma2000RATType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CDMA2000RATTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - cdma2000SectorID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000sectorid(&msg->cdma2000SectorID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CDMA2000SECTORID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - cdma2000HORequiredIndication
     if(msg->cdma2000HORequiredIndication_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000horequiredindication(&msg->cdma2000HORequiredIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CDMA2000HOREQUIREDINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - cdma2000OneXSRVCCInfo
     if(msg->cdma2000OneXSRVCCInfo_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000onexsrvccinfo(&msg->cdma2000OneXSRVCCInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CDMA2000ONEXSRVCCINFO,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - cdma2000OneXRAND
     if(msg->cdma2000OneXRAND_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000onexrand(&msg->cdma2000OneXRAND, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CDMA2000ONEXRAND,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - cdma2000PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000pdu(&msg->cdma2000PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CDMA2000PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRANRoundTripDelayEstimationInfo
     if(msg->EUTRANRoundTripDelayEstimationInfo_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_eutranroundtripdelayestimationinfo(&msg->EUTRANRoundTripDelayEstimationInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_EUTRANROUNDTRIPDELAYESTIMATIONINFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -33380,7 +32794,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33478,7 +32892,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33499,59 +32913,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UERadioCapability
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueradiocapability(&msg->UERadioCapability, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UERADIOCAPABILITY,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33559,7 +32970,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33619,7 +33030,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33640,59 +33051,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_StatusTransfer_TransparentContainer
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_statustransfer_transparentcontainer(&msg->eNB_StatusTransfer_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33700,7 +33108,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33760,7 +33168,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33781,59 +33189,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_StatusTransfer_TransparentContainer
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_statustransfer_transparentcontainer(&msg->eNB_StatusTransfer_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33841,7 +33246,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33901,7 +33306,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33922,59 +33327,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TraceActivation
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_traceactivation(&msg->TraceActivation, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TRACEACTIVATION,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33982,7 +33384,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34042,7 +33444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34063,76 +33465,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_UTRAN_Trace_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_utran_trace_id(&msg->E_UTRAN_Trace_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_UTRAN_TRACE_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34140,7 +33538,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34205,7 +33603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34226,59 +33624,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_UTRAN_Trace_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_utran_trace_id(&msg->E_UTRAN_Trace_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_UTRAN_TRACE_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34286,7 +33681,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34346,7 +33741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34369,111 +33764,105 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_UTRAN_Trace_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_utran_trace_id(&msg->E_UTRAN_Trace_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_UTRAN_TRACE_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TraceCollectionEntityIPAddress
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_transportlayeraddress(&msg->TraceCollectionEntityIPAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TRACECOLLECTIONENTITYIPADDRESS,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - PrivacyIndicator
     if(msg->PrivacyIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_privacyindicator(&msg->PrivacyIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_PRIVACYINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -34482,7 +33871,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34559,7 +33948,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34580,59 +33969,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - RequestType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_requesttype(&msg->RequestType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_REQUESTTYPE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34640,7 +34026,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34700,7 +34086,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34721,59 +34107,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34781,7 +34164,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34841,7 +34224,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34862,93 +34245,88 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - RequestType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_requesttype(&msg->RequestType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_REQUESTTYPE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34956,7 +34334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35026,7 +34404,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35051,62 +34429,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - OverloadResponse
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_overloadresponse(&msg->OverloadResponse, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_OVERLOADRESPONSE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - GUMMEIList
     if(msg->GUMMEIList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummeilist(&msg->GUMMEIList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GUMMEILIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - TrafficLoadReductionIndication
     if(msg->TrafficLoadReductionIndication_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_trafficloadreductionindication(&msg->TrafficLoadReductionIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TRAFFICLOADREDUCTIONINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35115,7 +34490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35179,7 +34554,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35202,26 +34577,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - GUMMEIList
     if(msg->GUMMEIList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummeilist(&msg->GUMMEIList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GUMMEILIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35230,7 +34604,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35282,7 +34656,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35317,208 +34691,197 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SerialNumber
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - WarningAreaList
     if(msg->WarningAreaList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningarealist(&msg->WarningAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_WARNINGAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - RepetitionPeriod
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_repetitionperiod(&msg->RepetitionPeriod, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_REPETITIONPERIOD,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - ExtendedRepetitionPeriod
     if(msg->ExtendedRepetitionPeriod_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_extendedrepetitionperiod(&msg->ExtendedRepetitionPeriod, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_EXTENDEDREPETITIONPERIOD,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - NumberofBroadcastRequest
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_numberofbroadcastrequest(&msg->NumberofBroadcastRequest, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_NUMBEROFBROADCASTREQUEST,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - WarningType
     if(msg->WarningType_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningtype(&msg->WarningType, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_WARNINGTYPE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - WarningSecurityInfo
     if(msg->WarningSecurityInfo_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningsecurityinfo(&msg->WarningSecurityInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_WARNINGSECURITYINFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - DataCodingScheme
     if(msg->DataCodingScheme_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_datacodingscheme(&msg->DataCodingScheme, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_DATACODINGSCHEME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - WarningMessageContents
     if(msg->WarningMessageContents_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningmessagecontents(&msg->WarningMessageContents, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_WARNINGMESSAGECONTENTS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ConcurrentWarningMessageIndicator
     if(msg->ConcurrentWarningMessageIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_concurrentwarningmessageindicator(&msg->ConcurrentWarningMessageIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CONCURRENTWARNINGMESSAGEINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35527,7 +34890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35641,7 +35004,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35666,79 +35029,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SerialNumber
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - BroadcastCompletedAreaList
     if(msg->BroadcastCompletedAreaList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_broadcastcompletedarealist(&msg->BroadcastCompletedAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_BROADCASTCOMPLETEDAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35747,7 +35106,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35816,7 +35175,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35837,25 +35196,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Inter_SystemInformationTransferTypeMDT
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_inter_systeminformationtransfertype(&msg->Inter_SystemInformationTransferTypeMDT, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_INTER_SYSTEMINFORMATIONTRANSFERTYPEMDT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -35863,7 +35221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35913,7 +35271,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35936,26 +35294,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - SONConfigurationTransferECT
     if(msg->SONConfigurationTransferECT_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_sonconfigurationtransfer(&msg->SONConfigurationTransferECT, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SONCONFIGURATIONTRANSFERECT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35964,7 +35321,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36016,7 +35373,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36039,26 +35396,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - SONConfigurationTransferMCT
     if(msg->SONConfigurationTransferMCT_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_sonconfigurationtransfer(&msg->SONConfigurationTransferMCT, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SONCONFIGURATIONTRANSFERMCT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36067,7 +35423,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36119,7 +35475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36140,8 +35496,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -36149,7 +35505,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36187,7 +35543,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36212,79 +35568,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SerialNumber
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - WarningAreaList
     if(msg->WarningAreaList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningarealist(&msg->WarningAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_WARNINGAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - KillAllWarningMessages
     if(msg->KillAllWarningMessages_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_killallwarningmessages(&msg->KillAllWarningMessages, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_KILLALLWARNINGMESSAGES,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36293,7 +35645,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36362,7 +35714,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36387,79 +35739,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SerialNumber
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - BroadcastCancelledAreaList
     if(msg->BroadcastCancelledAreaList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_broadcastcancelledarealist(&msg->BroadcastCancelledAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_BROADCASTCANCELLEDAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36468,7 +35816,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36537,7 +35885,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36560,77 +35908,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - ECGIListForRestart
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ecgilistforrestart(&msg->ECGIListForRestart, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ECGILISTFORRESTART,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Global_ENB_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_global_enb_id(&msg->Global_ENB_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_GLOBAL_ENB_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAIListForRestart
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tailistforrestart(&msg->TAIListForRestart, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAILISTFORRESTART,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EmergencyAreaIDListForRestart
     if(msg->EmergencyAreaIDListForRestart_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_emergencyareaidlistforrestart(&msg->EmergencyAreaIDListForRestart, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_EMERGENCYAREAIDLISTFORRESTART,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36639,7 +35983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36706,7 +36050,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36727,76 +36071,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Routing_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - LPPa_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -36804,7 +36144,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36869,7 +36209,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36890,76 +36230,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Routing_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - LPPa_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -36967,7 +36303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37032,7 +36368,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37053,42 +36389,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Routing_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - LPPa_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37096,7 +36430,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37151,7 +36485,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37172,42 +36506,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Routing_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - LPPa_PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37215,7 +36547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37270,7 +36602,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37291,25 +36623,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Inter_SystemInformationTransferTypeEDT
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_inter_systeminformationtransfertype(&msg->Inter_SystemInformationTransferTypeEDT, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_INTER_SYSTEMINFORMATIONTRANSFERTYPEEDT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37317,7 +36648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37367,7 +36698,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37388,25 +36719,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABDataForwardingItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabdataforwardingitem(&msg->E_RABDataForwardingItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABDATAFORWARDINGITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37414,7 +36744,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37464,7 +36794,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37485,25 +36815,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemHOReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetupitemhoreq(&msg->E_RABToBeSetupItemHOReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMHOREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37511,7 +36840,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37561,7 +36890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37582,25 +36911,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABAdmittedItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabadmitteditem(&msg->E_RABAdmittedItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABADMITTEDITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37608,7 +36936,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37658,7 +36986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37679,25 +37007,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABFailedtoSetupItemHOReqAck
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(&msg->E_RABFailedtoSetupItemHOReqAck, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPITEMHOREQACK,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37705,7 +37032,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37755,7 +37082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37776,25 +37103,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABToBeSwitchedDLItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobeswitcheddlitem(&msg->E_RABToBeSwitchedDLItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDDLITEM,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37802,7 +37128,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37852,7 +37178,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37873,25 +37199,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABToBeSwitchedULItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobeswitchedulitem(&msg->E_RABToBeSwitchedULItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDULITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37899,7 +37224,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37949,7 +37274,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37970,25 +37295,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemBearerSUReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetupitembearersureq(&msg->E_RABToBeSetupItemBearerSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMBEARERSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37996,7 +37320,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38046,7 +37370,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38067,25 +37391,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABSetupItemBearerSURes
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabsetupitembearersures(&msg->E_RABSetupItemBearerSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABSETUPITEMBEARERSURES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38093,7 +37416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38143,7 +37466,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38164,25 +37487,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABToBeModifiedItemBearerModReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(&msg->E_RABToBeModifiedItemBearerModReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBEMODIFIEDITEMBEARERMODREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38190,7 +37512,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38240,7 +37562,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38261,25 +37583,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABModifyItemBearerModRes
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabmodifyitembearermodres(&msg->E_RABModifyItemBearerModRes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABMODIFYITEMBEARERMODRES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38287,7 +37608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38337,7 +37658,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38358,25 +37679,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABReleaseItemBearerRelComp
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(&msg->E_RABReleaseItemBearerRelComp, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABRELEASEITEMBEARERRELCOMP,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38384,7 +37704,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38434,7 +37754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38455,25 +37775,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemCtxtSUReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(&msg->E_RABToBeSetupItemCtxtSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMCTXTSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38481,7 +37800,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38531,7 +37850,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38552,25 +37871,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - E_RABSetupItemCtxtSURes
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabsetupitemctxtsures(&msg->E_RABSetupItemCtxtSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABSETUPITEMCTXTSURES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38578,7 +37896,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38628,7 +37946,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38649,25 +37967,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - TAIItem
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_taiitem(&msg->TAIItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAIITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38675,7 +37992,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38725,7 +38042,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38750,45 +38067,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionListResAck
     if(msg->UE_associatedLogicalS1_ConnectionListResAck_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(&msg->UE_associatedLogicalS1_ConnectionListResAck, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -38797,7 +38112,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38856,7 +38171,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38877,42 +38192,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - ResetType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_resettype(&msg->ResetType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_RESETTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38920,7 +38233,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38975,7 +38288,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39000,114 +38313,108 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABSubjecttoDataForwardingList
     if(msg->E_RABSubjecttoDataForwardingList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(&msg->E_RABSubjecttoDataForwardingList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABSUBJECTTODATAFORWARDINGLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - cdma2000HOStatus
     if(msg->cdma2000HOStatus_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000hostatus(&msg->cdma2000HOStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CDMA2000HOSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - cdma2000RATType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000rattype(&msg->cdma2000RATType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CDMA2000RATTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - cdma2000PDU
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000pdu(&msg->cdma2000PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CDMA2000PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -39115,7 +38422,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -39194,7 +38501,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39225,170 +38532,161 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - HandoverType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_handovertype(&msg->HandoverType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_HANDOVERTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NASSecurityParametersfromE_UTRAN
     if(msg->NASSecurityParametersfromE_UTRAN_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_nassecurityparametersfrome_utran(&msg->NASSecurityParametersfromE_UTRAN, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_NASSECURITYPARAMETERSFROME_UTRAN,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABSubjecttoDataForwardingList
     if(msg->E_RABSubjecttoDataForwardingList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(&msg->E_RABSubjecttoDataForwardingList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABSUBJECTTODATAFORWARDINGLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABtoReleaseListHOCmd
     if(msg->E_RABtoReleaseListHOCmd_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABtoReleaseListHOCmd, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTORELEASELISTHOCMD,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - Target_ToSource_TransparentContainer
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_target_tosource_transparentcontainer(&msg->Target_ToSource_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TARGET_TOSOURCE_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Target_ToSource_TransparentContainer_Secondary
     if(msg->Target_ToSource_TransparentContainer_Secondary_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_target_tosource_transparentcontainer(&msg->Target_ToSource_TransparentContainer_Secondary, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TARGET_TOSOURCE_TRANSPARENTCONTAINER_SECONDARY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -39397,7 +38695,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -39496,7 +38794,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39539,352 +38837,333 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - HandoverType
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_handovertype(&msg->HandoverType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_HANDOVERTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Cause
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABToBeSetupListHOReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetuplisthoreq(&msg->E_RABToBeSetupListHOReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPLISTHOREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - Source_ToTarget_TransparentContainer
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_source_totarget_transparentcontainer(&msg->Source_ToTarget_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SOURCE_TOTARGET_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UESecurityCapabilities
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - HandoverRestrictionList
     if(msg->HandoverRestrictionList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_handoverrestrictionlist(&msg->HandoverRestrictionList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_HANDOVERRESTRICTIONLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - TraceActivation
     if(msg->TraceActivation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_traceactivation(&msg->TraceActivation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TRACEACTIVATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - RequestType
     if(msg->RequestType_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_requesttype(&msg->RequestType, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_REQUESTTYPE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SRVCCOperationPossible
     if(msg->SRVCCOperationPossible_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_srvccoperationpossible(&msg->SRVCCOperationPossible, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SRVCCOPERATIONPOSSIBLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SecurityContext
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_securitycontext(&msg->SecurityContext, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SECURITYCONTEXT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - NASSecurityParameterstoE_UTRAN
     if(msg->NASSecurityParameterstoE_UTRAN_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_nassecurityparameterstoe_utran(&msg->NASSecurityParameterstoE_UTRAN, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_NASSECURITYPARAMETERSTOE_UTRAN,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - GUMMEI_ID
     if(msg->GUMMEI_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->GUMMEI_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GUMMEI_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - MME_UE_S1AP_ID_2
     if(msg->MME_UE_S1AP_ID_2_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID_2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID_2,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTAllowed
     if(msg->ManagementBasedMDTAllowed_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_managementbasedmdtallowed(&msg->ManagementBasedMDTAllowed, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTALLOWED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTPLMNList
     if(msg->ManagementBasedMDTPLMNList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdtplmnlist(&msg->ManagementBasedMDTPLMNList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTPLMNLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -39893,7 +39172,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40054,7 +39333,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40087,223 +39366,211 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABToBeSwitchedDLList
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobeswitcheddllist(&msg->E_RABToBeSwitchedDLList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDDLLIST,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SourceMME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->SourceMME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SOURCEMME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAI
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UESecurityCapabilities
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SourceMME_GUMMEI
     if(msg->SourceMME_GUMMEI_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->SourceMME_GUMMEI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SOURCEMME_GUMMEI,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - Tunnel_Information_for_BBF
     if(msg->Tunnel_Information_for_BBF_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_tunnelinformation(&msg->Tunnel_Information_for_BBF, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TUNNEL_INFORMATION_FOR_BBF,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -40312,7 +39579,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40429,7 +39696,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40462,172 +39729,163 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABToBeSwitchedULList
     if(msg->E_RABToBeSwitchedULList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobeswitchedullist(&msg->E_RABToBeSwitchedULList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDULLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABToBeReleasedList
     if(msg->E_RABToBeReleasedList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABToBeReleasedList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBERELEASEDLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SecurityContext
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_securitycontext(&msg->SecurityContext, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SECURITYCONTEXT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - MME_UE_S1AP_ID_2
     if(msg->MME_UE_S1AP_ID_2_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID_2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID_2,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -40636,7 +39894,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40738,7 +39996,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40761,78 +40019,74 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABToBeSetupListBearerSUReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetuplistbearersureq(&msg->E_RABToBeSetupListBearerSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPLISTBEARERSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -40840,7 +40094,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40907,7 +40161,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40934,98 +40188,93 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABSetupListBearerSURes
     if(msg->E_RABSetupListBearerSURes_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsetuplistbearersures(&msg->E_RABSetupListBearerSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABSETUPLISTBEARERSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABFailedToSetupListBearerSURes
     if(msg->E_RABFailedToSetupListBearerSURes_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToSetupListBearerSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPLISTBEARERSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -41034,7 +40283,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41110,7 +40359,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41133,78 +40382,74 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABToBeModifiedListBearerModReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(&msg->E_RABToBeModifiedListBearerModReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBEMODIFIEDLISTBEARERMODREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -41212,7 +40457,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41279,7 +40524,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41306,98 +40551,93 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABModifyListBearerModRes
     if(msg->E_RABModifyListBearerModRes_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabmodifylistbearermodres(&msg->E_RABModifyListBearerModRes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABMODIFYLISTBEARERMODRES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABFailedToModifyList
     if(msg->E_RABFailedToModifyList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToModifyList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOMODIFYLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -41406,7 +40646,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41482,7 +40722,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41511,117 +40751,111 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABReleaseListBearerRelComp
     if(msg->E_RABReleaseListBearerRelComp_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(&msg->E_RABReleaseListBearerRelComp, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABRELEASELISTBEARERRELCOMP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - E_RABFailedToReleaseList
     if(msg->E_RABFailedToReleaseList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToReleaseList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTORELEASELIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - UserLocationInformation
     if(msg->UserLocationInformation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_userlocationinformation(&msg->UserLocationInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_USERLOCATIONINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -41630,7 +40864,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41713,7 +40947,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41760,356 +40994,337 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABToBeSetupListCtxtSUReq
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(&msg->E_RABToBeSetupListCtxtSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPLISTCTXTSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UESecurityCapabilities
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - SecurityKey
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_securitykey(&msg->SecurityKey, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_SECURITYKEY,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TraceActivation
     if(msg->TraceActivation_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_traceactivation(&msg->TraceActivation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_TRACEACTIVATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - HandoverRestrictionList
     if(msg->HandoverRestrictionList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_handoverrestrictionlist(&msg->HandoverRestrictionList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_HANDOVERRESTRICTIONLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - UERadioCapability
     if(msg->UERadioCapability_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueradiocapability(&msg->UERadioCapability, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_UERADIOCAPABILITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SubscriberProfileIDforRFP
     if(msg->SubscriberProfileIDforRFP_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_subscriberprofileidforrfp(&msg->SubscriberProfileIDforRFP, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SUBSCRIBERPROFILEIDFORRFP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSFallbackIndicator
     if(msg->CSFallbackIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csfallbackindicator(&msg->CSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - SRVCCOperationPossible
     if(msg->SRVCCOperationPossible_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_srvccoperationpossible(&msg->SRVCCOperationPossible, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_SRVCCOPERATIONPOSSIBLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - RegisteredLAI
     if(msg->RegisteredLAI_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lai(&msg->RegisteredLAI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_REGISTEREDLAI,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - GUMMEI_ID
     if(msg->GUMMEI_ID_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->GUMMEI_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_GUMMEI_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - MME_UE_S1AP_ID_2
     if(msg->MME_UE_S1AP_ID_2_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID_2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID_2,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTAllowed
     if(msg->ManagementBasedMDTAllowed_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_managementbasedmdtallowed(&msg->ManagementBasedMDTAllowed, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTALLOWED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTPLMNList
     if(msg->ManagementBasedMDTPLMNList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdtplmnlist(&msg->ManagementBasedMDTPLMNList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTPLMNLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - AdditionalCSFallbackIndicator
     if(msg->AdditionalCSFallbackIndicator_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_additionalcsfallbackindicator(&msg->AdditionalCSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_ADDITIONALCSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42118,7 +41333,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42283,7 +41498,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42308,96 +41523,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABSetupListCtxtSURes
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabsetuplistctxtsures(&msg->E_RABSetupListCtxtSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABSETUPLISTCTXTSURES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABFailedToSetupListCtxtSURes
     if(msg->E_RABFailedToSetupListCtxtSURes_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToSetupListCtxtSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPLISTCTXTSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42406,7 +41616,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42480,7 +41690,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42507,132 +41717,125 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - UEIdentityIndexValue
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueidentityindexvalue(&msg->UEIdentityIndexValue, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UEIDENTITYINDEXVALUE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - UEPagingID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uepagingid(&msg->UEPagingID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_UEPAGINGID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - pagingDRX
     if(msg->pagingDRX_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_pagingdrx(&msg->pagingDRX, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_PAGINGDRX,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CNDomain
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cndomain(&msg->CNDomain, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_CNDOMAIN,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - TAIList
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tailist(&msg->TAIList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TAILIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CSG_IdList
     if(msg->CSG_IdList_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_idlist(&msg->CSG_IdList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_IDLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - PagingPriority
     if(msg->PagingPriority_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_pagingpriority(&msg->PagingPriority, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_PAGINGPRIORITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42641,7 +41844,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42727,7 +41930,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42756,151 +41959,143 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABAdmittedList
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabadmittedlist(&msg->E_RABAdmittedList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_E_RABADMITTEDLIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - E_RABFailedToSetupListHOReqAck
     if(msg->E_RABFailedToSetupListHOReqAck_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(&msg->E_RABFailedToSetupListHOReqAck, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPLISTHOREQACK,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - Target_ToSource_TransparentContainer
     
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_target_tosource_transparentcontainer(&msg->Target_ToSource_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
     if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                           LIBLTE_S1AP_IE_ID_TARGET_TOSOURCE_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+      tmp_msg.N_bits = tmp_ptr.N_bits;
       if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42909,7 +42104,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequestacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR_STRUCT                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -43004,7 +42199,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
   uint32_t                      len,
   uint32_t                      ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM  crit,
-  uint8_t                     **ptr)
+  LIBLTE_BIT_PTR_STRUCT        *ptr)
 {
   liblte_value_2_bits(ie_id, ptr, 16); // ProtocolIE-ID
   liblte_value_2_bits(crit,  ptr, 2);  // Criticality
@@ -43024,7 +42219,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
-  uint8_t                     **ptr,
+  LIBLTE_BIT_PTR_STRUCT        *ptr,
   uint32_t                     *ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM *crit,
   uint32_t                     *len)
@@ -43050,15 +42245,16 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg,
-  uint8_t                             **ptr)
+  LIBLTE_BIT_PTR_STRUCT                *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
   if(msg                                      != NULL &&
      ptr                                      != NULL)
   { 
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_LOCATIONREPORTINGCONTROL) {
@@ -43262,7 +42458,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
     } 
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
 
     // Procedure code
     liblte_value_2_bits(msg->procedureCode, ptr, 8);
@@ -43285,8 +42481,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -43294,7 +42489,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_PTR_STRUCT                *ptr,
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43582,15 +42777,16 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                               **ptr)
+  LIBLTE_BIT_PTR_STRUCT                  *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
   if(msg                                      != NULL &&
      ptr                                      != NULL)
   { 
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_UNSUCCESSFULOUTCOME_CHOICE_S1SETUPFAILURE) {
@@ -43626,7 +42822,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
     } 
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
 
     // Procedure code
     liblte_value_2_bits(msg->procedureCode, ptr, 8);
@@ -43649,8 +42845,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -43658,7 +42853,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
-  uint8_t                               **ptr,
+  LIBLTE_BIT_PTR_STRUCT                  *ptr,
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43736,15 +42931,16 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                             **ptr)
+  LIBLTE_BIT_PTR_STRUCT                *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
   if(msg                                      != NULL &&
      ptr                                      != NULL)
   { 
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_PACKED_MSG_STRUCT tmp_msg;
+    LIBLTE_BIT_PTR_STRUCT    tmp_ptr;
+    liblte_bit_ptr_init(&tmp_ptr, tmp_msg.msg);
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_HANDOVERREQUESTACKNOWLEDGE) {
@@ -43816,7 +43012,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
     } 
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bits = tmp_ptr.N_bits;
 
     // Procedure code
     liblte_value_2_bits(msg->procedureCode, ptr, 8);
@@ -43839,8 +43035,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bytes_2_bits(tmp_msg.msg, ptr, tmp_msg.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -43848,7 +43043,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_successfuloutcome(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_PTR_STRUCT                *ptr,
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43975,13 +43170,13 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1ap_pdu(
   LIBLTE_BYTE_MSG_STRUCT      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  LIBLTE_BIT_MSG_STRUCT bit_msg;
 
   if(s1ap_pdu                                 != NULL &&
      msg                                      != NULL)
   {
-    uint8_t *p    = bit_msg.msg;
-    uint8_t **ptr = &p;
+    LIBLTE_BIT_PTR_STRUCT  p;
+    LIBLTE_BIT_PTR_STRUCT *ptr = &p;
+    liblte_bit_ptr_init(ptr, msg->msg);
 
     // Extension
     liblte_value_2_bits(s1ap_pdu->ext?1:0, ptr, 1);
@@ -44006,9 +43201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1ap_pdu(
     }
 
     liblte_align_up_zero(ptr, 8);
-    bit_msg.N_bits = (*ptr - bit_msg.msg);
-
-    liblte_pack(&bit_msg, msg);
+    msg->N_bytes = p.N_bits / 8;
     err = LIBLTE_SUCCESS;
 
   }
@@ -44020,15 +43213,13 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1ap_pdu(
   LIBLTE_S1AP_S1AP_PDU_STRUCT *s1ap_pdu)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  LIBLTE_BIT_MSG_STRUCT bit_msg;
 
   if(s1ap_pdu                                 != NULL &&
      msg                                      != NULL)
   {
-    liblte_unpack(msg, &bit_msg);
-
-    uint8_t *p    = bit_msg.msg;
-    uint8_t **ptr = &p;
+    LIBLTE_BIT_PTR_STRUCT  p;
+    LIBLTE_BIT_PTR_STRUCT *ptr = &p;
+    liblte_bit_ptr_init(ptr, msg->msg);
 
     // Extension
     s1ap_pdu->ext = liblte_bits_2_value(ptr, 1);
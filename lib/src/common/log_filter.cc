@@ -41,6 +41,7 @@ log_filter::log_filter()
   time_src    = NULL;
   time_format = TIME;
   logger_h    = NULL;
+  binary_h    = NULL;
 }
 
 log_filter::log_filter(std::string layer)
@@ -48,6 +49,7 @@ log_filter::log_filter(std::string layer)
   do_tti      = false;
   time_src    = NULL;
   time_format = TIME;
+  binary_h    = NULL;
   init(layer, &def_logger_stdout, tti);
 }
 
@@ -56,6 +58,7 @@ log_filter::log_filter(std::string layer, logger *logger_, bool tti)
   do_tti      = false;
   time_src    = NULL;
   time_format = TIME;
+  binary_h    = NULL;
   init(layer, logger_, tti);
 }
 
@@ -68,6 +71,10 @@ void log_filter::init(std::string layer, logger *logger_, bool tti)
   service_name  = layer;
   logger_h      = logger_;
   do_tti        = tti;
+  binary_h      = dynamic_cast<logger_binary*>(logger_);
+  if (binary_h) {
+    binary_layer_id = binary_h->register_layer(layer);
+  }
 }
 
 void log_filter::all_log(srslte::LOG_LEVEL_ENUM level,
@@ -139,6 +146,59 @@ void log_filter::all_log(srslte::LOG_LEVEL_ENUM level,
   }
 }
 
+/* Same prefix settings as all_log(), but only the format string, the time and
+ * the raw arguments are stored. The line is rendered by logger_binary::decode().
+ */
+void log_filter::binary_log(srslte::LOG_LEVEL_ENUM level,
+                            uint32_t               tti,
+                            const char            *msg,
+                            va_list                args,
+                            const uint8_t         *hex,
+                            int                    size,
+                            bool                   is_hex)
+{
+  logger_binary_entry_t entry;
+
+  if (!time_src) {
+    struct timeval rawtime;
+    gettimeofday(&rawtime, NULL);
+    entry.secs  = rawtime.tv_sec;
+    entry.usecs = rawtime.tv_usec;
+  } else {
+    srslte_timestamp_t now = time_src->get_time();
+    entry.secs  = now.full_secs;
+    entry.usecs = (uint32_t) (now.frac_secs * 1e6);
+  }
+  entry.tti      = tti;
+  entry.layer_id = binary_layer_id;
+  entry.level    = level;
+  entry.flags    = 0;
+  if (do_tti) {
+    entry.flags |= LOGGER_BINARY_FLAG_TTI;
+  }
+  if (show_layer_en) {
+    entry.flags |= LOGGER_BINARY_FLAG_SHOW_LAYER;
+  }
+  if (level_text_short) {
+    entry.flags |= LOGGER_BINARY_FLAG_LEVEL_SHORT;
+  }
+  if (time_format == EPOCH) {
+    entry.flags |= LOGGER_BINARY_FLAG_EPOCH;
+  }
+  if (time_src) {
+    entry.flags |= LOGGER_BINARY_FLAG_TIME_SRC;
+  }
+  if (is_hex) {
+    entry.flags |= LOGGER_BINARY_FLAG_HEX;
+    if (hex_limit > 0) {
+      size = (size > hex_limit) ? hex_limit : size;
+    } else {
+      size = 0;
+    }
+  }
+  binary_h->log_entry(&entry, msg, args, hex, size, add_string_en ? &add_string_val : NULL);
+}
+
 void log_filter::console(const char * message, ...) {
   char     *args_msg = NULL;
   va_list   args;
@@ -154,8 +214,11 @@ void log_filter::error(const char * message, ...) {
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_ERROR, tti, message, args);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_ERROR, tti, args_msg);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -165,8 +228,11 @@ void log_filter::warning(const char * message, ...) {
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_WARNING, tti, message, args);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_WARNING, tti, args_msg);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -176,8 +242,11 @@ void log_filter::info(const char * message, ...) {
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_INFO, tti, message, args);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_INFO, tti, args_msg);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -187,8 +256,11 @@ void log_filter::debug(const char * message, ...) {
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_DEBUG, tti, message, args);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_DEBUG, tti, args_msg);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -199,8 +271,11 @@ void log_filter::error_hex(const uint8_t *hex, int size, const char * message, .
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_ERROR, tti, message, args, hex, size, true);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_ERROR, tti, args_msg, hex, size);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -210,8 +285,11 @@ void log_filter::warning_hex(const uint8_t *hex, int size, const char * message,
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_WARNING, tti, message, args, hex, size, true);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_WARNING, tti, args_msg, hex, size);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -221,8 +299,11 @@ void log_filter::info_hex(const uint8_t *hex, int size, const char * message, ..
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_INFO, tti, message, args, hex, size, true);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_INFO, tti, args_msg, hex, size);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -232,8 +313,11 @@ void log_filter::debug_hex(const uint8_t *hex, int size, const char * message, .
     char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h) {
+      binary_log(LOG_LEVEL_DEBUG, tti, message, args, hex, size, true);
+    } else if (vasprintf(&args_msg, message, args) > 0) {
       all_log(LOG_LEVEL_DEBUG, tti, args_msg, hex, size);
+    }
     va_end(args);
     free(args_msg);
   }
@@ -0,0 +1,969 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <map>
+
+#include "srslte/common/log.h"
+#include "srslte/common/logger_binary.h"
+
+// va_copy is standard from C99 and C++11, strict C++03 builds only provide the older name
+#ifndef va_copy
+#define va_copy(dst, src) __va_copy(dst, src)
+#endif
+
+#define LOGGER_BINARY_MAGIC    "SRSBLOG1"
+#define LOGGER_BINARY_FILE_BUF (1024*1024)
+
+// Record types in the file
+#define RECORD_FORMAT 'F' // uint64 id, uint16 length, characters
+#define RECORD_LAYER  'L' // uint16 id, uint16 length, characters
+#define RECORD_ENTRY  'E' // uint32 length, entry
+#define RECORD_TEXT   'T' // uint32 length, characters
+
+// Ends of the loaded image, format strings outside of it may not outlive the call
+extern "C" char __executable_start;
+extern "C" char _edata;
+
+namespace srslte{
+
+static const char raw_fmt[] = "%s";
+
+/*******************************************************************************
+  printf conversion parsing, shared by the producers and the decoder
+*******************************************************************************/
+
+typedef enum {
+  ARG_NONE = 0,   // %%
+  ARG_INT,
+  ARG_UINT,
+  ARG_DOUBLE,
+  ARG_STRING,
+  ARG_ERRNO,      // %m, stored as a string
+  ARG_PTR,
+  ARG_UNSUPPORTED
+} arg_type_t;
+
+typedef enum {
+  ARG_LEN_NONE = 0,
+  ARG_LEN_HH,
+  ARG_LEN_H,
+  ARG_LEN_L,
+  ARG_LEN_LL,
+  ARG_LEN_BIG_L,
+  ARG_LEN_J,
+  ARG_LEN_Z,
+  ARG_LEN_T
+} arg_len_t;
+
+typedef struct {
+  const char *start; // At the '%'
+  const char *end;   // Past the conversion character
+  int         nof_stars;
+  arg_type_t  type;
+  arg_len_t   len;
+} conversion_t;
+
+// Finds the next conversion from *p on, returns false at the end of the format
+static bool next_conversion(const char **p, conversion_t *c)
+{
+  const char *s = strchr(*p, '%');
+  if (!s) {
+    return false;
+  }
+  c->start     = s++;
+  c->nof_stars = 0;
+  c->len       = ARG_LEN_NONE;
+
+  // flags, width and precision
+  while (*s && strchr("-+ #0'I", *s)) {
+    s++;
+  }
+  while ((*s >= '0' && *s <= '9') || *s == '*' || *s == '.') {
+    if (*s == '*') {
+      c->nof_stars++;
+    }
+    s++;
+  }
+
+  // length modifier
+  switch (*s) {
+    case 'h':
+      s++;
+      c->len = ARG_LEN_H;
+      if (*s == 'h') {
+        s++;
+        c->len = ARG_LEN_HH;
+      }
+      break;
+    case 'l':
+      s++;
+      c->len = ARG_LEN_L;
+      if (*s == 'l') {
+        s++;
+        c->len = ARG_LEN_LL;
+      }
+      break;
+    case 'q':
+      s++;
+      c->len = ARG_LEN_LL;
+      break;
+    case 'L':
+      s++;
+      c->len = ARG_LEN_BIG_L;
+      break;
+    case 'j':
+      s++;
+      c->len = ARG_LEN_J;
+      break;
+    case 'z':
+    case 'Z':
+      s++;
+      c->len = ARG_LEN_Z;
+      break;
+    case 't':
+      s++;
+      c->len = ARG_LEN_T;
+      break;
+    default:
+      break;
+  }
+
+  switch (*s) {
+    case '%':
+      c->type = ARG_NONE;
+      break;
+    case 'd':
+    case 'i':
+      c->type = ARG_INT;
+      break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'c':
+      c->type = ARG_UINT;
+      break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      c->type = ARG_DOUBLE;
+      break;
+    case 's':
+      c->type = c->len == ARG_LEN_L ? ARG_UNSUPPORTED : ARG_STRING;
+      break;
+    case 'm':
+      c->type = ARG_ERRNO;
+      break;
+    case 'p':
+      c->type = ARG_PTR;
+      break;
+    default:
+      c->type = ARG_UNSUPPORTED;
+      break;
+  }
+  if (*s) {
+    s++;
+  }
+  c->end = s;
+  *p = s;
+  return true;
+}
+
+static int pack_string(const char *str, uint8_t *out, uint32_t room)
+{
+  if (room < sizeof(uint16_t)) {
+    return -1;
+  }
+  if (!str) {
+    str = "(null)";
+  }
+  uint16_t n = (uint16_t) strnlen(str, LOGGER_BINARY_MAX_STRING);
+  if (n > room - sizeof(uint16_t)) {
+    n = (uint16_t) (room - sizeof(uint16_t));
+  }
+  memcpy(out, &n, sizeof(uint16_t));
+  memcpy(&out[sizeof(uint16_t)], str, n);
+  return sizeof(uint16_t) + n;
+}
+
+/* Stores the arguments as 64 bit integers, doubles, pointers and length
+ * prefixed strings, in the order of the conversions. Returns the number of
+ * bytes written, or -1 if the format can not be packed.
+ */
+static int pack_args(const char *fmt, va_list args, uint8_t *out, uint32_t room)
+{
+  const char  *p = fmt;
+  conversion_t c;
+  uint32_t     n = 0;
+
+  while (next_conversion(&p, &c)) {
+    if (c.type == ARG_UNSUPPORTED) {
+      return -1;
+    }
+    for (int i = 0; i < c.nof_stars; i++) {
+      int64_t v = va_arg(args, int);
+      if (n + sizeof(int64_t) > room) {
+        return -1;
+      }
+      memcpy(&out[n], &v, sizeof(int64_t));
+      n += sizeof(int64_t);
+    }
+    switch (c.type) {
+      case ARG_INT: {
+        int64_t v;
+        switch (c.len) {
+          case ARG_LEN_L:  v = va_arg(args, long);      break;
+          case ARG_LEN_LL: v = va_arg(args, long long); break;
+          case ARG_LEN_J:  v = va_arg(args, intmax_t);  break;
+          case ARG_LEN_Z:  v = va_arg(args, ssize_t);   break;
+          case ARG_LEN_T:  v = va_arg(args, ptrdiff_t); break;
+          default:         v = va_arg(args, int);       break;
+        }
+        if (n + sizeof(int64_t) > room) {
+          return -1;
+        }
+        memcpy(&out[n], &v, sizeof(int64_t));
+        n += sizeof(int64_t);
+        break;
+      }
+      case ARG_UINT: {
+        uint64_t v;
+        switch (c.len) {
+          case ARG_LEN_L:  v = va_arg(args, unsigned long);      break;
+          case ARG_LEN_LL: v = va_arg(args, unsigned long long); break;
+          case ARG_LEN_J:  v = va_arg(args, uintmax_t);          break;
+          case ARG_LEN_Z:  v = va_arg(args, size_t);             break;
+          case ARG_LEN_T:  v = va_arg(args, ptrdiff_t);          break;
+          default:         v = va_arg(args, unsigned int);       break;
+        }
+        if (n + sizeof(uint64_t) > room) {
+          return -1;
+        }
+        memcpy(&out[n], &v, sizeof(uint64_t));
+        n += sizeof(uint64_t);
+        break;
+      }
+      case ARG_DOUBLE: {
+        double v;
+        if (c.len == ARG_LEN_BIG_L) {
+          v = (double) va_arg(args, long double);
+        } else {
+          v = va_arg(args, double);
+        }
+        if (n + sizeof(double) > room) {
+          return -1;
+        }
+        memcpy(&out[n], &v, sizeof(double));
+        n += sizeof(double);
+        break;
+      }
+      case ARG_PTR: {
+        uint64_t v = (uint64_t) (uintptr_t) va_arg(args, void*);
+        if (n + sizeof(uint64_t) > room) {
+          return -1;
+        }
+        memcpy(&out[n], &v, sizeof(uint64_t));
+        n += sizeof(uint64_t);
+        break;
+      }
+      case ARG_STRING:
+      case ARG_ERRNO: {
+        const char *str = c.type == ARG_STRING ? va_arg(args, const char*) : strerror(errno);
+        int m = pack_string(str, &out[n], room - n);
+        if (m < 0) {
+          return -1;
+        }
+        n += m;
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  return (int) n;
+}
+
+template <typename T>
+static void render_conversion(std::string &out, const char *spec, int nof_stars, const int *stars, T v)
+{
+  char buf[512];
+  int  n;
+  switch (nof_stars) {
+    case 0:
+      n = snprintf(buf, sizeof(buf), spec, v);
+      break;
+    case 1:
+      n = snprintf(buf, sizeof(buf), spec, stars[0], v);
+      break;
+    default:
+      n = snprintf(buf, sizeof(buf), spec, stars[0], stars[1], v);
+      break;
+  }
+  if (n > 0) {
+    out.append(buf, (size_t) n < sizeof(buf) ? (size_t) n : sizeof(buf) - 1);
+  }
+}
+
+// Inverse of pack_args(), returns false if the arguments are truncated
+static bool render_args(std::string &out, const char *fmt, const uint8_t *args, uint32_t args_len)
+{
+  const char  *p = fmt;
+  conversion_t c;
+  uint32_t     n = 0;
+
+  while (true) {
+    const char *prev = p;
+    if (!next_conversion(&p, &c)) {
+      out.append(prev);
+      return true;
+    }
+    out.append(prev, c.start - prev);
+
+    if (c.type == ARG_NONE) {
+      out.append("%");
+      continue;
+    }
+    if (c.type == ARG_UNSUPPORTED) {
+      return false;
+    }
+
+    int stars[2] = {0, 0};
+    for (int i = 0; i < c.nof_stars; i++) {
+      int64_t v;
+      if (n + sizeof(int64_t) > args_len) {
+        return false;
+      }
+      memcpy(&v, &args[n], sizeof(int64_t));
+      n += sizeof(int64_t);
+      if (i < 2) {
+        stars[i] = (int) v;
+      }
+    }
+
+    char spec[32];
+    size_t spec_len = c.end - c.start;
+    if (spec_len >= sizeof(spec)) {
+      return false;
+    }
+    memcpy(spec, c.start, spec_len);
+    spec[spec_len] = '\0';
+
+    switch (c.type) {
+      case ARG_INT: {
+        int64_t v;
+        if (n + sizeof(int64_t) > args_len) {
+          return false;
+        }
+        memcpy(&v, &args[n], sizeof(int64_t));
+        n += sizeof(int64_t);
+        switch (c.len) {
+          case ARG_LEN_L:  render_conversion(out, spec, c.nof_stars, stars, (long) v);      break;
+          case ARG_LEN_LL: render_conversion(out, spec, c.nof_stars, stars, (long long) v); break;
+          case ARG_LEN_J:  render_conversion(out, spec, c.nof_stars, stars, (intmax_t) v);  break;
+          case ARG_LEN_Z:  render_conversion(out, spec, c.nof_stars, stars, (ssize_t) v);   break;
+          case ARG_LEN_T:  render_conversion(out, spec, c.nof_stars, stars, (ptrdiff_t) v); break;
+          default:         render_conversion(out, spec, c.nof_stars, stars, (int) v);       break;
+        }
+        break;
+      }
+      case ARG_UINT: {
+        uint64_t v;
+        if (n + sizeof(uint64_t) > args_len) {
+          return false;
+        }
+        memcpy(&v, &args[n], sizeof(uint64_t));
+        n += sizeof(uint64_t);
+        switch (c.len) {
+          case ARG_LEN_L:  render_conversion(out, spec, c.nof_stars, stars, (unsigned long) v);      break;
+          case ARG_LEN_LL: render_conversion(out, spec, c.nof_stars, stars, (unsigned long long) v); break;
+          case ARG_LEN_J:  render_conversion(out, spec, c.nof_stars, stars, (uintmax_t) v);          break;
+          case ARG_LEN_Z:  render_conversion(out, spec, c.nof_stars, stars, (size_t) v);             break;
+          case ARG_LEN_T:  render_conversion(out, spec, c.nof_stars, stars, (ptrdiff_t) v);          break;
+          default:         render_conversion(out, spec, c.nof_stars, stars, (unsigned int) v);       break;
+        }
+        break;
+      }
+      case ARG_DOUBLE: {
+        double v;
+        if (n + sizeof(double) > args_len) {
+          return false;
+        }
+        memcpy(&v, &args[n], sizeof(double));
+        n += sizeof(double);
+        if (c.len == ARG_LEN_BIG_L) {
+          render_conversion(out, spec, c.nof_stars, stars, (long double) v);
+        } else {
+          render_conversion(out, spec, c.nof_stars, stars, v);
+        }
+        break;
+      }
+      case ARG_PTR: {
+        uint64_t v;
+        if (n + sizeof(uint64_t) > args_len) {
+          return false;
+        }
+        memcpy(&v, &args[n], sizeof(uint64_t));
+        n += sizeof(uint64_t);
+        render_conversion(out, spec, c.nof_stars, stars, (void*) (uintptr_t) v);
+        break;
+      }
+      case ARG_STRING:
+      case ARG_ERRNO: {
+        uint16_t len;
+        if (n + sizeof(uint16_t) > args_len) {
+          return false;
+        }
+        memcpy(&len, &args[n], sizeof(uint16_t));
+        n += sizeof(uint16_t);
+        if (n + len > args_len) {
+          return false;
+        }
+        std::string str((const char*) &args[n], len);
+        n += len;
+        spec[spec_len - 1] = 's';
+        render_conversion(out, spec, c.nof_stars, stars, str.c_str());
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+/*******************************************************************************
+  Producers
+*******************************************************************************/
+
+logger_binary::logger_binary()
+  :logfile(NULL)
+  ,is_running(false)
+  ,ring_size(LOGGER_BINARY_RING_SIZE)
+  ,nof_layers_written(0)
+  ,nof_dropped(0)
+{
+  pthread_mutex_init(&mutex, NULL);
+  pthread_key_create(&ring_key, ring_release);
+}
+
+logger_binary::~logger_binary()
+{
+  stop();
+  pthread_key_delete(ring_key);
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    delete [] rings[i]->buf;
+    delete rings[i];
+  }
+  pthread_mutex_destroy(&mutex);
+}
+
+void logger_binary::init(std::string file, uint32_t ring_size_)
+{
+  // round up to a power of two
+  ring_size = 1024;
+  while (ring_size < ring_size_) {
+    ring_size <<= 1;
+  }
+  logfile = fopen(file.c_str(), "w");
+  if (logfile == NULL) {
+    printf("Error: could not create log file, no messages will be logged!\n");
+  } else {
+    setvbuf(logfile, NULL, _IOFBF, LOGGER_BINARY_FILE_BUF);
+    fwrite(LOGGER_BINARY_MAGIC, 1, strlen(LOGGER_BINARY_MAGIC), logfile);
+  }
+  is_running = true;
+  start(-2);
+}
+
+void logger_binary::stop()
+{
+  if (is_running) {
+    is_running = false;
+    wait_thread_finish();
+    drain();
+    if (logfile) {
+      fclose(logfile);
+      logfile = NULL;
+    }
+  }
+}
+
+void logger_binary::log(const char *msg)
+{
+  uint8_t tmp[LOGGER_BINARY_MAX_ENTRY];
+  logger_binary_entry_t entry;
+  bzero(&entry, sizeof(logger_binary_entry_t));
+  entry.fmt_id = (uint64_t) (uintptr_t) raw_fmt;
+  entry.flags  = LOGGER_BINARY_FLAG_RAW;
+
+  // raw lines are not limited to LOGGER_BINARY_MAX_STRING
+  uint32_t len  = sizeof(logger_binary_entry_t);
+  uint16_t n    = (uint16_t) strnlen(msg, LOGGER_BINARY_MAX_ENTRY - len - sizeof(uint16_t));
+  memcpy(&tmp[len], &n, sizeof(uint16_t));
+  memcpy(&tmp[len + sizeof(uint16_t)], msg, n);
+  entry.args_len = sizeof(uint16_t) + n;
+  len += entry.args_len;
+
+  memcpy(tmp, &entry, sizeof(logger_binary_entry_t));
+  push(tmp, len);
+}
+
+void logger_binary::log(str_ptr msg)
+{
+  log(msg->c_str());
+  delete msg;
+}
+
+uint16_t logger_binary::register_layer(std::string name)
+{
+  pthread_mutex_lock(&mutex);
+  uint16_t id = (uint16_t) layers.size();
+  layers.push_back(name);
+  pthread_mutex_unlock(&mutex);
+  return id;
+}
+
+void logger_binary::log_entry(logger_binary_entry_t *entry, const char *fmt, va_list args,
+                              const uint8_t *hex, int hex_len, const std::string *add_string)
+{
+  uint8_t  tmp[LOGGER_BINARY_MAX_ENTRY];
+  uint32_t len  = sizeof(logger_binary_entry_t);
+  uint32_t room = LOGGER_BINARY_MAX_ENTRY - len;
+  int      n    = -1;
+
+  // keep room for the prepended string, the hex dump takes what is left
+  uint32_t add_len = 0;
+  if (add_string) {
+    add_len = sizeof(uint16_t) + strnlen(add_string->c_str(), LOGGER_BINARY_MAX_STRING);
+    room   -= add_len;
+  }
+
+  // Only format strings in the image can be dereferenced by the consumer later
+  if (fmt >= &__executable_start && fmt < &_edata) {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    n = pack_args(fmt, args_copy, &tmp[len], room);
+    va_end(args_copy);
+    entry->fmt_id = (uint64_t) (uintptr_t) fmt;
+  }
+  if (n < 0) {
+    // Dynamic or unsupported format, render it here
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int m = vsnprintf((char*) &tmp[len + sizeof(uint16_t)], room - sizeof(uint16_t), fmt, args_copy);
+    va_end(args_copy);
+    if (m < 0) {
+      m = 0;
+    } else if ((uint32_t) m >= room - sizeof(uint16_t)) {
+      m = room - sizeof(uint16_t) - 1;
+    }
+    uint16_t m16 = (uint16_t) m;
+    memcpy(&tmp[len], &m16, sizeof(uint16_t));
+    n = sizeof(uint16_t) + m;
+    entry->fmt_id = (uint64_t) (uintptr_t) raw_fmt;
+  }
+  entry->args_len = (uint16_t) n;
+  len  += n;
+  room -= n;
+
+  entry->hex_len = 0;
+  if (hex && hex_len > 0) {
+    entry->hex_len = (uint16_t) ((uint32_t) hex_len < room ? hex_len : room);
+    memcpy(&tmp[len], hex, entry->hex_len);
+    len += entry->hex_len;
+  }
+  if (add_string) {
+    pack_string(add_string->c_str(), &tmp[len], add_len);
+    len += add_len;
+    entry->flags |= LOGGER_BINARY_FLAG_ADD_STRING;
+  }
+
+  memcpy(tmp, entry, sizeof(logger_binary_entry_t));
+  push(tmp, len);
+}
+
+uint64_t logger_binary::get_nof_dropped()
+{
+  uint64_t n = 0;
+  pthread_mutex_lock(&mutex);
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    n += rings[i]->dropped;
+  }
+  pthread_mutex_unlock(&mutex);
+  return n + nof_dropped;
+}
+
+logger_binary::ring_t* logger_binary::get_ring()
+{
+  ring_t *r = (ring_t*) pthread_getspecific(ring_key);
+  if (!r) {
+    // First entry of this thread
+    r = new ring_t;
+    r->buf      = new uint8_t[ring_size];
+    r->size     = ring_size;
+    r->wpos     = 0;
+    r->rpos     = 0;
+    r->dropped  = 0;
+    r->reported = 0;
+    r->closed   = false;
+    pthread_mutex_lock(&mutex);
+    rings.push_back(r);
+    pthread_mutex_unlock(&mutex);
+    pthread_setspecific(ring_key, r);
+  }
+  return r;
+}
+
+void logger_binary::ring_release(void *ring)
+{
+  ((ring_t*) ring)->closed = true;
+}
+
+/* Records in the ring are a 32 bit length followed by the entry, 4 byte
+ * aligned. A zero length means that the rest of the ring is unused and the
+ * next record starts at the beginning.
+ */
+void logger_binary::push(const uint8_t *data, uint32_t len)
+{
+  if (!is_running) {
+    return;
+  }
+  ring_t  *r     = get_ring();
+  uint32_t total = (sizeof(uint32_t) + len + 3) & ~3;
+  uint32_t wpos  = r->wpos;
+  uint32_t off   = wpos & (r->size - 1);
+  uint32_t tail  = r->size - off;
+  uint32_t need  = total <= tail ? total : total + tail;
+
+  if (r->size - (wpos - r->rpos) < need) {
+    r->dropped++;
+    return;
+  }
+  if (total > tail) {
+    uint32_t wrap = 0;
+    memcpy(&r->buf[off], &wrap, sizeof(uint32_t));
+    wpos += tail;
+    off   = 0;
+  }
+  memcpy(&r->buf[off], &len, sizeof(uint32_t));
+  memcpy(&r->buf[off + sizeof(uint32_t)], data, len);
+  __sync_synchronize();
+  r->wpos = wpos + total;
+}
+
+/*******************************************************************************
+  Consumer
+*******************************************************************************/
+
+void logger_binary::run_thread()
+{
+  while (is_running) {
+    if (drain() == 0) {
+      usleep(LOGGER_BINARY_POLL_US);
+    }
+  }
+}
+
+uint32_t logger_binary::drain()
+{
+  uint32_t n = 0;
+
+  pthread_mutex_lock(&mutex);
+  for (; nof_layers_written < layers.size(); nof_layers_written++) {
+    if (logfile) {
+      uint8_t  type = RECORD_LAYER;
+      uint16_t id   = (uint16_t) nof_layers_written;
+      uint16_t len  = (uint16_t) layers[id].size();
+      fwrite(&type, 1, 1, logfile);
+      fwrite(&id, sizeof(uint16_t), 1, logfile);
+      fwrite(&len, sizeof(uint16_t), 1, logfile);
+      fwrite(layers[id].c_str(), 1, len, logfile);
+    }
+  }
+
+  std::vector<ring_t*>::iterator it = rings.begin();
+  while (it != rings.end()) {
+    ring_t  *r    = *it;
+    bool     closed = r->closed;
+    uint32_t wpos = r->wpos;
+    __sync_synchronize();
+    uint32_t rpos = r->rpos;
+    while (rpos != wpos) {
+      uint32_t off = rpos & (r->size - 1);
+      uint32_t len;
+      memcpy(&len, &r->buf[off], sizeof(uint32_t));
+      if (len == 0) {
+        rpos += r->size - off;
+        continue;
+      }
+      write_entry(&r->buf[off + sizeof(uint32_t)], len);
+      rpos += (sizeof(uint32_t) + len + 3) & ~3;
+      n++;
+    }
+    __sync_synchronize();
+    r->rpos = rpos;
+
+    uint32_t dropped = r->dropped;
+    if (dropped != r->reported) {
+      char buf[64];
+      snprintf(buf, sizeof(buf), "Log ring full, %d entries dropped\n", dropped - r->reported);
+      write_text(buf);
+      r->reported = dropped;
+    }
+
+    // entries written before the thread exited are all in by now
+    if (closed) {
+      nof_dropped += r->dropped;
+      delete [] r->buf;
+      delete r;
+      it = rings.erase(it);
+    } else {
+      it++;
+    }
+  }
+  pthread_mutex_unlock(&mutex);
+  return n;
+}
+
+void logger_binary::write_entry(const uint8_t *data, uint32_t len)
+{
+  if (!logfile || len < sizeof(logger_binary_entry_t)) {
+    return;
+  }
+  uint64_t fmt_id;
+  memcpy(&fmt_id, data, sizeof(uint64_t));
+  if (fmts_written.insert(fmt_id).second) {
+    const char *fmt  = (const char*) (uintptr_t) fmt_id;
+    uint8_t     type = RECORD_FORMAT;
+    uint16_t    flen = (uint16_t) strlen(fmt);
+    fwrite(&type, 1, 1, logfile);
+    fwrite(&fmt_id, sizeof(uint64_t), 1, logfile);
+    fwrite(&flen, sizeof(uint16_t), 1, logfile);
+    fwrite(fmt, 1, flen, logfile);
+  }
+  uint8_t type = RECORD_ENTRY;
+  fwrite(&type, 1, 1, logfile);
+  fwrite(&len, sizeof(uint32_t), 1, logfile);
+  fwrite(data, 1, len, logfile);
+}
+
+void logger_binary::write_text(const char *text)
+{
+  if (logfile) {
+    uint8_t  type = RECORD_TEXT;
+    uint32_t len  = (uint32_t) strlen(text);
+    fwrite(&type, 1, 1, logfile);
+    fwrite(&len, sizeof(uint32_t), 1, logfile);
+    fwrite(text, 1, len, logfile);
+  }
+}
+
+/*******************************************************************************
+  Decoder
+*******************************************************************************/
+
+static std::string time_string(const logger_binary_entry_t *e)
+{
+  char buffer[64];
+  char us[16];
+
+  if (e->flags & LOGGER_BINARY_FLAG_EPOCH) {
+    uint64_t usec_epoch = e->secs * 1000000 + e->usecs;
+    snprintf(buffer, 64, "%ld", (long) usec_epoch);
+  } else if (e->flags & LOGGER_BINARY_FLAG_TIME_SRC) {
+    snprintf(buffer, 64, "%ld:%06u", (long) e->secs, e->usecs);
+  } else {
+    time_t secs = (time_t) e->secs;
+    struct tm *timeinfo = localtime(&secs);
+    strftime(buffer, 64, "%H:%M:%S", timeinfo);
+    strcat(buffer, ".");
+    snprintf(us, 16, "%06u", e->usecs);
+    strcat(buffer, us);
+  }
+  return std::string(buffer);
+}
+
+static std::string hex_string(const uint8_t *hex, int size)
+{
+  std::string s;
+  char        buf[32];
+  int         c = 0;
+
+  while (c < size) {
+    snprintf(buf, sizeof(buf), "             %04x: ", c);
+    s.append(buf);
+    int tmp = (size-c < 16) ? size-c : 16;
+    for (int i = 0; i < tmp; i++) {
+      snprintf(buf, sizeof(buf), "%02x ", hex[c++]);
+      s.append(buf);
+    }
+    s.append("\n");
+  }
+  return s;
+}
+
+template <typename T>
+static bool read_value(FILE *in, T *v)
+{
+  return fread(v, sizeof(T), 1, in) == 1;
+}
+
+static bool read_string(FILE *in, uint32_t len, std::string *s)
+{
+  std::vector<char> buf(len + 1);
+  if (len > 0 && fread(&buf[0], 1, len, in) != len) {
+    return false;
+  }
+  s->assign(&buf[0], len);
+  return true;
+}
+
+bool logger_binary::decode(FILE *in, FILE *out)
+{
+  std::map<uint64_t, std::string> fmts;
+  std::map<uint16_t, std::string> layer_names;
+  char    magic[sizeof(LOGGER_BINARY_MAGIC)];
+  uint8_t type;
+
+  if (fread(magic, 1, strlen(LOGGER_BINARY_MAGIC), in) != strlen(LOGGER_BINARY_MAGIC) ||
+      memcmp(magic, LOGGER_BINARY_MAGIC, strlen(LOGGER_BINARY_MAGIC))) {
+    fprintf(stderr, "Not a binary log file\n");
+    return false;
+  }
+
+  while (read_value(in, &type)) {
+    switch (type) {
+      case RECORD_FORMAT: {
+        uint64_t    id;
+        uint16_t    len;
+        std::string s;
+        if (!read_value(in, &id) || !read_value(in, &len) || !read_string(in, len, &s)) {
+          return false;
+        }
+        fmts[id] = s;
+        break;
+      }
+      case RECORD_LAYER: {
+        uint16_t    id;
+        uint16_t    len;
+        std::string s;
+        if (!read_value(in, &id) || !read_value(in, &len) || !read_string(in, len, &s)) {
+          return false;
+        }
+        layer_names[id] = s;
+        break;
+      }
+      case RECORD_TEXT: {
+        uint32_t    len;
+        std::string s;
+        if (!read_value(in, &len) || !read_string(in, len, &s)) {
+          return false;
+        }
+        fputs(s.c_str(), out);
+        break;
+      }
+      case RECORD_ENTRY: {
+        uint32_t len;
+        if (!read_value(in, &len) || len < sizeof(logger_binary_entry_t) || len > LOGGER_BINARY_MAX_ENTRY) {
+          return false;
+        }
+        uint8_t data[LOGGER_BINARY_MAX_ENTRY];
+        if (fread(data, 1, len, in) != len) {
+          return false;
+        }
+        logger_binary_entry_t e;
+        memcpy(&e, data, sizeof(logger_binary_entry_t));
+        const uint8_t *args = &data[sizeof(logger_binary_entry_t)];
+        const uint8_t *hex  = &args[e.args_len];
+        if (sizeof(logger_binary_entry_t) + e.args_len + e.hex_len > len) {
+          return false;
+        }
+
+        std::string msg;
+        std::map<uint64_t, std::string>::iterator f = fmts.find(e.fmt_id);
+        if (f == fmts.end() || !render_args(msg, f->second.c_str(), args, e.args_len)) {
+          msg = "(undecodable entry)\n";
+        }
+
+        std::string line;
+        if (e.flags & LOGGER_BINARY_FLAG_RAW) {
+          line = msg;
+        } else {
+          line = time_string(&e) + " ";
+          if (e.flags & LOGGER_BINARY_FLAG_SHOW_LAYER) {
+            line += "[" + layer_names[e.layer_id] + "] ";
+          }
+          if (e.level < LOG_LEVEL_N_ITEMS) {
+            line += (e.flags & LOGGER_BINARY_FLAG_LEVEL_SHORT) ? log_level_text_short[e.level] : log_level_text[e.level];
+            line += " ";
+          }
+          if (e.flags & LOGGER_BINARY_FLAG_TTI) {
+            char buf[16];
+            snprintf(buf, sizeof(buf), "[%05d] ", e.tti);
+            line += buf;
+          }
+          if (e.flags & LOGGER_BINARY_FLAG_ADD_STRING) {
+            uint16_t n;
+            const uint8_t *s = &hex[e.hex_len];
+            if (sizeof(logger_binary_entry_t) + e.args_len + e.hex_len + sizeof(uint16_t) <= len) {
+              memcpy(&n, s, sizeof(uint16_t));
+              if (sizeof(logger_binary_entry_t) + e.args_len + e.hex_len + sizeof(uint16_t) + n <= len) {
+                line.append((const char*) &s[sizeof(uint16_t)], n);
+                line += " ";
+              }
+            }
+          }
+          line += msg;
+          if (e.flags & LOGGER_BINARY_FLAG_HEX) {
+            if (msg.empty() || msg[msg.size() - 1] != '\n') {
+              line += "\n";
+            }
+            line += hex_string(hex, e.hex_len);
+          }
+        }
+        fputs(line.c_str(), out);
+        break;
+      }
+      default:
+        fprintf(stderr, "Unknown record type 0x%02x\n", type);
+        return false;
+    }
+  }
+  return true;
+}
+
+} // namespace srslte
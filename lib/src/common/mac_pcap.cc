@@ -38,16 +38,21 @@ void mac_pcap::enable(bool en)
 {
   enable_write = true; 
 }
-void mac_pcap::open(const char* filename, uint32_t ue_id)
+void mac_pcap::open(const char* filename, uint32_t ue_id, int max_file_size, int max_file_time)
 {
-  pcap_file = LTE_PCAP_Open(MAC_LTE_DLT, filename);
+  writer.open(MAC_LTE_DLT, filename, max_file_size, max_file_time);
   this->ue_id = ue_id;
   enable_write = true;
 }
 void mac_pcap::close()
 {
   fprintf(stdout, "Saving MAC PCAP file\n");
-  LTE_PCAP_Close(pcap_file);
+  writer.close();
+}
+
+uint64_t mac_pcap::get_nof_dropped()
+{
+  return writer.get_nof_dropped();
 }
 
 void mac_pcap::set_ue_id(uint16_t ue_id) {
@@ -69,7 +74,9 @@ void mac_pcap::pack_and_write(uint8_t* pdu, uint32_t pdu_len_bytes, uint32_t reT
         (uint16_t)(tti%10)        /* Subframe number */
     };
     if (pdu) {
-      LTE_PCAP_MAC_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+      uint8_t context_header[LTE_PCAP_MAX_CONTEXT];
+      int     context_len = LTE_PCAP_MAC_PackContext(&context, context_header);
+      writer.write(context_header, context_len, pdu, pdu_len_bytes);
     }
   }
 }
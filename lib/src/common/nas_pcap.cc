@@ -10,24 +10,23 @@ void nas_pcap::enable()
 {
   enable_write = true;
 }
-void nas_pcap::open(const char* filename, uint32_t ue_id)
+void nas_pcap::open(const char* filename, uint32_t ue_id, int max_file_size, int max_file_time)
 {
-  pcap_file = LTE_PCAP_Open(NAS_LTE_DLT, filename);
+  writer.open(NAS_LTE_DLT, filename, max_file_size, max_file_time);
   ue_id = ue_id;
   enable_write = true;
 }
 void nas_pcap::close()
 {
   fprintf(stdout, "Saving NAS PCAP file\n");
-  LTE_PCAP_Close(pcap_file);
+  writer.close();
 }
 
 void nas_pcap::write_nas(uint8_t *pdu, uint32_t pdu_len_bytes)
 {
     if (enable_write) {
-      NAS_Context_Info_t  context;
       if (pdu) {
-        LTE_PCAP_NAS_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+        writer.write(NULL, 0, pdu, pdu_len_bytes);
       }
     }
 }
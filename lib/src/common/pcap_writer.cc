@@ -0,0 +1,365 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "srslte/common/pcap_writer.h"
+
+namespace srslte {
+
+pcap_writer::pcap_writer()
+  :pcap_file(NULL)
+  ,dlt(0)
+  ,max_file_bytes(0)
+  ,max_file_secs(0)
+  ,cur_file_bytes(0)
+  ,cur_file_start(0)
+  ,name_idx(0)
+  ,is_running(false)
+  ,ring_size(PCAP_WRITER_RING_SIZE)
+  ,batch(NULL)
+  ,batch_len(0)
+  ,nof_written(0)
+  ,nof_dropped(0)
+  ,nof_truncated(0)
+{
+  pthread_mutex_init(&mutex, NULL);
+  pthread_key_create(&ring_key, ring_release);
+}
+
+pcap_writer::~pcap_writer()
+{
+  close();
+  pthread_key_delete(ring_key);
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    delete [] rings[i]->buf;
+    delete rings[i];
+  }
+  if (batch) {
+    delete [] batch;
+  }
+  pthread_mutex_destroy(&mutex);
+}
+
+bool pcap_writer::open(uint32_t dlt_, std::string filename_, int max_file_size, int max_file_time,
+                       uint32_t ring_size_)
+{
+  if (is_running) {
+    return false;
+  }
+  // round up to a power of two that fits the longest record twice
+  ring_size = 2*1024;
+  while (ring_size < ring_size_ || ring_size < 2*(sizeof(uint32_t) + sizeof(pcaprec_hdr_t) + PCAP_WRITER_SNAPLEN)) {
+    ring_size <<= 1;
+  }
+  if (!batch) {
+    batch = new uint8_t[PCAP_WRITER_BATCH_SIZE];
+  }
+  batch_len      = 0;
+  dlt            = dlt_;
+  filename       = filename_;
+  max_file_bytes = max_file_size > 0 ? (int64_t) max_file_size*1024 : 0;
+  max_file_secs  = max_file_time > 0 ? max_file_time : 0;
+  name_idx       = 0;
+  if (!open_file()) {
+    return false;
+  }
+  is_running = true;
+  start(-2);
+  return true;
+}
+
+void pcap_writer::close()
+{
+  if (is_running) {
+    is_running = false;
+    wait_thread_finish();
+    drain();
+    if (pcap_file) {
+      fclose(pcap_file);
+      pcap_file = NULL;
+    }
+    uint64_t dropped = get_nof_dropped();
+    if (dropped || nof_truncated) {
+      printf("PCAP %s: %lu packets dropped, %u truncated\n", filename.c_str(),
+             (unsigned long) dropped, (uint32_t) nof_truncated);
+    }
+  }
+}
+
+bool pcap_writer::is_open()
+{
+  return is_running;
+}
+
+uint64_t pcap_writer::get_nof_written()
+{
+  pthread_mutex_lock(&mutex);
+  uint64_t n = nof_written;
+  pthread_mutex_unlock(&mutex);
+  return n;
+}
+
+uint64_t pcap_writer::get_nof_dropped()
+{
+  uint64_t n = 0;
+  pthread_mutex_lock(&mutex);
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    n += rings[i]->dropped;
+  }
+  n += nof_dropped;
+  pthread_mutex_unlock(&mutex);
+  return n;
+}
+
+uint64_t pcap_writer::get_nof_truncated()
+{
+  return nof_truncated;
+}
+
+uint32_t pcap_writer::get_nof_files()
+{
+  return name_idx + 1;
+}
+
+/*******************************************************************************
+  Producers
+*******************************************************************************/
+
+pcap_writer::ring_t* pcap_writer::get_ring()
+{
+  ring_t *r = (ring_t*) pthread_getspecific(ring_key);
+  if (!r) {
+    // First record of this thread
+    r = new ring_t;
+    r->buf     = new uint8_t[ring_size];
+    r->size    = ring_size;
+    r->wpos    = 0;
+    r->rpos    = 0;
+    r->dropped = 0;
+    r->closed  = false;
+    pthread_mutex_lock(&mutex);
+    rings.push_back(r);
+    pthread_mutex_unlock(&mutex);
+    pthread_setspecific(ring_key, r);
+  }
+  return r;
+}
+
+void pcap_writer::ring_release(void *ring)
+{
+  ((ring_t*) ring)->closed = true;
+}
+
+/* Records in the ring are a 32 bit length followed by the pcap record, 4 byte
+ * aligned. A zero length means that the rest of the ring is unused and the
+ * next record starts at the beginning.
+ */
+void pcap_writer::write(const uint8_t *context, uint32_t context_len, const uint8_t *pdu, uint32_t pdu_len)
+{
+  if (!is_running) {
+    return;
+  }
+
+  pcaprec_hdr_t packet_header;
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  packet_header.ts_sec   = t.tv_sec;
+  packet_header.ts_usec  = t.tv_usec;
+  packet_header.orig_len = context_len + pdu_len;
+  packet_header.incl_len = context_len + pdu_len;
+  if (packet_header.incl_len > PCAP_WRITER_SNAPLEN) {
+    packet_header.incl_len = PCAP_WRITER_SNAPLEN;
+    if (context_len > PCAP_WRITER_SNAPLEN) {
+      context_len = PCAP_WRITER_SNAPLEN;
+    }
+    pdu_len = PCAP_WRITER_SNAPLEN - context_len;
+    __sync_fetch_and_add(&nof_truncated, 1);
+  }
+
+  ring_t  *r     = get_ring();
+  uint32_t len   = sizeof(pcaprec_hdr_t) + packet_header.incl_len;
+  uint32_t total = (sizeof(uint32_t) + len + 3) & ~3;
+  uint32_t wpos  = r->wpos;
+  uint32_t off   = wpos & (r->size - 1);
+  uint32_t tail  = r->size - off;
+  uint32_t need  = total <= tail ? total : total + tail;
+
+  if (r->size - (wpos - r->rpos) < need) {
+    r->dropped++;
+    return;
+  }
+  if (total > tail) {
+    uint32_t wrap = 0;
+    memcpy(&r->buf[off], &wrap, sizeof(uint32_t));
+    wpos += tail;
+    off   = 0;
+  }
+  uint8_t *p = &r->buf[off];
+  memcpy(p, &len, sizeof(uint32_t));
+  p += sizeof(uint32_t);
+  memcpy(p, &packet_header, sizeof(pcaprec_hdr_t));
+  p += sizeof(pcaprec_hdr_t);
+  if (context_len) {
+    memcpy(p, context, context_len);
+    p += context_len;
+  }
+  if (pdu_len) {
+    memcpy(p, pdu, pdu_len);
+  }
+  __sync_synchronize();
+  r->wpos = wpos + total;
+}
+
+/*******************************************************************************
+  Consumer
+*******************************************************************************/
+
+void pcap_writer::run_thread()
+{
+  while (is_running) {
+    if (drain() == 0) {
+      usleep(PCAP_WRITER_POLL_US);
+    }
+  }
+}
+
+uint32_t pcap_writer::drain()
+{
+  uint32_t n = 0;
+
+  pthread_mutex_lock(&mutex);
+  std::vector<ring_t*>::iterator it = rings.begin();
+  while (it != rings.end()) {
+    ring_t  *r      = *it;
+    bool     closed = r->closed;
+    uint32_t wpos   = r->wpos;
+    __sync_synchronize();
+    uint32_t rpos   = r->rpos;
+    while (rpos != wpos) {
+      uint32_t off = rpos & (r->size - 1);
+      uint32_t len;
+      memcpy(&len, &r->buf[off], sizeof(uint32_t));
+      if (len == 0) {
+        rpos += r->size - off;
+        continue;
+      }
+      append(&r->buf[off + sizeof(uint32_t)], len);
+      rpos += (sizeof(uint32_t) + len + 3) & ~3;
+      n++;
+    }
+    __sync_synchronize();
+    r->rpos = rpos;
+
+    // records written before the thread exited are all in by now
+    if (closed) {
+      nof_dropped += r->dropped;
+      delete [] r->buf;
+      delete r;
+      it = rings.erase(it);
+    } else {
+      it++;
+    }
+  }
+  flush();
+  pthread_mutex_unlock(&mutex);
+  return n;
+}
+
+void pcap_writer::append(const uint8_t *data, uint32_t len)
+{
+  if (cur_file_bytes + batch_len > (int64_t) sizeof(pcap_hdr_t)) {
+    bool too_big = max_file_bytes > 0 && cur_file_bytes + batch_len + len > max_file_bytes;
+    bool too_old = max_file_secs > 0 && time(NULL) - cur_file_start >= max_file_secs;
+    if (too_big || too_old) {
+      flush();
+      rotate();
+    }
+  }
+  if (batch_len + len > PCAP_WRITER_BATCH_SIZE) {
+    flush();
+  }
+  memcpy(&batch[batch_len], data, len);
+  batch_len += len;
+  nof_written++;
+}
+
+void pcap_writer::flush()
+{
+  if (batch_len > 0) {
+    if (pcap_file) {
+      fwrite(batch, 1, batch_len, pcap_file);
+      cur_file_bytes += batch_len;
+    }
+    batch_len = 0;
+  }
+}
+
+bool pcap_writer::open_file()
+{
+  pcap_hdr_t file_header =
+  {
+      0xa1b2c3d4,            /* magic number */
+      2, 4,                  /* version number is 2.4 */
+      0,                     /* timezone */
+      0,                     /* sigfigs */
+      PCAP_WRITER_SNAPLEN,   /* snaplen */
+      dlt                    /* Data Link Type (DLT) */
+  };
+
+  std::string name = filename;
+  if (name_idx > 0) {
+    char numstr[16];
+    snprintf(numstr, sizeof(numstr), ".%d", name_idx);
+    name += numstr;
+  }
+  pcap_file = fopen(name.c_str(), "w");
+  if (pcap_file == NULL) {
+    printf("Failed to open file \"%s\" for writing\n", name.c_str());
+    return false;
+  }
+  // the batches are already large, write them straight through
+  setvbuf(pcap_file, NULL, _IONBF, 0);
+  fwrite(&file_header, sizeof(pcap_hdr_t), 1, pcap_file);
+  cur_file_bytes = sizeof(pcap_hdr_t);
+  cur_file_start = time(NULL);
+  return true;
+}
+
+void pcap_writer::rotate()
+{
+  if (pcap_file) {
+    fclose(pcap_file);
+    pcap_file = NULL;
+  }
+  name_idx++;
+  open_file();
+}
+
+} // namespace srslte
@@ -36,17 +36,17 @@ void rlc_pcap::enable(bool en)
 {
   enable_write = true; 
 }
-void rlc_pcap::open(const char* filename, uint32_t ue_id)
+void rlc_pcap::open(const char* filename, uint32_t ue_id, int max_file_size, int max_file_time)
 {
   fprintf(stdout, "Opening RLC PCAP with DLT=%d\n", RLC_LTE_DLT);
-  pcap_file = LTE_PCAP_Open(RLC_LTE_DLT, filename);
+  writer.open(RLC_LTE_DLT, filename, max_file_size, max_file_time);
   this->ue_id = ue_id;
   enable_write = true;
 }
 void rlc_pcap::close()
 {
   fprintf(stdout, "Saving RLC PCAP file\n");
-  LTE_PCAP_Close(pcap_file);
+  writer.close();
 }
 
 void rlc_pcap::set_ue_id(uint16_t ue_id) {
@@ -66,7 +66,9 @@ void rlc_pcap::pack_and_write(uint8_t* pdu, uint32_t pdu_len_bytes, uint8_t mode
     context.channelId = channel_id;
     context.pduLength = pdu_len_bytes;
     if (pdu) {
-      LTE_PCAP_RLC_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+      uint8_t context_header[LTE_PCAP_MAX_CONTEXT];
+      int     context_len = LTE_PCAP_RLC_PackContext(&context, pdu_len_bytes, context_header);
+      writer.write(context_header, context_len, pdu, pdu_len_bytes);
     }
   }
 }
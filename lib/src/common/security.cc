@@ -139,20 +139,13 @@ uint8_t security_128_eia1( uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *mac)
 {
-  uint32_t msg_len_bits;
-  uint32_t i;
-  uint8_t *m_ptr;
-
-  msg_len_bits = msg_len*8;
-  m_ptr = snow3g_f9(key,
-                    count,
-                    bearer,
-                    direction,
-                    msg,
-                    msg_len_bits);
-  for(i=0; i<4; i++) {
-    mac[i] = m_ptr[i];
-  }
+  snow3g_f9_words(key,
+                  count,
+                  bearer,
+                  direction,
+                  msg,
+                  (uint64_t) msg_len*8,
+                  mac);
   return ERROR_NONE;
 }
 
@@ -164,13 +157,15 @@ uint8_t security_128_eia2( uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *mac)
 {
-  return liblte_security_128_eia2(key,
-                                  count,
-                                  bearer,
-                                  direction,
-                                  msg,
-                                  msg_len,
-                                  mac);
+  security_aes_ctx_t ctx;
+  security_aes_init(&ctx, key);
+  return security_128_eia2(&ctx,
+                           count,
+                           bearer,
+                           direction,
+                           msg,
+                           msg_len,
+                           mac);
 }
 
 uint8_t security_md5(const uint8_t *input, size_t len, uint8_t *output)
@@ -198,13 +193,14 @@ uint8_t security_128_eea1(uint8_t  *key,
                            uint32_t msg_len,
                            uint8_t *msg_out){
 
-    return liblte_security_encryption_eea1(key,
-                                           count,
-                                           bearer,
-                                           direction,
-                                           msg,
-                                           msg_len * 8,
-                                           msg_out);
+    snow3g_f8_words(key,
+                    count,
+                    bearer,
+                    direction,
+                    msg,
+                    msg_out,
+                    msg_len * 8);
+    return ERROR_NONE;
 
 }
 
@@ -217,13 +213,15 @@ uint8_t security_128_eea2(uint8_t  *key,
                            uint32_t msg_len,
                            uint8_t *msg_out){
 
-    return liblte_security_encryption_eea2(key,
-                                           count,
-                                           bearer,
-                                           direction,
-                                           msg,
-                                           msg_len * 8,
-                                           msg_out);
+    security_aes_ctx_t ctx;
+    security_aes_init(&ctx, key);
+    return security_128_eea2(&ctx,
+                             count,
+                             bearer,
+                             direction,
+                             msg,
+                             msg_len,
+                             msg_out);
 }
 
 /******************************************************************************
@@ -0,0 +1,394 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/******************************************************************************
+ * AES-128 with a cached key schedule for EEA2 (CTR) and EIA2 (CMAC).
+ *
+ * Document Reference: 33.401 v13.1.0 Annex B.1.3 and B.2.3
+ *                     FIPS-197, RFC4493
+ *****************************************************************************/
+
+#include <pthread.h>
+#include <string.h>
+#ifdef LV_HAVE_AESNI_TARGET
+#include <immintrin.h>
+#endif
+#include "srslte/common/security.h"
+
+namespace srslte {
+
+static const uint8_t aes_sbox[256] = {
+  0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+  0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+  0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+  0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+  0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+  0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+  0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+  0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+  0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+  0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+  0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+  0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+  0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+  0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+  0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+  0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+static const uint8_t aes_rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
+
+// Round tables, SubBytes and MixColumns for one byte of each column
+static uint32_t       aes_t[4][256];
+static pthread_once_t aes_t_once = PTHREAD_ONCE_INIT;
+
+static void aes_gen_tables()
+{
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t s  = aes_sbox[i];
+    uint32_t s2 = ((s << 1) ^ ((s & 0x80) ? 0x1b : 0)) & 0xff;
+    uint32_t s3 = s2 ^ s;
+    uint32_t t  = (s2 << 24) | (s << 16) | (s << 8) | s3;
+    aes_t[0][i] = t;
+    aes_t[1][i] = (t >> 8)  | (t << 24);
+    aes_t[2][i] = (t >> 16) | (t << 16);
+    aes_t[3][i] = (t >> 24) | (t << 8);
+  }
+}
+
+static inline uint32_t load_be32(const uint8_t *p)
+{
+  return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+static inline void store_be32(uint8_t *p, uint32_t v)
+{
+  p[0] = (v >> 24) & 0xFF;
+  p[1] = (v >> 16) & 0xFF;
+  p[2] = (v >> 8) & 0xFF;
+  p[3] = v & 0xFF;
+}
+
+static void aes_encrypt_sw(const uint32_t *rk, const uint8_t in[16], uint8_t out[16])
+{
+  uint32_t s0 = load_be32(&in[0])  ^ rk[0];
+  uint32_t s1 = load_be32(&in[4])  ^ rk[1];
+  uint32_t s2 = load_be32(&in[8])  ^ rk[2];
+  uint32_t s3 = load_be32(&in[12]) ^ rk[3];
+  uint32_t t0, t1, t2, t3;
+
+  for (int r = 1; r < 10; r++) {
+    rk += 4;
+    t0 = aes_t[0][s0 >> 24] ^ aes_t[1][(s1 >> 16) & 0xff] ^ aes_t[2][(s2 >> 8) & 0xff] ^ aes_t[3][s3 & 0xff] ^ rk[0];
+    t1 = aes_t[0][s1 >> 24] ^ aes_t[1][(s2 >> 16) & 0xff] ^ aes_t[2][(s3 >> 8) & 0xff] ^ aes_t[3][s0 & 0xff] ^ rk[1];
+    t2 = aes_t[0][s2 >> 24] ^ aes_t[1][(s3 >> 16) & 0xff] ^ aes_t[2][(s0 >> 8) & 0xff] ^ aes_t[3][s1 & 0xff] ^ rk[2];
+    t3 = aes_t[0][s3 >> 24] ^ aes_t[1][(s0 >> 16) & 0xff] ^ aes_t[2][(s1 >> 8) & 0xff] ^ aes_t[3][s2 & 0xff] ^ rk[3];
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
+  }
+  rk += 4;
+
+  // last round has no MixColumns
+  t0 = ((uint32_t) aes_sbox[s0 >> 24] << 24) | ((uint32_t) aes_sbox[(s1 >> 16) & 0xff] << 16) |
+       ((uint32_t) aes_sbox[(s2 >> 8) & 0xff] << 8) | aes_sbox[s3 & 0xff];
+  t1 = ((uint32_t) aes_sbox[s1 >> 24] << 24) | ((uint32_t) aes_sbox[(s2 >> 16) & 0xff] << 16) |
+       ((uint32_t) aes_sbox[(s3 >> 8) & 0xff] << 8) | aes_sbox[s0 & 0xff];
+  t2 = ((uint32_t) aes_sbox[s2 >> 24] << 24) | ((uint32_t) aes_sbox[(s3 >> 16) & 0xff] << 16) |
+       ((uint32_t) aes_sbox[(s0 >> 8) & 0xff] << 8) | aes_sbox[s1 & 0xff];
+  t3 = ((uint32_t) aes_sbox[s3 >> 24] << 24) | ((uint32_t) aes_sbox[(s0 >> 16) & 0xff] << 16) |
+       ((uint32_t) aes_sbox[(s1 >> 8) & 0xff] << 8) | aes_sbox[s2 & 0xff];
+  store_be32(&out[0],  t0 ^ rk[0]);
+  store_be32(&out[4],  t1 ^ rk[1]);
+  store_be32(&out[8],  t2 ^ rk[2]);
+  store_be32(&out[12], t3 ^ rk[3]);
+}
+
+static void xor_block(uint8_t *out, const uint8_t *a, const uint8_t *b, uint32_t len)
+{
+  for (uint32_t i = 0; i < len; i++) {
+    out[i] = a[i] ^ b[i];
+  }
+}
+
+/* Block i of n of the EIA2 message M = COUNT | BEARER | DIRECTION | 0 | msg.
+ * Blocks in the middle are read in place, the others are copied to tmp. The
+ * last block is padded and xored with its CMAC subkey.
+ */
+static const uint8_t* cmac_block(const security_aes_ctx_t *ctx, const uint8_t hdr[8], const uint8_t *msg,
+                                 uint32_t msg_len, uint32_t i, uint32_t n, uint8_t tmp[16])
+{
+  uint32_t start = 16*i;
+  if (i > 0 && i < n - 1) {
+    return &msg[start - 8];
+  }
+  uint32_t len = msg_len + 8 - start < 16 ? msg_len + 8 - start : 16;
+  uint32_t j   = 0;
+  for (; j < len && start + j < 8; j++) {
+    tmp[j] = hdr[start + j];
+  }
+  if (j < len) {
+    memcpy(&tmp[j], &msg[start + j - 8], len - j);
+  }
+  if (i == n - 1) {
+    if (len < 16) {
+      tmp[len] = 0x80;
+      memset(&tmp[len + 1], 0, 15 - len);
+      xor_block(tmp, tmp, ctx->k2, 16);
+    } else {
+      xor_block(tmp, tmp, ctx->k1, 16);
+    }
+  }
+  return tmp;
+}
+
+static void aes_ctr_sw(const security_aes_ctx_t *ctx, const uint8_t nonce[8], const uint8_t *in,
+                       uint32_t len, uint8_t *out)
+{
+  uint8_t  blk[16];
+  uint8_t  ks[16];
+  uint32_t ctr = 0;
+  memcpy(blk, nonce, 8);
+  store_be32(&blk[8], 0);
+  while (len > 0) {
+    uint32_t n = len < 16 ? len : 16;
+    store_be32(&blk[12], ctr++);
+    aes_encrypt_sw(ctx->rk_w, blk, ks);
+    xor_block(out, in, ks, n);
+    in  += n;
+    out += n;
+    len -= n;
+  }
+}
+
+static void aes_cmac_sw(const security_aes_ctx_t *ctx, const uint8_t hdr[8], const uint8_t *msg,
+                        uint32_t msg_len, uint8_t mac[16])
+{
+  uint8_t  tmp[16];
+  uint8_t  x[16];
+  uint32_t n = (msg_len + 8 + 15) / 16;
+  memset(mac, 0, 16);
+  for (uint32_t i = 0; i < n; i++) {
+    xor_block(x, mac, cmac_block(ctx, hdr, msg, msg_len, i, n, tmp), 16);
+    aes_encrypt_sw(ctx->rk_w, x, mac);
+  }
+}
+
+#ifdef LV_HAVE_AESNI_TARGET
+#pragma GCC push_options
+#pragma GCC target("sse4.1,aes")
+
+static inline __m128i aes_encrypt_ni(const __m128i *k, __m128i b)
+{
+  b = _mm_xor_si128(b, k[0]);
+  for (int r = 1; r < 10; r++) {
+    b = _mm_aesenc_si128(b, k[r]);
+  }
+  return _mm_aesenclast_si128(b, k[10]);
+}
+
+static inline __m128i ctr_block_ni(uint64_t nonce, uint32_t ctr)
+{
+  return _mm_set_epi64x((long long) __builtin_bswap64((uint64_t) ctr), (long long) nonce);
+}
+
+// Four counter blocks go through the rounds together to hide the AESENC latency
+static void aes_ctr_ni(const security_aes_ctx_t *ctx, const uint8_t nonce[8], const uint8_t *in,
+                       uint32_t len, uint8_t *out)
+{
+  __m128i  k[11];
+  uint64_t n;
+  uint32_t ctr = 0;
+  for (int r = 0; r < 11; r++) {
+    k[r] = _mm_loadu_si128((const __m128i*) ctx->rk[r]);
+  }
+  memcpy(&n, nonce, 8);
+
+  for (; len >= 64; len -= 64, in += 64, out += 64, ctr += 4) {
+    __m128i b0 = _mm_xor_si128(ctr_block_ni(n, ctr),     k[0]);
+    __m128i b1 = _mm_xor_si128(ctr_block_ni(n, ctr + 1), k[0]);
+    __m128i b2 = _mm_xor_si128(ctr_block_ni(n, ctr + 2), k[0]);
+    __m128i b3 = _mm_xor_si128(ctr_block_ni(n, ctr + 3), k[0]);
+    for (int r = 1; r < 10; r++) {
+      b0 = _mm_aesenc_si128(b0, k[r]);
+      b1 = _mm_aesenc_si128(b1, k[r]);
+      b2 = _mm_aesenc_si128(b2, k[r]);
+      b3 = _mm_aesenc_si128(b3, k[r]);
+    }
+    b0 = _mm_aesenclast_si128(b0, k[10]);
+    b1 = _mm_aesenclast_si128(b1, k[10]);
+    b2 = _mm_aesenclast_si128(b2, k[10]);
+    b3 = _mm_aesenclast_si128(b3, k[10]);
+    _mm_storeu_si128((__m128i*) &out[0],  _mm_xor_si128(b0, _mm_loadu_si128((const __m128i*) &in[0])));
+    _mm_storeu_si128((__m128i*) &out[16], _mm_xor_si128(b1, _mm_loadu_si128((const __m128i*) &in[16])));
+    _mm_storeu_si128((__m128i*) &out[32], _mm_xor_si128(b2, _mm_loadu_si128((const __m128i*) &in[32])));
+    _mm_storeu_si128((__m128i*) &out[48], _mm_xor_si128(b3, _mm_loadu_si128((const __m128i*) &in[48])));
+  }
+  for (; len >= 16; len -= 16, in += 16, out += 16, ctr++) {
+    __m128i b = aes_encrypt_ni(k, ctr_block_ni(n, ctr));
+    _mm_storeu_si128((__m128i*) out, _mm_xor_si128(b, _mm_loadu_si128((const __m128i*) in)));
+  }
+  if (len > 0) {
+    uint8_t ks[16];
+    _mm_storeu_si128((__m128i*) ks, aes_encrypt_ni(k, ctr_block_ni(n, ctr)));
+    xor_block(out, in, ks, len);
+  }
+}
+
+static void aes_cmac_ni(const security_aes_ctx_t *ctx, const uint8_t hdr[8], const uint8_t *msg,
+                        uint32_t msg_len, uint8_t mac[16])
+{
+  __m128i  k[11];
+  __m128i  t = _mm_setzero_si128();
+  uint8_t  tmp[16];
+  uint32_t n = (msg_len + 8 + 15) / 16;
+  for (int r = 0; r < 11; r++) {
+    k[r] = _mm_loadu_si128((const __m128i*) ctx->rk[r]);
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    __m128i m = _mm_loadu_si128((const __m128i*) cmac_block(ctx, hdr, msg, msg_len, i, n, tmp));
+    t = aes_encrypt_ni(k, _mm_xor_si128(t, m));
+  }
+  _mm_storeu_si128((__m128i*) mac, t);
+}
+
+#pragma GCC pop_options
+#endif // LV_HAVE_AESNI_TARGET
+
+bool security_aesni_supported()
+{
+#ifdef LV_HAVE_AESNI_TARGET
+  static int supported = -1;
+  if (supported < 0) {
+    __builtin_cpu_init();
+    supported = __builtin_cpu_supports("aes") && __builtin_cpu_supports("sse4.1");
+  }
+  return supported;
+#else
+  return false;
+#endif
+}
+
+static void cmac_subkey(const uint8_t *in, uint8_t *out)
+{
+  for (int i = 0; i < 15; i++) {
+    out[i] = (in[i] << 1) | ((in[i + 1] >> 7) & 0x01);
+  }
+  out[15] = in[15] << 1;
+  if (in[0] & 0x80) {
+    out[15] ^= 0x87;
+  }
+}
+
+void security_aes_init(security_aes_ctx_t *ctx, uint8_t *key)
+{
+  pthread_once(&aes_t_once, aes_gen_tables);
+
+  uint32_t *w = ctx->rk_w;
+  for (int i = 0; i < 4; i++) {
+    w[i] = load_be32(&key[4*i]);
+  }
+  for (int i = 4; i < 44; i++) {
+    uint32_t t = w[i - 1];
+    if (i % 4 == 0) {
+      t = ((uint32_t) aes_sbox[(t >> 16) & 0xff] << 24) | ((uint32_t) aes_sbox[(t >> 8) & 0xff] << 16) |
+          ((uint32_t) aes_sbox[t & 0xff] << 8) | aes_sbox[t >> 24];
+      t ^= (uint32_t) aes_rcon[i/4 - 1] << 24;
+    }
+    w[i] = w[i - 4] ^ t;
+  }
+  for (int i = 0; i < 44; i++) {
+    store_be32(&ctx->rk[i/4][4*(i%4)], w[i]);
+  }
+
+  // CMAC subkeys from L = AES(K, 0)
+  uint8_t zero[16];
+  uint8_t L[16];
+  memset(zero, 0, 16);
+  aes_encrypt_sw(ctx->rk_w, zero, L);
+  cmac_subkey(L, ctx->k1);
+  cmac_subkey(ctx->k1, ctx->k2);
+
+  ctx->aesni = security_aesni_supported();
+}
+
+uint8_t security_128_eia2( security_aes_ctx_t *ctx,
+                           uint32_t            count,
+                           uint32_t            bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len,
+                           uint8_t            *mac)
+{
+  uint8_t hdr[8];
+  uint8_t T[16];
+  store_be32(hdr, count);
+  hdr[4] = ((bearer & 0x1F) << 3) | ((direction & 0x01) << 2);
+  hdr[5] = 0;
+  hdr[6] = 0;
+  hdr[7] = 0;
+
+#ifdef LV_HAVE_AESNI_TARGET
+  if (ctx->aesni) {
+    aes_cmac_ni(ctx, hdr, msg, msg_len, T);
+  } else
+#endif
+  {
+    aes_cmac_sw(ctx, hdr, msg, msg_len, T);
+  }
+  memcpy(mac, T, 4);
+  return ERROR_NONE;
+}
+
+uint8_t security_128_eea2( security_aes_ctx_t *ctx,
+                           uint32_t            count,
+                           uint8_t             bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len,
+                           uint8_t            *msg_out)
+{
+  uint8_t nonce[8];
+  store_be32(nonce, count);
+  nonce[4] = ((bearer & 0x1F) << 3) | ((direction & 0x01) << 2);
+  nonce[5] = 0;
+  nonce[6] = 0;
+  nonce[7] = 0;
+
+#ifdef LV_HAVE_AESNI_TARGET
+  if (ctx->aesni) {
+    aes_ctr_ni(ctx, nonce, msg, msg_len, msg_out);
+  } else
+#endif
+  {
+    aes_ctr_sw(ctx, nonce, msg, msg_len, msg_out);
+  }
+  return ERROR_NONE;
+}
+
+} // namespace srslte
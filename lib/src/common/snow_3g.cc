@@ -10,6 +10,10 @@
 * Document 2: SNOW 3G Specification"
 *------------------------------------------------------------------------*/
 
+#include <pthread.h>
+#ifdef LV_HAVE_PCLMUL_TARGET
+#include <immintrin.h>
+#endif
 #include "srslte/common/snow_3g.h"
 
 /* LFSR */
@@ -575,3 +579,356 @@ u8* snow3g_f9( u8* key, u32 count, u32 fresh, u32 dir, u8 *data, u64 length)
 	
 	return MAC_I;
 }
+
+/*------------------------------------------------------------------------
+* Word-oriented engine
+*------------------------------------------------------------------------*/
+
+#define SNOW3G_KS_WORDS 64 /* Keystream words generated per f8 chunk */
+
+static u32 MULalpha_tab[256];
+static u32 DIValpha_tab[256];
+static u32 S1_tab[4][256];
+static u32 S2_tab[4][256];
+static u64 MUL64_red4[16]; /* t * x^64 mod the f9 polynomial, t of degree < 4 */
+static pthread_once_t snow3g_tab_once = PTHREAD_ONCE_INIT;
+
+/* S1 and S2 are a byte substitution followed by a MixColumn, so each input
+* byte contributes a fixed word that depends only on that byte.
+*/
+static void gen_sbox_tab(u32 tab[4][256], u8 *sbox, u8 c)
+{
+	int i;
+	for (i=0; i<256; i++)
+	{
+		u32 s1 = sbox[i];
+		u32 s2 = MULx(sbox[i], c);
+		u32 s3 = s2 ^ s1;
+		tab[0][i] = (s2 << 24) | (s3 << 16) | (s1 << 8) | s1;
+		tab[1][i] = (s1 << 24) | (s2 << 16) | (s3 << 8) | s1;
+		tab[2][i] = (s1 << 24) | (s1 << 16) | (s2 << 8) | s3;
+		tab[3][i] = (s3 << 24) | (s1 << 16) | (s1 << 8) | s2;
+	}
+}
+
+static void snow3g_gen_tables()
+{
+	int i, b;
+	for (i=0; i<256; i++)
+	{
+		MULalpha_tab[i] = MULalpha((u8)i);
+		DIValpha_tab[i] = DIValpha((u8)i);
+	}
+	gen_sbox_tab(S1_tab, SR, 0x1b);
+	gen_sbox_tab(S2_tab, SQ, 0x69);
+	for (i=0; i<16; i++)
+	{
+		MUL64_red4[i] = 0;
+		for (b=0; b<4; b++)
+			if ((i >> b) & 1)
+				MUL64_red4[i] ^= (u64)0x1b << b;
+	}
+}
+
+static inline u32 S1_fast(u32 w)
+{
+	return S1_tab[0][w >> 24] ^ S1_tab[1][(w >> 16) & 0xff] ^
+	       S1_tab[2][(w >> 8) & 0xff] ^ S1_tab[3][w & 0xff];
+}
+
+static inline u32 S2_fast(u32 w)
+{
+	return S2_tab[0][w >> 24] ^ S2_tab[1][(w >> 16) & 0xff] ^
+	       S2_tab[2][(w >> 8) & 0xff] ^ S2_tab[3][w & 0xff];
+}
+
+/* One clock of the FSM and of the LFSR, with s_i in s[(j + i) % 16]. The
+* new s_15 takes the place of s_0. Returns the FSM output F and, in
+* keystream mode, the keystream word F ^ s_0 in z.
+*/
+static inline u32 snow3g_clock(u32 *s, u32 j, u32 *r1, u32 *r2, u32 *r3, int init_mode)
+{
+	u32 s0  = s[j & 15];
+	u32 s11 = s[(j + 11) & 15];
+	u32 F   = (s[(j + 15) & 15] + *r1) ^ *r2;
+	u32 r   = *r2 + (*r3 ^ s[(j + 5) & 15]);
+	u32 v;
+
+	*r3 = S2_fast(*r2);
+	*r2 = S1_fast(*r1);
+	*r1 = r;
+
+	v = (s0 << 8) ^ MULalpha_tab[s0 >> 24] ^ s[(j + 2) & 15] ^
+	    (s11 >> 8) ^ DIValpha_tab[s11 & 0xff];
+	if (init_mode)
+		v ^= F;
+	s[j & 15] = v;
+	return F ^ s0;
+}
+
+void snow3g_state_init(snow3g_state_t *st, u32 k[4], u32 IV[4])
+{
+	u32 *s = st->s;
+	u32 j;
+
+	pthread_once(&snow3g_tab_once, snow3g_gen_tables);
+
+	s[15] = k[3] ^ IV[0];
+	s[14] = k[2];
+	s[13] = k[1];
+	s[12] = k[0] ^ IV[1];
+	s[11] = k[3] ^ 0xffffffff;
+	s[10] = k[2] ^ 0xffffffff ^ IV[2];
+	s[9]  = k[1] ^ 0xffffffff ^ IV[3];
+	s[8]  = k[0] ^ 0xffffffff;
+	s[7]  = k[3];
+	s[6]  = k[2];
+	s[5]  = k[1];
+	s[4]  = k[0];
+	s[3]  = k[3] ^ 0xffffffff;
+	s[2]  = k[2] ^ 0xffffffff;
+	s[1]  = k[1] ^ 0xffffffff;
+	s[0]  = k[0] ^ 0xffffffff;
+	st->r1 = 0;
+	st->r2 = 0;
+	st->r3 = 0;
+	for (j=0; j<32; j++)
+		snow3g_clock(s, j, &st->r1, &st->r2, &st->r3, 1);
+
+	/* First keystream mode clock, its output is discarded */
+	snow3g_clock(s, 0, &st->r1, &st->r2, &st->r3, 0);
+	st->base = 1;
+}
+
+#define SNOW3G_KS(i) ks[t + i] = snow3g_clock(s, i, &r1, &r2, &r3, 0)
+
+void snow3g_state_keystream(snow3g_state_t *st, u32 n, u32 *ks)
+{
+	u32 *s = st->s;
+	u32 j  = st->base;
+	u32 r1 = st->r1;
+	u32 r2 = st->r2;
+	u32 r3 = st->r3;
+	u32 t  = 0;
+
+	/* Until the LFSR position wraps, then 16 clocks with constant offsets */
+	while (t < n && (j & 15))
+	{
+		ks[t++] = snow3g_clock(s, j++, &r1, &r2, &r3, 0);
+	}
+	for (; t + 16 <= n; t += 16)
+	{
+		SNOW3G_KS(0);  SNOW3G_KS(1);  SNOW3G_KS(2);  SNOW3G_KS(3);
+		SNOW3G_KS(4);  SNOW3G_KS(5);  SNOW3G_KS(6);  SNOW3G_KS(7);
+		SNOW3G_KS(8);  SNOW3G_KS(9);  SNOW3G_KS(10); SNOW3G_KS(11);
+		SNOW3G_KS(12); SNOW3G_KS(13); SNOW3G_KS(14); SNOW3G_KS(15);
+	}
+	while (t < n)
+	{
+		ks[t++] = snow3g_clock(s, j++, &r1, &r2, &r3, 0);
+	}
+
+	st->base = j & 15;
+	st->r1 = r1;
+	st->r2 = r2;
+	st->r3 = r3;
+}
+
+void snow3g_f8_words(u8 *key, u32 count, u32 bearer, u32 dir, u8 *in, u8 *out, u32 length)
+{
+	u32 K[4], IV[4];
+	u32 ks[SNOW3G_KS_WORDS];
+	u8  kb[4*SNOW3G_KS_WORDS];
+	u32 nof_bytes = (length + 7) / 8;
+	int lastbits = (8-(length%8)) % 8;
+	snow3g_state_t st;
+	u32 i;
+
+	for (i=0; i<4; i++)
+		K[3-i] = (key[4*i] << 24) ^ (key[4*i+1] << 16)
+			   ^ (key[4*i+2] << 8) ^ (key[4*i+3]);
+	IV[3] = count;
+	IV[2] = (bearer << 27) | ((dir & 0x1) << 26);
+	IV[1] = IV[3];
+	IV[0] = IV[2];
+
+	snow3g_state_init(&st, K, IV);
+	while (nof_bytes > 0)
+	{
+		u32 nw = (nof_bytes + 3) / 4;
+		u32 nb;
+		if (nw > SNOW3G_KS_WORDS)
+			nw = SNOW3G_KS_WORDS;
+		nb = 4*nw < nof_bytes ? 4*nw : nof_bytes;
+
+		snow3g_state_keystream(&st, nw, ks);
+		for (i=0; i<nw; i++)
+		{
+			kb[4*i+0] = (u8) (ks[i] >> 24);
+			kb[4*i+1] = (u8) (ks[i] >> 16);
+			kb[4*i+2] = (u8) (ks[i] >> 8);
+			kb[4*i+3] = (u8) (ks[i]);
+		}
+		/* Vectorized by the compiler */
+		for (i=0; i<nb; i++)
+			out[i] = in[i] ^ kb[i];
+
+		in  += nb;
+		out += nb;
+		nof_bytes -= nb;
+	}
+
+	if (lastbits)
+		out[-1] &= 256 - (1<<lastbits);
+}
+
+/* Multiplication in GF(2^64) by a fixed P, with the products of P and
+* every polynomial of degree < 4 in tab, four bits of V at a time.
+*/
+static void MUL64_gen_tab(u64 P, u64 tab[16])
+{
+	int i, b;
+	for (i=0; i<16; i++)
+	{
+		tab[i] = 0;
+		for (b=0; b<4; b++)
+			if ((i >> b) & 1)
+				tab[i] ^= MUL64xPOW(P, b, 0x1b);
+	}
+}
+
+static inline u64 MUL64_tab(u64 V, u64 tab[16])
+{
+	u64 result = 0;
+	int i;
+	for (i=60; i>=0; i-=4)
+	{
+		result = (result << 4) ^ MUL64_red4[result >> 60];
+		result ^= tab[(V >> i) & 0xf];
+	}
+	return result;
+}
+
+static inline u64 load_be64(u8 *p)
+{
+	return (u64)p[0]<<56 | (u64)p[1]<<48 | (u64)p[2]<<40 | (u64)p[3]<<32 |
+	       (u64)p[4]<<24 | (u64)p[5]<<16 | (u64)p[6]<< 8 | (u64)p[7];
+}
+
+static u64 f9_eval_tab(u8 *data, u32 nof_blocks, u64 M_last, u64 P)
+{
+	u64 tab[16];
+	u64 EVAL = 0;
+	u32 i;
+	MUL64_gen_tab(P, tab);
+	for (i=0; i<nof_blocks; i++)
+		EVAL = MUL64_tab(EVAL ^ load_be64(&data[8*i]), tab);
+	return MUL64_tab(EVAL ^ M_last, tab);
+}
+
+#ifdef LV_HAVE_PCLMUL_TARGET
+#pragma GCC push_options
+#pragma GCC target("sse4.1,pclmul")
+
+/* 128-bit carry-less product, folded twice by x^64 = x^4 + x^3 + x + 1 */
+static inline u64 MUL64_clmul(u64 V, __m128i P)
+{
+	const __m128i c = _mm_cvtsi64_si128(0x1b);
+	__m128i p  = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) V), P, 0x00);
+	__m128i q  = _mm_clmulepi64_si128(p, c, 0x01);
+	__m128i r  = _mm_clmulepi64_si128(q, c, 0x01);
+	return (u64) _mm_cvtsi128_si64(_mm_xor_si128(_mm_xor_si128(p, q), r));
+}
+
+static u64 f9_eval_clmul(u8 *data, u32 nof_blocks, u64 M_last, u64 P)
+{
+	__m128i p = _mm_cvtsi64_si128((long long) P);
+	u64 EVAL = 0;
+	u32 i;
+	for (i=0; i<nof_blocks; i++)
+		EVAL = MUL64_clmul(EVAL ^ load_be64(&data[8*i]), p);
+	return MUL64_clmul(EVAL ^ M_last, p);
+}
+
+static u64 MUL64_fast_clmul(u64 V, u64 P)
+{
+	return MUL64_clmul(V, _mm_cvtsi64_si128((long long) P));
+}
+
+#pragma GCC pop_options
+#endif /* LV_HAVE_PCLMUL_TARGET */
+
+static int snow3g_pclmul_supported()
+{
+#ifdef LV_HAVE_PCLMUL_TARGET
+	static int supported = -1;
+	if (supported < 0)
+	{
+		__builtin_cpu_init();
+		supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+	}
+	return supported;
+#else
+	return 0;
+#endif
+}
+
+void snow3g_f9_words(u8 *key, u32 count, u32 fresh, u32 dir, u8 *data, u64 length, u8 *mac)
+{
+	u32 K[4], IV[4], z[5];
+	u32 i, D;
+	u64 EVAL, P, Q, M_D_2;
+	int rem_bits;
+	snow3g_state_t st;
+
+	for (i=0; i<4; i++)
+		K[3-i] = (key[4*i] << 24) ^ (key[4*i+1] << 16) ^
+				 (key[4*i+2] << 8) ^ (key[4*i+3]);
+	IV[3] = count;
+	IV[2] = fresh;
+	IV[1] = count ^ ( dir << 31 ) ;
+	IV[0] = fresh ^ (dir << 15);
+
+	snow3g_state_init(&st, K, IV);
+	snow3g_state_keystream(&st, 5, z);
+
+	P = (u64)z[0] << 32 | (u64)z[1];
+	Q = (u64)z[2] << 32 | (u64)z[3];
+
+	if ((length % 64) == 0)
+		D = (length>>6) + 1;
+	else
+		D = (length>>6) + 2;
+
+	/* Last message block, zero padded */
+	rem_bits = length % 64;
+	if (rem_bits == 0)
+		rem_bits = 64;
+	M_D_2 = 0;
+	i = 0;
+	while (rem_bits > 7)
+	{
+		M_D_2 |= (u64)data[8*(D-2)+i] << (8*(7-i));
+		rem_bits -= 8;
+		i++;
+	}
+	if (rem_bits > 0)
+		M_D_2 |= (u64)(data[8*(D-2)+i] & mask8bit(rem_bits)) << (8*(7-i));
+
+#ifdef LV_HAVE_PCLMUL_TARGET
+	if (snow3g_pclmul_supported())
+	{
+		EVAL = f9_eval_clmul(data, D-2, M_D_2, P);
+		EVAL = MUL64_fast_clmul(EVAL ^ length, Q);
+	} else
+#endif
+	{
+		u64 tab[16];
+		EVAL = f9_eval_tab(data, D-2, M_D_2, P);
+		MUL64_gen_tab(Q, tab);
+		EVAL = MUL64_tab(EVAL ^ length, tab);
+	}
+
+	for (i=0; i<4; i++)
+		mac[i] = ((EVAL >> (56-(i*8))) ^ (z[4] >> (24-(i*8)))) & 0xff;
+}
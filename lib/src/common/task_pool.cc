@@ -0,0 +1,212 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <sched.h>
+#include "srslte/common/task_pool.h"
+
+namespace srslte {
+
+task_pool::task_pool()
+{
+  nof_threads = 0;
+  nof_queued  = 0;
+  running     = false;
+}
+
+task_pool::~task_pool()
+{
+  stop();
+  for (uint32_t i = 0; i < slots.size(); i++) {
+    pthread_spin_destroy(&slots[i].lock);
+    delete [] slots[i].tasks;
+  }
+}
+
+bool task_pool::init(uint32_t nof_threads_, uint32_t nof_helpers, int prio)
+{
+  nof_threads = nof_threads_;
+  slots.resize(nof_threads + nof_helpers);
+  for (uint32_t i = 0; i < slots.size(); i++) {
+    pthread_spin_init(&slots[i].lock, PTHREAD_PROCESS_PRIVATE);
+    slots[i].front = 0;
+    slots[i].back  = 0;
+    slots[i].tasks = new task_t[SRSLTE_TASK_POOL_MAX_TASKS];
+  }
+  running = true;
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    worker *w = new worker;
+    w->setup(this, i);
+    if (!w->start(prio)) {
+      delete w;
+      stop();
+      return false;
+    }
+    workers.push_back(w);
+  }
+  return true;
+}
+
+void task_pool::stop()
+{
+  if (running) {
+    running = false;
+    work_available.wake_all();
+    for (uint32_t i = 0; i < workers.size(); i++) {
+      workers[i]->wait_thread_finish();
+      delete workers[i];
+    }
+    workers.clear();
+  }
+}
+
+uint32_t task_pool::get_nof_threads()
+{
+  return nof_threads;
+}
+
+uint32_t task_pool::get_nof_slots()
+{
+  return slots.size();
+}
+
+uint32_t task_pool::get_helper_slot(uint32_t helper_idx)
+{
+  return nof_threads + helper_idx;
+}
+
+void task_pool::push(uint32_t slot, group *g, task_func_t func, void *arg)
+{
+  task_t task;
+  task.func = func;
+  task.arg  = arg;
+  task.grp  = g;
+
+  __sync_fetch_and_add(&g->pending, 1);
+
+  slot_t *s = &slots[slot];
+  bool queued = false;
+  pthread_spin_lock(&s->lock);
+  if (s->back - s->front < SRSLTE_TASK_POOL_MAX_TASKS) {
+    s->tasks[s->back & (SRSLTE_TASK_POOL_MAX_TASKS - 1)] = task;
+    s->back++;
+    queued = true;
+  }
+  pthread_spin_unlock(&s->lock);
+
+  if (queued) {
+    __sync_fetch_and_add(&nof_queued, 1);
+    work_available.notify();
+  } else {
+    func(arg, slot);
+    __sync_fetch_and_sub(&g->pending, 1);
+  }
+}
+
+void task_pool::wait(uint32_t slot, group *g)
+{
+  while (!g->done()) {
+    task_t task;
+    if (get_task(slot, &task)) {
+      run_task(slot, &task);
+    } else {
+      // The remaining tasks are running in other threads
+      sched_yield();
+    }
+  }
+}
+
+// The owner takes the most recent task, its data is likely still in cache
+bool task_pool::pop(uint32_t slot, task_t *task)
+{
+  slot_t *s = &slots[slot];
+  bool ret = false;
+  pthread_spin_lock(&s->lock);
+  if (s->back != s->front) {
+    s->back--;
+    *task = s->tasks[s->back & (SRSLTE_TASK_POOL_MAX_TASKS - 1)];
+    ret = true;
+  }
+  pthread_spin_unlock(&s->lock);
+  return ret;
+}
+
+bool task_pool::steal(uint32_t slot, task_t *task)
+{
+  slot_t *s = &slots[slot];
+  bool ret = false;
+  if (s->back == s->front) {
+    return false;
+  }
+  pthread_spin_lock(&s->lock);
+  if (s->back != s->front) {
+    *task = s->tasks[s->front & (SRSLTE_TASK_POOL_MAX_TASKS - 1)];
+    s->front++;
+    ret = true;
+  }
+  pthread_spin_unlock(&s->lock);
+  return ret;
+}
+
+bool task_pool::get_task(uint32_t slot, task_t *task)
+{
+  if (pop(slot, task)) {
+    return true;
+  }
+  for (uint32_t i = 1; i < slots.size(); i++) {
+    if (steal((slot + i) % slots.size(), task)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void task_pool::run_task(uint32_t slot, task_t *task)
+{
+  // Tasks were taken from a queue, wake another thread if more are left
+  if (__sync_sub_and_fetch(&nof_queued, 1) > 0) {
+    work_available.notify();
+  }
+  task->func(task->arg, slot);
+  __sync_fetch_and_sub(&task->grp->pending, 1);
+}
+
+void task_pool::run_worker(uint32_t slot)
+{
+  while (running) {
+    task_t task;
+    if (get_task(slot, &task)) {
+      run_task(slot, &task);
+      continue;
+    }
+    int32_t seq = work_available.prepare_wait();
+    if (running && __sync_fetch_and_add(&nof_queued, 0) <= 0) {
+      work_available.wait(seq);
+    }
+    work_available.end_wait();
+  }
+}
+
+} // namespace srslte
@@ -0,0 +1,74 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <complex.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <math.h>
+
+#include "srslte/phy/channel/ch_fading.h"
+#include "srslte/srslte.h"
+
+static float rand_uniform(uint32_t *seed) {
+  return (float) rand_r(seed) / ((float) RAND_MAX + 1.0f);
+}
+
+int srslte_ch_fading_init(srslte_ch_fading_t *q, float doppler_hz, uint32_t seed) {
+  if (q == NULL || doppler_hz < 0) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  bzero(q, sizeof(srslte_ch_fading_t));
+  q->doppler_hz = doppler_hz;
+
+  // Arrival angles are spread over the circle with a random offset, phases are random
+  uint32_t N = SRSLTE_CH_FADING_NOF_SINUSOIDS;
+  float theta = 2 * M_PI * rand_uniform(&seed) - M_PI;
+  for (uint32_t n = 0; n < N; n++) {
+    float alpha = (2 * M_PI * n + theta) / N;
+    q->w[n]   = 2 * M_PI * doppler_hz * cosf(alpha);
+    q->phi[n] = 2 * M_PI * rand_uniform(&seed) - M_PI;
+  }
+  return SRSLTE_SUCCESS;
+}
+
+cf_t srslte_ch_fading_gain(srslte_ch_fading_t *q, double time_s) {
+  cf_t h = 0;
+  for (uint32_t n = 0; n < SRSLTE_CH_FADING_NOF_SINUSOIDS; n++) {
+    // Wrap the argument before going to single precision, time grows unbounded
+    double arg = fmod(q->w[n] * time_s + q->phi[n], 2 * M_PI);
+    h += cexpf(_Complex_I * (float) arg);
+  }
+  return h / sqrtf(SRSLTE_CH_FADING_NOF_SINUSOIDS);
+}
+
+void srslte_ch_fading_execute(srslte_ch_fading_t *q, const cf_t *input, cf_t *output, uint32_t len,
+                              double time_s, double srate)
+{
+  for (uint32_t i = 0; i < len; i += SRSLTE_CH_FADING_STEP) {
+    uint32_t n = SRSLTE_MIN(SRSLTE_CH_FADING_STEP, len - i);
+    srslte_vec_sc_prod_ccc(&input[i], srslte_ch_fading_gain(q, time_s + i / srate), &output[i], n);
+  }
+}
@@ -27,6 +27,7 @@
 
 #include <math.h>
 #include <complex.h>
+#include <stdlib.h>
 #include <fftw3.h>
 #include <string.h>
 #include <srslte/srslte.h>
@@ -37,28 +38,200 @@
 #define dft_ceil(a,b) ((a-1)/b+1)
 #define dft_floor(a,b) (a/b)
 
+/* Wisdom is loaded from the file given by the environment variable below or,
+ * if it is not set, from FFTW_WISDOM_SYSTEM_FILE (see srslte_fftw_wisdom).
+ * If neither can be read, the wisdom measured by the process is kept in
+ * FFTW_WISDOM_FILE in the working directory */
 #define FFTW_WISDOM_FILE ".fftw_wisdom"
+#define FFTW_WISDOM_ENV  "SRSLTE_FFTW_WISDOM"
 
-#ifdef FFTW_WISDOM_FILE
-#define FFTW_TYPE FFTW_MEASURE
-#else
-#define FFTW_TYPE 0
+#ifndef FFTW_WISDOM_SYSTEM_FILE
+#define FFTW_WISDOM_SYSTEM_FILE "/usr/local/share/srslte/fftw_wisdom"
 #endif
 
+#define FFTW_TYPE FFTW_MEASURE
+
 pthread_mutex_t fft_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+// Set if the system wisdom was loaded, plans are then never measured
+static bool wisdom_only = false;
+
+/* Process-wide plan cache. Objects planning the same transform share the
+ * FFTW plan, which they execute on their own buffers with the new-array
+ * execute functions. Buffers must have the alignment of the ones used for
+ * planning, so it is part of the key. Protected by fft_mutex */
+typedef enum {
+  PLAN_C = 0, PLAN_R, PLAN_GURU_C
+} plan_kind_t;
+
+typedef struct plan_cache_s {
+  plan_kind_t kind;
+  int size;
+  int sign;
+  int istride, ostride, how_many, idist, odist;
+  int in_align, out_align;
+  bool in_place;
+  fftwf_plan p;
+  uint32_t refcount;
+  struct plan_cache_s *next;
+} plan_cache_t;
+
+static plan_cache_t *plan_cache = NULL;
+
+static fftwf_plan plan_create(plan_cache_t *key, void *in, void *out, unsigned flags) {
+  switch (key->kind) {
+    case PLAN_C:
+      return fftwf_plan_dft_1d(key->size, in, out, key->sign, flags);
+    case PLAN_R:
+      return fftwf_plan_r2r_1d(key->size, in, out, (fftwf_r2r_kind) key->sign, flags);
+    case PLAN_GURU_C:
+    default: {
+      const fftwf_iodim iodim = {key->size, key->istride, key->ostride};
+      const fftwf_iodim howmany_dims = {key->how_many, key->idist, key->odist};
+      return fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in, out, key->sign, flags);
+    }
+  }
+}
+
+static bool plan_key_equal(plan_cache_t *a, plan_cache_t *b) {
+  return a->kind == b->kind && a->size == b->size && a->sign == b->sign &&
+         a->istride == b->istride && a->ostride == b->ostride && a->how_many == b->how_many &&
+         a->idist == b->idist && a->odist == b->odist &&
+         a->in_align == b->in_align && a->out_align == b->out_align && a->in_place == b->in_place;
+}
+
+/* Returns a plan for the transform described by key, planned with the buffers
+ * in and out if it is not in the cache. Must be called with fft_mutex locked */
+static fftwf_plan plan_cache_get(plan_cache_t *key, void *in, void *out) {
+  key->in_align  = fftwf_alignment_of(in);
+  key->out_align = fftwf_alignment_of(out);
+  key->in_place  = (in == out);
+
+  for (plan_cache_t *e = plan_cache; e; e = e->next) {
+    if (plan_key_equal(e, key)) {
+      e->refcount++;
+      return e->p;
+    }
+  }
+
+  fftwf_plan p = NULL;
+  if (wisdom_only) {
+    p = plan_create(key, in, out, FFTW_TYPE | FFTW_WISDOM_ONLY);
+    if (!p) {
+      p = plan_create(key, in, out, FFTW_ESTIMATE);
+    }
+  } else {
+    p = plan_create(key, in, out, FFTW_TYPE);
+  }
+  if (!p) {
+    return NULL;
+  }
+
+  plan_cache_t *e = malloc(sizeof(plan_cache_t));
+  if (!e) {
+    fftwf_destroy_plan(p);
+    return NULL;
+  }
+  *e = *key;
+  e->p = p;
+  e->refcount = 1;
+  e->next = plan_cache;
+  plan_cache = e;
+  return p;
+}
+
+/* Releases a plan returned by plan_cache_get(). Must be called with fft_mutex locked */
+static void plan_cache_put(fftwf_plan p) {
+  for (plan_cache_t **e = &plan_cache; *e; e = &(*e)->next) {
+    if ((*e)->p == p) {
+      if (--(*e)->refcount == 0) {
+        plan_cache_t *next = (*e)->next;
+        fftwf_destroy_plan((*e)->p);
+        free(*e);
+        *e = next;
+      }
+      return;
+    }
+  }
+  fftwf_destroy_plan(p);
+}
+
+static fftwf_plan plan_get(plan_kind_t kind, int size, int sign, void *in, void *out) {
+  plan_cache_t key;
+  bzero(&key, sizeof(plan_cache_t));
+  key.kind = kind;
+  key.size = size;
+  key.sign = sign;
+
+  pthread_mutex_lock(&fft_mutex);
+  fftwf_plan p = plan_cache_get(&key, in, out);
+  pthread_mutex_unlock(&fft_mutex);
+  return p;
+}
+
+static fftwf_plan plan_get_guru(int size, int sign, void *in, void *out, int istride, int ostride,
+                                int how_many, int idist, int odist) {
+  plan_cache_t key;
+  bzero(&key, sizeof(plan_cache_t));
+  key.kind = PLAN_GURU_C;
+  key.size = size;
+  key.sign = sign;
+  key.istride = istride;
+  key.ostride = ostride;
+  key.how_many = how_many;
+  key.idist = idist;
+  key.odist = odist;
+
+  pthread_mutex_lock(&fft_mutex);
+  fftwf_plan p = plan_cache_get(&key, in, out);
+  pthread_mutex_unlock(&fft_mutex);
+  return p;
+}
+
+static void plan_put(void *p) {
+  if (p) {
+    pthread_mutex_lock(&fft_mutex);
+    plan_cache_put(p);
+    pthread_mutex_unlock(&fft_mutex);
+  }
+}
+
+uint32_t srslte_dft_nof_cached_plans() {
+  uint32_t n = 0;
+  pthread_mutex_lock(&fft_mutex);
+  for (plan_cache_t *e = plan_cache; e; e = e->next) {
+    n++;
+  }
+  pthread_mutex_unlock(&fft_mutex);
+  return n;
+}
+
+const char *srslte_dft_wisdom_file() {
+  const char *file = getenv(FFTW_WISDOM_ENV);
+  return file ? file : FFTW_WISDOM_SYSTEM_FILE;
+}
+
 void srslte_dft_load() {
-#ifdef FFTW_WISDOM_FILE
-  fftwf_import_wisdom_from_filename(FFTW_WISDOM_FILE);
-#else
-  printf("Warning: FFTW Wisdom file not defined\n");
-#endif
+  pthread_mutex_lock(&fft_mutex);
+  if (fftwf_import_wisdom_from_filename(srslte_dft_wisdom_file())) {
+    wisdom_only = true;
+  } else {
+    fftwf_import_wisdom_from_filename(FFTW_WISDOM_FILE);
+  }
+  pthread_mutex_unlock(&fft_mutex);
+}
+
+int srslte_dft_export_wisdom(const char *filename) {
+  pthread_mutex_lock(&fft_mutex);
+  int ret = fftwf_export_wisdom_to_filename(filename) ? 0 : -1;
+  pthread_mutex_unlock(&fft_mutex);
+  return ret;
 }
 
 void srslte_dft_exit() {
-#ifdef FFTW_WISDOM_FILE
-  fftwf_export_wisdom_to_filename(FFTW_WISDOM_FILE);
-#endif
+  if (!wisdom_only) {
+    fftwf_export_wisdom_to_filename(FFTW_WISDOM_FILE);
+  }
   fftwf_cleanup();
 }
 
@@ -99,21 +272,15 @@ int srslte_dft_replan_guru_c(srslte_dft_plan_t *plan, const int new_dft_points,
                              int idist, int odist) {
   int sign = (plan->forward) ? FFTW_FORWARD : FFTW_BACKWARD;
 
-  const fftwf_iodim iodim = {new_dft_points, istride, ostride};
-  const fftwf_iodim howmany_dims = {how_many, idist, odist};
-
-  pthread_mutex_lock(&fft_mutex);
-
-  /* Destroy current plan */
-  fftwf_destroy_plan(plan->p);
-
-  plan->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
-
-  pthread_mutex_unlock(&fft_mutex);
+  /* Release current plan */
+  plan_put(plan->p);
 
+  plan->p = plan_get_guru(new_dft_points, sign, in_buffer, out_buffer, istride, ostride, how_many, idist, odist);
   if (!plan->p) {
     return -1;
   }
+  plan->in = in_buffer;
+  plan->out = out_buffer;
   plan->size = new_dft_points;
   plan->init_size = plan->size;
 
@@ -123,13 +290,8 @@ int srslte_dft_replan_guru_c(srslte_dft_plan_t *plan, const int new_dft_points,
 int srslte_dft_replan_c(srslte_dft_plan_t *plan, const int new_dft_points) {
   int sign = (plan->dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
 
-  pthread_mutex_lock(&fft_mutex);
-  if (plan->p) {
-    fftwf_destroy_plan(plan->p);
-    plan->p = NULL;
-  }
-  plan->p = fftwf_plan_dft_1d(new_dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-  pthread_mutex_unlock(&fft_mutex);
+  plan_put(plan->p);
+  plan->p = plan_get(PLAN_C, new_dft_points, sign, plan->in, plan->out);
 
   if (!plan->p) {
     return -1;
@@ -143,17 +305,13 @@ int srslte_dft_plan_guru_c(srslte_dft_plan_t *plan, const int dft_points, srslte
                            int idist, int odist) {
   int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
 
-  const fftwf_iodim iodim = {dft_points, istride, ostride};
-  const fftwf_iodim howmany_dims = {how_many, idist, odist};
-
-  pthread_mutex_lock(&fft_mutex);
-
-  plan->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
+  plan->p = plan_get_guru(dft_points, sign, in_buffer, out_buffer, istride, ostride, how_many, idist, odist);
   if (!plan->p) {
     return -1;
   }
-  pthread_mutex_unlock(&fft_mutex);
 
+  plan->in = in_buffer;
+  plan->out = out_buffer;
   plan->size = dft_points;
   plan->init_size = plan->size;
   plan->mode = SRSLTE_DFT_COMPLEX;
@@ -171,12 +329,8 @@ int srslte_dft_plan_guru_c(srslte_dft_plan_t *plan, const int dft_points, srslte
 int srslte_dft_plan_c(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_dir_t dir) {
   allocate(plan,sizeof(fftwf_complex),sizeof(fftwf_complex), dft_points);
 
-  pthread_mutex_lock(&fft_mutex);
-
   int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
-  plan->p = fftwf_plan_dft_1d(dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-
-  pthread_mutex_unlock(&fft_mutex);
+  plan->p = plan_get(PLAN_C, dft_points, sign, plan->in, plan->out);
 
   if (!plan->p) {
     return -1;
@@ -198,13 +352,8 @@ int srslte_dft_plan_c(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_
 int srslte_dft_replan_r(srslte_dft_plan_t *plan, const int new_dft_points) {
   int sign = (plan->dir == SRSLTE_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
 
-  pthread_mutex_lock(&fft_mutex);
-  if (plan->p) {
-    fftwf_destroy_plan(plan->p);
-    plan->p = NULL;
-  }
-  plan->p = fftwf_plan_r2r_1d(new_dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-  pthread_mutex_unlock(&fft_mutex);
+  plan_put(plan->p);
+  plan->p = plan_get(PLAN_R, new_dft_points, sign, plan->in, plan->out);
 
   if (!plan->p) {
     return -1;
@@ -217,9 +366,7 @@ int srslte_dft_plan_r(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_
   allocate(plan,sizeof(float),sizeof(float), dft_points);
   int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
 
-  pthread_mutex_lock(&fft_mutex);
-  plan->p = fftwf_plan_r2r_1d(dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-  pthread_mutex_unlock(&fft_mutex);
+  plan->p = plan_get(PLAN_R, dft_points, sign, plan->in, plan->out);
 
   if (!plan->p) {
     return -1;
@@ -294,7 +441,7 @@ void srslte_dft_run_c(srslte_dft_plan_t *plan, const cf_t *in, cf_t *out) {
 
   copy_pre((uint8_t*)plan->in, (uint8_t*)in, sizeof(cf_t), plan->size,
            plan->forward, plan->mirror, plan->dc);
-  fftwf_execute(plan->p);
+  fftwf_execute_dft(plan->p, plan->in, plan->out);
   if (plan->norm) {
     norm = 1.0/sqrtf(plan->size);
     srslte_vec_sc_prod_cfc(f_out, norm, f_out, plan->size);    
@@ -310,7 +457,7 @@ void srslte_dft_run_c(srslte_dft_plan_t *plan, const cf_t *in, cf_t *out) {
 
 void srslte_dft_run_guru_c(srslte_dft_plan_t *plan) {
   if (plan->is_guru == true) {
-    fftwf_execute(plan->p);
+    fftwf_execute_dft(plan->p, plan->in, plan->out);
   } else {
     fprintf(stderr, "srslte_dft_run_guru_c: the selected plan is not guru!\n");
   }
@@ -323,7 +470,7 @@ void srslte_dft_run_r(srslte_dft_plan_t *plan, const float *in, float *out) {
   float *f_out = plan->out;
 
   memcpy(plan->in,in,sizeof(float)*plan->size);
-  fftwf_execute(plan->p);
+  fftwf_execute_r2r(plan->p, plan->in, plan->out);
   if (plan->norm) {
     norm = 1.0/plan->size;
     srslte_vec_sc_prod_fff(f_out, norm, f_out, plan->size);    
@@ -340,13 +487,11 @@ void srslte_dft_plan_free(srslte_dft_plan_t *plan) {
   if (!plan) return;
   if (!plan->size) return;
 
-  pthread_mutex_lock(&fft_mutex);
   if (!plan->is_guru) {
     if (plan->in) fftwf_free(plan->in);
     if (plan->out) fftwf_free(plan->out);
   }
-  if (plan->p) fftwf_destroy_plan(plan->p);
-  pthread_mutex_unlock(&fft_mutex);
+  plan_put(plan->p);
 
   bzero(plan, sizeof(srslte_dft_plan_t));
 }
@@ -452,9 +452,10 @@ int srslte_enb_dl_put_pdcch_ul(srslte_enb_dl_t *q, srslte_ra_ul_dci_t *grant,
   return SRSLTE_SUCCESS;
 }
 
-int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q, srslte_ra_dl_grant_t *grant, srslte_softbuffer_tx_t *softbuffer[SRSLTE_MAX_CODEWORDS],
-                            uint16_t rnti, int rv_idx[SRSLTE_MAX_CODEWORDS], uint32_t sf_idx,
-                            uint8_t *data[SRSLTE_MAX_CODEWORDS], srslte_mimo_type_t mimo_type)
+static int put_pdsch(srslte_enb_dl_t *q, srslte_pdsch_t *pdsch, srslte_pdsch_cfg_t *pdsch_cfg,
+                     srslte_ra_dl_grant_t *grant, srslte_softbuffer_tx_t *softbuffer[SRSLTE_MAX_CODEWORDS],
+                     uint16_t rnti, int rv_idx[SRSLTE_MAX_CODEWORDS], uint32_t sf_idx,
+                     uint8_t *data[SRSLTE_MAX_CODEWORDS], srslte_mimo_type_t mimo_type)
 {  
   uint32_t pmi = 0;
   uint32_t nof_tb = SRSLTE_RA_DL_GRANT_NOF_TB(grant);
@@ -487,19 +488,72 @@ int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q, srslte_ra_dl_grant_t *grant, srs
   }
 
   /* Configure pdsch_cfg parameters */
-  if (srslte_pdsch_cfg_mimo(&q->pdsch_cfg, q->cell, grant, q->cfi, sf_idx, rv_idx, mimo_type, pmi)) {
+  if (srslte_pdsch_cfg_mimo(pdsch_cfg, q->cell, grant, q->cfi, sf_idx, rv_idx, mimo_type, pmi)) {
     ERROR("Error configuring PDSCH (rnti=0x%04x)", rnti);
     return SRSLTE_ERROR;
   }
 
   /* Encode PDSCH */
-  if (srslte_pdsch_encode(&q->pdsch, &q->pdsch_cfg, softbuffer, data, rnti, q->sf_symbols)) {
+  if (srslte_pdsch_encode(pdsch, pdsch_cfg, softbuffer, data, rnti, q->sf_symbols)) {
     fprintf(stderr, "Error encoding PDSCH\n");
     return SRSLTE_ERROR;
   }        
   return SRSLTE_SUCCESS; 
 }
 
+int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q, srslte_ra_dl_grant_t *grant, srslte_softbuffer_tx_t *softbuffer[SRSLTE_MAX_CODEWORDS],
+                            uint16_t rnti, int rv_idx[SRSLTE_MAX_CODEWORDS], uint32_t sf_idx,
+                            uint8_t *data[SRSLTE_MAX_CODEWORDS], srslte_mimo_type_t mimo_type)
+{
+  return put_pdsch(q, &q->pdsch, &q->pdsch_cfg, grant, softbuffer, rnti, rv_idx, sf_idx, data, mimo_type);
+}
+
+int srslte_enb_dl_pdsch_encoder_init(srslte_enb_dl_pdsch_encoder_t *q, uint32_t max_prb)
+{
+  if (q) {
+    bzero(q, sizeof(srslte_enb_dl_pdsch_encoder_t));
+    if (srslte_pdsch_init_enb(&q->pdsch, max_prb)) {
+      fprintf(stderr, "Error creating PDSCH object\n");
+      return SRSLTE_ERROR;
+    }
+    return SRSLTE_SUCCESS;
+  }
+  return SRSLTE_ERROR_INVALID_INPUTS;
+}
+
+void srslte_enb_dl_pdsch_encoder_free(srslte_enb_dl_pdsch_encoder_t *q)
+{
+  if (q) {
+    srslte_pdsch_free(&q->pdsch);
+  }
+}
+
+int srslte_enb_dl_pdsch_encoder_set_cell(srslte_enb_dl_pdsch_encoder_t *q, srslte_cell_t cell)
+{
+  if (q) {
+    if (srslte_pdsch_set_cell(&q->pdsch, cell)) {
+      fprintf(stderr, "Error setting PDSCH object cell\n");
+      return SRSLTE_ERROR;
+    }
+    return SRSLTE_SUCCESS;
+  }
+  return SRSLTE_ERROR_INVALID_INPUTS;
+}
+
+/* Same as srslte_enb_dl_put_pdsch() but the encoding buffers are the encoder ones and rho_a is given, so that it can
+ * be called from several threads for different users of the subframe. The scrambling sequences of the users added to
+ * q are reused, q->pdsch is only read.
+ */
+int srslte_enb_dl_put_pdsch_encoder(srslte_enb_dl_t *q, srslte_enb_dl_pdsch_encoder_t *encoder, float rho_a,
+                                    srslte_ra_dl_grant_t *grant, srslte_softbuffer_tx_t *softbuffer[SRSLTE_MAX_CODEWORDS],
+                                    uint16_t rnti, int rv_idx[SRSLTE_MAX_CODEWORDS], uint32_t sf_idx,
+                                    uint8_t *data[SRSLTE_MAX_CODEWORDS], srslte_mimo_type_t mimo_type)
+{
+  srslte_pdsch_set_power_allocation(&encoder->pdsch, rho_a);
+  srslte_pdsch_set_shared_users(&encoder->pdsch, &q->pdsch);
+  return put_pdsch(q, &encoder->pdsch, &encoder->pdsch_cfg, grant, softbuffer, rnti, rv_idx, sf_idx, data, mimo_type);
+}
+
 int srslte_enb_dl_put_pmch(srslte_enb_dl_t *q, srslte_ra_dl_grant_t *grant, srslte_softbuffer_tx_t *softbuffer, uint32_t sf_idx, uint8_t *data_mbms)
 {
    /* Encode PMCH */
@@ -31,6 +31,13 @@
 #include "srslte/phy/utils/bit.h"
 #include "srslte/phy/fec/crc.h"
 
+#ifdef LV_HAVE_PCLMUL_TARGET
+#include <immintrin.h>
+#endif
+
+// Below this number of bytes slicing-by-8 is faster than folding
+#define CRC_PCLMUL_MIN_BYTES 32
+
 void gen_crc_table(srslte_crc_t *h) {
 
   int i, j, ord = (h->order - 8);
@@ -48,6 +55,207 @@ void gen_crc_table(srslte_crc_t *h) {
   }
 }
 
+/* Tables for slicing-by-8. table8[k][b] is the checksum of byte b followed by
+ * k zero bytes, computed with the polynomial scaled to 32 bits */
+static void gen_crc_table8(srslte_crc_t *h) {
+
+  for (int i = 0; i < 256; i++) {
+    uint32_t crc = ((uint32_t) i) << 24;
+    for (int j = 0; j < 8; j++) {
+      crc = (crc << 1) ^ ((crc & 0x80000000) ? h->polynom32 : 0);
+    }
+    h->table8[0][i] = crc;
+  }
+  for (int k = 1; k < 8; k++) {
+    for (int i = 0; i < 256; i++) {
+      uint32_t crc = h->table8[k - 1][i];
+      h->table8[k][i] = (crc << 8) ^ h->table8[0][crc >> 24];
+    }
+  }
+}
+
+// x^n mod P, with P scaled to 32 bits
+static uint64_t crc_xpow_mod(srslte_crc_t *h, uint32_t n) {
+  uint32_t r = 1;
+  for (uint32_t i = 0; i < n; i++) {
+    r = (r << 1) ^ ((r & 0x80000000) ? h->polynom32 : 0);
+  }
+  return r;
+}
+
+// Barrett constant floor(x^64 / P), with P scaled to 32 bits
+static uint64_t crc_barrett_mu(srslte_crc_t *h) {
+  uint64_t hi = 1, lo = 0, mu = 0;
+  for (int i = 64; i >= 32; i--) {
+    if (i == 64 ? (hi & 1) : ((lo >> i) & 1)) {
+      mu |= (uint64_t) 1 << (i - 32);
+      if (i == 64) {
+        hi ^= 1;
+        lo ^= ((uint64_t) h->polynom32) << 32;
+      } else {
+        lo ^= (((uint64_t) 1 << 32) | h->polynom32) << (i - 32);
+      }
+    }
+  }
+  return mu;
+}
+
+/* Folding constants. Each 128-bit block is split in two halves which are
+ * multiplied by x^(d+64) and x^d mod P to move them d bits forward */
+static void gen_crc_clmul_k(srslte_crc_t *h) {
+  h->clmul_k[0] = crc_xpow_mod(h, 512 + 64);
+  h->clmul_k[1] = crc_xpow_mod(h, 512);
+  h->clmul_k[2] = crc_xpow_mod(h, 128 + 64);
+  h->clmul_k[3] = crc_xpow_mod(h, 128);
+  h->clmul_k[4] = crc_xpow_mod(h, 96);
+  h->clmul_k[5] = crc_xpow_mod(h, 64);
+  h->clmul_k[6] = crc_barrett_mu(h);
+  h->clmul_k[7] = ((uint64_t) 1 << 32) | h->polynom32;
+}
+
+bool srslte_crc_pclmul_supported() {
+#ifdef LV_HAVE_PCLMUL_TARGET
+  static int supported = -1;
+  if (supported < 0) {
+    __builtin_cpu_init();
+    supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+  }
+  return supported;
+#else
+  return false;
+#endif
+}
+
+static uint32_t crc_update_byte(srslte_crc_t *h, uint32_t crc, const uint8_t *data, uint32_t nof_bytes) {
+  for (uint32_t i = 0; i < nof_bytes; i++) {
+    crc = (crc << 8) ^ h->table8[0][(crc >> 24) ^ data[i]];
+  }
+  return crc;
+}
+
+static uint32_t crc_update_slice8(srslte_crc_t *h, uint32_t crc, const uint8_t *data, uint32_t nof_bytes) {
+  while (nof_bytes >= 8) {
+    crc ^= ((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) | ((uint32_t) data[2] << 8) | data[3];
+    crc = h->table8[7][crc >> 24] ^ h->table8[6][(crc >> 16) & 0xff] ^
+          h->table8[5][(crc >> 8) & 0xff] ^ h->table8[4][crc & 0xff] ^
+          h->table8[3][data[4]] ^ h->table8[2][data[5]] ^
+          h->table8[1][data[6]] ^ h->table8[0][data[7]];
+    data += 8;
+    nof_bytes -= 8;
+  }
+  return crc_update_byte(h, crc, data, nof_bytes);
+}
+
+#ifdef LV_HAVE_PCLMUL_TARGET
+#pragma GCC push_options
+#pragma GCC target("ssse3,pclmul")
+
+/* Moves a 128-bit block forward by the distance of the constants k (see gen_crc_clmul_k) */
+static inline __m128i crc_fold(__m128i x, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x01), _mm_clmulepi64_si128(x, k, 0x10));
+}
+
+/* Folds the buffer, 4 blocks in parallel while possible, into a 128-bit
+ * remainder which is reduced to the 32-bit checksum with Barrett reduction.
+ * Bytes are swapped so that the first bit is the highest degree. Needs at
+ * least 16 bytes, the trailing bytes are processed by slicing-by-8 */
+static uint32_t crc_update_pclmul(srslte_crc_t *h, uint32_t crc, const uint8_t *data, uint32_t nof_bytes) {
+  const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i k512  = _mm_set_epi64x(h->clmul_k[1], h->clmul_k[0]);
+  const __m128i k128  = _mm_set_epi64x(h->clmul_k[3], h->clmul_k[2]);
+  const __m128i k96   = _mm_set_epi64x(0, h->clmul_k[4]);
+  const __m128i k64   = _mm_set_epi64x(0, h->clmul_k[5]);
+  const __m128i mu    = _mm_set_epi64x(0, h->clmul_k[6]);
+  const __m128i poly  = _mm_set_epi64x(0, h->clmul_k[7]);
+
+  __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) data), bswap);
+  x = _mm_xor_si128(x, _mm_set_epi32(crc, 0, 0, 0));
+  data += 16;
+  nof_bytes -= 16;
+
+  if (nof_bytes >= 48) {
+    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[0]), bswap);
+    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[16]), bswap);
+    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[32]), bswap);
+    data += 48;
+    nof_bytes -= 48;
+
+    while (nof_bytes >= 64) {
+      x  = _mm_xor_si128(crc_fold(x,  k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[0]), bswap));
+      x1 = _mm_xor_si128(crc_fold(x1, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[16]), bswap));
+      x2 = _mm_xor_si128(crc_fold(x2, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[32]), bswap));
+      x3 = _mm_xor_si128(crc_fold(x3, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) &data[48]), bswap));
+      data += 64;
+      nof_bytes -= 64;
+    }
+
+    x = _mm_xor_si128(crc_fold(x, k128), x1);
+    x = _mm_xor_si128(crc_fold(x, k128), x2);
+    x = _mm_xor_si128(crc_fold(x, k128), x3);
+  }
+
+  while (nof_bytes >= 16) {
+    x = _mm_xor_si128(crc_fold(x, k128), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) data), bswap));
+    data += 16;
+    nof_bytes -= 16;
+  }
+
+  // Remainder of x * x^32, first down to 96 bits and then to 64 bits
+  x = _mm_xor_si128(_mm_clmulepi64_si128(x, k96, 0x01), _mm_slli_si128(_mm_move_epi64(x), 4));
+  x = _mm_xor_si128(_mm_clmulepi64_si128(x, k64, 0x01), _mm_move_epi64(x));
+
+  // Barrett reduction to 32 bits
+  __m128i q = _mm_srli_epi64(_mm_clmulepi64_si128(_mm_srli_epi64(x, 32), mu, 0x00), 32);
+  x = _mm_xor_si128(x, _mm_clmulepi64_si128(q, poly, 0x00));
+  crc = (uint32_t) _mm_cvtsi128_si32(x);
+
+  return crc_update_slice8(h, crc, data, nof_bytes);
+}
+
+#pragma GCC pop_options
+#endif
+
+static uint32_t crc_update(srslte_crc_t *h, uint32_t crc, const uint8_t *data, uint32_t nof_bytes) {
+  switch (h->engine) {
+    case SRSLTE_CRC_BYTE:
+      return crc_update_byte(h, crc, data, nof_bytes);
+    case SRSLTE_CRC_SLICE8:
+      return crc_update_slice8(h, crc, data, nof_bytes);
+#ifdef LV_HAVE_PCLMUL_TARGET
+    case SRSLTE_CRC_PCLMUL:
+      if (nof_bytes >= 16) {
+        return crc_update_pclmul(h, crc, data, nof_bytes);
+      }
+      return crc_update_slice8(h, crc, data, nof_bytes);
+#endif
+    default:
+#ifdef LV_HAVE_PCLMUL_TARGET
+      if (nof_bytes >= CRC_PCLMUL_MIN_BYTES && srslte_crc_pclmul_supported()) {
+        return crc_update_pclmul(h, crc, data, nof_bytes);
+      }
+#endif
+      return crc_update_slice8(h, crc, data, nof_bytes);
+  }
+}
+
+int srslte_crc_set_engine(srslte_crc_t *h, srslte_crc_engine_t engine) {
+  if (engine >= SRSLTE_CRC_NOF_ENGINES || (engine == SRSLTE_CRC_PCLMUL && !srslte_crc_pclmul_supported())) {
+    fprintf(stderr, "Error CRC engine %d not supported\n", engine);
+    return -1;
+  }
+  h->engine = engine;
+  return 0;
+}
+
+void srslte_crc_checksum_put_bytes(srslte_crc_t *h, const uint8_t *data, uint32_t nof_bytes) {
+  int shift = 32 - h->order;
+  uint32_t crc = ((uint32_t) (h->crcinit & h->crcmask)) << shift;
+
+  crc = crc_update(h, crc, data, nof_bytes);
+
+  h->crcinit = crc >> shift;
+}
+
 uint64_t reversecrcbit(uint32_t crc, int nbits, srslte_crc_t *h) {
 
   uint64_t m, rmask = 0x1;
@@ -94,9 +302,14 @@ int srslte_crc_init(srslte_crc_t *h, uint32_t crc_poly, int crc_order) {
     return -1;
   }
 
-  // generate lookup table
+  // generate lookup tables
   gen_crc_table(h);
 
+  h->engine = SRSLTE_CRC_AUTO;
+  h->polynom32 = ((uint32_t) h->polynom) << (32 - h->order);
+  gen_crc_table8(h);
+  gen_crc_clmul_k(h);
+
   return 0;
 }
 
@@ -140,21 +353,19 @@ uint32_t srslte_crc_checksum(srslte_crc_t *h, uint8_t *data, int len) {
 
 }
 
-// len is multiple of 8
 uint32_t srslte_crc_checksum_byte(srslte_crc_t *h, uint8_t *data, int len) {
-  int i;
-  uint32_t crc = 0;
-
-  srslte_crc_set_init(h, 0);
+  uint32_t crc = crc_update(h, 0, data, (uint32_t) len / 8);
 
-  // Calculate CRC
-  for (i = 0; i < len/8; i++) {
-    srslte_crc_checksum_put_byte(h, data[i]);
+  // Remaining bits, MSB first
+  for (int i = 0; i < len % 8; i++) {
+    uint32_t bit = (data[len / 8] >> (7 - i)) & 1;
+    crc = (crc << 1) ^ (((crc >> 31) ^ bit) ? h->polynom32 : 0);
   }
-  crc = (uint32_t) srslte_crc_checksum_get(h);
 
-  return crc;
+  crc >>= 32 - h->order;
+  h->crcinit = crc;
 
+  return crc;
 }
 
 uint32_t srslte_crc_attach_byte(srslte_crc_t *h, uint8_t *data, int len) {
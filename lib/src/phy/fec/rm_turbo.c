@@ -74,8 +74,8 @@ static bool rm_turbo_tables_generated = false;
 // Store deinterleaver version for sub-block turbo decoder
 #if SRSLTE_TDEC_EXPECT_INPUT_SB == 1
 // Prepare bit for sub-block decoder processing. These are the nof subblock sizes
-#define NOF_DEINTER_TABLE_SB_IDX 3
-const static int deinter_table_sb_idx[NOF_DEINTER_TABLE_SB_IDX] = {8, 16, 32};
+#define NOF_DEINTER_TABLE_SB_IDX 4
+const static int deinter_table_sb_idx[NOF_DEINTER_TABLE_SB_IDX] = {8, 16, 32, 64};
 int deinter_table_idx_from_sb_len(uint32_t nof_subblocks) {
   for (int i=0;i<NOF_DEINTER_TABLE_SB_IDX;i++) {
     if (deinter_table_sb_idx[i] == nof_subblocks) {
@@ -294,7 +294,7 @@ void srslte_rm_turbo_gentables() {
         srslte_rm_turbo_gentable_receive(deinterleaver[cb_idx][i], in_len, i);
 
 #if SRSLTE_TDEC_EXPECT_INPUT_SB == 1
-        for (uint32_t s = 0; s < NOF_DEINTER_TABLE_SB_IDX; s++) {
+        for (uint32_t s = 0; s < NOF_DEINTER_TABLE_SB_IDX && deinter_table_sb_idx[s] <= cb_len; s++) {
           interleave_table_sb(deinterleaver[cb_idx][i], deinterleaver_sb[s][cb_idx][i], cb_idx,
                               deinter_table_sb_idx[s]);
         }
@@ -0,0 +1,196 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+/* Measures the throughput of each CRC engine, in Mbps for a single core, for all LTE polynomials across packed
+ * buffer lengths. Each checksum is compared with the one computed over unpacked bits. */
+
+uint32_t nof_repetitions = 1000;
+int frame_length = 0;
+bool test_errors = false;
+
+const char *engine_names[SRSLTE_CRC_NOF_ENGINES] = {"Auto", "Byte", "Slicing-by-8", "PCLMUL"};
+
+typedef struct {
+  const char *name;
+  uint32_t    polynom;
+  int         order;
+} crc_poly_t;
+
+const crc_poly_t polys[] = {{"CRC24A", SRSLTE_LTE_CRC24A, 24},
+                            {"CRC24B", SRSLTE_LTE_CRC24B, 24},
+                            {"CRC16", SRSLTE_LTE_CRC16, 16},
+                            {"CRC8", SRSLTE_LTE_CRC8, 8}};
+
+// Includes lengths which are not multiple of 8 and the largest transport block
+const uint32_t lengths[] = {20, 40, 101, 328, 1001, 6144, 75376};
+
+void usage(char *prog) {
+  printf("Usage: %s [nlt]\n", prog);
+  printf("\t-n nof_repetitions [Default %d]\n", nof_repetitions);
+  printf("\t-l length in bits [Default sweep]\n");
+  printf("\t-t test: exit with error on wrong checksums [Default disabled]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nlt")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_repetitions = atoi(argv[optind]);
+      break;
+    case 'l':
+      frame_length = atoi(argv[optind]);
+      break;
+    case 't':
+      test_errors = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+/* Returns true if the checksum of the packed buffer, computed in one go and in pieces, matches the one of the
+ * unpacked bits */
+bool check_engine(srslte_crc_t *crc, uint8_t *bits, uint8_t *bytes, uint32_t len)
+{
+  uint32_t expected = srslte_crc_checksum(crc, bits, len);
+  if (srslte_crc_checksum_byte(crc, bytes, len) != expected) {
+    return false;
+  }
+  if (len % 8) {
+    return true;
+  }
+
+  // Feed the buffer in pieces of different sizes, as the turbo coder does with the transport block CRC
+  srslte_crc_set_init(crc, 0);
+  uint32_t nof_bytes = len / 8;
+  for (uint32_t i = 0, n = 1; i < nof_bytes; i += n, n = n * 3 + 1) {
+    srslte_crc_checksum_put_bytes(crc, &bytes[i], SRSLTE_MIN(n, nof_bytes - i));
+  }
+  return (uint32_t) srslte_crc_checksum_get(crc) == expected;
+}
+
+/* Returns -1 if the engine is not supported, 1 if any checksum is wrong and 0 otherwise */
+int run_bench(const crc_poly_t *poly, srslte_crc_engine_t engine, uint32_t len, float *mbps)
+{
+  srslte_crc_t crc;
+  struct timeval tdata[3];
+  int ret = 0;
+
+  if (srslte_crc_init(&crc, poly->polynom, poly->order)) {
+    exit(-1);
+  }
+  if (engine == SRSLTE_CRC_PCLMUL && !srslte_crc_pclmul_supported()) {
+    return -1;
+  }
+  if (srslte_crc_set_engine(&crc, engine)) {
+    exit(-1);
+  }
+
+  uint8_t *bits  = srslte_vec_malloc(len);
+  uint8_t *bytes = srslte_vec_malloc(len / 8 + 1);
+  if (!bits || !bytes) {
+    perror("malloc");
+    exit(-1);
+  }
+  for (uint32_t i = 0; i < len; i++) {
+    bits[i] = rand() % 2;
+  }
+  bzero(bytes, len / 8 + 1);
+  srslte_bit_pack_vector(bits, bytes, len);
+
+  if (!check_engine(&crc, bits, bytes, len)) {
+    ret = 1;
+  }
+
+  uint32_t checksum = 0;
+  gettimeofday(&tdata[1], NULL);
+  for (uint32_t n = 0; n < nof_repetitions; n++) {
+    bytes[0] ^= (uint8_t) checksum;
+    checksum = srslte_crc_checksum_byte(&crc, bytes, len);
+  }
+  gettimeofday(&tdata[2], NULL);
+  get_time_interval(tdata);
+  double usec = tdata[0].tv_sec * 1e6 + tdata[0].tv_usec;
+  *mbps = usec > 0 ? (float) (nof_repetitions * len / usec) : 0;
+
+  free(bits);
+  free(bytes);
+  return ret;
+}
+
+int main(int argc, char **argv) {
+  int ret = 0;
+
+  parse_args(argc, argv);
+  srand(0);
+
+  uint32_t nof_lengths = frame_length ? 1 : sizeof(lengths) / sizeof(uint32_t);
+
+  printf("%d repetitions. PCLMUL %ssupported\n", nof_repetitions, srslte_crc_pclmul_supported() ? "" : "not ");
+
+  for (uint32_t p = 0; p < sizeof(polys) / sizeof(crc_poly_t); p++) {
+    printf("%-6s %-13s", polys[p].name, "Mbps/core");
+    for (uint32_t l = 0; l < nof_lengths; l++) {
+      printf("%9d", frame_length ? frame_length : lengths[l]);
+    }
+    printf("\n");
+
+    for (int e = 0; e < SRSLTE_CRC_NOF_ENGINES; e++) {
+      printf("       %-13s", engine_names[e]);
+      for (uint32_t l = 0; l < nof_lengths; l++) {
+        float mbps = 0;
+        int r = run_bench(&polys[p], (srslte_crc_engine_t) e, frame_length ? frame_length : lengths[l], &mbps);
+        if (r < 0) {
+          printf("%9s", "-");
+        } else if (r > 0) {
+          printf("%6.0f(E)", mbps);
+          if (test_errors) {
+            ret = -1;
+          }
+        } else {
+          printf("%9.0f", mbps);
+        }
+        fflush(stdout);
+      }
+      printf("\n");
+    }
+  }
+  printf("(E): wrong checksum\n");
+
+  exit(ret);
+}
@@ -0,0 +1,231 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+/* Measures the throughput of each turbo decoder implementation, in Mbps for a single core, across code-block
+ * sizes. Implementations not supported by the CPU or the code-block size are skipped. */
+
+// 8-bit decoders saturate the metrics and have an error floor
+#define MAX_BER_8BIT 1e-3
+
+uint32_t nof_frames = 20;
+int nof_iterations = 4;
+int frame_length = 0;
+int dec_type = -1;
+float ebno_db = 7.0;
+bool test_errors = false;
+
+const char *dec_names[SRSLTE_TDEC_NOF_IMP] = {"Auto", "Generic", "SSE", "SSE-window", "AVX-window", "SSE8-window",
+                                              "AVX8-window", "AVX512-window", "AVX512-8-window"};
+
+const uint32_t cb_sizes[] = {504, 1024, 2048, 3072, 4096, 5120, 6144};
+
+void usage(char *prog) {
+  printf("Usage: %s [dlneit]\n", prog);
+  printf("\t-d Decoder implementation type (see srslte_tdec_impl_type_t) [Default all]\n");
+  printf("\t-l frame_length [Default sweep]\n");
+  printf("\t-n nof_frames [Default %d]\n", nof_frames);
+  printf("\t-e ebno in dB [Default %.1f]\n", ebno_db);
+  printf("\t-i nof_iterations [Default %d]\n", nof_iterations);
+  printf("\t-t test: exit with error on bit errors, BER above %.0e for 8-bit decoders [Default disabled]\n",
+         MAX_BER_8BIT);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "dlneit")) != -1) {
+    switch (opt) {
+    case 'd':
+      dec_type = atoi(argv[optind]);
+      break;
+    case 'l':
+      frame_length = atoi(argv[optind]);
+      break;
+    case 'n':
+      nof_frames = atoi(argv[optind]);
+      break;
+    case 'e':
+      ebno_db = atof(argv[optind]);
+      break;
+    case 'i':
+      nof_iterations = atoi(argv[optind]);
+      break;
+    case 't':
+      test_errors = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+bool dec_is_8bit(srslte_tdec_impl_type_t type)
+{
+  return type == SRSLTE_TDEC_SSE8_WINDOW || type == SRSLTE_TDEC_AVX8_WINDOW || type == SRSLTE_TDEC_AVX512_8_WINDOW;
+}
+
+/* Window decoders split the code-block in sub-blocks, each longer than the window overlap */
+bool cb_supported(srslte_tdec_t *tdec, uint32_t long_cb)
+{
+  int nof_blocks = (tdec->current_llr_type == SRSLTE_TDEC_16) ? tdec->nof_blocks16[0] : tdec->nof_blocks8[0];
+  if (tdec->dec_type == SRSLTE_TDEC_AUTO || nof_blocks <= 1) {
+    return true;
+  }
+  return !(long_cb % (8 * nof_blocks)) && long_cb / nof_blocks >= 40;
+}
+
+/* Returns the number of bit errors or -1 if the implementation does not support long_cb */
+int run_bench(srslte_tdec_impl_type_t type, uint32_t long_cb, float var, float *mbps)
+{
+  uint32_t coded_length = 3 * long_cb + SRSLTE_TCOD_TOTALTAIL;
+  srslte_tdec_t tdec;
+  srslte_tcod_t tcod;
+  struct timeval tdata[3];
+  int errors = 0;
+  double usec = 0;
+
+  if (srslte_tdec_init_manual(&tdec, long_cb, type)) {
+    return -1;
+  }
+  srslte_tdec_force_not_sb(&tdec);
+  if (!cb_supported(&tdec, long_cb)) {
+    srslte_tdec_free(&tdec);
+    return -1;
+  }
+  if (srslte_tcod_init(&tcod, long_cb)) {
+    fprintf(stderr, "Error initiating Turbo coder\n");
+    exit(-1);
+  }
+
+  uint8_t *data_tx  = srslte_vec_malloc(long_cb);
+  uint8_t *data_rx  = srslte_vec_malloc(long_cb);
+  uint8_t *rx_bytes = srslte_vec_malloc(long_cb / 8 + 1);
+  uint8_t *symbols  = srslte_vec_malloc(coded_length);
+  float   *llr      = srslte_vec_malloc(sizeof(float) * coded_length);
+  int16_t *llr_s    = srslte_vec_malloc(sizeof(int16_t) * coded_length);
+  int8_t  *llr_c    = srslte_vec_malloc(sizeof(int8_t) * coded_length);
+  if (!data_tx || !data_rx || !rx_bytes || !symbols || !llr || !llr_s || !llr_c) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  for (uint32_t n = 0; n < nof_frames; n++) {
+    for (uint32_t i = 0; i < long_cb; i++) {
+      data_tx[i] = rand() % 2;
+    }
+    srslte_tcod_encode(&tcod, data_tx, symbols, long_cb);
+    for (uint32_t i = 0; i < coded_length; i++) {
+      llr[i] = symbols[i] ? 1 : -1;
+    }
+    srslte_ch_awgn_f(llr, llr, var, coded_length);
+
+    gettimeofday(&tdata[1], NULL);
+    if (dec_is_8bit(type)) {
+      srslte_vec_convert_fb(llr, 20, llr_c, coded_length);
+      srslte_tdec_run_all_8bit(&tdec, llr_c, rx_bytes, nof_iterations, long_cb);
+    } else {
+      srslte_vec_convert_fi(llr, 100, llr_s, coded_length);
+      srslte_tdec_run_all(&tdec, llr_s, rx_bytes, nof_iterations, long_cb);
+    }
+    gettimeofday(&tdata[2], NULL);
+    get_time_interval(tdata);
+    usec += tdata[0].tv_sec * 1e6 + tdata[0].tv_usec;
+
+    srslte_bit_unpack_vector(rx_bytes, data_rx, long_cb);
+    errors += srslte_bit_diff(data_tx, data_rx, long_cb);
+  }
+  *mbps = usec > 0 ? (float) (nof_frames * long_cb / usec) : 0;
+
+  free(data_tx);
+  free(data_rx);
+  free(rx_bytes);
+  free(symbols);
+  free(llr);
+  free(llr_s);
+  free(llr_c);
+  srslte_tcod_free(&tcod);
+  srslte_tdec_free(&tdec);
+  return errors;
+}
+
+int main(int argc, char **argv) {
+  int ret = 0;
+
+  parse_args(argc, argv);
+  srand(0);
+
+  float esno_db = ebno_db + 10 * log10((double) 1 / 3);
+  float var     = sqrt(1 / (pow(10, esno_db / 10)));
+
+  uint32_t nof_sizes = frame_length ? 1 : sizeof(cb_sizes) / sizeof(uint32_t);
+
+  printf("Eb/No %.1f dB, %d iterations, %d frames. AVX512 %ssupported\n", ebno_db, nof_iterations, nof_frames,
+         srslte_tdec_avx512_supported() ? "" : "not ");
+  printf("%-16s", "Mbps/core");
+  for (uint32_t s = 0; s < nof_sizes; s++) {
+    printf("%8d", frame_length ? srslte_cbsegm_cbsize(srslte_cbsegm_cbindex(frame_length)) : cb_sizes[s]);
+  }
+  printf("\n");
+
+  for (int t = 0; t < SRSLTE_TDEC_NOF_IMP; t++) {
+    if (dec_type >= 0 && t != dec_type) {
+      continue;
+    }
+    printf("%-16s", dec_names[t]);
+    for (uint32_t s = 0; s < nof_sizes; s++) {
+      uint32_t long_cb = frame_length ? srslte_cbsegm_cbsize(srslte_cbsegm_cbindex(frame_length)) : cb_sizes[s];
+      float mbps = 0;
+      int errors = run_bench((srslte_tdec_impl_type_t) t, long_cb, var, &mbps);
+      if (errors < 0) {
+        printf("%8s", "-");
+      } else if (errors > 0) {
+        printf("%5.1f(E)", mbps);
+        float ber = (float) errors / (nof_frames * long_cb);
+        if (test_errors && (!dec_is_8bit((srslte_tdec_impl_type_t) t) || ber > MAX_BER_8BIT)) {
+          ret = -1;
+        }
+      } else {
+        printf("%8.1f", mbps);
+      }
+      fflush(stdout);
+    }
+    printf("\n");
+  }
+  printf("(E): decoded with bit errors\n");
+
+  exit(ret);
+}
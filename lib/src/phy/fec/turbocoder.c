@@ -214,84 +214,37 @@ int srslte_tcod_encode_lut(srslte_tcod_t *h,
       srslte_crc_set_init(crc_cb, 0);
     }
 
-    /* Parity bits for the 1st constituent encoders */
-    uint8_t state0 = 0;
-    if (crc_cb) {
-      int block_size_nocrc = (long_cb - crc_cb->order - ((last_cb) ? crc_tb->order : 0)) / 8;
-
-      /* if CRC pointer is given */
-      for (int i = 0; i < block_size_nocrc; i++) {
-        uint8_t in = input[i];
-
-        /* Put byte in TB CRC and save latest checksum */
-        srslte_crc_checksum_put_byte(crc_tb, in);
+    /* Compute the CRCs over the packed block and append them */
+    int block_size_nocrc = (long_cb - ((crc_cb) ? crc_cb->order : 0) - ((last_cb) ? crc_tb->order : 0)) / 8;
 
-        /* Put byte in CB CRC and save latest checksum */
-        srslte_crc_checksum_put_byte(crc_cb, in);
+    srslte_crc_checksum_put_bytes(crc_tb, input, block_size_nocrc);
 
-        /* Run actual encoder */
-        tcod_lut_t l = tcod_lut[state0][in];
-        parity[i] = l.output;
-        state0 = l.next_state;
+    if (last_cb) {
+      uint32_t checksum = (uint32_t) srslte_crc_checksum_get(crc_tb);
+      for (int i = 0; i < crc_tb->order / 8; i++) {
+        int mask_shift = 8 * (crc_tb->order / 8 - i - 1);
+        input[block_size_nocrc + i] = (uint8_t) ((checksum >> mask_shift) & 0xff);
       }
+    }
 
-      if (last_cb) {
-        uint32_t checksum = (uint32_t) srslte_crc_checksum_get(crc_tb);
-        for (int i = 0; i < crc_tb->order / 8; i++) {
-          int mask_shift = 8 * (crc_tb->order / 8 - i - 1);
-          int idx = block_size_nocrc + i;
-          uint8_t in = (uint8_t) ((checksum >> mask_shift) & 0xff);
-
-          /* Put byte in CB CRC and save latest checksum */
-          srslte_crc_checksum_put_byte(crc_cb, in);
-
-          input[idx] = in;
-          tcod_lut_t l = tcod_lut[state0][in];
-          parity[idx] = l.output;
-          state0 = l.next_state;
-        }
-      }
+    if (crc_cb) {
+      srslte_crc_checksum_put_bytes(crc_cb, input, (long_cb - crc_cb->order) / 8);
 
       uint32_t checksum = (uint32_t) srslte_crc_checksum_get(crc_cb);
       for (int i = 0; i < crc_cb->order / 8; i++) {
         int mask_shift = 8 * (crc_cb->order / 8 - i - 1);
-        int idx = (long_cb - crc_cb->order) / 8 + i;
-        uint8_t in = (uint8_t) ((checksum >> mask_shift) & 0xff);
-
-        input[idx] = in;
-        tcod_lut_t l = tcod_lut[state0][in];
-        parity[idx] = l.output;
-        state0 = l.next_state;
-      }
-
-    } else {
-      /* No CRC given */
-      int block_size_nocrc = (long_cb - ((last_cb) ? crc_tb->order : 0)) / 8;
-
-      for (uint32_t i = 0; i < block_size_nocrc; i++) {
-        uint8_t in = input[i];
-
-        srslte_crc_checksum_put_byte(crc_tb, in);
-
-        tcod_lut_t l = tcod_lut[state0][in];
-        parity[i] = l.output;
-        state0 = l.next_state;
+        input[(long_cb - crc_cb->order) / 8 + i] = (uint8_t) ((checksum >> mask_shift) & 0xff);
       }
+    }
 
-      if (last_cb) {
-        uint32_t checksum = (uint32_t) srslte_crc_checksum_get(crc_tb);
-        for (int i = 0; i < crc_tb->order / 8; i++) {
-          int mask_shift = 8 * (crc_tb->order / 8 - i - 1);
-          int idx = block_size_nocrc + i;
-          uint8_t in = (uint8_t) ((checksum >> mask_shift) & 0xff);
-
-          input[idx] = in;
-          tcod_lut_t l = tcod_lut[state0][in];
-          parity[idx] = l.output;
-          state0 = l.next_state;
-        }
-      }
+    /* Parity bits for the 1st constituent encoders */
+    uint8_t state0 = 0;
+    for (uint32_t i = 0; i < long_cb / 8; i++) {
+      tcod_lut_t l = tcod_lut[state0][input[i]];
+      parity[i] = l.output;
+      state0 = l.next_state;
     }
+
     parity[long_cb / 8] = 0;  // will put tail here later
     
     /* Interleave input */
@@ -113,11 +113,44 @@ srslte_tdec_8bit_impl_t avx8_win_impl = {
 };
 #endif
 
-#define AUTO_16_SSE    0
-#define AUTO_16_SSEWIN 1
-#define AUTO_16_AVXWIN 2
-#define AUTO_8_SSEWIN  0
-#define AUTO_8_AVXWIN  1
+/* AVX512 window implementations. They are built for the CPU features given in the pragma and are only used if the
+ * CPU running the code supports them */
+#ifdef LV_HAVE_AVX512BW_TARGET
+#pragma GCC push_options
+#pragma GCC target("avx2,avx512f,avx512bw")
+
+#define WINIMP_IS_AVX512_16
+#include "srslte/phy/fec/turbodecoder_win.h"
+#undef WINIMP_IS_AVX512_16
+srslte_tdec_16bit_impl_t avx512_16_win_impl = {
+    tdec_winavx512_16_init,
+    tdec_winavx512_16_free,
+    tdec_winavx512_16_dec,
+    tdec_winavx512_16_extract_input,
+    tdec_winavx512_16_decision_byte
+};
+
+#define WINIMP_IS_AVX512_8
+#include "srslte/phy/fec/turbodecoder_win.h"
+#undef WINIMP_IS_AVX512_8
+srslte_tdec_8bit_impl_t avx512_8_win_impl = {
+    tdec_winavx512_8_init,
+    tdec_winavx512_8_free,
+    tdec_winavx512_8_dec,
+    tdec_winavx512_8_extract_input,
+    tdec_winavx512_8_decision_byte
+};
+
+#pragma GCC pop_options
+#endif
+
+#define AUTO_16_SSE       0
+#define AUTO_16_SSEWIN    1
+#define AUTO_16_AVXWIN    2
+#define AUTO_16_AVX512WIN 3
+#define AUTO_8_SSEWIN     0
+#define AUTO_8_AVXWIN     1
+#define AUTO_8_AVX512WIN  2
 
 
 // Include interfaces for 8 and 16 bit decoder implementations
@@ -130,12 +163,29 @@ srslte_tdec_8bit_impl_t avx8_win_impl = {
 #undef LLR_IS_16BIT
 
 
+/* Returns true if the AVX512 implementations are built and the CPU supports them */
+bool srslte_tdec_avx512_supported()
+{
+#ifdef LV_HAVE_AVX512BW_TARGET
+  static int supported = -1;
+  if (supported < 0) {
+    __builtin_cpu_init();
+    supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+  }
+  return supported;
+#else
+  return false;
+#endif
+}
+
 int srslte_tdec_init(srslte_tdec_t * h, uint32_t max_long_cb) {
   return srslte_tdec_init_manual(h, max_long_cb, SRSLTE_TDEC_AUTO);
 }
 
 uint32_t interleaver_idx(uint32_t nof_subblocks) {
   switch (nof_subblocks) {
+    case 64:
+      return 4;
     case 32:
       return 3;
     case 16:
@@ -187,6 +237,24 @@ int srslte_tdec_init_manual(srslte_tdec_t * h, uint32_t max_long_cb, srslte_tdec
       h->dec8[0] = &avx8_win_impl;
       h->current_llr_type = SRSLTE_TDEC_8;
       break;
+#endif
+#ifdef LV_HAVE_AVX512BW_TARGET
+    case SRSLTE_TDEC_AVX512_WINDOW:
+      if (!srslte_tdec_avx512_supported()) {
+        fprintf(stderr, "Error decoder %d not supported by this CPU\n", dec_type);
+        goto clean_and_exit;
+      }
+      h->dec16[0] = &avx512_16_win_impl;
+      h->current_llr_type = SRSLTE_TDEC_16;
+      break;
+    case SRSLTE_TDEC_AVX512_8_WINDOW:
+      if (!srslte_tdec_avx512_supported()) {
+        fprintf(stderr, "Error decoder %d not supported by this CPU\n", dec_type);
+        goto clean_and_exit;
+      }
+      h->dec8[0] = &avx512_8_win_impl;
+      h->current_llr_type = SRSLTE_TDEC_8;
+      break;
 #endif
     default:
       fprintf(stderr, "Error decoder %d not supported\n", dec_type);
@@ -244,6 +312,12 @@ int srslte_tdec_init_manual(srslte_tdec_t * h, uint32_t max_long_cb, srslte_tdec
     h->dec16[AUTO_16_AVXWIN] = &avx16_win_impl;
     h->dec8[AUTO_8_AVXWIN]  = &avx8_win_impl;
 #endif
+#ifdef LV_HAVE_AVX512BW_TARGET
+    if (srslte_tdec_avx512_supported()) {
+      h->dec16[AUTO_16_AVX512WIN] = &avx512_16_win_impl;
+      h->dec8[AUTO_8_AVX512WIN]   = &avx512_8_win_impl;
+    }
+#endif
 
     for (int td=0;td<SRSLTE_TDEC_NOF_AUTO_MODES_16;td++) {
       if (h->dec16[td]) {
@@ -260,18 +334,22 @@ int srslte_tdec_init_manual(srslte_tdec_t * h, uint32_t max_long_cb, srslte_tdec
       }
     }
 
-    // Compute 1 interleaver for each possible nof_subblocks (1, 8, 16 or 32)
-    for (int s=0;s<4;s++) {
+    // Compute 1 interleaver for each possible nof_subblocks (1, 8, 16, 32 and 64 if AVX512 is used)
+    int nof_interleavers = srslte_tdec_avx512_supported() ? SRSLTE_TDEC_NOF_INTERLEAVERS : SRSLTE_TDEC_NOF_INTERLEAVERS - 1;
+    for (int s=0;s<nof_interleavers;s++) {
+      uint32_t nof_sb = s?(8<<(s-1)):1;
       for (int i=0;i<SRSLTE_NOF_TC_CB_SIZES;i++) {
         if (srslte_tc_interl_init(&h->interleaver[s][i], srslte_cbsegm_cbsize(i)) < 0) {
           goto clean_and_exit;
         }
-        srslte_tc_interl_LTE_gen_interl(&h->interleaver[s][i], srslte_cbsegm_cbsize(i), s?(8<<(s-1)):1);
+        // Code-blocks shorter than the number of sub-blocks are never decoded with sub-blocks
+        srslte_tc_interl_LTE_gen_interl(&h->interleaver[s][i], srslte_cbsegm_cbsize(i),
+                                        srslte_cbsegm_cbsize(i) >= nof_sb ? nof_sb : 1);
       }
     }
   } else {
     uint32_t nof_subblocks;
-    if (dec_type < SRSLTE_TDEC_SSE8_WINDOW) {
+    if (h->current_llr_type == SRSLTE_TDEC_16) {
       if ((h->nof_blocks16[0] = h->dec16[0]->tdec_init(&h->dec16_hdlr[0], h->max_long_cb))<0) {
         goto clean_and_exit;
       }
@@ -286,7 +364,8 @@ int srslte_tdec_init_manual(srslte_tdec_t * h, uint32_t max_long_cb, srslte_tdec
       if (srslte_tc_interl_init(&h->interleaver[interleaver_idx(nof_subblocks)][i], srslte_cbsegm_cbsize(i)) < 0) {
         goto clean_and_exit;
       }
-      srslte_tc_interl_LTE_gen_interl(&h->interleaver[interleaver_idx(nof_subblocks)][i], srslte_cbsegm_cbsize(i), nof_subblocks);
+      srslte_tc_interl_LTE_gen_interl(&h->interleaver[interleaver_idx(nof_subblocks)][i], srslte_cbsegm_cbsize(i),
+                                      srslte_cbsegm_cbsize(i) >= nof_subblocks ? nof_subblocks : 1);
     }
   }
 
@@ -337,7 +416,7 @@ void srslte_tdec_free(srslte_tdec_t * h)
       h->dec16[td]->tdec_free(h->dec16_hdlr[td]);
     }
   }
-  for (int s=0;s<4;s++) {
+  for (int s=0;s<SRSLTE_TDEC_NOF_INTERLEAVERS;s++) {
     for (int i=0;i<SRSLTE_NOF_TC_CB_SIZES;i++) {
       srslte_tc_interl_free(&h->interleaver[s][i]);
     }
@@ -363,6 +442,9 @@ static void tdec_decision_byte(srslte_tdec_t * h, uint8_t *output)
 /* Returns number of subblocks in automatic mode for this long_cb */
 uint32_t srslte_tdec_autoimp_get_subblocks(uint32_t long_cb)
 {
+  if (srslte_tdec_avx512_supported() && !(long_cb%32) && long_cb > 1600) {
+    return 32;
+  }
 #ifdef LV_HAVE_AVX2
   if (!(long_cb%16) && long_cb > 800) {
     return 16;
@@ -378,6 +460,8 @@ uint32_t srslte_tdec_autoimp_get_subblocks(uint32_t long_cb)
 static int tdec_sb_idx(uint32_t long_cb) {
   uint32_t nof_sb = srslte_tdec_autoimp_get_subblocks(long_cb);
   switch(nof_sb) {
+    case 32:
+      return AUTO_16_AVX512WIN;
     case 16:
       return AUTO_16_AVXWIN;
     case 8:
@@ -391,6 +475,9 @@ static int tdec_sb_idx(uint32_t long_cb) {
 
 uint32_t srslte_tdec_autoimp_get_subblocks_8bit(uint32_t long_cb)
 {
+  if (srslte_tdec_avx512_supported() && !(long_cb%64) && long_cb > 4096) {
+    return 64;
+  }
 #ifdef LV_HAVE_AVX2
   if (!(long_cb%32) && long_cb > 2048) {
     return 32;
@@ -408,6 +495,8 @@ uint32_t srslte_tdec_autoimp_get_subblocks_8bit(uint32_t long_cb)
 static int tdec_sb_idx_8(uint32_t long_cb) {
   uint32_t nof_sb = srslte_tdec_autoimp_get_subblocks_8bit(long_cb);
   switch(nof_sb) {
+    case 64:
+      return AUTO_8_AVX512WIN;
     case 32:
       return AUTO_8_AVXWIN;
     case 16:
@@ -452,6 +541,11 @@ static void tdec_iteration_8(srslte_tdec_t * h, int8_t * input)
     }
   } else {
     h->current_dec = 0;
+    if (h->current_llr_type == SRSLTE_TDEC_8) {
+      h->current_inter_idx = interleaver_idx(h->nof_blocks8[h->current_dec]);
+    } else {
+      h->current_inter_idx = interleaver_idx(h->nof_blocks16[h->current_dec]);
+    }
   }
 
   if (h->current_llr_type == SRSLTE_TDEC_16) {
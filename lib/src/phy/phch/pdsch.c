@@ -459,6 +459,15 @@ void srslte_pdsch_set_power_allocation(srslte_pdsch_t *q, float rho_a) {
   }
 }
 
+/* Makes the encoder read the pregenerated scrambling sequences of the owner object (NULL to use its own). The owner
+ * table is only read, so several objects can share it to encode different users of the same subframe concurrently.
+ */
+void srslte_pdsch_set_shared_users(srslte_pdsch_t *q, srslte_pdsch_t *owner) {
+  if (q) {
+    q->shared_users = owner ? owner->users : NULL;
+  }
+}
+
 int srslte_pdsch_enable_csi(srslte_pdsch_t *q, bool enable) {
   if (enable) {
     for (int i = 0; i < SRSLTE_MAX_CODEWORDS; i++) {
@@ -617,14 +626,15 @@ static srslte_sequence_t *get_user_sequence(srslte_pdsch_t *q, uint16_t rnti,
                                             uint32_t codeword_idx, uint32_t sf_idx, uint32_t len)
 {
   uint32_t rnti_idx = q->is_ue?0:rnti;
+  srslte_pdsch_user_t **users = q->shared_users?q->shared_users:q->users;
 
   // The scrambling sequence is pregenerated for all RNTIs in the eNodeB but only for C-RNTI in the UE
-  if (q->users[rnti_idx] &&
-      q->users[rnti_idx]->sequence_generated &&
-      q->users[rnti_idx]->cell_id == q->cell.id &&
+  if (users[rnti_idx] &&
+      users[rnti_idx]->sequence_generated &&
+      users[rnti_idx]->cell_id == q->cell.id &&
       (!q->is_ue || q->ue_rnti == rnti))
   {
-    return &q->users[rnti_idx]->seq[codeword_idx][sf_idx];
+    return &users[rnti_idx]->seq[codeword_idx][sf_idx];
   } else {
     srslte_sequence_pdsch(&q->tmp_seq, rnti, codeword_idx, 2 * sf_idx, q->cell.id, len);
     return &q->tmp_seq;
@@ -304,103 +304,139 @@ static int encode_tb(srslte_sch_t *q,
   return encode_tb_off(q, soft_buffer, cb_segm, Qm, rv, nof_e_bits, data, e_bits, 0);
 }
 
-bool decode_tb_cb(srslte_sch_t *q, 
-                     srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm, 
-                     uint32_t Qm, uint32_t rv, uint32_t nof_e_bits, 
-                     void *e_bits, uint8_t *data)
-{
+void srslte_sch_set_async(srslte_sch_t *q, srslte_sch_executor_t *executor, srslte_sch_tb_t *tb) {
+  q->executor = executor;
+  q->async_tb = tb;
+  if (tb) {
+    tb->pending = false;
+    tb->nof_cb  = 0;
+  }
+}
 
-  int8_t *e_bits_b  = e_bits;
-  int16_t *e_bits_s = e_bits;
+int srslte_sch_cb_decoder_init(srslte_sch_cb_decoder_t *q) {
+  int ret = SRSLTE_ERROR_INVALID_INPUTS;
+  if (q) {
+    ret = SRSLTE_ERROR;
+    bzero(q, sizeof(srslte_sch_cb_decoder_t));
 
-  if (cb_segm->C > SRSLTE_MAX_CODEBLOCKS) {
-    fprintf(stderr, "Error SRSLTE_MAX_CODEBLOCKS=%d\n", SRSLTE_MAX_CODEBLOCKS);
-    return false;
+    if (srslte_crc_init(&q->crc_tb, SRSLTE_LTE_CRC24A, 24)) {
+      fprintf(stderr, "Error initiating CRC\n");
+      goto clean;
+    }
+    if (srslte_crc_init(&q->crc_cb, SRSLTE_LTE_CRC24B, 24)) {
+      fprintf(stderr, "Error initiating CRC\n");
+      goto clean;
+    }
+    if (srslte_tdec_init(&q->decoder, SRSLTE_TCOD_MAX_LEN_CB)) {
+      fprintf(stderr, "Error initiating Turbo Decoder\n");
+      goto clean;
+    }
+    q->data = srslte_vec_malloc(sizeof(uint8_t) * (SRSLTE_TCOD_MAX_LEN_CB+8)/8);
+    if (!q->data) {
+      goto clean;
+    }
+    ret = SRSLTE_SUCCESS;
+  }
+clean:
+  if (ret == SRSLTE_ERROR) {
+    srslte_sch_cb_decoder_free(q);
   }
+  return ret;
+}
 
-  q->nof_iterations = 0;
+void srslte_sch_cb_decoder_free(srslte_sch_cb_decoder_t *q) {
+  if (q->data) {
+    free(q->data);
+  }
+  srslte_tdec_free(&q->decoder);
+  bzero(q, sizeof(srslte_sch_cb_decoder_t));
+}
 
-  for (int cb_idx=0;cb_idx<cb_segm->C;cb_idx++)
-  {
-    /* Do not process blocks with CRC Ok */
-    if (softbuffer->cb_crc[cb_idx] == false) {
+/* Rate dematching of one code block into its softbuffer */
+static int cb_rate_dematch(bool llr_is_8bit, srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm,
+                           uint32_t Qm, uint32_t rv, uint32_t nof_e_bits, void *e_bits, uint32_t cb_idx)
+{
+  int8_t *e_bits_b  = e_bits;
+  int16_t *e_bits_s = e_bits;
 
-      uint32_t cb_len     = cb_idx<cb_segm->C1?cb_segm->K1:cb_segm->K2;
-      uint32_t cb_len_idx = cb_idx<cb_segm->C1?cb_segm->K1_idx:cb_segm->K2_idx;
+  uint32_t cb_len_idx = cb_idx<cb_segm->C1?cb_segm->K1_idx:cb_segm->K2_idx;
 
-      uint32_t rlen       = cb_segm->C==1?cb_len:(cb_len-24);
-      uint32_t Gp         = nof_e_bits / Qm;
-      uint32_t gamma      = cb_segm->C>0?Gp%cb_segm->C:Gp;
-      uint32_t n_e        = Qm * (Gp/cb_segm->C);
+  uint32_t Gp         = nof_e_bits / Qm;
+  uint32_t gamma      = cb_segm->C>0?Gp%cb_segm->C:Gp;
+  uint32_t n_e        = Qm * (Gp/cb_segm->C);
 
-      uint32_t rp   = cb_idx*n_e;
-      uint32_t n_e2 = n_e;
+  uint32_t rp   = cb_idx*n_e;
+  uint32_t n_e2 = n_e;
 
-      if (cb_idx > cb_segm->C - gamma) {
-        n_e2 = n_e+Qm;
-        rp   = (cb_segm->C - gamma)*n_e + (cb_idx-(cb_segm->C - gamma))*n_e2;
-      }
+  if (cb_idx > cb_segm->C - gamma) {
+    n_e2 = n_e+Qm;
+    rp   = (cb_segm->C - gamma)*n_e + (cb_idx-(cb_segm->C - gamma))*n_e2;
+  }
 
-      if (q->llr_is_8bit) {
-        if (srslte_rm_turbo_rx_lut_8bit(&e_bits_b[rp], (int8_t*) softbuffer->buffer_f[cb_idx], n_e2, cb_len_idx, rv)) {
-          fprintf(stderr, "Error in rate matching\n");
-          return SRSLTE_ERROR;
-        }
-      } else {
-        if (srslte_rm_turbo_rx_lut(&e_bits_s[rp], softbuffer->buffer_f[cb_idx], n_e2, cb_len_idx, rv)) {
-          fprintf(stderr, "Error in rate matching\n");
-          return SRSLTE_ERROR;
-        }
-      }
+  if (llr_is_8bit) {
+    if (srslte_rm_turbo_rx_lut_8bit(&e_bits_b[rp], (int8_t*) softbuffer->buffer_f[cb_idx], n_e2, cb_len_idx, rv)) {
+      fprintf(stderr, "Error in rate matching\n");
+      return SRSLTE_ERROR;
+    }
+  } else {
+    if (srslte_rm_turbo_rx_lut(&e_bits_s[rp], softbuffer->buffer_f[cb_idx], n_e2, cb_len_idx, rv)) {
+      fprintf(stderr, "Error in rate matching\n");
+      return SRSLTE_ERROR;
+    }
+  }
+  return SRSLTE_SUCCESS;
+}
 
-      srslte_tdec_new_cb(&q->decoder, cb_len);
+/* Runs turbo decoder iterations on a code block, using CRC for early stopping */
+static bool cb_decode(srslte_tdec_t *decoder, srslte_crc_t *crc_tb, srslte_crc_t *crc_cb,
+                      bool llr_is_8bit, uint32_t max_iterations, srslte_softbuffer_rx_t *softbuffer,
+                      srslte_cbsegm_t *cb_segm, uint32_t cb_idx, uint8_t *data, uint32_t *nof_iterations)
+{
+  uint32_t cb_len = cb_idx<cb_segm->C1?cb_segm->K1:cb_segm->K2;
 
-      // Run iterations and use CRC for early stopping
-      bool early_stop = false;
-      uint32_t cb_noi = 0;
-      do {
-        if (q->llr_is_8bit) {
-          srslte_tdec_iteration_8bit(&q->decoder, (int8_t*) softbuffer->buffer_f[cb_idx], &data[cb_idx*rlen/8]);
-        } else {
-          srslte_tdec_iteration(&q->decoder, softbuffer->buffer_f[cb_idx], &data[cb_idx*rlen/8]);
-        }
-        q->nof_iterations++;
-        cb_noi++;
+  uint32_t len_crc;
+  srslte_crc_t *crc_ptr;
 
-        uint32_t len_crc;
-        srslte_crc_t *crc_ptr;
+  if (cb_segm->C > 1) {
+    len_crc = cb_len;
+    crc_ptr = crc_cb;
+  } else {
+    len_crc = cb_segm->tbs+24;
+    crc_ptr = crc_tb;
+  }
 
-        if (cb_segm->C > 1) {
-          len_crc = cb_len;
-          crc_ptr = &q->crc_cb;
-        } else {
-          len_crc = cb_segm->tbs+24;
-          crc_ptr = &q->crc_tb;
-        }
+  srslte_tdec_new_cb(decoder, cb_len);
 
-        // CRC is OK
-        if (!srslte_crc_checksum_byte(crc_ptr, &data[cb_idx*rlen/8], len_crc)) {
+  bool early_stop = false;
+  uint32_t cb_noi = 0;
+  do {
+    if (llr_is_8bit) {
+      srslte_tdec_iteration_8bit(decoder, (int8_t*) softbuffer->buffer_f[cb_idx], data);
+    } else {
+      srslte_tdec_iteration(decoder, softbuffer->buffer_f[cb_idx], data);
+    }
+    cb_noi++;
 
-          softbuffer->cb_crc[cb_idx] = true;
-          early_stop = true;
+    // CRC is OK
+    if (!srslte_crc_checksum_byte(crc_ptr, data, len_crc)) {
 
-          // CRC is error and exceeded maximum iterations for this CB.
-          // Early stop the whole transport block.
-        }
+      softbuffer->cb_crc[cb_idx] = true;
+      early_stop = true;
 
-      } while (cb_noi < q->max_iterations && !early_stop);
+      // CRC is error and exceeded maximum iterations for this CB.
+      // Early stop the whole transport block.
+    }
 
-      INFO("CB %d: rp=%d, n_e=%d, cb_len=%d, CRC=%s, rlen=%d, iterations=%d/%d\n",
-           cb_idx, rp, n_e2, cb_len, early_stop?"OK":"KO", rlen, cb_noi, q->max_iterations);
+  } while (cb_noi < max_iterations && !early_stop);
 
-    } else {
-      // Copy decoded data from previous transmissions
-      uint32_t cb_len     = cb_idx<cb_segm->C1?cb_segm->K1:cb_segm->K2;
-      uint32_t rlen       = cb_segm->C==1?cb_len:(cb_len-24);
-      memcpy(&data[cb_idx*rlen/8], softbuffer->data[cb_idx], rlen/8 * sizeof(uint8_t));
-    }
-  }
+  *nof_iterations = cb_noi;
+  return early_stop;
+}
 
+/* Transport block is correct if all code blocks are. Otherwise, saves the
+ * correct code blocks for the next retransmission */
+static bool tb_cb_crc(srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm, uint8_t *data)
+{
   softbuffer->tb_crc = true;
   for (int i = 0; i < cb_segm->C && softbuffer->tb_crc; i++) {
     /* If one CB failed return false */
@@ -416,9 +452,155 @@ bool decode_tb_cb(srslte_sch_t *q,
       }
     }
   }
+  return softbuffer->tb_crc;
+}
+
+/* Checks the transport block parity bits */
+static int tb_crc(srslte_crc_t *crc_tb, srslte_cbsegm_t *cb_segm, uint8_t *data)
+{
+  uint32_t par_rx = 0, par_tx = 0;
+
+  // Compute transport block CRC
+  par_rx = srslte_crc_checksum_byte(crc_tb, data, cb_segm->tbs);
+
+  // check parity bits
+  par_tx = ((uint32_t) data[cb_segm->tbs/8+0])<<16  |
+           ((uint32_t) data[cb_segm->tbs/8+1])<<8   |
+           ((uint32_t) data[cb_segm->tbs/8+2]);
+
+  if (par_rx == par_tx && par_rx) {
+    INFO("TB decoded OK\n");
+    return SRSLTE_SUCCESS;
+  } else {
+    INFO("Error in TB parity: par_tx=0x%x, par_rx=0x%x\n", par_tx, par_rx);
+    return SRSLTE_ERROR;
+  }
+}
+
+bool decode_tb_cb(srslte_sch_t *q, 
+                     srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm, 
+                     uint32_t Qm, uint32_t rv, uint32_t nof_e_bits, 
+                     void *e_bits, uint8_t *data)
+{
+  if (cb_segm->C > SRSLTE_MAX_CODEBLOCKS) {
+    fprintf(stderr, "Error SRSLTE_MAX_CODEBLOCKS=%d\n", SRSLTE_MAX_CODEBLOCKS);
+    return false;
+  }
+
+  q->nof_iterations = 0;
+
+  for (int cb_idx=0;cb_idx<cb_segm->C;cb_idx++)
+  {
+    uint32_t cb_len     = cb_idx<cb_segm->C1?cb_segm->K1:cb_segm->K2;
+    uint32_t rlen       = cb_segm->C==1?cb_len:(cb_len-24);
+
+    /* Do not process blocks with CRC Ok */
+    if (softbuffer->cb_crc[cb_idx] == false) {
+
+      if (cb_rate_dematch(q->llr_is_8bit, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, cb_idx)) {
+        return false;
+      }
+
+      uint32_t cb_noi = 0;
+      bool crc_ok = cb_decode(&q->decoder, &q->crc_tb, &q->crc_cb, q->llr_is_8bit, q->max_iterations,
+                              softbuffer, cb_segm, cb_idx, &data[cb_idx*rlen/8], &cb_noi);
+      q->nof_iterations += cb_noi;
+
+      INFO("CB %d: cb_len=%d, CRC=%s, rlen=%d, iterations=%d/%d\n",
+           cb_idx, cb_len, crc_ok?"OK":"KO", rlen, cb_noi, q->max_iterations);
+
+    } else {
+      // Copy decoded data from previous transmissions
+      memcpy(&data[cb_idx*rlen/8], softbuffer->data[cb_idx], rlen/8 * sizeof(uint8_t));
+    }
+  }
 
   q->nof_iterations /= cb_segm->C;
-  return softbuffer->tb_crc;
+  return tb_cb_crc(softbuffer, cb_segm, data);
+}
+
+/* Rate dematches the code blocks and hands those not yet decoded to the executor */
+static int decode_tb_async(srslte_sch_t *q, srslte_sch_tb_t *tb,
+                           srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm,
+                           uint32_t Qm, uint32_t rv, uint32_t nof_e_bits,
+                           void *e_bits, uint8_t *data)
+{
+  if (cb_segm->C > SRSLTE_MAX_CODEBLOCKS) {
+    fprintf(stderr, "Error SRSLTE_MAX_CODEBLOCKS=%d\n", SRSLTE_MAX_CODEBLOCKS);
+    return SRSLTE_ERROR;
+  }
+
+  tb->softbuffer     = softbuffer;
+  tb->data           = data;
+  tb->llr_is_8bit    = q->llr_is_8bit;
+  tb->max_iterations = q->max_iterations;
+  tb->nof_cb         = 0;
+  memcpy(&tb->cb_segm, cb_segm, sizeof(srslte_cbsegm_t));
+
+  for (int cb_idx=0;cb_idx<cb_segm->C;cb_idx++) {
+    if (softbuffer->cb_crc[cb_idx] == false) {
+      if (cb_rate_dematch(q->llr_is_8bit, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, cb_idx)) {
+        return SRSLTE_ERROR;
+      }
+      tb->cb[tb->nof_cb].tb             = tb;
+      tb->cb[tb->nof_cb].cb_idx         = cb_idx;
+      tb->cb[tb->nof_cb].nof_iterations = 0;
+      tb->nof_cb++;
+    } else {
+      uint32_t cb_len = cb_idx<cb_segm->C1?cb_segm->K1:cb_segm->K2;
+      uint32_t rlen   = cb_segm->C==1?cb_len:(cb_len-24);
+      memcpy(&data[cb_idx*rlen/8], softbuffer->data[cb_idx], rlen/8 * sizeof(uint8_t));
+    }
+  }
+
+  tb->pending = true;
+  if (tb->nof_cb) {
+    q->executor->run(q->executor->arg, tb);
+  }
+  return SRSLTE_SUCCESS;
+}
+
+/* Decodes one code block of a deferred transport block. Each code block is
+ * decoded into the thread scratch buffer, since consecutive code blocks
+ * overlap in the output by their CRC bytes. */
+bool srslte_sch_decode_cb(srslte_sch_cb_decoder_t *q, srslte_sch_cb_t *cb)
+{
+  srslte_sch_tb_t *tb = cb->tb;
+  srslte_cbsegm_t *cb_segm = &tb->cb_segm;
+
+  uint32_t cb_len = cb->cb_idx<cb_segm->C1?cb_segm->K1:cb_segm->K2;
+  uint32_t rlen   = cb_segm->C==1?cb_len:(cb_len-24);
+
+  bool crc_ok = cb_decode(&q->decoder, &q->crc_tb, &q->crc_cb, tb->llr_is_8bit, tb->max_iterations,
+                          tb->softbuffer, cb_segm, cb->cb_idx, q->data, &cb->nof_iterations);
+
+  memcpy(&tb->data[cb->cb_idx*rlen/8], q->data, rlen/8 * sizeof(uint8_t));
+
+  INFO("CB %d: cb_len=%d, CRC=%s, rlen=%d, iterations=%d/%d\n",
+       cb->cb_idx, cb_len, crc_ok?"OK":"KO", rlen, cb->nof_iterations, tb->max_iterations);
+
+  return crc_ok;
+}
+
+/* Completes a deferred transport block once all its code blocks are decoded */
+int srslte_sch_tb_finish(srslte_sch_t *q, srslte_sch_tb_t *tb)
+{
+  if (!tb->pending) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  tb->pending = false;
+
+  q->nof_iterations = 0;
+  for (uint32_t i = 0; i < tb->nof_cb; i++) {
+    q->nof_iterations += tb->cb[i].nof_iterations;
+  }
+  q->nof_iterations /= tb->cb_segm.C;
+
+  if (tb_cb_crc(tb->softbuffer, &tb->cb_segm, tb->data)) {
+    return tb_crc(&q->crc_tb, &tb->cb_segm, tb->data);
+  } else {
+    return SRSLTE_ERROR;
+  }
 }
 
 /**
@@ -461,34 +643,18 @@ static int decode_tb(srslte_sch_t *q,
       return SRSLTE_ERROR_INVALID_INPUTS;
     }
         
-    bool crc_ok = true; 
-
     data[cb_segm->tbs/8+0] = 0; 
     data[cb_segm->tbs/8+1] = 0; 
     data[cb_segm->tbs/8+2] = 0; 
+
+    // Code blocks are decoded by the executor, the caller finishes the TB
+    if (q->executor && q->async_tb) {
+      return decode_tb_async(q, q->async_tb, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, data);
+    }
     
     // Process Codeblocks
-    crc_ok = decode_tb_cb(q, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, data);
-
-    if (crc_ok) {
-
-      uint32_t par_rx = 0, par_tx = 0;
-  
-      // Compute transport block CRC
-      par_rx = srslte_crc_checksum_byte(&q->crc_tb, data, cb_segm->tbs);
-
-      // check parity bits
-      par_tx = ((uint32_t) data[cb_segm->tbs/8+0])<<16  | 
-               ((uint32_t) data[cb_segm->tbs/8+1])<<8   | 
-               ((uint32_t) data[cb_segm->tbs/8+2]);
-
-      if (par_rx == par_tx && par_rx) {
-        INFO("TB decoded OK\n");
-        return SRSLTE_SUCCESS;
-      } else {
-        INFO("Error in TB parity: par_tx=0x%x, par_rx=0x%x\n", par_tx, par_rx);
-        return SRSLTE_ERROR;
-      }
+    if (decode_tb_cb(q, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, data)) {
+      return tb_crc(&q->crc_tb, cb_segm, data);
     } else {
       return SRSLTE_ERROR; 
     }        
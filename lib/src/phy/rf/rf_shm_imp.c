@@ -0,0 +1,794 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Shared memory RF loopback device. Each process (eNodeB or UE) attaches to a POSIX shared memory segment and owns
+ * a node in it, with a ring of transmitted samples per antenna indexed by their absolute timestamp. A receiver sums
+ * the rings of the nodes of the other role transmitting on its receive frequency. Time is the host monotonic clock
+ * (optionally slowed down), shared by all the processes, so timestamps behave as with a real radio: a receiver blocks
+ * until its samples are in the past and a transmission into the past is late. Rings are written by blocks tagged
+ * with their absolute time, blocks never written for the current lap read as zeros.
+ *
+ * Device arguments:
+ *   shm_role=enb|ue      Mandatory, the device is not opened without it
+ *   shm_name=<name>      Segment name (default srslte_rf), shared by the processes to connect
+ *   shm_noise_db=<dB>    Adds AWGN of this power (dB relative to unit power) to the received samples
+ *   shm_doppler_hz=<Hz>  Flat Rayleigh fading of the link of this process, applied to transmitted and received samples
+ *   shm_seed=<n>         Seed of the fading (default the process id)
+ *   shm_time_scale=<x>   Time runs x times slower than real time, set by the process creating the segment
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "srslte/srslte.h"
+#include "rf_shm_imp.h"
+
+#define SHM_MAGIC            0x3146524554534c53ULL // Layout version, change with the structs below
+#define SHM_DEFAULT_NAME     "srslte_rf"
+#define SHM_MAX_NODES        9                     // e.g. one eNodeB and eight UEs
+#define SHM_MAX_CHANNELS     SRSLTE_MAX_PORTS
+#define SHM_RING_SIZE        (1<<18)               // Samples per antenna, power of two
+#define SHM_BLOCK_SIZE       128
+#define SHM_NOF_BLOCKS       (SHM_RING_SIZE/SHM_BLOCK_SIZE)
+#define SHM_RX_GUARD_SEC     100e-6                // Samples younger than this are not received yet
+#define SHM_MAX_RX_LAG_SEC   5e-3                  // Receiving later than this is an overflow
+#define SHM_DECIM_HALF_TAPS  8                     // Decimation filter half length, in output samples
+#define SHM_OPEN_TIMEOUT_SEC 10
+
+typedef enum {
+  SHM_ROLE_ENB = 1,
+  SHM_ROLE_UE,
+} shm_role_t;
+
+typedef struct {
+  volatile int32_t pid;                         // Owner process, 0 if the node is free
+  volatile uint32_t role;
+  volatile uint32_t nof_channels;
+  volatile double   tx_freq;
+  volatile double   tx_srate;                   // 0 while not transmitting
+  volatile int64_t  block_time[SHM_NOF_BLOCKS]; // Absolute block held by each ring block
+  cf_t              samples[SHM_MAX_CHANNELS][SHM_RING_SIZE];
+} shm_node_t;
+
+typedef struct {
+  uint64_t          magic;
+  volatile uint32_t ready;
+  int64_t           epoch_ns;
+  double            time_scale;
+  shm_node_t        nodes[SHM_MAX_NODES];
+} shm_segment_t;
+
+typedef struct {
+  char               path[80];
+  shm_segment_t     *seg;
+  shm_node_t        *node;
+  shm_role_t         role;
+  uint32_t           nof_channels;
+
+  double             rx_srate;
+  double             rx_freq;
+  double             rx_gain;
+  bool               rx_streaming;
+  int64_t            rx_next;       // Next sample to receive, at rx_srate
+  cf_t              *rx_buffer;
+  uint32_t           rx_buffer_len;
+  uint32_t           decim;         // Ratio of the current decimation filter
+  float             *taps;
+  uint32_t           nof_taps;
+
+  double             tx_srate;
+  double             tx_freq;
+  double             tx_gain;
+  bool               in_burst;
+  int64_t            tx_next;       // Next sample of the burst, at tx_srate
+  cf_t              *tx_buffer;
+  uint32_t           tx_buffer_len;
+
+  float              noise_std;
+  bool               fading_enabled;
+  srslte_ch_fading_t fading;
+
+  srslte_rf_info_t          info;
+  srslte_rf_error_handler_t error_handler;
+} rf_shm_handler_t;
+
+static void shm_error(rf_shm_handler_t *h, int type, int opt)
+{
+  if (h->error_handler) {
+    srslte_rf_error_t error;
+    bzero(&error, sizeof(srslte_rf_error_t));
+    error.type = type;
+    error.opt  = opt;
+    h->error_handler(error);
+  }
+}
+
+static int64_t shm_clock_ns()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (int64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+// Device time in seconds
+static double shm_time(rf_shm_handler_t *h)
+{
+  return (shm_clock_ns() - h->seg->epoch_ns) * 1e-9 / h->seg->time_scale;
+}
+
+static void shm_wait_until(rf_shm_handler_t *h, double time_s)
+{
+  double now;
+  while ((now = shm_time(h)) < time_s) {
+    double wait = (time_s - now) * h->seg->time_scale;
+    struct timespec t;
+    t.tv_sec  = (time_t) wait;
+    t.tv_nsec = (long) ((wait - t.tv_sec) * 1e9);
+    nanosleep(&t, NULL);
+  }
+}
+
+static void shm_time_to_secs(double time_s, time_t *secs, double *frac_secs)
+{
+  if (secs && frac_secs) {
+    *secs      = (time_t) floor(time_s);
+    *frac_secs = time_s - *secs;
+  }
+}
+
+static int64_t floor_div(int64_t a, int64_t b)
+{
+  return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+/* Copies the value of key=value from the device arguments, up to the next comma */
+static bool parse_arg(char *args, const char *key, char *value, uint32_t max_len)
+{
+  char *ptr = args ? strstr(args, key) : NULL;
+  if (ptr) {
+    ptr += strlen(key);
+    uint32_t n = 0;
+    while (n < max_len - 1 && ptr[n] != '\0' && ptr[n] != ',') {
+      value[n] = ptr[n];
+      n++;
+    }
+    value[n] = '\0';
+    return true;
+  }
+  return false;
+}
+
+static cf_t *shm_buffer(cf_t **buffer, uint32_t *len, uint32_t min_len)
+{
+  if (*len < min_len) {
+    if (*buffer) {
+      free(*buffer);
+    }
+    *buffer = srslte_vec_malloc(sizeof(cf_t) * min_len);
+    *len    = *buffer ? min_len : 0;
+  }
+  return *buffer;
+}
+
+/* Windowed sinc low-pass filter to decimate by R, the passband is 90% of the output Nyquist band */
+static int shm_design_decimator(rf_shm_handler_t *h, uint32_t R)
+{
+  if (h->taps) {
+    free(h->taps);
+  }
+  h->nof_taps = 2 * SHM_DECIM_HALF_TAPS * R + 1;
+  h->taps     = srslte_vec_malloc(sizeof(float) * h->nof_taps);
+  if (!h->taps) {
+    h->decim = 0;
+    return SRSLTE_ERROR;
+  }
+  float fc  = 0.9f / (2 * R);
+  float c   = (h->nof_taps - 1) / 2.0f;
+  float sum = 0;
+  for (uint32_t k = 0; k < h->nof_taps; k++) {
+    float x = 2 * fc * (k - c);
+    float s = (x == 0) ? 1.0f : sinf(M_PI * x) / (M_PI * x);
+    h->taps[k] = s * (0.54f - 0.46f * cosf(2 * M_PI * k / (h->nof_taps - 1)));
+    sum += h->taps[k];
+  }
+  for (uint32_t k = 0; k < h->nof_taps; k++) {
+    h->taps[k] /= sum;
+  }
+  h->decim = R;
+  return SRSLTE_SUCCESS;
+}
+
+/* Copies len samples of a node ring starting at absolute sample t, samples not transmitted read as zeros */
+static void shm_ring_read(shm_node_t *node, uint32_t ch, int64_t t, uint32_t len, cf_t *out)
+{
+  uint32_t i = 0;
+  while (i < len) {
+    int64_t  blk = floor_div(t, SHM_BLOCK_SIZE);
+    uint32_t off = (uint32_t) (t - blk * SHM_BLOCK_SIZE);
+    uint32_t n   = SRSLTE_MIN(SHM_BLOCK_SIZE - off, len - i);
+    uint32_t b   = (uint32_t) (blk & (SHM_NOF_BLOCKS - 1));
+    bool valid = false;
+    if (t >= 0 && node->block_time[b] == blk) {
+      __sync_synchronize();
+      memcpy(&out[i], &node->samples[ch][b * SHM_BLOCK_SIZE + off], sizeof(cf_t) * n);
+      __sync_synchronize();
+      // The writer may have started the next lap of the ring meanwhile
+      valid = (node->block_time[b] == blk);
+    }
+    if (!valid) {
+      bzero(&out[i], sizeof(cf_t) * n);
+    }
+    i += n;
+    t += n;
+  }
+}
+
+/* Writes len samples of all the antennas to the own ring starting at absolute sample t */
+static void shm_ring_write(shm_node_t *node, cf_t **data, uint32_t nof_channels, int64_t t, uint32_t len)
+{
+  uint32_t i = 0;
+  while (i < len) {
+    int64_t  blk = floor_div(t, SHM_BLOCK_SIZE);
+    uint32_t off = (uint32_t) (t - blk * SHM_BLOCK_SIZE);
+    uint32_t n   = SRSLTE_MIN(SHM_BLOCK_SIZE - off, len - i);
+    uint32_t b   = (uint32_t) (blk & (SHM_NOF_BLOCKS - 1));
+    if (node->block_time[b] != blk) {
+      // Clear the previous lap before the block becomes valid for the readers
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        bzero(&node->samples[ch][b * SHM_BLOCK_SIZE], sizeof(cf_t) * SHM_BLOCK_SIZE);
+      }
+      __sync_synchronize();
+      node->block_time[b] = blk;
+      __sync_synchronize();
+    }
+    for (uint32_t ch = 0; ch < nof_channels; ch++) {
+      memcpy(&node->samples[ch][b * SHM_BLOCK_SIZE + off], &data[ch][i], sizeof(cf_t) * n);
+    }
+    i += n;
+    t += n;
+  }
+}
+
+/* Adds the samples transmitted by a node to the nsamples received from rx_next at the receive rate. The transmit
+ * rate must be an integer multiple of the receive rate, e.g. the UE searching the cell at 1.92 MHz */
+static void shm_receive_node(rf_shm_handler_t *h, shm_node_t *node, void **data, uint32_t nsamples)
+{
+  double tx_srate = node->tx_srate;
+  if (tx_srate <= 0 || h->rx_srate <= 0) {
+    return;
+  }
+  uint32_t R = (uint32_t) lround(tx_srate / h->rx_srate);
+  if (R < 1 || fabs(tx_srate - R * h->rx_srate) > 1.0) {
+    return;
+  }
+  if (R > 1 && R != h->decim && shm_design_decimator(h, R)) {
+    return;
+  }
+  uint32_t half = (R > 1) ? (h->nof_taps - 1) / 2 : 0;
+  uint32_t len  = nsamples * R + 2 * half;
+  cf_t *buffer  = shm_buffer(&h->rx_buffer, &h->rx_buffer_len, len);
+  if (!buffer) {
+    return;
+  }
+  for (uint32_t ch = 0; ch < h->nof_channels; ch++) {
+    cf_t *out = (cf_t*) data[ch];
+    shm_ring_read(node, ch % node->nof_channels, h->rx_next * R - half, len, buffer);
+    if (R == 1) {
+      srslte_vec_sum_ccc(out, buffer, out, nsamples);
+    } else {
+      for (uint32_t m = 0; m < nsamples; m++) {
+        out[m] += srslte_vec_dot_prod_cfc(&buffer[m * R], h->taps, h->nof_taps);
+      }
+    }
+  }
+}
+
+static int shm_attach(rf_shm_handler_t *h, double time_scale)
+{
+  int fd = shm_open(h->path, O_RDWR | O_CREAT | O_EXCL, 0666);
+  bool creator = (fd >= 0);
+  if (!creator) {
+    if (errno != EEXIST) {
+      perror("shm_open");
+      return SRSLTE_ERROR;
+    }
+    fd = shm_open(h->path, O_RDWR, 0666);
+    if (fd < 0) {
+      perror("shm_open");
+      return SRSLTE_ERROR;
+    }
+    // Wait for the creator to size it
+    struct stat st;
+    int64_t deadline = shm_clock_ns() + (int64_t) SHM_OPEN_TIMEOUT_SEC * 1000000000;
+    while (!fstat(fd, &st) && st.st_size == 0 && shm_clock_ns() < deadline) {
+      usleep(1000);
+    }
+    if (st.st_size != sizeof(shm_segment_t)) {
+      fprintf(stderr, "Error shared memory RF segment %s has a different layout, remove /dev/shm%s\n",
+              h->path, h->path);
+      close(fd);
+      return SRSLTE_ERROR;
+    }
+  } else if (ftruncate(fd, sizeof(shm_segment_t))) {
+    perror("ftruncate");
+    close(fd);
+    shm_unlink(h->path);
+    return SRSLTE_ERROR;
+  }
+
+  h->seg = mmap(NULL, sizeof(shm_segment_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (h->seg == MAP_FAILED) {
+    perror("mmap");
+    h->seg = NULL;
+    return SRSLTE_ERROR;
+  }
+
+  if (creator) {
+    h->seg->epoch_ns   = shm_clock_ns();
+    h->seg->time_scale = time_scale;
+    for (uint32_t i = 0; i < SHM_MAX_NODES; i++) {
+      for (uint32_t b = 0; b < SHM_NOF_BLOCKS; b++) {
+        h->seg->nodes[i].block_time[b] = -1;
+      }
+    }
+    h->seg->magic = SHM_MAGIC;
+    __sync_synchronize();
+    h->seg->ready = 1;
+  } else {
+    int64_t deadline = shm_clock_ns() + (int64_t) SHM_OPEN_TIMEOUT_SEC * 1000000000;
+    while (!h->seg->ready && shm_clock_ns() < deadline) {
+      usleep(1000);
+    }
+    __sync_synchronize();
+    if (!h->seg->ready || h->seg->magic != SHM_MAGIC) {
+      fprintf(stderr, "Error shared memory RF segment %s is not valid, remove /dev/shm%s\n", h->path, h->path);
+      return SRSLTE_ERROR;
+    }
+  }
+
+  // Claim a free node, or one left by a process that no longer exists
+  int32_t pid = (int32_t) getpid();
+  for (uint32_t i = 0; i < SHM_MAX_NODES && !h->node; i++) {
+    shm_node_t *node = &h->seg->nodes[i];
+    int32_t owner = node->pid;
+    if ((owner == 0 || (kill(owner, 0) && errno == ESRCH)) && __sync_bool_compare_and_swap(&node->pid, owner, pid)) {
+      node->tx_srate     = 0;
+      node->tx_freq      = 0;
+      node->nof_channels = h->nof_channels;
+      node->role         = h->role;
+      h->node            = node;
+    }
+  }
+  if (!h->node) {
+    fprintf(stderr, "Error shared memory RF segment %s has no free node (maximum %d)\n", h->path, SHM_MAX_NODES);
+    return SRSLTE_ERROR;
+  }
+  return SRSLTE_SUCCESS;
+}
+
+static void shm_detach(rf_shm_handler_t *h)
+{
+  if (h->seg) {
+    if (h->node) {
+      h->node->tx_srate = 0;
+      __sync_synchronize();
+      h->node->pid = 0;
+    }
+    // The last process leaving removes the segment
+    bool in_use = false;
+    for (uint32_t i = 0; i < SHM_MAX_NODES; i++) {
+      in_use |= (h->seg->nodes[i].pid != 0);
+    }
+    if (!in_use) {
+      shm_unlink(h->path);
+    }
+    munmap(h->seg, sizeof(shm_segment_t));
+    h->seg  = NULL;
+    h->node = NULL;
+  }
+}
+
+void rf_shm_suppress_stdout(void *h)
+{
+}
+
+void rf_shm_register_error_handler(void *h, srslte_rf_error_handler_t new_handler)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->error_handler = new_handler;
+}
+
+char* rf_shm_devname(void *h)
+{
+  return DEVNAME_SHM;
+}
+
+bool rf_shm_rx_wait_lo_locked(void *h)
+{
+  return true;
+}
+
+int rf_shm_start_rx_stream(void *h, bool now)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_next      = (int64_t) floor(shm_time(handler) * handler->rx_srate);
+  handler->rx_streaming = true;
+  return 0;
+}
+
+int rf_shm_stop_rx_stream(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_streaming = false;
+  return 0;
+}
+
+void rf_shm_flush_buffer(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_next = (int64_t) floor(shm_time(handler) * handler->rx_srate);
+}
+
+bool rf_shm_has_rssi(void *h)
+{
+  return false;
+}
+
+float rf_shm_get_rssi(void *h)
+{
+  return 0.0;
+}
+
+int rf_shm_open(char *args, void **h)
+{
+  return rf_shm_open_multi(args, h, 1);
+}
+
+int rf_shm_open_multi(char *args, void **h, uint32_t nof_channels)
+{
+  char value[64];
+
+  *h = NULL;
+  if (!parse_arg(args, "shm_role=", value, sizeof(value))) {
+    return SRSLTE_ERROR;
+  }
+  if (nof_channels < 1 || nof_channels > SHM_MAX_CHANNELS) {
+    fprintf(stderr, "Error shared memory RF supports up to %d channels\n", SHM_MAX_CHANNELS);
+    return SRSLTE_ERROR;
+  }
+
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) calloc(1, sizeof(rf_shm_handler_t));
+  if (!handler) {
+    perror("calloc");
+    return SRSLTE_ERROR;
+  }
+  handler->nof_channels = nof_channels;
+  handler->info.min_tx_gain = 0;
+  handler->info.max_tx_gain = 100;
+  handler->info.min_rx_gain = 0;
+  handler->info.max_rx_gain = 100;
+
+  if (!strcmp(value, "enb")) {
+    handler->role = SHM_ROLE_ENB;
+  } else if (!strcmp(value, "ue")) {
+    handler->role = SHM_ROLE_UE;
+  } else {
+    fprintf(stderr, "Error invalid shm_role=%s, must be enb or ue\n", value);
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+
+  snprintf(handler->path, sizeof(handler->path), "/%s", SHM_DEFAULT_NAME);
+  if (parse_arg(args, "shm_name=", value, sizeof(value))) {
+    snprintf(handler->path, sizeof(handler->path), "/%s", value);
+  }
+  if (parse_arg(args, "shm_noise_db=", value, sizeof(value))) {
+    handler->noise_std = sqrtf(powf(10.0f, atof(value) / 10.0f) / 2.0f);
+  }
+  uint32_t seed = (uint32_t) getpid();
+  if (parse_arg(args, "shm_seed=", value, sizeof(value))) {
+    seed = (uint32_t) atoi(value);
+  }
+  if (parse_arg(args, "shm_doppler_hz=", value, sizeof(value)) && atof(value) > 0) {
+    srslte_ch_fading_init(&handler->fading, atof(value), seed);
+    handler->fading_enabled = true;
+  }
+  double time_scale = 1.0;
+  if (parse_arg(args, "shm_time_scale=", value, sizeof(value)) && atof(value) > 0) {
+    time_scale = atof(value);
+  }
+
+  if (shm_attach(handler, time_scale)) {
+    shm_detach(handler);
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+
+  printf("Opened shared memory RF %s as %s, node %d, %d channels, time scale %.1f\n", handler->path,
+         handler->role == SHM_ROLE_ENB ? "eNodeB" : "UE", (int) (handler->node - handler->seg->nodes),
+         nof_channels, handler->seg->time_scale);
+
+  *h = handler;
+  return SRSLTE_SUCCESS;
+}
+
+int rf_shm_close(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  shm_detach(handler);
+  if (handler->rx_buffer) {
+    free(handler->rx_buffer);
+  }
+  if (handler->tx_buffer) {
+    free(handler->tx_buffer);
+  }
+  if (handler->taps) {
+    free(handler->taps);
+  }
+  free(handler);
+  return 0;
+}
+
+void rf_shm_set_master_clock_rate(void *h, double rate)
+{
+}
+
+bool rf_shm_is_master_clock_dynamic(void *h)
+{
+  return true;
+}
+
+double rf_shm_set_rx_srate(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  if (handler->rx_streaming && handler->rx_srate > 0) {
+    handler->rx_next = llround(handler->rx_next / handler->rx_srate * freq);
+  }
+  handler->rx_srate = freq;
+  return freq;
+}
+
+double rf_shm_set_tx_srate(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->tx_srate = freq;
+  handler->in_burst = false;
+  // Readers use the rate to index the ring, samples written at the previous rate are dropped
+  handler->node->tx_srate = 0;
+  __sync_synchronize();
+  for (uint32_t b = 0; b < SHM_NOF_BLOCKS; b++) {
+    handler->node->block_time[b] = -1;
+  }
+  __sync_synchronize();
+  handler->node->tx_srate = freq;
+  return freq;
+}
+
+double rf_shm_set_rx_gain(void *h, double gain)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_gain = gain;
+  return gain;
+}
+
+double rf_shm_set_tx_gain(void *h, double gain)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->tx_gain = gain;
+  return gain;
+}
+
+double rf_shm_get_rx_gain(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return handler->rx_gain;
+}
+
+double rf_shm_get_tx_gain(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return handler->tx_gain;
+}
+
+srslte_rf_info_t *rf_shm_get_info(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return &handler->info;
+}
+
+double rf_shm_set_rx_freq(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_freq = freq;
+  return freq;
+}
+
+double rf_shm_set_tx_freq(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->tx_freq       = freq;
+  handler->node->tx_freq = freq;
+  return freq;
+}
+
+void rf_shm_get_time(void *h, time_t *secs, double *frac_secs)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  shm_time_to_secs(shm_time(handler), secs, frac_secs);
+}
+
+int rf_shm_recv_with_time(void *h, void *data, uint32_t nsamples, bool blocking, time_t *secs, double *frac_secs)
+{
+  return rf_shm_recv_with_time_multi(h, &data, nsamples, blocking, secs, frac_secs);
+}
+
+int rf_shm_recv_with_time_multi(void *h, void **data, uint32_t nsamples, bool blocking, time_t *secs,
+                                double *frac_secs)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  double srate = handler->rx_srate;
+
+  if (srate <= 0) {
+    fprintf(stderr, "Error receiving from shared memory RF: sampling rate not set\n");
+    return SRSLTE_ERROR;
+  }
+  if (!handler->rx_streaming) {
+    rf_shm_start_rx_stream(h, true);
+  }
+
+  // Samples not read in time are lost, as with a radio
+  double now = shm_time(handler);
+  if (now - handler->rx_next / srate > SHM_MAX_RX_LAG_SEC + SHM_RX_GUARD_SEC) {
+    int64_t rx_next = (int64_t) floor((now - SHM_RX_GUARD_SEC) * srate);
+    shm_error(handler, SRSLTE_RF_ERROR_OVERFLOW, (int) (rx_next - handler->rx_next));
+    handler->rx_next = rx_next;
+  }
+
+  double end = (handler->rx_next + nsamples) / srate + SHM_RX_GUARD_SEC;
+  if (end > now) {
+    if (!blocking) {
+      return 0;
+    }
+    shm_wait_until(handler, end);
+  }
+
+  for (uint32_t ch = 0; ch < handler->nof_channels; ch++) {
+    bzero(data[ch], sizeof(cf_t) * nsamples);
+  }
+  for (uint32_t i = 0; i < SHM_MAX_NODES; i++) {
+    shm_node_t *node = &handler->seg->nodes[i];
+    if (node != handler->node && node->pid && node->role != handler->role &&
+        fabs(node->tx_freq - handler->rx_freq) < 1.0)
+    {
+      shm_receive_node(handler, node, data, nsamples);
+    }
+  }
+
+  double time_s = handler->rx_next / srate;
+  for (uint32_t ch = 0; ch < handler->nof_channels; ch++) {
+    if (handler->fading_enabled) {
+      srslte_ch_fading_execute(&handler->fading, data[ch], data[ch], nsamples, time_s, srate);
+    }
+    if (handler->noise_std > 0) {
+      srslte_ch_awgn_c(data[ch], data[ch], handler->noise_std, nsamples);
+    }
+  }
+
+  shm_time_to_secs(time_s, secs, frac_secs);
+  handler->rx_next += nsamples;
+  return nsamples;
+}
+
+int rf_shm_send_timed(void *h, void *data, int nsamples, time_t secs, double frac_secs, bool has_time_spec,
+                      bool blocking, bool is_start_of_burst, bool is_end_of_burst)
+{
+  void *_data[SRSLTE_MAX_PORTS] = {data, NULL, NULL, NULL};
+  return rf_shm_send_timed_multi(h, _data, nsamples, secs, frac_secs, has_time_spec, blocking,
+                                 is_start_of_burst, is_end_of_burst);
+}
+
+int rf_shm_send_timed_multi(void *h, void *data[4], int nsamples, time_t secs, double frac_secs,
+                            bool has_time_spec, bool blocking, bool is_start_of_burst, bool is_end_of_burst)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  double srate = handler->tx_srate;
+
+  if (srate <= 0) {
+    fprintf(stderr, "Error transmitting to shared memory RF: sampling rate not set\n");
+    return SRSLTE_ERROR;
+  }
+
+  int64_t t;
+  if (has_time_spec) {
+    t = llround((secs + frac_secs) * srate);
+  } else if (handler->in_burst) {
+    t = handler->tx_next;
+  } else {
+    t = (int64_t) ceil((shm_time(handler) + SHM_RX_GUARD_SEC) * srate);
+  }
+  handler->in_burst = !is_end_of_burst;
+  handler->tx_next  = t + nsamples;
+
+  if (nsamples <= 0) {
+    return nsamples;
+  }
+
+  // Do not overwrite samples that may not have been received yet
+  double ahead = (t + nsamples) / srate - (SHM_RING_SIZE / 2) / srate;
+  if (ahead > shm_time(handler)) {
+    if (!blocking) {
+      return 0;
+    }
+    shm_wait_until(handler, ahead);
+  }
+
+  // The part of the burst that should have been transmitted already is dropped
+  uint32_t skip = 0;
+  int64_t  now  = (int64_t) ceil((shm_time(handler) + SHM_RX_GUARD_SEC) * srate);
+  if (t < now) {
+    skip = (uint32_t) SRSLTE_MIN(now - t, nsamples);
+    shm_error(handler, SRSLTE_RF_ERROR_LATE, skip);
+  }
+  uint32_t len = nsamples - skip;
+  if (len == 0) {
+    return nsamples;
+  }
+
+  cf_t *ptr[SHM_MAX_CHANNELS];
+  for (uint32_t ch = 0; ch < handler->nof_channels; ch++) {
+    ptr[ch] = data[ch] ? &((cf_t*) data[ch])[skip] : NULL;
+  }
+  if (handler->fading_enabled || !ptr[handler->nof_channels - 1]) {
+    cf_t *buffer = shm_buffer(&handler->tx_buffer, &handler->tx_buffer_len, len * handler->nof_channels);
+    if (!buffer) {
+      return SRSLTE_ERROR;
+    }
+    for (uint32_t ch = 0; ch < handler->nof_channels; ch++) {
+      cf_t *out = &buffer[ch * len];
+      if (!ptr[ch]) {
+        bzero(out, sizeof(cf_t) * len);
+      } else if (handler->fading_enabled) {
+        srslte_ch_fading_execute(&handler->fading, ptr[ch], out, len, (t + skip) / srate, srate);
+      } else {
+        memcpy(out, ptr[ch], sizeof(cf_t) * len);
+      }
+      ptr[ch] = out;
+    }
+  }
+  shm_ring_write(handler->node, ptr, handler->nof_channels, t + skip, len);
+
+  return nsamples;
+}
@@ -0,0 +1,206 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/rf/rf.h"
+
+#define FREQ        2680e6
+#define BURST_DELAY 2e-3
+
+char args_enb[128];
+char args_ue[128];
+
+/* Receives with the UE until the samples of [t, t+len/srate) have been read, returning them in out */
+int receive_burst(srslte_rf_t *ue, double srate, double t, uint32_t len, cf_t *out)
+{
+  uint32_t sf_len = (uint32_t) (srate / 1000);
+  cf_t *buffer = srslte_vec_malloc(sizeof(cf_t) * sf_len);
+  uint32_t nof_rcv = 0;
+  int ret = -1;
+
+  for (int n = 0; n < 1000 && nof_rcv < len; n++) {
+    time_t secs;
+    double frac_secs;
+    if (srslte_rf_recv_with_time(ue, buffer, sf_len, true, &secs, &frac_secs) != (int) sf_len) {
+      fprintf(stderr, "Error receiving\n");
+      goto clean_exit;
+    }
+    int64_t start = llround((secs + frac_secs - t) * srate);
+    for (uint32_t i = 0; i < sf_len; i++) {
+      if (start + i >= 0 && start + i < len) {
+        out[start + i] = buffer[i];
+        nof_rcv++;
+      }
+    }
+  }
+  ret = (nof_rcv == len) ? 0 : -1;
+
+clean_exit:
+  free(buffer);
+  return ret;
+}
+
+/* A timestamped burst is received at the same sampling rate exactly at its timestamp */
+int test_timed_burst(srslte_rf_t *enb, srslte_rf_t *ue)
+{
+  double   srate = 1.92e6;
+  uint32_t len   = 1000;
+  cf_t *tx = srslte_vec_malloc(sizeof(cf_t) * len);
+  cf_t *rx = srslte_vec_malloc(sizeof(cf_t) * (len + 200));
+  int ret = -1;
+
+  srslte_rf_set_tx_srate(enb, srate);
+  srslte_rf_set_rx_srate(ue, srate);
+  for (uint32_t i = 0; i < len; i++) {
+    tx[i] = (rand() % 2 ? 1 : -1) + _Complex_I * (rand() % 2 ? 1 : -1);
+  }
+
+  srslte_rf_start_rx_stream(ue, true);
+  time_t secs;
+  double frac_secs;
+  srslte_rf_get_time(enb, &secs, &frac_secs);
+  double t = secs + frac_secs + BURST_DELAY;
+  t = round(t * srate) / srate;
+  if (srslte_rf_send_timed2(enb, tx, len, (time_t) floor(t), t - floor(t), true, true) != (int) len) {
+    fprintf(stderr, "Error transmitting\n");
+    goto clean_exit;
+  }
+
+  // Receive 100 samples of silence around the burst
+  if (receive_burst(ue, srate, t - 100 / srate, len + 200, rx)) {
+    fprintf(stderr, "Burst not received\n");
+    goto clean_exit;
+  }
+  srslte_rf_stop_rx_stream(ue);
+
+  for (uint32_t i = 0; i < len + 200; i++) {
+    cf_t expected = (i >= 100 && i < len + 100) ? tx[i - 100] : 0;
+    if (cabsf(rx[i] - expected) > 1e-5) {
+      fprintf(stderr, "Sample %d received %.2f%+.2fi, expected %.2f%+.2fi\n", i, crealf(rx[i]), cimagf(rx[i]),
+              crealf(expected), cimagf(expected));
+      goto clean_exit;
+    }
+  }
+  printf("Timed burst received at its timestamp\n");
+  ret = 0;
+
+clean_exit:
+  free(tx);
+  free(rx);
+  return ret;
+}
+
+/* A UE receiving at a rate that divides the eNodeB one (e.g. during cell search) gets the low-pass filtered signal */
+int test_decimation(srslte_rf_t *enb, srslte_rf_t *ue)
+{
+  double   tx_srate = 15.36e6;
+  double   rx_srate = 1.92e6;
+  uint32_t R        = (uint32_t) (tx_srate / rx_srate);
+  uint32_t rx_len   = 5000;
+  uint32_t len      = rx_len * R;
+  cf_t *tx = srslte_vec_malloc(sizeof(cf_t) * len);
+  cf_t *rx = srslte_vec_malloc(sizeof(cf_t) * rx_len);
+  int ret = -1;
+
+  srslte_rf_set_tx_srate(enb, tx_srate);
+  srslte_rf_set_rx_srate(ue, rx_srate);
+
+  // In-band tone of 100 KHz plus an out of band one of 3 MHz
+  for (uint32_t i = 0; i < len; i++) {
+    tx[i] = cexpf(_Complex_I * 2 * M_PI * 100e3 * i / tx_srate) + cexpf(_Complex_I * 2 * M_PI * 3e6 * i / tx_srate);
+  }
+
+  srslte_rf_start_rx_stream(ue, true);
+  time_t secs;
+  double frac_secs;
+  srslte_rf_get_time(enb, &secs, &frac_secs);
+  double t = secs + frac_secs + BURST_DELAY;
+  t = round(t * rx_srate) / rx_srate;
+  if (srslte_rf_send_timed2(enb, tx, len, (time_t) floor(t), t - floor(t), true, true) != (int) len) {
+    fprintf(stderr, "Error transmitting\n");
+    goto clean_exit;
+  }
+  if (receive_burst(ue, rx_srate, t, rx_len, rx)) {
+    fprintf(stderr, "Burst not received\n");
+    goto clean_exit;
+  }
+  srslte_rf_stop_rx_stream(ue);
+
+  // Skip the filter transients at the edges of the burst
+  float max_err = 0;
+  for (uint32_t i = 20; i < rx_len - 20; i++) {
+    cf_t expected = cexpf(_Complex_I * 2 * M_PI * 100e3 * i / rx_srate);
+    max_err = SRSLTE_MAX(max_err, cabsf(rx[i] - expected));
+  }
+  printf("Decimation by %d maximum error %.4f\n", R, max_err);
+  ret = (max_err < 0.05) ? 0 : -1;
+
+clean_exit:
+  free(tx);
+  free(rx);
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  srslte_rf_t enb, ue;
+  int ret = -1;
+
+  snprintf(args_enb, sizeof(args_enb), "shm_role=enb,shm_name=rf_shm_test_%d", getpid());
+  snprintf(args_ue, sizeof(args_ue), "shm_role=ue,shm_name=rf_shm_test_%d", getpid());
+
+  if (srslte_rf_open_devname(&enb, "shm", args_enb, 1)) {
+    fprintf(stderr, "Error opening eNodeB device\n");
+    exit(-1);
+  }
+  if (srslte_rf_open_devname(&ue, "shm", args_ue, 1)) {
+    fprintf(stderr, "Error opening UE device\n");
+    srslte_rf_close(&enb);
+    exit(-1);
+  }
+  srslte_rf_set_tx_freq(&enb, FREQ);
+  srslte_rf_set_rx_freq(&ue, FREQ);
+
+  if (test_timed_burst(&enb, &ue)) {
+    goto clean_exit;
+  }
+  if (test_decimation(&enb, &ue)) {
+    goto clean_exit;
+  }
+  ret = 0;
+
+clean_exit:
+  srslte_rf_close(&ue);
+  srslte_rf_close(&enb);
+  printf("%s\n", ret ? "Error" : "Ok");
+  exit(ret);
+}
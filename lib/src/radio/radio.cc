@@ -58,6 +58,8 @@ bool radio::init(char *args, char *devname, uint32_t nof_channels)
   if (strstr(srslte_rf_name(&rf_device), "uhd")) {
   } else if (strstr(srslte_rf_name(&rf_device), "bladerf")) {
     burst_preamble_sec = blade_default_burst_preamble_sec;
+  } else if (!strcmp(srslte_rf_name(&rf_device), "shm")) {
+    burst_preamble_sec = 0;
   } else {
     burst_preamble_sec = 0;
     printf("\nWarning burst preamble is not calibrated for device %s. Set a value manually\n\n", srslte_rf_name(&rf_device));
@@ -444,6 +446,9 @@ void radio::set_tx_srate(double srate)
         printf("\nWarning TX/RX time offset for sampling rate %.0f KHz not calibrated. Using interpolated value\n\n", cur_tx_srate);
         tx_adv_sec = blade_default_tx_adv_samples * (1/cur_tx_srate) + blade_default_tx_adv_offset_sec;        
       }
+    } else if (!strcmp(srslte_rf_name(&rf_device), "shm")) {
+      // Samples are received at the time they are transmitted
+      nsamples = 0;
     } else {
       printf("\nWarning TX/RX time offset has not been calibrated for device %s. Set a value manually\n\n", srslte_rf_name(&rf_device));
     }
@@ -159,6 +159,14 @@ void pdcp_entity::config_security(uint8_t *k_enc_,
   }
   cipher_algo = cipher_algo_;
   integ_algo  = integ_algo_;
+
+  // Expand the AES keys once, they are used for every PDU
+  if (cipher_algo == CIPHERING_ALGORITHM_ID_128_EEA2) {
+    security_aes_init(&aes_enc, &k_enc[16]);
+  }
+  if (integ_algo == INTEGRITY_ALGORITHM_ID_128_EIA2) {
+    security_aes_init(&aes_int, &k_int[16]);
+  }
 }
 
 void pdcp_entity::enable_integrity()
@@ -253,7 +261,7 @@ void pdcp_entity::integrity_generate( uint8_t  *msg,
                       mac);
     break;
   case INTEGRITY_ALGORITHM_ID_128_EIA2:
-    security_128_eia2(&k_int[16],
+    security_128_eia2(&aes_int,
                       tx_count,
                       get_bearer_id(lcid),
                       cfg.direction,
@@ -289,7 +297,7 @@ bool pdcp_entity::integrity_verify(uint8_t  *msg,
                       mac_exp);
     break;
   case INTEGRITY_ALGORITHM_ID_128_EIA2:
-    security_128_eia2(&k_int[16],
+    security_128_eia2(&aes_int,
                       count,
                       get_bearer_id(lcid),
                       (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
@@ -331,7 +339,6 @@ void pdcp_entity::cipher_encrypt(uint8_t  *msg,
                                  uint32_t  msg_len,
                                  uint8_t  *ct)
 {
-  byte_buffer_t ct_tmp;
   switch(cipher_algo)
   {
   case CIPHERING_ALGORITHM_ID_EEA0:
@@ -343,18 +350,16 @@ void pdcp_entity::cipher_encrypt(uint8_t  *msg,
                       cfg.direction,
                       msg,
                       msg_len,
-                      ct_tmp.msg);
-    memcpy(ct, ct_tmp.msg, msg_len);
+                      ct);
     break;
   case CIPHERING_ALGORITHM_ID_128_EEA2:
-    security_128_eea2(&(k_enc[16]),
+    security_128_eea2(&aes_enc,
                       tx_count,
                       get_bearer_id(lcid),
                       cfg.direction,
                       msg,
                       msg_len,
-                      ct_tmp.msg);
-    memcpy(ct, ct_tmp.msg, msg_len);
+                      ct);
     break;
   default:
     break;
@@ -366,7 +371,6 @@ void pdcp_entity::cipher_decrypt(uint8_t  *ct,
                                  uint32_t  ct_len,
                                  uint8_t  *msg)
 {
-  byte_buffer_t msg_tmp;
   switch(cipher_algo)
   {
   case CIPHERING_ALGORITHM_ID_EEA0:
@@ -378,18 +382,16 @@ void pdcp_entity::cipher_decrypt(uint8_t  *ct,
                       (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
                       ct,
                       ct_len,
-                      msg_tmp.msg);
-    memcpy(msg, msg_tmp.msg, ct_len);
+                      msg);
     break;
   case CIPHERING_ALGORITHM_ID_128_EEA2:
-    security_128_eea2(&(k_enc[16]),
+    security_128_eea2(&aes_enc,
                       count,
                       get_bearer_id(lcid),
                       (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
                       ct,
                       ct_len,
-                      msg_tmp.msg);
-    memcpy(msg, msg_tmp.msg, ct_len);
+                      msg);
     break;
   default:
     break;
@@ -272,9 +272,10 @@ void rlc_am::rlc_am_tx::stop()
   byte_without_poll = 0;
 
   // Drop all messages in TX window
-  std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator txit;
-  for(txit = tx_window.begin(); txit != tx_window.end(); txit++) {
-    pool->deallocate(txit->second.buf);
+  for (uint32_t i = 0; i < RLC_AM_WINDOW_SIZE; i++) {
+    if (tx_window.slot(i) != NULL) {
+      pool->deallocate(tx_window.slot(i)->buf);
+    }
   }
   tx_window.clear();
 
@@ -331,7 +332,7 @@ uint32_t rlc_am::rlc_am_tx::get_buffer_state()
   if (not retx_queue.empty()) {
     rlc_amd_retx_t retx = retx_queue.front();
     log->debug("Buffer state - retx - SN: %d, Segment: %s, %d:%d\n", retx.sn, retx.is_segment ? "true" : "false", retx.so_start, retx.so_end);
-    if(tx_window.end() != tx_window.find(retx.sn)) {
+    if(tx_window.has_sn(retx.sn)) {
       int req_bytes = required_buffer_size(retx);
       if (req_bytes < 0) {
         log->error("In get_buffer_state(): Removing retx.sn=%d from queue\n", retx.sn);
@@ -386,7 +387,7 @@ uint32_t rlc_am::rlc_am_tx::get_total_buffer_state()
   if(not retx_queue.empty()) {
     rlc_amd_retx_t retx = retx_queue.front();
     log->debug("Buffer state - retx - SN: %d, Segment: %s, %d:%d\n", retx.sn, retx.is_segment ? "true" : "false", retx.so_start, retx.so_end);
-    if(tx_window.end() != tx_window.find(retx.sn)) {
+    if(tx_window.has_sn(retx.sn)) {
       int req_bytes = required_buffer_size(retx);
       if (req_bytes < 0) {
         log->error("In get_total_buffer_state(): Removing retx.sn=%d from queue\n", retx.sn);
@@ -456,7 +457,7 @@ int rlc_am::rlc_am_tx::read_pdu(uint8_t *payload, uint32_t nof_bytes)
   int pdu_size = 0;
 
   log->debug("MAC opportunity - %d bytes\n", nof_bytes);
-  log->debug("tx_window size - %zu PDUs\n", tx_window.size());
+  log->debug("tx_window size - %d PDUs\n", tx_window.size());
 
   if (not tx_enabled) {
     log->debug("RLC entity not active. Not generating PDU.\n");
@@ -512,15 +513,20 @@ void rlc_am::rlc_am_tx::timer_expired(uint32_t timeout_id)
 void rlc_am::rlc_am_tx::retransmit_random_pdu()
 {
   if (not tx_window.empty()) {
-    // randomly select PDU in tx window for retransmission
-    std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator it = tx_window.begin();
-    std::advance(it, rand() % tx_window.size());
-    log->info("Schedule SN=%d for reTx.\n", it->first);
+    // randomly select PDU in tx window for retransmission, the window holds [vt_a, vt_s)
+    uint32_t sn = (vt_a + rand() % tx_window.size()) % MOD;
+    if (not tx_window.has_sn(sn)) {
+      sn = vt_a;
+    }
+    if (not tx_window.has_sn(sn) || retx_queue.has_sn(sn)) {
+      return;
+    }
+    log->info("Schedule SN=%d for reTx.\n", sn);
     rlc_amd_retx_t retx = {};
     retx.is_segment = false;
     retx.so_start = 0;
-    retx.so_end = it->second.buf->N_bytes;
-    retx.sn = it->first;
+    retx.so_end = tx_window[sn].buf->N_bytes;
+    retx.sn = sn;
     retx_queue.push_back(retx);
   }
 }
@@ -619,7 +625,7 @@ int rlc_am::rlc_am_tx::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
   rlc_amd_retx_t retx = retx_queue.front();
 
   // Sanity check - drop any retx SNs not present in tx_window
-  while(tx_window.end() == tx_window.find(retx.sn)) {
+  while(not tx_window.has_sn(retx.sn)) {
     retx_queue.pop_front();
     if (!retx_queue.empty()) {
       retx = retx_queue.front();
@@ -839,13 +845,13 @@ int rlc_am::rlc_am_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return 0;
   }
 
-  // do not build any more PDU if window is already full
-  if (tx_sdu == NULL && tx_window.size() >= RLC_AM_WINDOW_SIZE) {
+  // do not build any more PDU if window is already full, its SNs would not fit
+  if (tx_window.size() >= RLC_AM_WINDOW_SIZE) {
     log->info("Tx window full.\n");
     return 0;
   }
 
-  byte_buffer_t *pdu = pool_allocate_blocking;
+  byte_buffer_t *pdu = pool_allocate_bytes_blocking(nof_bytes);
   if (pdu == NULL) {
 #ifdef RLC_AM_BUFFER_DEBUG
     log->console("Fatal Error: Could not allocate PDU in build_data_pdu()\n");
@@ -855,9 +861,10 @@ int rlc_am::rlc_am_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
                  vt_a, vt_ms, vt_s, poll_sn,
                  vr_r, vr_mr, vr_x, vr_ms, vr_h);
     log->console("retx_queue size: %d PDUs\n", retx_queue.size());
-    std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator txit;
-    for(txit = tx_window.begin(); txit != tx_window.end(); txit++) {
-      log->console("tx_window - SN: %d\n", txit->first);
+    for (uint32_t i = 0; i < RLC_AM_WINDOW_SIZE; i++) {
+      if (tx_window.slot(i) != NULL) {
+        log->console("tx_window - SN: %d\n", tx_window.slot(i)->header.sn);
+      }
     }
     exit(-1);
 #else
@@ -909,7 +916,7 @@ int rlc_am::rlc_am_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
       tx_sdu = NULL;
     }
     if (pdu_space > to_move) {
-      pdu_space -= SRSLTE_MIN(to_move, pdu->get_tailroom());
+      pdu_space -= to_move;
     } else {
       pdu_space = 0;
     }
@@ -987,10 +994,11 @@ int rlc_am::rlc_am_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   vt_s = (vt_s + 1)%MOD;
 
   // Place PDU in tx_window, write header and TX
-  tx_window[header.sn].buf        = pdu;
-  tx_window[header.sn].header     = header;
-  tx_window[header.sn].is_acked   = false;
-  tx_window[header.sn].retx_count = 0;
+  rlc_amd_tx_pdu_t &tx_pdu = tx_window.add_pdu(header.sn);
+  tx_pdu.buf        = pdu;
+  tx_pdu.header     = header;
+  tx_pdu.is_acked   = false;
+  tx_pdu.retx_count = 0;
 
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&header, &ptr);
@@ -1023,7 +1031,7 @@ void rlc_am::rlc_am_tx::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
   }
 
   // Handle ACKs and NACKs
-  std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator it;
+  rlc_amd_tx_pdu_t *it;
   bool update_vt_a = true;
   uint32_t i       = vt_a;
 
@@ -1035,40 +1043,40 @@ void rlc_am::rlc_am_tx::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
       if(status.nacks[j].nack_sn == i) {
         nack = true;
         update_vt_a = false;
-        it = tx_window.find(i);
-        if(tx_window.end() != it)
+        if(tx_window.has_sn(i))
         {
-          if(!retx_queue_has_sn(i)) {
+          it = &tx_window[i];
+          if(!retx_queue.has_sn(i)) {
             rlc_amd_retx_t retx = {};
             retx.sn         = i;
             retx.is_segment = false;
             retx.so_start   = 0;
-            retx.so_end     = it->second.buf->N_bytes;
+            retx.so_end     = it->buf->N_bytes;
 
             if(status.nacks[j].has_so) {
               // sanity check
-              if (status.nacks[j].so_start >= it->second.buf->N_bytes) {
+              if (status.nacks[j].so_start >= it->buf->N_bytes) {
                 // print error but try to send original PDU again
                 log->info("SO_start is larger than original PDU (%d >= %d)\n",
                            status.nacks[j].so_start,
-                           it->second.buf->N_bytes);
+                           it->buf->N_bytes);
                 status.nacks[j].so_start = 0;
               }
 
               // check for special SO_end value
               if(status.nacks[j].so_end == 0x7FFF) {
-                status.nacks[j].so_end = it->second.buf->N_bytes;
+                status.nacks[j].so_end = it->buf->N_bytes;
               }else{
                 retx.so_end = status.nacks[j].so_end + 1;
               }
 
-              if(status.nacks[j].so_start <  it->second.buf->N_bytes &&
-                 status.nacks[j].so_end   <= it->second.buf->N_bytes) {
+              if(status.nacks[j].so_start <  it->buf->N_bytes &&
+                 status.nacks[j].so_end   <= it->buf->N_bytes) {
                   retx.is_segment = true;
                   retx.so_start = status.nacks[j].so_start;
               } else {
                 log->warning("%s invalid segment NACK received for SN %d. so_start: %d, so_end: %d, N_bytes: %d\n",
-                             RB_NAME, i, status.nacks[j].so_start, status.nacks[j].so_end, it->second.buf->N_bytes);
+                             RB_NAME, i, status.nacks[j].so_start, status.nacks[j].so_end, it->buf->N_bytes);
               }
             }
             retx_queue.push_back(retx);
@@ -1079,18 +1087,16 @@ void rlc_am::rlc_am_tx::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
 
     if(!nack) {
       //ACKed SNs get marked and removed from tx_window if possible
-      if(tx_window.count(i) > 0) {
-        it = tx_window.find(i);
-        if (it != tx_window.end()) {
-          if(update_vt_a) {
-            if (it->second.buf != NULL) {
-              pool->deallocate(it->second.buf);
-              it->second.buf = 0;
-            }
-            tx_window.erase(it);
-            vt_a = (vt_a + 1)%MOD;
-            vt_ms = (vt_ms + 1)%MOD;
+      if(tx_window.has_sn(i)) {
+        it = &tx_window[i];
+        if(update_vt_a) {
+          if (it->buf != NULL) {
+            pool->deallocate(it->buf);
+            it->buf = 0;
           }
+          tx_window.remove_pdu(i);
+          vt_a = (vt_a + 1)%MOD;
+          vt_ms = (vt_ms + 1)%MOD;
         }
       }
     }
@@ -1113,7 +1119,7 @@ void rlc_am::rlc_am_tx::debug_state()
 int rlc_am::rlc_am_tx::required_buffer_size(rlc_amd_retx_t retx)
 {
   if (!retx.is_segment) {
-    if (tx_window.count(retx.sn) == 1) {
+    if (tx_window.has_sn(retx.sn)) {
       if (tx_window[retx.sn].buf) {
         return rlc_am_packed_length(&tx_window[retx.sn].header) + tx_window[retx.sn].buf->N_bytes;
       } else {
@@ -1183,17 +1189,6 @@ int rlc_am::rlc_am_tx::required_buffer_size(rlc_amd_retx_t retx)
   return rlc_am_packed_length(&new_header) + (retx.so_end-retx.so_start);
 }
 
-bool rlc_am::rlc_am_tx::retx_queue_has_sn(uint32_t sn)
-{
-  std::deque<rlc_amd_retx_t>::iterator q_it;
-  for (q_it = retx_queue.begin(); q_it != retx_queue.end(); ++q_it) {
-    if (q_it->sn == sn) {
-      return true;
-    }
-  }
-  return false;
-}
-
 
 
 /****************************************************************************
@@ -1282,21 +1277,18 @@ void rlc_am::rlc_am_rx::stop()
   do_status     = false;
 
   // Drop all messages in RX segments
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator rxsegsit;
-  std::list<rlc_amd_rx_pdu_t>::iterator                   segit;
-  for(rxsegsit = rx_segments.begin(); rxsegsit != rx_segments.end(); rxsegsit++) {
-    std::list<rlc_amd_rx_pdu_t> l = rxsegsit->second.segments;
-    for(segit = l.begin(); segit != l.end(); segit++) {
-      pool->deallocate(segit->buf);
+  for (uint32_t i = 0; i < RLC_AM_WINDOW_SIZE; i++) {
+    if (rx_segments.slot(i) != NULL) {
+      clear_segments(rx_segments.slot(i));
     }
-    l.clear();
   }
   rx_segments.clear();
 
   // Drop all messages in RX window
-  std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator rxit;
-  for(rxit = rx_window.begin(); rxit != rx_window.end(); rxit++) {
-    pool->deallocate(rxit->second.buf);
+  for (uint32_t i = 0; i < RLC_AM_WINDOW_SIZE; i++) {
+    if (rx_window.slot(i) != NULL) {
+      pool->deallocate(rx_window.slot(i)->buf);
+    }
   }
   rx_window.clear();
 
@@ -1306,8 +1298,6 @@ void rlc_am::rlc_am_rx::stop()
 
 void rlc_am::rlc_am_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t &header)
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator it;
-
   log->info_hex(payload, nof_bytes, "%s Rx data PDU SN=%d (%d B)",
                 RB_NAME,
                 header.sn,
@@ -1324,8 +1314,7 @@ void rlc_am::rlc_am_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rl
     return;
   }
 
-  it = rx_window.find(header.sn);
-  if(rx_window.end() != it) {
+  if(rx_window.has_sn(header.sn)) {
     if(header.p) {
       log->info("%s Status packet requested through polling bit\n", RB_NAME);
       do_status = true;
@@ -1336,9 +1325,8 @@ void rlc_am::rlc_am_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rl
   }
 
   // Write to rx window
-  rlc_amd_rx_pdu_t pdu;
-  pdu.buf = pool_allocate_blocking;
-  if (pdu.buf == NULL) {
+  byte_buffer_t *buf = pool_allocate_bytes_blocking(nof_bytes);
+  if (buf == NULL) {
 #ifdef RLC_AM_BUFFER_DEBUG
     log->console("Fatal Error: Couldn't allocate PDU in handle_data_pdu().\n");
     exit(-1);
@@ -1349,17 +1337,19 @@ void rlc_am::rlc_am_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rl
   }
 
   // check available space for payload
-  if (nof_bytes > pdu.buf->get_tailroom()) {
+  if (nof_bytes > buf->get_tailroom()) {
     log->error("%s Discarding SN: %d of size %d B (available space %d B)\n",
-               RB_NAME, header.sn, nof_bytes, pdu.buf->get_tailroom());
-    pool->deallocate(pdu.buf);
+               RB_NAME, header.sn, nof_bytes, buf->get_tailroom());
+    pool->deallocate(buf);
     return;
   }
-  memcpy(pdu.buf->msg, payload, nof_bytes);
-  pdu.buf->N_bytes  = nof_bytes;
-  memcpy(&pdu.header, &header, sizeof(rlc_amd_pdu_header_t));
+  memcpy(buf->msg, payload, nof_bytes);
+  buf->N_bytes  = nof_bytes;
 
-  rx_window[header.sn] = pdu;
+  rlc_amd_rx_pdu_t &pdu = rx_window.add_pdu(header.sn);
+  pdu.buf    = buf;
+  pdu.header = header;
+  pdu.next   = NULL;
 
   // Update vr_h
   if(RX_MOD_BASE(header.sn) >= RX_MOD_BASE(vr_h)) {
@@ -1367,10 +1357,8 @@ void rlc_am::rlc_am_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rl
   }
 
   // Update vr_ms
-  it = rx_window.find(vr_ms);
-  while(rx_window.end() != it) {
+  while(rx_window.has_sn(vr_ms)) {
     vr_ms = (vr_ms + 1)%MOD;
-    it = rx_window.find(vr_ms);
   }
 
   // Check poll bit
@@ -1411,8 +1399,6 @@ void rlc_am::rlc_am_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rl
 
 void rlc_am::rlc_am_rx::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t &header)
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
-
   log->info_hex(payload, nof_bytes, "%s Rx data PDU segment of SN=%d (%d B), SO=%d, N_li=%d",
                 RB_NAME, header.sn, nof_bytes, header.so, header.N_li);
   log->debug("%s\n", rlc_amd_pdu_header_to_string(header).c_str());
@@ -1428,9 +1414,8 @@ void rlc_am::rlc_am_rx::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_b
     return;
   }
 
-  rlc_amd_rx_pdu_t segment;
-  segment.buf = pool_allocate_blocking;
-  if (segment.buf == NULL) {
+  byte_buffer_t *buf = pool_allocate_bytes_blocking(nof_bytes);
+  if (buf == NULL) {
 #ifdef RLC_AM_BUFFER_DEBUG
     log->console("Fatal Error: Couldn't allocate PDU in handle_data_pdu_segment().\n");
     exit(-1);
@@ -1440,36 +1425,37 @@ void rlc_am::rlc_am_rx::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_b
 #endif
   }
 
-  memcpy(segment.buf->msg, payload, nof_bytes);
-  segment.buf->N_bytes = nof_bytes;
-  memcpy(&segment.header, &header, sizeof(rlc_amd_pdu_header_t));
+  memcpy(buf->msg, payload, nof_bytes);
+  buf->N_bytes = nof_bytes;
+
+  rlc_amd_rx_pdu_t *segment = segment_pool.allocate();
+  segment->buf    = buf;
+  segment->header = header;
+  segment->next   = NULL;
 
   // Check if we already have a segment from the same PDU
-  it = rx_segments.find(header.sn);
-  if (rx_segments.end() != it) {
+  if (rx_segments.has_sn(header.sn)) {
 
     if (header.p) {
       log->info("%s Status packet requested through polling bit\n", RB_NAME);
       do_status = true;
     }
 
-    // Add segment to PDU list and check for complete
-    if(add_segment_and_check(&it->second, &segment)) {
-      std::list<rlc_amd_rx_pdu_t>::iterator segit;
-      std::list<rlc_amd_rx_pdu_t>           seglist = it->second.segments;
-      for(segit = seglist.begin(); segit != seglist.end(); segit++) {
-        pool->deallocate(segit->buf);
-      }
-      seglist.clear();
-      rx_segments.erase(it);
+    // Add segment to PDU list and check for complete. Reassembly may have
+    // released the segments already if the PDU was the next in sequence.
+    if(add_segment_and_check(&rx_segments[header.sn], segment) && rx_segments.has_sn(header.sn)) {
+      clear_segments(&rx_segments[header.sn]);
+      rx_segments.remove_pdu(header.sn);
     }
 
   } else {
 
     // Create new PDU segment list and write to rx_segments
-    rlc_amd_rx_pdu_segments_t pdu;
-    pdu.segments.push_back(segment);
-    rx_segments[header.sn] = pdu;
+    rlc_amd_rx_pdu_segments_t &pdu = rx_segments.add_pdu(header.sn);
+    pdu.head  = NULL;
+    pdu.tail  = NULL;
+    pdu.count = 0;
+    push_segment(&pdu, segment);
 
     // Update vr_h
     if (RX_MOD_BASE(header.sn) >= RX_MOD_BASE(vr_h)) {
@@ -1514,14 +1500,16 @@ void rlc_am::rlc_am_rx::reassemble_rx_sdus()
   }
 
   // Iterate through rx_window, assembling and delivering SDUs
-  while(rx_window.end() != rx_window.find(vr_r))
+  while(rx_window.has_sn(vr_r))
   {
+    rlc_amd_rx_pdu_t &pdu = rx_window[vr_r];
+
     // Handle any SDU segments
-    for(uint32_t i=0; i<rx_window[vr_r].header.N_li; i++)
+    for(uint32_t i=0; i<pdu.header.N_li; i++)
     {
-      len = rx_window[vr_r].header.li[i];
+      len = pdu.header.li[i];
 
-      log->debug_hex(rx_window[vr_r].buf->msg, len, "Handling segment %d/%d of length %d B of SN=%d\n", i+1, rx_window[vr_r].header.N_li, len, vr_r);
+      log->debug_hex(pdu.buf->msg, len, "Handling segment %d/%d of length %d B of SN=%d\n", i+1, pdu.header.N_li, len, vr_r);
 
       // sanity check to avoid zero-size SDUs
       if (len == 0) {
@@ -1529,11 +1517,11 @@ void rlc_am::rlc_am_rx::reassemble_rx_sdus()
       }
 
       if (rx_sdu->get_tailroom() >= len) {
-        if ((rx_window[vr_r].buf->msg - rx_window[vr_r].buf->buffer) + len < SRSLTE_MAX_BUFFER_SIZE_BYTES) {
-          memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_r].buf->msg, len);
+        if ((pdu.buf->msg - pdu.buf->buffer) + len < SRSLTE_MAX_BUFFER_SIZE_BYTES) {
+          memcpy(&rx_sdu->msg[rx_sdu->N_bytes], pdu.buf->msg, len);
           rx_sdu->N_bytes += len;
-          rx_window[vr_r].buf->msg += len;
-          rx_window[vr_r].buf->N_bytes -= len;
+          pdu.buf->msg += len;
+          pdu.buf->N_bytes -= len;
           log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU (%d B)", RB_NAME, rx_sdu->N_bytes);
           rx_sdu->set_timestamp();
           parent->pdcp->write_pdu(parent->lcid, rx_sdu);
@@ -1549,31 +1537,30 @@ void rlc_am::rlc_am_rx::reassemble_rx_sdus()
 #endif
           }
         } else {
-          log->error("Cannot read %d bytes from rx_window. vr_r=%d, msg-buffer=%ld bytes\n", len, vr_r, (rx_window[vr_r].buf->msg - rx_window[vr_r].buf->buffer));
-          pool->deallocate(rx_sdu);
+          log->error("Cannot read %d bytes from rx_window. vr_r=%d, msg-buffer=%ld bytes\n", len, vr_r, (pdu.buf->msg - pdu.buf->buffer));
+          rx_sdu->reset();
           goto exit;
         }
       } else {
         log->error("Cannot fit RLC PDU in SDU buffer, dropping both.\n");
-        pool->deallocate(rx_sdu);
+        rx_sdu->reset();
         goto exit;
       }
     }
 
     // Handle last segment
-    len = rx_window[vr_r].buf->N_bytes;
-    log->debug_hex(rx_window[vr_r].buf->msg, len, "Handling last segment of length %d B of SN=%d\n", len, vr_r);
+    len = pdu.buf->N_bytes;
+    log->debug_hex(pdu.buf->msg, len, "Handling last segment of length %d B of SN=%d\n", len, vr_r);
     if (rx_sdu->get_tailroom() >= len) {
-      memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_r].buf->msg, len);
-      rx_sdu->N_bytes += rx_window[vr_r].buf->N_bytes;
+      memcpy(&rx_sdu->msg[rx_sdu->N_bytes], pdu.buf->msg, len);
+      rx_sdu->N_bytes += pdu.buf->N_bytes;
     } else {
       log->error("Cannot fit RLC PDU in SDU buffer, dropping both. Erasing SN=%d.\n", vr_r);
-      pool->deallocate(rx_sdu);
-      pool->deallocate(rx_window[vr_r].buf);
-      rx_window.erase(vr_r);
+      rx_sdu->reset();
+      goto exit;
     }
 
-    if (rlc_am_end_aligned(rx_window[vr_r].header.fi)) {
+    if (rlc_am_end_aligned(pdu.header.fi)) {
       log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU (%d B)", RB_NAME, rx_sdu->N_bytes);
       rx_sdu->set_timestamp();
       parent->pdcp->write_pdu(parent->lcid, rx_sdu);
@@ -1593,19 +1580,17 @@ exit:
     // Move the rx_window
     log->debug("Erasing SN=%d.\n", vr_r);
     // also erase any segments of this SN
-    std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
-    it = rx_segments.find(vr_r);
-    if(rx_segments.end() != it) {
+    if(rx_segments.has_sn(vr_r)) {
       log->debug("Erasing segments of SN=%d\n", vr_r);
-      std::list<rlc_amd_rx_pdu_t>::iterator segit;
-      for(segit = it->second.segments.begin(); segit != it->second.segments.end(); ++segit) {
+      rlc_amd_rx_pdu_t *segit;
+      for(segit = rx_segments[vr_r].head; segit != NULL; segit = segit->next) {
         log->debug(" Erasing segment of SN=%d SO=%d Len=%d N_li=%d\n", segit->header.sn, segit->header.so, segit->buf->N_bytes,  segit->header.N_li);
-        pool->deallocate(segit->buf);
       }
-      it->second.segments.clear();
+      clear_segments(&rx_segments[vr_r]);
+      rx_segments.remove_pdu(vr_r);
     }
-    pool->deallocate(rx_window[vr_r].buf);
-    rx_window.erase(vr_r);
+    pool->deallocate(pdu.buf);
+    rx_window.remove_pdu(vr_r);
     vr_r = (vr_r + 1)%MOD;
     vr_mr = (vr_mr + 1)%MOD;
   }
@@ -1668,10 +1653,8 @@ void rlc_am::rlc_am_rx::timer_expired(uint32_t timeout_id)
 
     // 36.322 v10 Section 5.1.3.2.4
     vr_ms = vr_x;
-    std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator it = rx_window.find(vr_ms);
-    while (rx_window.end() != it) {
+    while (rx_window.has_sn(vr_ms)) {
       vr_ms = (vr_ms + 1) % MOD;
-      it = rx_window.find(vr_ms);
     }
 
     if (poll_received) {
@@ -1700,7 +1683,7 @@ int rlc_am::rlc_am_rx::get_status_pdu(rlc_status_pdu_t* status, const uint32_t m
   uint32_t i = vr_r;
   while (RX_MOD_BASE(i) < RX_MOD_BASE(vr_ms) && status->N_nack < RLC_AM_WINDOW_SIZE && rlc_am_packed_length(status) <= max_pdu_size-2) {
     status->ack_sn = i;
-    if(rx_window.find(i) == rx_window.end()) {
+    if(not rx_window.has_sn(i)) {
       status->nacks[status->N_nack].nack_sn = i;
       status->N_nack++;
     }
@@ -1717,7 +1700,7 @@ int rlc_am::rlc_am_rx::get_status_pdu_length()
   rlc_status_pdu_t status;
   uint32_t i = vr_r;
   while (RX_MOD_BASE(i) < RX_MOD_BASE(vr_ms) && status.N_nack < RLC_AM_WINDOW_SIZE) {
-    if(rx_window.find(i) == rx_window.end()) {
+    if(not rx_window.has_sn(i)) {
       status.N_nack++;
     }
     i = (i + 1)%MOD;
@@ -1728,54 +1711,80 @@ int rlc_am::rlc_am_rx::get_status_pdu_length()
 
 void rlc_am::rlc_am_rx::print_rx_segments()
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
   std::stringstream ss;
   ss << "rx_segments:" << std::endl;
-  for(it=rx_segments.begin();it!=rx_segments.end();it++) {
-    std::list<rlc_amd_rx_pdu_t>::iterator segit;
-    for(segit = it->second.segments.begin(); segit != it->second.segments.end(); segit++) {
+  for(uint32_t i=0;i<RLC_AM_WINDOW_SIZE;i++) {
+    if (rx_segments.slot(i) == NULL) {
+      continue;
+    }
+    rlc_amd_rx_pdu_t *segit;
+    for(segit = rx_segments.slot(i)->head; segit != NULL; segit = segit->next) {
       ss << "    SN:" << segit->header.sn << " SO:" << segit->header.so << " N:" << segit->buf->N_bytes <<  " N_li: " << segit->header.N_li << std::endl;
     }
   }
   log->debug("%s\n", ss.str().c_str());
 }
 
+// Appends a segment taken from segment_pool to the list of a PDU
+void rlc_am::rlc_am_rx::push_segment(rlc_amd_rx_pdu_segments_t *pdu, rlc_amd_rx_pdu_t *segment)
+{
+  segment->next = NULL;
+  if (pdu->tail != NULL) {
+    pdu->tail->next = segment;
+  } else {
+    pdu->head = segment;
+  }
+  pdu->tail = segment;
+  pdu->count++;
+}
+
+// Frees the buffers of the segments of a PDU and returns them to segment_pool
+void rlc_am::rlc_am_rx::clear_segments(rlc_amd_rx_pdu_segments_t *pdu)
+{
+  rlc_amd_rx_pdu_t *segit = pdu->head;
+  while (segit != NULL) {
+    rlc_amd_rx_pdu_t *next = segit->next;
+    pool->deallocate(segit->buf);
+    segment_pool.deallocate(segit);
+    segit = next;
+  }
+  pdu->head  = NULL;
+  pdu->tail  = NULL;
+  pdu->count = 0;
+}
+
 bool rlc_am::rlc_am_rx::add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rlc_amd_rx_pdu_t *segment)
 {
   // Check for first segment
   if(0 == segment->header.so) {
-    std::list<rlc_amd_rx_pdu_t>::iterator it;
-    for(it = pdu->segments.begin(); it != pdu->segments.end(); it++) {
-      pool->deallocate(it->buf);
-    }
-    pdu->segments.clear();
-    pdu->segments.push_back(*segment);
+    clear_segments(pdu);
+    push_segment(pdu, segment);
     return false;
   }
 
   // Check segment offset
   uint32_t n = 0;
-  if(!pdu->segments.empty()) {
-    rlc_amd_rx_pdu_t &back = pdu->segments.back();
-    n = back.header.so + back.buf->N_bytes;
+  if(pdu->tail != NULL) {
+    n = pdu->tail->header.so + pdu->tail->buf->N_bytes;
   }
   if(segment->header.so != n) {
     pool->deallocate(segment->buf);
+    segment_pool.deallocate(segment);
     return false;
   } else {
-    pdu->segments.push_back(*segment);
+    push_segment(pdu, segment);
   }
 
   // Check for complete
   uint32_t so = 0;
-  std::list<rlc_amd_rx_pdu_t>::iterator it, tmpit;
-  for(it = pdu->segments.begin(); it != pdu->segments.end(); it++) {
+  rlc_amd_rx_pdu_t *it;
+  for(it = pdu->head; it != NULL; it = it->next) {
     if (so != it->header.so) {
       return false;
     }
     so += it->buf->N_bytes;
   }
-  if (!pdu->segments.back().header.lsf) {
+  if (!pdu->tail->header.lsf) {
     return false;
   }
 
@@ -1785,21 +1794,21 @@ bool rlc_am::rlc_am_rx::add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rl
   header.rf   = 0;
   header.p    = 0;
   header.fi   = RLC_FI_FIELD_START_AND_END_ALIGNED;
-  header.sn   = pdu->segments.front().header.sn;
+  header.sn   = pdu->head->header.sn;
   header.lsf  = 0;
   header.so   = 0;
   header.N_li = 0;
 
   // Reconstruct fi field
-  header.fi |= (pdu->segments.front().header.fi & RLC_FI_FIELD_NOT_START_ALIGNED);
-  header.fi |= (pdu->segments.back().header.fi  & RLC_FI_FIELD_NOT_END_ALIGNED);
+  header.fi |= (pdu->head->header.fi & RLC_FI_FIELD_NOT_START_ALIGNED);
+  header.fi |= (pdu->tail->header.fi & RLC_FI_FIELD_NOT_END_ALIGNED);
 
-  log->debug("Starting header reconstruction of %zd segments\n", pdu->segments.size());
+  log->debug("Starting header reconstruction of %d segments\n", pdu->count);
 
   // Reconstruct li fields
   uint16_t count     = 0;
   uint16_t carryover = 0;
-  for(it = pdu->segments.begin(); it != pdu->segments.end(); it++) {
+  for(it = pdu->head; it != NULL; it = it->next) {
     log->debug(" Handling %d PDU segments\n", it->header.N_li);
     for(uint32_t i=0; i<it->header.N_li; i++) {
       header.li[header.N_li] = it->header.li[i];
@@ -1822,8 +1831,7 @@ bool rlc_am::rlc_am_rx::add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rl
       log->debug("Recalculated carryover=%d (it->buf->N_bytes=%d, count=%d, header.li[header.N_li]=%d)\n", carryover, it->buf->N_bytes, count, header.li[header.N_li]);
     }
 
-    tmpit = it;
-    if(rlc_am_end_aligned(it->header.fi) && ++tmpit != pdu->segments.end()) {
+    if(rlc_am_end_aligned(it->header.fi) && it->next != NULL) {
       log->debug("Header is end-aligned, overwrite header.li[%d]=%d\n", header.N_li, carryover);
       header.li[header.N_li] = carryover;
       header.N_li++;
@@ -1832,7 +1840,7 @@ bool rlc_am::rlc_am_rx::add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rl
     count = 0;
   }
 
-  log->debug("Finished header reconstruction of %zd segments\n", pdu->segments.size());
+  log->debug("Finished header reconstruction of %d segments\n", pdu->count);
 
   // Copy data
   byte_buffer_t *full_pdu = pool_allocate_blocking;
@@ -1845,7 +1853,7 @@ bool rlc_am::rlc_am_rx::add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rl
     return false;
 #endif
   }
-  for(it = pdu->segments.begin(); it != pdu->segments.end(); it++) {
+  for(it = pdu->head; it != NULL; it = it->next) {
     memcpy(&full_pdu->msg[full_pdu->N_bytes], it->buf->msg, it->buf->N_bytes);
     full_pdu->N_bytes += it->buf->N_bytes;
   }
@@ -38,11 +38,13 @@ rlc_tm::rlc_tm(uint32_t queue_len) : ul_queue(queue_len)
   num_tx_bytes = 0;
   num_rx_bytes = 0;
   pool = byte_buffer_pool::get_instance();
+  pthread_mutex_init(&mutex, NULL);
 }
 
 // Warning: must call stop() to properly deallocate all buffers
 rlc_tm::~rlc_tm() {
   pool = NULL;
+  pthread_mutex_destroy(&mutex);
 }
 
 void rlc_tm::init(srslte::log               *log_,
@@ -67,11 +69,13 @@ bool rlc_tm::configure(srslte_rlc_config_t cnfg)
 void rlc_tm::empty_queue()
 {
   // Drop all messages in TX queue
+  pthread_mutex_lock(&mutex);
   byte_buffer_t *buf;
   while (ul_queue.try_read(&buf)) {
     pool->deallocate(buf);
   }
   ul_queue.reset();
+  pthread_mutex_unlock(&mutex);
 }
 
 void rlc_tm::reestablish() {
@@ -151,10 +155,13 @@ void rlc_tm::reset_metrics()
 
 int rlc_tm::read_pdu(uint8_t *payload, uint32_t nof_bytes)
 {
+  int ret = 0;
+  pthread_mutex_lock(&mutex);
   uint32_t pdu_size = ul_queue.size_tail_bytes();
   if (pdu_size > nof_bytes) {
     log->error("TX %s PDU size larger than MAC opportunity (%d > %d)\n", rrc->get_rb_name(lcid).c_str(), pdu_size, nof_bytes);
-    return -1;
+    ret = -1;
+    goto exit;
   }
   byte_buffer_t *buf;
   if (ul_queue.try_read(&buf)) {
@@ -167,20 +174,22 @@ int rlc_tm::read_pdu(uint8_t *payload, uint32_t nof_bytes)
                   rrc->get_rb_name(lcid).c_str(), rlc_mode_text[RLC_MODE_TM], ul_queue.size(), ul_queue.size_bytes());
 
     num_tx_bytes += pdu_size;
-    return pdu_size;
+    ret = pdu_size;
   } else {
     log->warning("Queue empty while trying to read\n");
     if (ul_queue.size_bytes() > 0) {
       log->warning("Corrupted queue: empty but size_bytes > 0. Resetting queue\n");
       ul_queue.reset();
     }
-    return 0;
   }
+exit:
+  pthread_mutex_unlock(&mutex);
+  return ret;
 }
 
 void rlc_tm::write_pdu(uint8_t *payload, uint32_t nof_bytes)
 {
-  byte_buffer_t *buf = pool_allocate;
+  byte_buffer_t *buf = pool_allocate_bytes(nof_bytes);
   if (buf) {
     memcpy(buf->msg, payload, nof_bytes);
     buf->N_bytes = nof_bytes;
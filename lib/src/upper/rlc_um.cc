@@ -254,7 +254,9 @@ bool rlc_um::rlc_um_tx::configure(srslte_rlc_config_t cnfg_, std::string rb_name
   }
 
   if(cfg.is_mrb){
-    tx_sdu_queue.resize(512);
+    if (!tx_sdu_queue.resize(512)) {
+      log->error("Error resizing %s RLC UM SDU queue, it is not empty\n", get_rb_name());
+    }
   }
 
   rb_name = rb_name_;
@@ -388,7 +390,7 @@ int rlc_um::rlc_um_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return 0;
   }
 
-  byte_buffer_t *pdu = pool_allocate;
+  byte_buffer_t *pdu = pool_allocate_bytes(nof_bytes);
   if(!pdu || pdu->N_bytes != 0) {
     log->error("Failed to allocate PDU buffer\n");
     pthread_mutex_unlock(&mutex);
@@ -437,7 +439,7 @@ int rlc_um::rlc_um_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
       pool->deallocate(tx_sdu);
       tx_sdu = NULL;
     }
-    pdu_space -= SRSLTE_MIN(to_move, pdu->get_tailroom());
+    pdu_space -= to_move;
     header.fi |= RLC_FI_FIELD_NOT_START_ALIGNED; // First byte does not correspond to first byte of SDU
   }
 
@@ -447,6 +449,10 @@ int rlc_um::rlc_um_tx::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     if(last_li > 0)
       header.li[header.N_li++] = last_li;
     head_len = rlc_um_packed_length(&header);
+    if (head_len >= pdu_space) {
+      header.N_li--;
+      break;
+    }
     tx_sdu_queue.read(&tx_sdu);
     uint32_t space = pdu_space-head_len;
     to_move = space >= tx_sdu->N_bytes ? tx_sdu->N_bytes : space;
@@ -619,7 +625,7 @@ void rlc_um::rlc_um_rx::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   }
 
   // Write to rx window
-  pdu.buf = pool_allocate;
+  pdu.buf = pool_allocate_bytes(nof_bytes);
   if (!pdu.buf) {
     log->error("Discarting packet: no space in buffer pool\n");
     goto unlock_and_exit;
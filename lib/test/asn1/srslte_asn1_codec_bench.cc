@@ -0,0 +1,294 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/asn1/liblte_mme.h"
+#include "srslte/asn1/liblte_rrc.h"
+#include "srslte/asn1/liblte_s1ap.h"
+#include "srslte/srslte.h"
+
+/* Measures the encode and decode rate, in messages per second for a single
+ * core, of a NAS Attach Request, an S1AP Initial Context Setup Request
+ * carrying it and an RRC Connection Reconfiguration. S1AP and RRC are coded
+ * on packed bits. The encoded messages are checked to be stable across a
+ * decode and re-encode.
+ */
+
+uint32_t nof_repetitions = 10000;
+bool     test_errors = false;
+
+typedef enum {
+  BENCH_NAS_ATTACH_REQUEST = 0,
+  BENCH_S1AP_INITIAL_CONTEXT_SETUP_REQUEST,
+  BENCH_RRC_CONNECTION_RECONFIGURATION,
+  BENCH_NOF_CASES
+} bench_case_t;
+
+const char *case_names[BENCH_NOF_CASES] = {"NAS Attach Request", "S1AP Initial Context Setup",
+                                           "RRC Connection Reconfig"};
+
+// The messages are too large for the stack
+LIBLTE_MME_ATTACH_REQUEST_MSG_STRUCT attach_req;
+LIBLTE_S1AP_S1AP_PDU_STRUCT          s1ap_pdu;
+LIBLTE_RRC_DL_DCCH_MSG_STRUCT        dl_dcch_msg;
+LIBLTE_BYTE_MSG_STRUCT               byte_msg;
+LIBLTE_BYTE_MSG_STRUCT               ref_msg;
+
+void usage(char *prog) {
+  printf("Usage: %s [nt]\n", prog);
+  printf("\t-n nof_repetitions [Default %d]\n", nof_repetitions);
+  printf("\t-t test: exit with error on unstable encoding [Default disabled]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nt")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_repetitions = atoi(argv[optind]);
+      break;
+    case 't':
+      test_errors = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+void fill_attach_request() {
+  LIBLTE_MME_PDN_CONNECTIVITY_REQUEST_MSG_STRUCT pdn_con_req;
+
+  bzero(&attach_req, sizeof(attach_req));
+  attach_req.eps_attach_type = LIBLTE_MME_EPS_ATTACH_TYPE_EPS_ATTACH;
+  for (uint32_t i = 0; i < 8; i++) {
+    attach_req.ue_network_cap.eea[i] = i < 3;
+    attach_req.ue_network_cap.eia[i] = i < 3;
+  }
+  attach_req.eps_mobile_id.type_of_id = LIBLTE_MME_EPS_MOBILE_ID_TYPE_IMSI;
+  for (uint32_t i = 0; i < 15; i++) {
+    attach_req.eps_mobile_id.imsi[i] = (i + 1) % 10;
+  }
+  attach_req.nas_ksi.tsc_flag = LIBLTE_MME_TYPE_OF_SECURITY_CONTEXT_FLAG_NATIVE;
+  attach_req.nas_ksi.nas_ksi  = 0;
+
+  bzero(&pdn_con_req, sizeof(pdn_con_req));
+  pdn_con_req.eps_bearer_id                  = 0;
+  pdn_con_req.proc_transaction_id            = 1;
+  pdn_con_req.pdn_type                       = LIBLTE_MME_PDN_TYPE_IPV4;
+  pdn_con_req.request_type                   = LIBLTE_MME_REQUEST_TYPE_INITIAL_REQUEST;
+  pdn_con_req.esm_info_transfer_flag_present = true;
+  pdn_con_req.esm_info_transfer_flag         = LIBLTE_MME_ESM_INFO_TRANSFER_FLAG_REQUIRED;
+  liblte_mme_pack_pdn_connectivity_request_msg(&pdn_con_req, &attach_req.esm_msg);
+}
+
+// Filled as the MME does, with the NAS message in the E-RAB
+void fill_initial_context_setup_request(LIBLTE_BYTE_MSG_STRUCT *nas_msg) {
+  bzero(&s1ap_pdu, sizeof(s1ap_pdu));
+  s1ap_pdu.choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &s1ap_pdu.choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALCONTEXTSETUP;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALCONTEXTSETUPREQUEST;
+
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT *req  = &init->choice.InitialContextSetupRequest;
+  LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT        *erab = &req->E_RABToBeSetupListCtxtSUReq.buffer[0];
+
+  req->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  req->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 56;
+  req->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateDL.BitRate = 1000000000;
+  req->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateUL.BitRate = 1000000000;
+
+  req->E_RABToBeSetupListCtxtSUReq.len = 1;
+  erab->e_RAB_ID.E_RAB_ID = 5;
+  erab->e_RABlevelQoSParameters.qCI.QCI = 9;
+  erab->e_RABlevelQoSParameters.allocationRetentionPriority.priorityLevel.PriorityLevel = 15;
+  erab->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionCapability =
+      LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_SHALL_NOT_TRIGGER_PRE_EMPTION;
+  erab->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionVulnerability =
+      LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_PRE_EMPTABLE;
+  erab->transportLayerAddress.n_bits = 32;
+  for (uint32_t i = 0; i < 32; i++) {
+    erab->transportLayerAddress.buffer[i] = (0x7F000001 >> (31 - i)) & 1;
+  }
+  for (uint32_t i = 0; i < 4; i++) {
+    erab->gTP_TEID.buffer[i] = i + 1;
+  }
+  erab->nAS_PDU_present  = true;
+  erab->nAS_PDU.n_octets = nas_msg->N_bytes;
+  memcpy(erab->nAS_PDU.buffer, nas_msg->msg, nas_msg->N_bytes);
+
+  for (uint32_t i = 0; i < 3; i++) {
+    req->UESecurityCapabilities.encryptionAlgorithms.buffer[i]          = 1;
+    req->UESecurityCapabilities.integrityProtectionAlgorithms.buffer[i] = 1;
+  }
+  for (uint32_t i = 0; i < LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN; i++) {
+    req->SecurityKey.buffer[i] = (i * 7 >> 3) & 1;
+  }
+}
+
+void encode(bench_case_t c, LIBLTE_BYTE_MSG_STRUCT *msg) {
+  switch (c) {
+    case BENCH_NAS_ATTACH_REQUEST:
+      liblte_mme_pack_attach_request_msg(&attach_req, msg);
+      break;
+    case BENCH_S1AP_INITIAL_CONTEXT_SETUP_REQUEST:
+      liblte_s1ap_pack_s1ap_pdu(&s1ap_pdu, msg);
+      break;
+    case BENCH_RRC_CONNECTION_RECONFIGURATION:
+      liblte_rrc_pack_dl_dcch_msg(&dl_dcch_msg, msg);
+      break;
+    default:
+      break;
+  }
+}
+
+void decode(bench_case_t c, LIBLTE_BYTE_MSG_STRUCT *msg) {
+  switch (c) {
+    case BENCH_NAS_ATTACH_REQUEST:
+      liblte_mme_unpack_attach_request_msg(msg, &attach_req);
+      break;
+    case BENCH_S1AP_INITIAL_CONTEXT_SETUP_REQUEST:
+      liblte_s1ap_unpack_s1ap_pdu(msg, &s1ap_pdu);
+      break;
+    case BENCH_RRC_CONNECTION_RECONFIGURATION:
+      liblte_rrc_unpack_dl_dcch_msg(msg, &dl_dcch_msg);
+      break;
+    default:
+      break;
+  }
+}
+
+// Filled as the eNodeB does for the first DRB, with the NAS message attached
+void fill_rrc_connection_reconfiguration(LIBLTE_BYTE_MSG_STRUCT *nas_msg) {
+  bzero(&dl_dcch_msg, sizeof(dl_dcch_msg));
+  dl_dcch_msg.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG;
+
+  LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *reconf = &dl_dcch_msg.msg.rrc_con_reconfig;
+  reconf->rrc_transaction_id  = 1;
+  reconf->rr_cnfg_ded_present = true;
+
+  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT *phy_cfg = &reconf->rr_cnfg_ded.phy_cnfg_ded;
+  reconf->rr_cnfg_ded.phy_cnfg_ded_present                 = true;
+  phy_cfg->cqi_report_cnfg_present                         = true;
+  phy_cfg->cqi_report_cnfg.report_periodic_present         = true;
+  phy_cfg->cqi_report_cnfg.report_periodic_setup_present   = true;
+  phy_cfg->cqi_report_cnfg.report_periodic.pmi_cnfg_idx    = 30;
+  phy_cfg->cqi_report_cnfg.report_periodic.pucch_resource_idx = 1;
+  phy_cfg->cqi_report_cnfg.report_periodic.format_ind_periodic =
+      LIBLTE_RRC_CQI_FORMAT_INDICATOR_PERIODIC_WIDEBAND_CQI;
+
+  reconf->rr_cnfg_ded.srb_to_add_mod_list_size                        = 1;
+  reconf->rr_cnfg_ded.srb_to_add_mod_list[0].srb_id                   = 2;
+  reconf->rr_cnfg_ded.srb_to_add_mod_list[0].lc_cnfg_present          = true;
+  reconf->rr_cnfg_ded.srb_to_add_mod_list[0].lc_default_cnfg_present  = true;
+  reconf->rr_cnfg_ded.srb_to_add_mod_list[0].rlc_cnfg_present         = true;
+  reconf->rr_cnfg_ded.srb_to_add_mod_list[0].rlc_default_cnfg_present = true;
+
+  LIBLTE_RRC_DRB_TO_ADD_MOD_STRUCT *drb = &reconf->rr_cnfg_ded.drb_to_add_mod_list[0];
+  reconf->rr_cnfg_ded.drb_to_add_mod_list_size             = 1;
+  drb->drb_id                                              = 1;
+  drb->lc_id                                               = 3;
+  drb->lc_id_present                                       = true;
+  drb->eps_bearer_id                                       = 5;
+  drb->eps_bearer_id_present                               = true;
+  drb->lc_cnfg_present                                     = true;
+  drb->lc_cnfg.ul_specific_params_present                  = true;
+  drb->lc_cnfg.ul_specific_params.priority                 = 11;
+  drb->lc_cnfg.ul_specific_params.log_chan_group           = 3;
+  drb->lc_cnfg.ul_specific_params.log_chan_group_present   = true;
+  drb->pdcp_cnfg_present                                   = true;
+  drb->pdcp_cnfg.discard_timer_present                     = true;
+  drb->pdcp_cnfg.discard_timer                             = LIBLTE_RRC_DISCARD_TIMER_INFINITY;
+  drb->rlc_cnfg_present                                    = true;
+  drb->rlc_cnfg.rlc_mode                                   = LIBLTE_RRC_RLC_MODE_AM;
+
+  reconf->N_ded_info_nas               = 1;
+  reconf->ded_info_nas_list[0].N_bytes = nas_msg->N_bytes;
+  memcpy(reconf->ded_info_nas_list[0].msg, nas_msg->msg, nas_msg->N_bytes);
+}
+
+// Encodes the message, decodes it and encodes it again. Returns 0 if both encodings match
+int check(bench_case_t c) {
+  encode(c, &ref_msg);
+  decode(c, &ref_msg);
+  encode(c, &byte_msg);
+  if (byte_msg.N_bytes != ref_msg.N_bytes || memcmp(byte_msg.msg, ref_msg.msg, ref_msg.N_bytes)) {
+    printf("%s changed after decoding and encoding again\n", case_names[c]);
+    return 1;
+  }
+  return 0;
+}
+
+// Returns the time per message in microseconds
+float run_bench(bench_case_t c, bool is_encode) {
+  struct timeval t[3];
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t r = 0; r < nof_repetitions; r++) {
+    if (is_encode) {
+      encode(c, &byte_msg);
+    } else {
+      decode(c, &ref_msg);
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  return (t[0].tv_sec * 1e6 + t[0].tv_usec) / nof_repetitions;
+}
+
+int main(int argc, char **argv) {
+  int errors = 0;
+
+  parse_args(argc, argv);
+
+  fill_attach_request();
+  encode(BENCH_NAS_ATTACH_REQUEST, &byte_msg);
+  fill_initial_context_setup_request(&byte_msg);
+  fill_rrc_connection_reconfiguration(&byte_msg);
+
+  for (int c = 0; c < BENCH_NOF_CASES; c++) {
+    errors += check((bench_case_t) c);
+  }
+  printf("%d repetitions. %d errors\n", nof_repetitions, errors);
+
+  printf("%-28s%8s%14s%14s\n", "", "bytes", "encode us", "decode us");
+  for (int c = 0; c < BENCH_NOF_CASES; c++) {
+    encode((bench_case_t) c, &ref_msg);
+    printf("%-28s%8d", case_names[c], ref_msg.N_bytes);
+    printf("%14.2f", run_bench((bench_case_t) c, true));
+    printf("%14.2f\n", run_bench((bench_case_t) c, false));
+  }
+
+  exit(test_errors && errors ? -1 : 0);
+}
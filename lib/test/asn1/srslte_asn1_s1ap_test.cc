@@ -0,0 +1,626 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "srslte/asn1/liblte_s1ap.h"
+
+/* Encodes the S1AP messages exchanged by the eNodeB and the MME during an
+ * attach, filled as srsENB and srsEPC fill them, and compares the result with
+ * the encodings produced by the previous, one bit per byte, S1AP codec. The
+ * encodings are then decoded and the main fields checked.
+ */
+
+#define TESTASSERT(cond)                                                      \
+  {                                                                           \
+    if (!(cond)) {                                                            \
+      printf("[%d][%s] Assertion failed: %s\n", __LINE__, __func__, #cond); \
+      return -1;                                                              \
+    }                                                                         \
+  }
+
+// Too large for the stack
+LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
+LIBLTE_S1AP_S1AP_PDU_STRUCT rx_pdu;
+LIBLTE_BYTE_MSG_STRUCT      msg;
+
+// NAS Attach Request with a PDN Connectivity Request, as sent by srsUE
+uint8_t nas_attach_request[] = {0x07, 0x41, 0x01, 0x08, 0x09, 0x10, 0x10, 0x32, 0x54, 0x76, 0x98, 0x07, 0xe0,
+                                0xe0, 0x00, 0x06, 0x02, 0x01, 0xd0, 0x11, 0x52, 0x00};
+// NAS Authentication Request
+uint8_t nas_auth_request[] = {0x07, 0x52, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+                              0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a,
+                              0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
+
+// Encodings of the previous S1AP codec
+uint8_t s1_setup_request_enc[] = {
+  0x00, 0x11, 0x00, 0x2d, 0x00, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x08, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x00, 0x19, 0xb0, 0x00,
+  0x3c, 0x40, 0x0a, 0x03, 0x80, 0x73, 0x72, 0x73, 0x65, 0x6e, 0x62, 0x30, 0x31, 0x00, 0x40, 0x00, 0x07, 0x00, 0x00, 0x01,
+  0xc0, 0x09, 0xf1, 0x07, 0x00, 0x89, 0x40, 0x01, 0x40};
+uint8_t s1_setup_response_enc[] = {
+  0x20, 0x11, 0x00, 0x25, 0x00, 0x00, 0x03, 0x00, 0x3d, 0x40, 0x0a, 0x03, 0x80, 0x73, 0x72, 0x73, 0x6d, 0x6d, 0x65, 0x30,
+  0x31, 0x00, 0x69, 0x00, 0x0b, 0x00, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x57, 0x40, 0x01,
+  0xff};
+uint8_t initial_ue_message_enc[] = {
+  0x00, 0x0c, 0x40, 0x49, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x17, 0x16, 0x07, 0x41,
+  0x01, 0x08, 0x09, 0x10, 0x10, 0x32, 0x54, 0x76, 0x98, 0x07, 0xe0, 0xe0, 0x00, 0x06, 0x02, 0x01, 0xd0, 0x11, 0x52, 0x00,
+  0x00, 0x43, 0x00, 0x06, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x07, 0x00, 0x64, 0x40, 0x08, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x19,
+  0xb0, 0x10, 0x00, 0x86, 0x40, 0x01, 0x30, 0x00, 0x60, 0x00, 0x06, 0x06, 0x80, 0xc0, 0x00, 0x12, 0x34};
+uint8_t initial_context_setup_request_enc[] = {
+  0x00, 0x09, 0x00, 0x79, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x40, 0x04, 0xd2, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x42, 0x00, 0x0a, 0x18, 0x3b, 0x9a, 0xca, 0x00, 0x60, 0x3b, 0x9a, 0xca, 0x00, 0x00, 0x18, 0x00, 0x2a, 0x00, 0x00,
+  0x34, 0x00, 0x25, 0x45, 0x00, 0x09, 0x3d, 0x0f, 0x80, 0x7f, 0x00, 0x01, 0x64, 0x01, 0x02, 0x03, 0x04, 0x16, 0x07, 0x41,
+  0x01, 0x08, 0x09, 0x10, 0x10, 0x32, 0x54, 0x76, 0x98, 0x07, 0xe0, 0xe0, 0x00, 0x06, 0x02, 0x01, 0xd0, 0x11, 0x52, 0x00,
+  0x00, 0x6b, 0x00, 0x05, 0x1c, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x49, 0x00, 0x20, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a,
+  0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a, 0xd5, 0x2a,
+  0xd5, 0x2a, 0xd5, 0x2a, 0xd5};
+uint8_t initial_context_setup_response_enc[] = {
+  0x20, 0x09, 0x00, 0x23, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x03, 0x40, 0x04, 0xd2, 0x00, 0x08, 0x40, 0x02, 0x00, 0x01,
+  0x00, 0x33, 0x40, 0x0f, 0x00, 0x00, 0x32, 0x40, 0x0a, 0x0a, 0x1f, 0x7f, 0x00, 0x01, 0x64, 0x10, 0x11, 0x12, 0x13};
+uint8_t uplink_nas_transport_enc[] = {
+  0x00, 0x0d, 0x40, 0x41, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x40, 0x04, 0xd2, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x1a, 0x00, 0x17, 0x16, 0x07, 0x41, 0x01, 0x08, 0x09, 0x10, 0x10, 0x32, 0x54, 0x76, 0x98, 0x07, 0xe0, 0xe0, 0x00,
+  0x06, 0x02, 0x01, 0xd0, 0x11, 0x52, 0x00, 0x00, 0x64, 0x40, 0x08, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x19, 0xb0, 0x10, 0x00,
+  0x43, 0x40, 0x06, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x07};
+uint8_t downlink_nas_transport_enc[] = {
+  0x00, 0x0b, 0x40, 0x38, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x40, 0x04, 0xd2, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x1a, 0x00, 0x24, 0x23, 0x07, 0x52, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+  0x0d, 0x0e, 0x0f, 0x10, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
+uint8_t ue_context_release_request_enc[] = {
+  0x00, 0x12, 0x40, 0x16, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x40, 0x04, 0xd2, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x02, 0x40, 0x02, 0x02, 0x80};
+uint8_t ue_context_release_command_enc[] = {
+  0x00, 0x17, 0x00, 0x11, 0x00, 0x00, 0x02, 0x00, 0x63, 0x00, 0x05, 0x04, 0x04, 0xd2, 0x00, 0x01, 0x00, 0x02, 0x40, 0x01,
+  0x20};
+uint8_t ue_context_release_complete_enc[] = {
+  0x20, 0x17, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x03, 0x40, 0x04, 0xd2, 0x00, 0x08, 0x40, 0x02, 0x00, 0x01};
+uint8_t paging_enc[] = {
+  0x00, 0x0a, 0x40, 0x2c, 0x00, 0x00, 0x05, 0x00, 0x50, 0x40, 0x02, 0x45, 0x40, 0x00, 0x2b, 0x40, 0x06, 0x01, 0xa0, 0xc0,
+  0x00, 0x12, 0x34, 0x00, 0x2c, 0x40, 0x01, 0x40, 0x00, 0x6d, 0x40, 0x01, 0x00, 0x00, 0x2e, 0x40, 0x0b, 0x00, 0x00, 0x2f,
+  0x40, 0x06, 0x00, 0x09, 0xf1, 0x07, 0x00, 0x07};
+
+void fill_plmn(uint8_t *buffer) {
+  // MCC 901, MNC 70
+  buffer[0] = 0x09;
+  buffer[1] = 0xf1;
+  buffer[2] = 0x07;
+}
+
+void fill_tai(LIBLTE_S1AP_TAI_STRUCT *tai) {
+  fill_plmn(tai->pLMNidentity.buffer);
+  tai->tAC.buffer[0] = 0x00;
+  tai->tAC.buffer[1] = 0x07;
+}
+
+void fill_eutran_cgi(LIBLTE_S1AP_EUTRAN_CGI_STRUCT *cgi) {
+  fill_plmn(cgi->pLMNidentity.buffer);
+  // eNB ID 0x19B, cell 0x01
+  uint32_t cell_id = 0x19B01;
+  for (uint32_t i = 0; i < LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN; i++) {
+    cgi->cell_ID.buffer[i] = (cell_id >> (LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN - 1 - i)) & 1;
+  }
+}
+
+void fill_transport_layer_address(LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT *addr) {
+  // 127.0.1.100
+  addr->n_bits = 32;
+  for (uint32_t i = 0; i < 32; i++) {
+    addr->buffer[i] = (0x7F000164 >> (31 - i)) & 1;
+  }
+}
+
+void fill_s1_setup_request(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_S1SETUP;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_S1SETUPREQUEST;
+
+  LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT *req = &init->choice.S1SetupRequest;
+  fill_plmn(req->Global_ENB_ID.pLMNidentity.buffer);
+  req->Global_ENB_ID.eNB_ID.choice_type = LIBLTE_S1AP_ENB_ID_CHOICE_MACROENB_ID;
+  for (uint32_t i = 0; i < LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN; i++) {
+    req->Global_ENB_ID.eNB_ID.choice.macroENB_ID.buffer[i] = (0x19B >> (LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN - 1 - i)) & 1;
+  }
+  req->eNBname_present  = true;
+  req->eNBname.n_octets = strlen("srsenb01");
+  memcpy(req->eNBname.buffer, "srsenb01", req->eNBname.n_octets);
+  req->SupportedTAs.len = 1;
+  req->SupportedTAs.buffer[0].tAC.buffer[1] = 0x07;
+  req->SupportedTAs.buffer[0].broadcastPLMNs.len = 1;
+  fill_plmn(req->SupportedTAs.buffer[0].broadcastPLMNs.buffer[0].buffer);
+  req->DefaultPagingDRX.e = LIBLTE_S1AP_PAGINGDRX_V128;
+}
+
+int check_s1_setup_request(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_S1SETUPREQUEST);
+  LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT *req = &pdu->choice.initiatingMessage.choice.S1SetupRequest;
+  TESTASSERT(!memcmp(req->Global_ENB_ID.pLMNidentity.buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(req->Global_ENB_ID.eNB_ID.choice_type == LIBLTE_S1AP_ENB_ID_CHOICE_MACROENB_ID);
+  uint32_t enb_id = 0;
+  for (uint32_t i = 0; i < LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN; i++) {
+    enb_id = enb_id << 1 | req->Global_ENB_ID.eNB_ID.choice.macroENB_ID.buffer[i];
+  }
+  TESTASSERT(enb_id == 0x19B);
+  TESTASSERT(req->eNBname_present);
+  TESTASSERT(req->eNBname.n_octets == 8 && !memcmp(req->eNBname.buffer, "srsenb01", 8));
+  TESTASSERT(req->SupportedTAs.len == 1);
+  TESTASSERT(req->SupportedTAs.buffer[0].tAC.buffer[0] == 0x00 && req->SupportedTAs.buffer[0].tAC.buffer[1] == 0x07);
+  TESTASSERT(req->SupportedTAs.buffer[0].broadcastPLMNs.len == 1);
+  TESTASSERT(!memcmp(req->SupportedTAs.buffer[0].broadcastPLMNs.buffer[0].buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(req->DefaultPagingDRX.e == LIBLTE_S1AP_PAGINGDRX_V128);
+  TESTASSERT(!req->CSG_IdList_present);
+  return 0;
+}
+
+void fill_s1_setup_response(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME;
+  LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *succ = &pdu->choice.successfulOutcome;
+  succ->procedureCode = LIBLTE_S1AP_PROC_ID_S1SETUP;
+  succ->criticality   = LIBLTE_S1AP_CRITICALITY_IGNORE;
+  succ->choice_type   = LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_S1SETUPRESPONSE;
+
+  LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT *res = &succ->choice.S1SetupResponse;
+  res->MMEname_present  = true;
+  res->MMEname.n_octets = strlen("srsmme01");
+  memcpy(res->MMEname.buffer, "srsmme01", res->MMEname.n_octets);
+  res->ServedGUMMEIs.len = 1;
+  LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT *gummei = &res->ServedGUMMEIs.buffer[0];
+  gummei->servedPLMNs.len = 1;
+  fill_plmn(gummei->servedPLMNs.buffer[0].buffer);
+  gummei->servedGroupIDs.len = 1;
+  gummei->servedGroupIDs.buffer[0].buffer[0] = 0x00;
+  gummei->servedGroupIDs.buffer[0].buffer[1] = 0x01;
+  gummei->servedMMECs.len = 1;
+  gummei->servedMMECs.buffer[0].buffer[0] = 0x1a;
+  res->RelativeMMECapacity.RelativeMMECapacity = 255;
+}
+
+int check_s1_setup_response(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME);
+  TESTASSERT(pdu->choice.successfulOutcome.choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_S1SETUPRESPONSE);
+  LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT *res = &pdu->choice.successfulOutcome.choice.S1SetupResponse;
+  TESTASSERT(res->MMEname_present);
+  TESTASSERT(res->MMEname.n_octets == 8 && !memcmp(res->MMEname.buffer, "srsmme01", 8));
+  TESTASSERT(res->ServedGUMMEIs.len == 1);
+  LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT *gummei = &res->ServedGUMMEIs.buffer[0];
+  TESTASSERT(gummei->servedPLMNs.len == 1);
+  TESTASSERT(!memcmp(gummei->servedPLMNs.buffer[0].buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(gummei->servedGroupIDs.len == 1);
+  TESTASSERT(gummei->servedGroupIDs.buffer[0].buffer[0] == 0x00 && gummei->servedGroupIDs.buffer[0].buffer[1] == 0x01);
+  TESTASSERT(gummei->servedMMECs.len == 1 && gummei->servedMMECs.buffer[0].buffer[0] == 0x1a);
+  TESTASSERT(res->RelativeMMECapacity.RelativeMMECapacity == 255);
+  TESTASSERT(!res->MMERelaySupportIndicator_present);
+  TESTASSERT(!res->CriticalityDiagnostics_present);
+  return 0;
+}
+
+void fill_initial_ue_message(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALUEMESSAGE;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALUEMESSAGE;
+
+  LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT *initue = &init->choice.InitialUEMessage;
+  initue->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  initue->NAS_PDU.n_octets = sizeof(nas_attach_request);
+  memcpy(initue->NAS_PDU.buffer, nas_attach_request, sizeof(nas_attach_request));
+  fill_tai(&initue->TAI);
+  fill_eutran_cgi(&initue->EUTRAN_CGI);
+  initue->RRC_Establishment_Cause.e = LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_MO_SIGNALLING;
+  initue->S_TMSI_present = true;
+  initue->S_TMSI.mMEC.buffer[0] = 0x1a;
+  initue->S_TMSI.m_TMSI.buffer[0] = 0xc0;
+  initue->S_TMSI.m_TMSI.buffer[1] = 0x00;
+  initue->S_TMSI.m_TMSI.buffer[2] = 0x12;
+  initue->S_TMSI.m_TMSI.buffer[3] = 0x34;
+}
+
+int check_initial_ue_message(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALUEMESSAGE);
+  LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT *initue = &pdu->choice.initiatingMessage.choice.InitialUEMessage;
+  TESTASSERT(initue->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(initue->NAS_PDU.n_octets == sizeof(nas_attach_request));
+  TESTASSERT(!memcmp(initue->NAS_PDU.buffer, nas_attach_request, sizeof(nas_attach_request)));
+  TESTASSERT(!memcmp(initue->TAI.pLMNidentity.buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(initue->TAI.tAC.buffer[0] == 0x00 && initue->TAI.tAC.buffer[1] == 0x07);
+  uint32_t cell_id = 0;
+  for (uint32_t i = 0; i < LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN; i++) {
+    cell_id = cell_id << 1 | initue->EUTRAN_CGI.cell_ID.buffer[i];
+  }
+  TESTASSERT(cell_id == 0x19B01);
+  TESTASSERT(initue->RRC_Establishment_Cause.e == LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_MO_SIGNALLING);
+  TESTASSERT(initue->S_TMSI_present);
+  TESTASSERT(initue->S_TMSI.mMEC.buffer[0] == 0x1a);
+  TESTASSERT(!memcmp(initue->S_TMSI.m_TMSI.buffer, "\xc0\x00\x12\x34", 4));
+  TESTASSERT(!initue->GUMMEI_ID_present && !initue->CSG_Id_present);
+  return 0;
+}
+
+// Filled as the MME does, with the NAS message in the E-RAB
+void fill_initial_context_setup_request(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALCONTEXTSETUP;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALCONTEXTSETUPREQUEST;
+
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT *req  = &init->choice.InitialContextSetupRequest;
+  LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT        *erab = &req->E_RABToBeSetupListCtxtSUReq.buffer[0];
+  req->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  req->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  req->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateDL.BitRate = 1000000000;
+  req->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateUL.BitRate = 1000000000;
+
+  req->E_RABToBeSetupListCtxtSUReq.len = 1;
+  erab->e_RAB_ID.E_RAB_ID = 5;
+  erab->e_RABlevelQoSParameters.qCI.QCI = 9;
+  erab->e_RABlevelQoSParameters.allocationRetentionPriority.priorityLevel.PriorityLevel = 15;
+  erab->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionCapability =
+      LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_SHALL_NOT_TRIGGER_PRE_EMPTION;
+  erab->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionVulnerability =
+      LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_PRE_EMPTABLE;
+  fill_transport_layer_address(&erab->transportLayerAddress);
+  for (uint32_t i = 0; i < 4; i++) {
+    erab->gTP_TEID.buffer[i] = i + 1;
+  }
+  erab->nAS_PDU_present  = true;
+  erab->nAS_PDU.n_octets = sizeof(nas_attach_request);
+  memcpy(erab->nAS_PDU.buffer, nas_attach_request, sizeof(nas_attach_request));
+
+  for (uint32_t i = 0; i < 3; i++) {
+    req->UESecurityCapabilities.encryptionAlgorithms.buffer[i]          = 1;
+    req->UESecurityCapabilities.integrityProtectionAlgorithms.buffer[i] = 1;
+  }
+  for (uint32_t i = 0; i < LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN; i++) {
+    req->SecurityKey.buffer[i] = (i * 7 >> 3) & 1;
+  }
+}
+
+int check_initial_context_setup_request(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALCONTEXTSETUPREQUEST);
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT *req =
+      &pdu->choice.initiatingMessage.choice.InitialContextSetupRequest;
+  TESTASSERT(req->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(req->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(req->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateDL.BitRate == 1000000000);
+  TESTASSERT(req->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateUL.BitRate == 1000000000);
+  TESTASSERT(req->E_RABToBeSetupListCtxtSUReq.len == 1);
+  LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT *erab = &req->E_RABToBeSetupListCtxtSUReq.buffer[0];
+  TESTASSERT(erab->e_RAB_ID.E_RAB_ID == 5);
+  TESTASSERT(erab->e_RABlevelQoSParameters.qCI.QCI == 9);
+  TESTASSERT(erab->e_RABlevelQoSParameters.allocationRetentionPriority.priorityLevel.PriorityLevel == 15);
+  TESTASSERT(erab->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionCapability ==
+             LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_SHALL_NOT_TRIGGER_PRE_EMPTION);
+  TESTASSERT(erab->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionVulnerability ==
+             LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_PRE_EMPTABLE);
+  TESTASSERT(erab->transportLayerAddress.n_bits == 32);
+  uint32_t addr = 0;
+  for (uint32_t i = 0; i < 32; i++) {
+    addr = addr << 1 | erab->transportLayerAddress.buffer[i];
+  }
+  TESTASSERT(addr == 0x7F000164);
+  TESTASSERT(!memcmp(erab->gTP_TEID.buffer, "\x01\x02\x03\x04", 4));
+  TESTASSERT(erab->nAS_PDU_present);
+  TESTASSERT(erab->nAS_PDU.n_octets == sizeof(nas_attach_request));
+  TESTASSERT(!memcmp(erab->nAS_PDU.buffer, nas_attach_request, sizeof(nas_attach_request)));
+  for (uint32_t i = 0; i < LIBLTE_S1AP_ENCRYPTIONALGORITHMS_BIT_STRING_LEN; i++) {
+    TESTASSERT(req->UESecurityCapabilities.encryptionAlgorithms.buffer[i] == (i < 3));
+    TESTASSERT(req->UESecurityCapabilities.integrityProtectionAlgorithms.buffer[i] == (i < 3));
+  }
+  for (uint32_t i = 0; i < LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN; i++) {
+    TESTASSERT(req->SecurityKey.buffer[i] == ((i * 7 >> 3) & 1));
+  }
+  return 0;
+}
+
+void fill_initial_context_setup_response(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME;
+  LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *succ = &pdu->choice.successfulOutcome;
+  succ->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALCONTEXTSETUP;
+  succ->choice_type   = LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_INITIALCONTEXTSETUPRESPONSE;
+
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT *res = &succ->choice.InitialContextSetupResponse;
+  res->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  res->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  res->E_RABSetupListCtxtSURes.len = 1;
+  res->E_RABSetupListCtxtSURes.buffer[0].e_RAB_ID.E_RAB_ID = 5;
+  fill_transport_layer_address(&res->E_RABSetupListCtxtSURes.buffer[0].transportLayerAddress);
+  for (uint32_t i = 0; i < 4; i++) {
+    res->E_RABSetupListCtxtSURes.buffer[0].gTP_TEID.buffer[i] = 0x10 + i;
+  }
+}
+
+int check_initial_context_setup_response(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME);
+  TESTASSERT(pdu->choice.successfulOutcome.choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_INITIALCONTEXTSETUPRESPONSE);
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT *res =
+      &pdu->choice.successfulOutcome.choice.InitialContextSetupResponse;
+  TESTASSERT(res->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(res->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(res->E_RABSetupListCtxtSURes.len == 1);
+  LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT *erab = &res->E_RABSetupListCtxtSURes.buffer[0];
+  TESTASSERT(erab->e_RAB_ID.E_RAB_ID == 5);
+  TESTASSERT(erab->transportLayerAddress.n_bits == 32);
+  uint32_t addr = 0;
+  for (uint32_t i = 0; i < 32; i++) {
+    addr = addr << 1 | erab->transportLayerAddress.buffer[i];
+  }
+  TESTASSERT(addr == 0x7F000164);
+  TESTASSERT(!memcmp(erab->gTP_TEID.buffer, "\x10\x11\x12\x13", 4));
+  TESTASSERT(!res->E_RABFailedToSetupListCtxtSURes_present);
+  TESTASSERT(!res->CriticalityDiagnostics_present);
+  return 0;
+}
+
+void fill_uplink_nas_transport(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_UPLINKNASTRANSPORT;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UPLINKNASTRANSPORT;
+
+  LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT *ultx = &init->choice.UplinkNASTransport;
+  ultx->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  ultx->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  ultx->NAS_PDU.n_octets = sizeof(nas_attach_request);
+  memcpy(ultx->NAS_PDU.buffer, nas_attach_request, sizeof(nas_attach_request));
+  fill_eutran_cgi(&ultx->EUTRAN_CGI);
+  fill_tai(&ultx->TAI);
+}
+
+int check_uplink_nas_transport(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UPLINKNASTRANSPORT);
+  LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT *ultx = &pdu->choice.initiatingMessage.choice.UplinkNASTransport;
+  TESTASSERT(ultx->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(ultx->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(ultx->NAS_PDU.n_octets == sizeof(nas_attach_request));
+  TESTASSERT(!memcmp(ultx->NAS_PDU.buffer, nas_attach_request, sizeof(nas_attach_request)));
+  TESTASSERT(!memcmp(ultx->EUTRAN_CGI.pLMNidentity.buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(!memcmp(ultx->TAI.pLMNidentity.buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(ultx->TAI.tAC.buffer[0] == 0x00 && ultx->TAI.tAC.buffer[1] == 0x07);
+  TESTASSERT(!ultx->GW_TransportLayerAddress_present && !ultx->LHN_ID_present);
+  return 0;
+}
+
+void fill_downlink_nas_transport(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_DOWNLINKNASTRANSPORT;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_DOWNLINKNASTRANSPORT;
+
+  LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT *dw_nas = &init->choice.DownlinkNASTransport;
+  dw_nas->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  dw_nas->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  dw_nas->NAS_PDU.n_octets = sizeof(nas_auth_request);
+  memcpy(dw_nas->NAS_PDU.buffer, nas_auth_request, sizeof(nas_auth_request));
+}
+
+int check_downlink_nas_transport(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_DOWNLINKNASTRANSPORT);
+  LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT *dw_nas = &pdu->choice.initiatingMessage.choice.DownlinkNASTransport;
+  TESTASSERT(dw_nas->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(dw_nas->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(dw_nas->NAS_PDU.n_octets == sizeof(nas_auth_request));
+  TESTASSERT(!memcmp(dw_nas->NAS_PDU.buffer, nas_auth_request, sizeof(nas_auth_request)));
+  TESTASSERT(!dw_nas->HandoverRestrictionList_present && !dw_nas->SubscriberProfileIDforRFP_present);
+  return 0;
+}
+
+void fill_ue_context_release_request(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_UECONTEXTRELEASEREQUEST;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UECONTEXTRELEASEREQUEST;
+
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT *req = &init->choice.UEContextReleaseRequest;
+  req->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  req->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  req->Cause.choice_type = LIBLTE_S1AP_CAUSE_CHOICE_RADIONETWORK;
+  req->Cause.choice.radioNetwork.e = LIBLTE_S1AP_CAUSERADIONETWORK_USER_INACTIVITY;
+}
+
+int check_ue_context_release_request(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UECONTEXTRELEASEREQUEST);
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT *req = &pdu->choice.initiatingMessage.choice.UEContextReleaseRequest;
+  TESTASSERT(req->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(req->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(req->Cause.choice_type == LIBLTE_S1AP_CAUSE_CHOICE_RADIONETWORK);
+  TESTASSERT(req->Cause.choice.radioNetwork.e == LIBLTE_S1AP_CAUSERADIONETWORK_USER_INACTIVITY);
+  TESTASSERT(!req->GWContextReleaseIndication_present);
+  return 0;
+}
+
+void fill_ue_context_release_command(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_UECONTEXTRELEASE;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UECONTEXTRELEASECOMMAND;
+
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT *cmd = &init->choice.UEContextReleaseCommand;
+  cmd->UE_S1AP_IDs.choice_type = LIBLTE_S1AP_UE_S1AP_IDS_CHOICE_UE_S1AP_ID_PAIR;
+  cmd->UE_S1AP_IDs.choice.uE_S1AP_ID_pair.mME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  cmd->UE_S1AP_IDs.choice.uE_S1AP_ID_pair.eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  cmd->Cause.choice_type  = LIBLTE_S1AP_CAUSE_CHOICE_NAS;
+  cmd->Cause.choice.nas.e = LIBLTE_S1AP_CAUSENAS_NORMAL_RELEASE;
+}
+
+int check_ue_context_release_command(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UECONTEXTRELEASECOMMAND);
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT *cmd = &pdu->choice.initiatingMessage.choice.UEContextReleaseCommand;
+  TESTASSERT(cmd->UE_S1AP_IDs.choice_type == LIBLTE_S1AP_UE_S1AP_IDS_CHOICE_UE_S1AP_ID_PAIR);
+  TESTASSERT(cmd->UE_S1AP_IDs.choice.uE_S1AP_ID_pair.mME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(cmd->UE_S1AP_IDs.choice.uE_S1AP_ID_pair.eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(cmd->Cause.choice_type == LIBLTE_S1AP_CAUSE_CHOICE_NAS);
+  TESTASSERT(cmd->Cause.choice.nas.e == LIBLTE_S1AP_CAUSENAS_NORMAL_RELEASE);
+  return 0;
+}
+
+void fill_ue_context_release_complete(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME;
+  LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *succ = &pdu->choice.successfulOutcome;
+  succ->procedureCode = LIBLTE_S1AP_PROC_ID_UECONTEXTRELEASE;
+  succ->choice_type   = LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_UECONTEXTRELEASECOMPLETE;
+
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT *comp = &succ->choice.UEContextReleaseComplete;
+  comp->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 1234;
+  comp->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+}
+
+int check_ue_context_release_complete(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME);
+  TESTASSERT(pdu->choice.successfulOutcome.choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_UECONTEXTRELEASECOMPLETE);
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT *comp =
+      &pdu->choice.successfulOutcome.choice.UEContextReleaseComplete;
+  TESTASSERT(comp->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 1234);
+  TESTASSERT(comp->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1);
+  TESTASSERT(!comp->CriticalityDiagnostics_present && !comp->UserLocationInformation_present);
+  return 0;
+}
+
+void fill_paging(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_PAGING;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_PAGING;
+
+  LIBLTE_S1AP_MESSAGE_PAGING_STRUCT *paging = &init->choice.Paging;
+  // IMSI 901700123456789 mod 1024
+  for (uint32_t i = 0; i < LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN; i++) {
+    paging->UEIdentityIndexValue.buffer[i] = (277 >> (LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN - 1 - i)) & 1;
+  }
+  paging->UEPagingID.choice_type = LIBLTE_S1AP_UEPAGINGID_CHOICE_S_TMSI;
+  paging->UEPagingID.choice.s_TMSI.mMEC.buffer[0] = 0x1a;
+  paging->UEPagingID.choice.s_TMSI.m_TMSI.buffer[0] = 0xc0;
+  paging->UEPagingID.choice.s_TMSI.m_TMSI.buffer[1] = 0x00;
+  paging->UEPagingID.choice.s_TMSI.m_TMSI.buffer[2] = 0x12;
+  paging->UEPagingID.choice.s_TMSI.m_TMSI.buffer[3] = 0x34;
+  paging->pagingDRX_present = true;
+  paging->pagingDRX.e = LIBLTE_S1AP_PAGINGDRX_V128;
+  paging->CNDomain = LIBLTE_S1AP_CNDOMAIN_PS;
+  paging->TAIList.len = 1;
+  fill_tai(&paging->TAIList.buffer[0].tAI);
+}
+
+int check_paging(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  TESTASSERT(pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE);
+  TESTASSERT(pdu->choice.initiatingMessage.choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_PAGING);
+  LIBLTE_S1AP_MESSAGE_PAGING_STRUCT *paging = &pdu->choice.initiatingMessage.choice.Paging;
+  uint32_t ue_index = 0;
+  for (uint32_t i = 0; i < LIBLTE_S1AP_UEIDENTITYINDEXVALUE_BIT_STRING_LEN; i++) {
+    ue_index = ue_index << 1 | paging->UEIdentityIndexValue.buffer[i];
+  }
+  TESTASSERT(ue_index == 277);
+  TESTASSERT(paging->UEPagingID.choice_type == LIBLTE_S1AP_UEPAGINGID_CHOICE_S_TMSI);
+  TESTASSERT(paging->UEPagingID.choice.s_TMSI.mMEC.buffer[0] == 0x1a);
+  TESTASSERT(!memcmp(paging->UEPagingID.choice.s_TMSI.m_TMSI.buffer, "\xc0\x00\x12\x34", 4));
+  TESTASSERT(paging->pagingDRX_present && paging->pagingDRX.e == LIBLTE_S1AP_PAGINGDRX_V128);
+  TESTASSERT(paging->CNDomain == LIBLTE_S1AP_CNDOMAIN_PS);
+  TESTASSERT(paging->TAIList.len == 1);
+  TESTASSERT(!memcmp(paging->TAIList.buffer[0].tAI.pLMNidentity.buffer, "\x09\xf1\x07", 3));
+  TESTASSERT(paging->TAIList.buffer[0].tAI.tAC.buffer[1] == 0x07);
+  TESTASSERT(!paging->CSG_IdList_present && !paging->PagingPriority_present);
+  return 0;
+}
+
+typedef struct {
+  const char *name;
+  void (*fill)(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu);
+  int (*check)(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu);
+  uint8_t    *enc;
+  uint32_t    enc_len;
+} test_case_t;
+
+#define TEST_CASE(name, msg) {name, fill_##msg, check_##msg, msg##_enc, sizeof(msg##_enc)}
+
+test_case_t test_cases[] = {
+  TEST_CASE("S1SetupRequest", s1_setup_request),
+  TEST_CASE("S1SetupResponse", s1_setup_response),
+  TEST_CASE("InitialUEMessage", initial_ue_message),
+  TEST_CASE("InitialContextSetupRequest", initial_context_setup_request),
+  TEST_CASE("InitialContextSetupResponse", initial_context_setup_response),
+  TEST_CASE("UplinkNASTransport", uplink_nas_transport),
+  TEST_CASE("DownlinkNASTransport", downlink_nas_transport),
+  TEST_CASE("UEContextReleaseRequest", ue_context_release_request),
+  TEST_CASE("UEContextReleaseCommand", ue_context_release_command),
+  TEST_CASE("UEContextReleaseComplete", ue_context_release_complete),
+  TEST_CASE("Paging", paging),
+};
+
+void print_hex(const char *prefix, uint8_t *buf, uint32_t len) {
+  printf("%s (%d bytes):", prefix, len);
+  for (uint32_t i = 0; i < len; i++) {
+    printf("%s0x%02x,", i % 20 ? " " : "\n  ", buf[i]);
+  }
+  printf("\n");
+}
+
+int run_test_case(test_case_t *t) {
+  bzero(&tx_pdu, sizeof(tx_pdu));
+  t->fill(&tx_pdu);
+  bzero(&msg, sizeof(msg));
+  if (liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg) != LIBLTE_SUCCESS) {
+    printf("%s: error encoding\n", t->name);
+    return -1;
+  }
+  if (msg.N_bytes != t->enc_len || memcmp(msg.msg, t->enc, t->enc_len)) {
+    printf("%s: encoding differs from the reference\n", t->name);
+    print_hex("Reference", t->enc, t->enc_len);
+    print_hex("Encoded", msg.msg, msg.N_bytes);
+    return -1;
+  }
+
+  // Decode the reference, not the encoder output
+  bzero(&msg, sizeof(msg));
+  memcpy(msg.msg, t->enc, t->enc_len);
+  msg.N_bytes = t->enc_len;
+  bzero(&rx_pdu, sizeof(rx_pdu));
+  if (liblte_s1ap_unpack_s1ap_pdu(&msg, &rx_pdu) != LIBLTE_SUCCESS) {
+    printf("%s: error decoding\n", t->name);
+    return -1;
+  }
+  if (t->check(&rx_pdu)) {
+    printf("%s: decoded fields differ\n", t->name);
+    return -1;
+  }
+  printf("%s: Ok\n", t->name);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int errors = 0;
+  for (uint32_t i = 0; i < sizeof(test_cases) / sizeof(test_case_t); i++) {
+    errors += run_test_case(&test_cases[i]) ? 1 : 0;
+  }
+  printf("%d errors\n", errors);
+  exit(errors ? -1 : 0);
+}
@@ -0,0 +1,229 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Multi-threaded contention benchmark for byte_buffer_pool. Every thread
+ * allocates a burst of buffers and releases them again, which is the access
+ * pattern of the MAC/RLC/PDCP/GTP-U threads. The same workload is run
+ * against a mutex-protected pool with a linear ownership scan, which is how
+ * the pool used to be implemented, to have a reference.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <stack>
+#include "srslte/common/buffer_pool.h"
+
+using namespace srslte;
+
+static uint32_t nof_threads = 4;
+static uint32_t nof_iterations = 20000;
+static uint32_t burst_size = 16;
+static uint32_t pool_capacity = 4096;
+
+void usage(char *prog) {
+  printf("Usage: %s [tibc]\n", prog);
+  printf("\t-t number of threads [Default %d]\n", nof_threads);
+  printf("\t-i iterations per thread [Default %d]\n", nof_iterations);
+  printf("\t-b buffers allocated per burst [Default %d]\n", burst_size);
+  printf("\t-c pool capacity [Default %d]\n", pool_capacity);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "tibc")) != -1) {
+    switch (opt) {
+      case 't':
+        nof_threads = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'i':
+        nof_iterations = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'b':
+        burst_size = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'c':
+        pool_capacity = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+// Reference implementation: global mutex and O(n) ownership scan
+class locked_pool {
+public:
+  locked_pool(uint32_t capacity) {
+    pthread_mutex_init(&mutex, NULL);
+    for (uint32_t i = 0; i < capacity; i++) {
+      available.push(new byte_buffer_t);
+    }
+  }
+  ~locked_pool() {
+    while (available.size()) {
+      delete available.top();
+      available.pop();
+    }
+    pthread_mutex_destroy(&mutex);
+  }
+  byte_buffer_t* allocate() {
+    byte_buffer_t *b = NULL;
+    pthread_mutex_lock(&mutex);
+    if (available.size() > 0) {
+      b = available.top();
+      available.pop();
+      used.push_back(b);
+    }
+    pthread_mutex_unlock(&mutex);
+    return b;
+  }
+  void deallocate(byte_buffer_t *b) {
+    pthread_mutex_lock(&mutex);
+    std::vector<byte_buffer_t*>::iterator elem = std::find(used.begin(), used.end(), b);
+    if (elem != used.end()) {
+      used.erase(elem);
+      available.push(b);
+    }
+    pthread_mutex_unlock(&mutex);
+  }
+private:
+  std::stack<byte_buffer_t*>  available;
+  std::vector<byte_buffer_t*> used;
+  pthread_mutex_t             mutex;
+};
+
+template <class pool_t>
+struct worker_args_t {
+  pool_t   *pool;
+  uint32_t  seed;
+  uint32_t  nof_failed;
+};
+
+template <class pool_t>
+void* worker_thread(void *a) {
+  worker_args_t<pool_t> *args = (worker_args_t<pool_t>*) a;
+  std::vector<byte_buffer_t*> burst(burst_size);
+  for (uint32_t i = 0; i < nof_iterations; i++) {
+    // vary the burst a bit so that magazines are refilled and flushed
+    uint32_t n = 1 + rand_r(&args->seed) % burst_size;
+    for (uint32_t j = 0; j < n; j++) {
+      burst[j] = args->pool->allocate();
+      if (burst[j] == NULL) {
+        args->nof_failed++;
+      } else {
+        burst[j]->N_bytes = j;
+      }
+    }
+    for (uint32_t j = 0; j < n; j++) {
+      if (burst[j]) {
+        if (burst[j]->N_bytes != j) {
+          args->nof_failed++;
+        }
+        args->pool->deallocate(burst[j]);
+      }
+    }
+  }
+  return NULL;
+}
+
+template <class pool_t>
+uint32_t run_benchmark(const char *name, pool_t *pool) {
+  std::vector<pthread_t> threads(nof_threads);
+  std::vector<worker_args_t<pool_t> > args(nof_threads);
+  struct timeval t[3];
+  uint32_t nof_failed = 0;
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    args[i].pool       = pool;
+    args[i].seed       = i;
+    args[i].nof_failed = 0;
+    pthread_create(&threads[i], NULL, worker_thread<pool_t>, &args[i]);
+  }
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    pthread_join(threads[i], NULL);
+    nof_failed += args[i].nof_failed;
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double elapsed_us = t[0].tv_sec * 1e6 + t[0].tv_usec;
+  double nof_ops    = (double) nof_threads * nof_iterations * (1 + burst_size) / 2;
+  printf("%-16s threads=%d: %8.2f Mops/s (%.1f ns per allocate+deallocate), %d failed\n",
+         name, nof_threads, nof_ops / elapsed_us, elapsed_us * 1e3 / nof_ops, nof_failed);
+  return nof_failed;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  if (burst_size * nof_threads > pool_capacity) {
+    printf("Pool capacity must be at least threads*burst\n");
+    exit(-1);
+  }
+
+  locked_pool *ref = new locked_pool(pool_capacity);
+  run_benchmark("mutex pool", ref);
+  delete ref;
+
+  byte_buffer_pool *pool = new byte_buffer_pool(pool_capacity);
+  uint32_t nof_failed = run_benchmark("byte_buffer_pool", pool);
+
+  // worker threads hand their magazines back when they exit
+  uint32_t nof_available = pool->nof_available_pdus();
+  delete pool;
+
+  if (nof_failed > 0 || nof_available != pool_capacity) {
+    printf("Failed: %d buffers available out of %d\n", nof_available, pool_capacity);
+    exit(1);
+  }
+
+  // once the thread-specific keys are exhausted the pool falls back to the global list
+  std::vector<pthread_key_t> keys;
+  pthread_key_t key;
+  while (pthread_key_create(&key, NULL) == 0) {
+    keys.push_back(key);
+  }
+  pool = new byte_buffer_pool(pool_capacity);
+  nof_failed = run_benchmark("without magazines", pool);
+  nof_available = pool->nof_available_pdus();
+  delete pool;
+  for (uint32_t i = 0; i < keys.size(); i++) {
+    pthread_key_delete(keys[i]);
+  }
+
+  if (nof_failed > 0 || nof_available != pool_capacity) {
+    printf("Failed without magazines: %d buffers available out of %d\n", nof_available, pool_capacity);
+    exit(1);
+  }
+  printf("Passed\n");
+  exit(0);
+}
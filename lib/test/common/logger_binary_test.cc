@@ -0,0 +1,207 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#define NTHREADS 20
+#define NMSGS    1000
+#define NBENCH   200000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "srslte/common/log_filter.h"
+#include "srslte/common/logger_binary.h"
+#include "srslte/common/logger_file.h"
+
+using namespace srslte;
+
+typedef struct {
+  logger *l;
+  int thread_id;
+}args_t;
+
+void* thread_loop(void *a) {
+  args_t *args = (args_t*)a;
+  char    buf[100];
+  uint8_t hex[100];
+
+  for(int i=0;i<100;i++)
+    hex[i] = i & 0xFF;
+  sprintf(buf, "LAYER%d", args->thread_id);
+  log_filter filter(buf, args->l, true);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(16);
+
+  for(int i=0;i<NMSGS;i++)
+  {
+    filter.step(i);
+    filter.info("Thread %d: %d %s %5.2f %lu 0x%04x %c %%\n",
+                args->thread_id, i, buf, i * 0.25, (unsigned long) i * 100000, i, 'a' + i % 26);
+    filter.debug_hex(hex, 100, "Thread %d: %d hex", args->thread_id, i);
+  }
+  return NULL;
+}
+
+void write(std::string filename) {
+  logger_binary l;
+  l.init(filename, 4*1024*1024);
+  pthread_t threads[NTHREADS];
+  args_t    args[NTHREADS];
+  for(int i=0;i<NTHREADS;i++) {
+    args[i].l = &l;
+    args[i].thread_id = i;
+    pthread_create(&threads[i], NULL, &thread_loop, &args[i]);
+  }
+  for(int i=0;i<NTHREADS;i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  // formats built at runtime are rendered by the producer
+  char fmt[32];
+  sprintf(fmt, "Dynamic %s %%d\n", "format");
+  log_filter filter("DYN", &l);
+  filter.set_level(LOG_LEVEL_INFO);
+  filter.info(fmt, 42);
+
+  l.stop();
+  if (l.get_nof_dropped()) {
+    printf("%ld entries dropped\n", (long) l.get_nof_dropped());
+  }
+}
+
+bool read(std::string filename) {
+  bool pass = true;
+  bool written[NTHREADS][NMSGS];
+  bool hex_written[NTHREADS][NMSGS];
+  bool dynamic = false;
+  char line[512];
+
+  for(int i=0;i<NTHREADS;i++) {
+    for(int j=0;j<NMSGS;j++) {
+      written[i][j] = false;
+      hex_written[i][j] = false;
+    }
+  }
+  FILE *f = fopen(filename.c_str(), "r");
+  if(f!=NULL) {
+    while(fgets(line, sizeof(line), f)) {
+      int thread, msg;
+      char *s = strstr(line, "Thread ");
+      if (strstr(line, "Dynamic format 42\n")) {
+        dynamic = true;
+      }
+      if (!s || sscanf(s, "Thread %d: %d", &thread, &msg) != 2 ||
+          thread < 0 || thread >= NTHREADS || msg < 0 || msg >= NMSGS) {
+        continue;
+      }
+      char expected[512];
+      char layer[16];
+      sprintf(layer, "LAYER%d", thread);
+      if (strstr(s, "hex")) {
+        // prefix, the hex dump limited to 16 bytes follows on the next line
+        sprintf(expected, "[%s] [D] [%05d] Thread %d: %d hex\n", layer, msg, thread, msg);
+        if (strstr(line, expected) && fgets(line, sizeof(line), f) &&
+            strstr(line, "0000: 00 01 02 03 04 05 06 07 08 09 0a 0b 0c 0d 0e 0f \n")) {
+          hex_written[thread][msg] = true;
+        }
+      } else {
+        sprintf(expected, "[%s] [I] [%05d] Thread %d: %d %s %5.2f %lu 0x%04x %c %%\n", layer, msg,
+                thread, msg, layer, msg * 0.25, (unsigned long) msg * 100000, msg, 'a' + msg % 26);
+        written[thread][msg] = strstr(line, expected) != NULL;
+      }
+    }
+    fclose(f);
+  }
+  for(int i=0;i<NTHREADS;i++) {
+    for(int j=0;j<NMSGS;j++) {
+      if(!written[i][j] || !hex_written[i][j]) pass = false;
+    }
+  }
+  return pass && dynamic;
+}
+
+bool decode(std::string in_name, std::string out_name) {
+  FILE *in  = fopen(in_name.c_str(), "r");
+  FILE *out = fopen(out_name.c_str(), "w");
+  bool ret = false;
+  if (in && out) {
+    ret = logger_binary::decode(in, out);
+  }
+  if (in) {
+    fclose(in);
+  }
+  if (out) {
+    fclose(out);
+  }
+  return ret;
+}
+
+// Time spent in the calling thread per log line
+double bench(logger *l) {
+  struct timeval start, end;
+  log_filter filter("BENCH", l, true);
+  filter.set_level(LOG_LEVEL_DEBUG);
+
+  gettimeofday(&start, NULL);
+  for (int i = 0; i < NBENCH; i++) {
+    filter.step(i);
+    filter.debug("SCHED: tti=%d, rnti=0x%x, mcs=%d, tbs=%d, prb=(%d,%d), snr=%.1f dB\n",
+                 i, 0x46 + i % 8, i % 28, 1000 + i, i % 50, 6, 12.5);
+  }
+  gettimeofday(&end, NULL);
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / NBENCH;
+}
+
+int main(int argc, char **argv) {
+  bool result;
+  std::string f("log.bin");
+  std::string t("log.txt");
+  write(f);
+  result = decode(f, t) && read(t);
+
+  logger_binary b;
+  b.init(f, 32*1024*1024);
+  double ns_binary = bench(&b);
+  b.stop();
+
+  logger_file lf;
+  lf.init(t);
+  double ns_text = bench(&lf);
+
+  printf("Per log line in the caller: text %.0f ns, binary %.0f ns\n", ns_text, ns_binary);
+
+  if (remove(f.c_str()) || remove(t.c_str())) {
+    perror("Removing file");
+  }
+
+  if(result) {
+    printf("Passed\n");
+    exit(0);
+  }else{
+    printf("Failed\n");
+    exit(1);
+  }
+}
@@ -0,0 +1,205 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#define NTHREADS 8
+#define NPDUS    2000
+#define NBENCH   200000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "srslte/common/mac_pcap.h"
+#include "srslte/common/pcap_writer.h"
+
+using namespace srslte;
+
+typedef struct {
+  mac_pcap *pcap;
+  int thread_id;
+}args_t;
+
+// PDUs carry the thread id and their index, so the reader can check them
+void* thread_loop(void *a) {
+  args_t *args = (args_t*)a;
+  uint8_t pdu[1500];
+
+  for(int i=0;i<NPDUS;i++) {
+    uint32_t len = 8 + (i*37) % (sizeof(pdu) - 8);
+    memset(pdu, i & 0xFF, len);
+    memcpy(&pdu[0], &args->thread_id, sizeof(int));
+    memcpy(&pdu[4], &i, sizeof(int));
+    args->pcap->write_dl_crnti(pdu, len, 0x46 + args->thread_id, true, i);
+  }
+  return NULL;
+}
+
+// Reads one capture file, returns the number of records or -1 on error
+int read(const char *filename, bool received[NTHREADS][NPDUS]) {
+  int n = 0;
+  FILE *f = fopen(filename, "r");
+  if (!f) {
+    return -1;
+  }
+  pcap_hdr_t hdr;
+  if (fread(&hdr, sizeof(pcap_hdr_t), 1, f) != 1 || hdr.magic_number != 0xa1b2c3d4 ||
+      hdr.network != MAC_LTE_DLT) {
+    fclose(f);
+    return -1;
+  }
+  pcaprec_hdr_t rec;
+  uint8_t buf[PCAP_WRITER_SNAPLEN];
+  MAC_Context_Info_t context;
+  bzero(&context, sizeof(MAC_Context_Info_t));
+  uint32_t context_len = LTE_PCAP_MAC_PackContext(&context, buf);
+  while (fread(&rec, sizeof(pcaprec_hdr_t), 1, f) == 1) {
+    if (rec.incl_len != rec.orig_len || rec.incl_len > sizeof(buf) ||
+        fread(buf, 1, rec.incl_len, f) != rec.incl_len) {
+      n = -1;
+      break;
+    }
+    // the PDU follows the MAC context header
+    if (rec.incl_len < context_len + 8) {
+      n = -1;
+      break;
+    }
+    uint8_t *pdu = &buf[context_len];
+    int thread, msg;
+    memcpy(&thread, &pdu[0], sizeof(int));
+    memcpy(&msg, &pdu[4], sizeof(int));
+    if (thread < 0 || thread >= NTHREADS || msg < 0 || msg >= NPDUS) {
+      n = -1;
+      break;
+    }
+    received[thread][msg] = true;
+    n++;
+  }
+  fclose(f);
+  return n;
+}
+
+bool write_and_check(const char *filename, int max_file_size) {
+  bool received[NTHREADS][NPDUS];
+  bzero(received, sizeof(received));
+
+  mac_pcap pcap;
+  pcap.open(filename, 0, max_file_size);
+  pthread_t threads[NTHREADS];
+  args_t    args[NTHREADS];
+  for(int i=0;i<NTHREADS;i++) {
+    args[i].pcap = &pcap;
+    args[i].thread_id = i;
+    pthread_create(&threads[i], NULL, &thread_loop, &args[i]);
+  }
+  for(int i=0;i<NTHREADS;i++) {
+    pthread_join(threads[i], NULL);
+  }
+  pcap.close();
+
+  // the first file keeps the name, the rotated ones get a .N suffix
+  int  total = 0;
+  int  nof_files = 0;
+  char name[256];
+  strcpy(name, filename);
+  while (true) {
+    int n = read(name, received);
+    if (n < 0) {
+      break;
+    }
+    total += n;
+    nof_files++;
+    remove(name);
+    sprintf(name, "%s.%d", filename, nof_files);
+  }
+
+  int missing = 0;
+  for(int i=0;i<NTHREADS;i++) {
+    for(int j=0;j<NPDUS;j++) {
+      if(!received[i][j]) missing++;
+    }
+  }
+  int dropped = (int) pcap.get_nof_dropped();
+  printf("%s: %d records in %d files, %d missing, %d dropped\n", filename, total, nof_files, missing, dropped);
+  if (max_file_size > 0 && nof_files < 2) {
+    return false;
+  }
+  // a thread can outrun the writer, but every missing record must have been counted as dropped
+  return missing == dropped && total == NTHREADS*NPDUS - dropped && total > 0;
+}
+
+// Time spent in the calling thread per packet
+double bench(mac_pcap *pcap) {
+  struct timeval start, end;
+  uint8_t pdu[100];
+  memset(pdu, 0xAA, sizeof(pdu));
+
+  gettimeofday(&start, NULL);
+  for (int i = 0; i < NBENCH; i++) {
+    pcap->write_dl_crnti(pdu, sizeof(pdu), 0x46, true, i);
+  }
+  gettimeofday(&end, NULL);
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / NBENCH;
+}
+
+double bench_sync(const char *filename) {
+  struct timeval start, end;
+  uint8_t pdu[100];
+  memset(pdu, 0xAA, sizeof(pdu));
+
+  FILE *f = LTE_PCAP_Open(MAC_LTE_DLT, filename);
+  gettimeofday(&start, NULL);
+  for (int i = 0; i < NBENCH; i++) {
+    MAC_Context_Info_t context = {FDD_RADIO, DIRECTION_DOWNLINK, C_RNTI, 0x46, 0, 0, 1,
+                                  (uint16_t) ((i/10)%1024), (uint16_t) (i%10)};
+    LTE_PCAP_MAC_WritePDU(f, &context, pdu, sizeof(pdu));
+  }
+  gettimeofday(&end, NULL);
+  LTE_PCAP_Close(f);
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / NBENCH;
+}
+
+int main(int argc, char **argv) {
+  bool result = write_and_check("pcap_writer_test.pcap", -1) &&
+                write_and_check("pcap_writer_test_rotate.pcap", 1024);
+
+  mac_pcap pcap;
+  pcap.open("pcap_writer_bench.pcap");
+  double ns_async = bench(&pcap);
+  pcap.close();
+  double ns_sync = bench_sync("pcap_writer_bench.pcap");
+  remove("pcap_writer_bench.pcap");
+
+  printf("Per packet in the caller: fwrite %.0f ns, ring %.0f ns\n", ns_sync, ns_async);
+
+  if(result) {
+    printf("Passed\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(1);
+  }
+}
@@ -0,0 +1,202 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Checks that the lock-free queues deliver every item exactly once and in
+ * order per producer, then compares their throughput and the latency of a
+ * blocked consumer against block_queue.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <vector>
+#include <algorithm>
+#include "srslte/common/block_queue.h"
+#include "srslte/common/lockfree_queue.h"
+
+using namespace srslte;
+
+#define MAX_PRODUCERS 16
+
+uint32_t nof_items     = 1000000;
+uint32_t nof_producers = 4;
+uint32_t nof_latency   = 10000;
+uint32_t capacity      = 128;
+
+void usage(char *prog) {
+  printf("Usage: %s [npl]\n", prog);
+  printf("\t-n number of items per test [Default %d]\n", nof_items);
+  printf("\t-p number of producers in the multi-producer tests [Default %d]\n", nof_producers);
+  printf("\t-l number of latency samples [Default %d]\n", nof_latency);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "npl")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_items = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'p':
+        nof_producers = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'l':
+        nof_latency = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (nof_producers < 1 || nof_producers > MAX_PRODUCERS) {
+    nof_producers = 4;
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+typedef struct {
+  uint64_t tstamp;
+  uint32_t producer;
+  uint32_t seq;
+} item_t;
+
+template<class queue_t>
+struct producer_args_t {
+  queue_t  *q;
+  uint32_t  id;
+  uint32_t  nof_items;
+  uint32_t  period_ns; // 0 to push as fast as possible
+};
+
+template<class queue_t>
+void* producer_thread(void *arg)
+{
+  producer_args_t<queue_t> *args = (producer_args_t<queue_t>*) arg;
+  uint64_t next = now_ns();
+  for (uint32_t i = 0; i < args->nof_items; i++) {
+    if (args->period_ns) {
+      next += args->period_ns;
+      while (now_ns() < next) {
+        sched_yield();
+      }
+    }
+    item_t item;
+    item.producer = args->id;
+    item.seq      = i;
+    item.tstamp   = now_ns();
+    args->q->push(item);
+  }
+  return NULL;
+}
+
+/* Runs nof_prod producers against one blocking consumer. Returns false if an
+ * item is lost, duplicated or out of order */
+template<class queue_t>
+bool run(const char *name, uint32_t nof_prod, uint32_t nof_total, uint32_t period_ns, bool print_rate)
+{
+  queue_t                  q(capacity);
+  pthread_t                threads[MAX_PRODUCERS];
+  producer_args_t<queue_t> args[MAX_PRODUCERS];
+  uint32_t                 next_seq[MAX_PRODUCERS];
+  std::vector<uint32_t>    latency;
+  uint32_t                 per_producer = nof_total / nof_prod;
+  bool                     ret = true;
+
+  latency.reserve(per_producer * nof_prod);
+  uint64_t t_start = now_ns();
+  for (uint32_t i = 0; i < nof_prod; i++) {
+    args[i].q         = &q;
+    args[i].id        = i;
+    args[i].nof_items = per_producer;
+    args[i].period_ns = period_ns;
+    next_seq[i]       = 0;
+    pthread_create(&threads[i], NULL, producer_thread<queue_t>, &args[i]);
+  }
+  for (uint32_t n = 0; n < per_producer * nof_prod; n++) {
+    item_t item = q.wait_pop();
+    latency.push_back((uint32_t) (now_ns() - item.tstamp));
+    if (item.producer >= nof_prod || item.seq != next_seq[item.producer]) {
+      fprintf(stderr, "%s: producer %d item %d received, expected %d\n", name, item.producer, item.seq,
+              item.producer < nof_prod ? next_seq[item.producer] : 0);
+      ret = false;
+      break;
+    }
+    next_seq[item.producer]++;
+  }
+  uint64_t t_total = now_ns() - t_start;
+  for (uint32_t i = 0; i < nof_prod; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  if (!ret) {
+    return false;
+  }
+  if (!q.empty()) {
+    fprintf(stderr, "%s: queue not empty at the end\n", name);
+    return false;
+  }
+
+  std::sort(latency.begin(), latency.end());
+  uint32_t p50 = latency[latency.size()/2];
+  uint32_t p99 = latency[latency.size()*99/100];
+  if (print_rate) {
+    printf("%-12s %d producers: %6.2f Mitems/s\n", name, nof_prod, (float) latency.size()*1000/t_total);
+  } else {
+    printf("%-12s %d producers: latency p50=%d ns, p99=%d ns\n", name, nof_prod, p50, p99);
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  printf("Throughput, %d items, capacity %d\n", nof_items, capacity);
+  if (!run<block_queue<item_t> >("block_queue", 1, nof_items, 0, true) ||
+      !run<spsc_queue<item_t> >("spsc_queue", 1, nof_items, 0, true) ||
+      !run<block_queue<item_t> >("block_queue", nof_producers, nof_items, 0, true) ||
+      !run<mpsc_queue<item_t> >("mpsc_queue", nof_producers, nof_items, 0, true)) {
+    return -1;
+  }
+
+  // One item every 20 us, the consumer sleeps in wait_pop between items
+  printf("Wake-up latency, %d items\n", nof_latency);
+  if (!run<block_queue<item_t> >("block_queue", 1, nof_latency, 20000, false) ||
+      !run<spsc_queue<item_t> >("spsc_queue", 1, nof_latency, 20000, false) ||
+      !run<mpsc_queue<item_t> >("mpsc_queue", 1, nof_latency, 20000, false)) {
+    return -1;
+  }
+
+  printf("Ok\n");
+  return 0;
+}
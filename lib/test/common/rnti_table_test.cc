@@ -0,0 +1,209 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Checks rnti_table against std::map with a random sequence of insertions,
+ * lookups and removals, then compares the cost of the per-TTI accesses of
+ * the MAC (one pass over all the users plus a few lookups per user) with 64
+ * and 256 connected users.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include <map>
+#include "srslte/common/rnti_table.h"
+
+using namespace srslte;
+
+uint32_t nof_ops  = 200000;
+uint32_t nof_ttis = 10000;
+
+void usage(char *prog) {
+  printf("Usage: %s [nt]\n", prog);
+  printf("\t-n number of random operations [Default %d]\n", nof_ops);
+  printf("\t-t number of TTIs in the timing test [Default %d]\n", nof_ttis);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nt")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_ops = (uint32_t) atoi(argv[optind]);
+        break;
+      case 't':
+        nof_ttis = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+typedef struct {
+  uint32_t tti;
+  uint32_t data[16];
+} user_t;
+
+bool same_content(rnti_table<uint32_t> &t, std::map<uint16_t, uint32_t> &m)
+{
+  if (t.size() != m.size()) {
+    printf("Size %d, expected %d\n", (int) t.size(), (int) m.size());
+    return false;
+  }
+  uint32_t n = 0;
+  for (rnti_table<uint32_t>::iterator it = t.begin(); it != t.end(); ++it, n++) {
+    std::map<uint16_t, uint32_t>::iterator m_it = m.find(it->first);
+    if (m_it == m.end() || m_it->second != it->second) {
+      printf("Unexpected entry 0x%x\n", it->first);
+      return false;
+    }
+  }
+  return n == m.size();
+}
+
+bool test_random()
+{
+  rnti_table<uint32_t>         t;
+  std::map<uint16_t, uint32_t> m;
+  std::map<uint16_t, uint32_t*> addr;
+
+  srand(0);
+  for (uint32_t i = 0; i < nof_ops; i++) {
+    // Mostly sequential RNTIs as the MAC allocates them, some random ones
+    uint16_t rnti = (rand() % 4) ? 70 + 3 * (rand() % 300) : (uint16_t) rand();
+    switch (rand() % 4) {
+      case 0:
+      case 1:
+        t[rnti] = i;
+        m[rnti] = i;
+        if (addr.count(rnti) && addr[rnti] != &t[rnti]) {
+          printf("Entry 0x%x has moved\n", rnti);
+          return false;
+        }
+        addr[rnti] = &t[rnti];
+        break;
+      case 2:
+        if (t.erase(rnti) != m.erase(rnti)) {
+          printf("Erase of 0x%x differs\n", rnti);
+          return false;
+        }
+        addr.erase(rnti);
+        break;
+      default:
+        if (t.count(rnti) != m.count(rnti) || (m.count(rnti) && t.find(rnti)->second != m[rnti])) {
+          printf("Lookup of 0x%x differs\n", rnti);
+          return false;
+        }
+        break;
+    }
+    if ((i % 1000) == 0 && !same_content(t, m)) {
+      return false;
+    }
+  }
+  if (!same_content(t, m)) {
+    return false;
+  }
+
+  // Copies keep the content, removal while iterating with erase(it++)
+  rnti_table<uint32_t> c(t);
+  if (!same_content(c, m)) {
+    return false;
+  }
+  for (rnti_table<uint32_t>::iterator it = c.begin(); it != c.end(); ) {
+    if (it->second % 2) {
+      m.erase(it->first);
+      c.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  if (!same_content(c, m)) {
+    return false;
+  }
+  c.clear();
+  if (!c.empty() || c.begin() != c.end()) {
+    printf("Table not empty after clear\n");
+    return false;
+  }
+  printf("Random test: %d operations OK\n", nof_ops);
+  return true;
+}
+
+template<class table_t>
+double time_tti(table_t &t, uint32_t nof_users)
+{
+  for (uint32_t i = 0; i < nof_users; i++) {
+    t[70 + 3 * i].tti = 0;
+  }
+  uint64_t t_start = now_ns();
+  for (uint32_t tti = 0; tti < nof_ttis; tti++) {
+    // Scheduler and PHY pass over all the users
+    for (typename table_t::iterator it = t.begin(); it != t.end(); ++it) {
+      it->second.tti = tti;
+    }
+    // Buffer state, CQI, ACK and CRC reports look up each user
+    for (uint32_t k = 0; k < 4; k++) {
+      for (uint32_t i = 0; i < nof_users; i++) {
+        uint16_t rnti = 70 + 3 * ((i * 7 + k) % nof_users);
+        if (t.count(rnti)) {
+          t[rnti].data[k] += tti;
+        }
+      }
+    }
+  }
+  return (double) (now_ns() - t_start) / nof_ttis / 1000;
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  if (!test_random()) {
+    printf("Random test failed\n");
+    exit(-1);
+  }
+
+  uint32_t nof_users[2] = {64, 256};
+  for (uint32_t i = 0; i < 2; i++) {
+    std::map<uint16_t, user_t> m;
+    rnti_table<user_t>         t;
+    double t_map   = time_tti(m, nof_users[i]);
+    double t_table = time_tti(t, nof_users[i]);
+    printf("%3d users: std::map %.2f us/TTI, rnti_table %.2f us/TTI\n",
+           nof_users[i], t_map, t_table);
+  }
+  exit(0);
+}
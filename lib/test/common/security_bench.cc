@@ -0,0 +1,279 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/liblte_security.h"
+#include "srslte/common/security.h"
+#include "srslte/common/snow_3g.h"
+
+/* Measures the PDCP ciphering and integrity throughput, in Mbps for a single
+ * core, for SDU sizes up to the largest PDCP SDU. EEA1/EIA1 are run through
+ * the bit-oriented reference SNOW 3G and the word-oriented engine. EEA2/EIA2
+ * are run through liblte_security, with the key expanded for every PDU, and
+ * with the key expanded once, as PDCP does, on the software or the AES-NI
+ * engine. Their output is compared with the reference implementations.
+ */
+
+using namespace srslte;
+
+uint32_t nof_repetitions = 2000;
+int      sdu_length = 0;
+bool     test_errors = false;
+
+const uint32_t lengths[] = {40, 100, 500, 1500, 8188};
+
+#define MAX_SDU 8188
+
+typedef enum {
+  BENCH_EEA1_REF = 0,
+  BENCH_EEA1,
+  BENCH_EEA2_LIBLTE,
+  BENCH_EEA2_KEY,
+  BENCH_EEA2_SW,
+  BENCH_EEA2_AESNI,
+  BENCH_EIA1_REF,
+  BENCH_EIA1,
+  BENCH_EIA2_LIBLTE,
+  BENCH_EIA2_KEY,
+  BENCH_EIA2_SW,
+  BENCH_EIA2_AESNI,
+  BENCH_NOF_CASES
+} bench_case_t;
+
+const char *case_names[BENCH_NOF_CASES] = {"EEA1 reference", "EEA1", "EEA2 liblte", "EEA2 per PDU",
+                                           "EEA2 software", "EEA2 AES-NI", "EIA1 reference", "EIA1",
+                                           "EIA2 liblte", "EIA2 per PDU", "EIA2 software", "EIA2 AES-NI"};
+
+void usage(char *prog) {
+  printf("Usage: %s [nlt]\n", prog);
+  printf("\t-n nof_repetitions [Default %d]\n", nof_repetitions);
+  printf("\t-l SDU length in bytes [Default sweep]\n");
+  printf("\t-t test: exit with error on wrong output [Default disabled]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nlt")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_repetitions = atoi(argv[optind]);
+      break;
+    case 'l':
+      sdu_length = atoi(argv[optind]);
+      break;
+    case 't':
+      test_errors = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+// Compares both engines with the reference for every length up to max_len, returns the number of errors
+int check(uint8_t *key, uint32_t max_len) {
+  int                errors = 0;
+  security_aes_ctx_t ctx;
+  uint8_t            msg[MAX_SDU];
+  uint8_t            out[MAX_SDU];
+  uint8_t            ref[MAX_SDU];
+  uint8_t            mac[4];
+  uint8_t            mac_ref[4];
+
+  security_aes_init(&ctx, key);
+  for (uint32_t i = 0; i < max_len; i++) {
+    msg[i] = rand() & 0xFF;
+  }
+  for (uint32_t len = 1; len <= max_len; len++) {
+    uint32_t count     = rand();
+    uint8_t  bearer    = rand() & 0x1F;
+    uint8_t  direction = rand() & 0x01;
+
+    liblte_security_encryption_eea1(key, count, bearer, direction, msg, len*8, ref);
+    security_128_eea1(key, count, bearer, direction, msg, len, out);
+    if (memcmp(out, ref, len)) {
+      printf("EEA1 error for %d bytes\n", len);
+      errors++;
+    }
+    // in place
+    memcpy(out, msg, len);
+    security_128_eea1(key, count, bearer, direction, out, len, out);
+    if (memcmp(out, ref, len)) {
+      printf("EEA1 in place error for %d bytes\n", len);
+      errors++;
+    }
+
+    memcpy(mac_ref, snow3g_f9(key, count, bearer, direction, msg, len*8), 4);
+    security_128_eia1(key, count, bearer, direction, msg, len, mac);
+    if (memcmp(mac, mac_ref, 4)) {
+      printf("EIA1 error for %d bytes\n", len);
+      errors++;
+    }
+  }
+  for (int e = 0; e < 2; e++) {
+    if (e == 1 && !security_aesni_supported()) {
+      break;
+    }
+    ctx.aesni = e == 1;
+    for (uint32_t len = 1; len <= max_len; len++) {
+      uint32_t count     = rand();
+      uint8_t  bearer    = rand() & 0x1F;
+      uint8_t  direction = rand() & 0x01;
+
+      liblte_security_encryption_eea2(key, count, bearer, direction, msg, len*8, ref);
+      security_128_eea2(&ctx, count, bearer, direction, msg, len, out);
+      if (memcmp(out, ref, len)) {
+        printf("EEA2 %s error for %d bytes\n", e ? "AES-NI" : "software", len);
+        errors++;
+      }
+      // in place
+      memcpy(out, msg, len);
+      security_128_eea2(&ctx, count, bearer, direction, out, len, out);
+      if (memcmp(out, ref, len)) {
+        printf("EEA2 %s in place error for %d bytes\n", e ? "AES-NI" : "software", len);
+        errors++;
+      }
+
+      liblte_security_128_eia2(key, count, bearer, direction, msg, len, mac_ref);
+      security_128_eia2(&ctx, count, bearer, direction, msg, len, mac);
+      if (memcmp(mac, mac_ref, 4)) {
+        printf("EIA2 %s error for %d bytes\n", e ? "AES-NI" : "software", len);
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+// Returns the throughput in Mbps, or a negative value if the case is not supported
+float run_bench(bench_case_t c, uint8_t *key, uint32_t len) {
+  security_aes_ctx_t ctx;
+  uint8_t            msg[MAX_SDU];
+  uint8_t            out[MAX_SDU];
+  uint8_t            mac[4];
+  struct timeval     t[3];
+
+  security_aes_init(&ctx, key);
+  if (c == BENCH_EEA2_AESNI || c == BENCH_EIA2_AESNI) {
+    if (!security_aesni_supported()) {
+      return -1;
+    }
+    ctx.aesni = true;
+  } else {
+    ctx.aesni = false;
+  }
+  for (uint32_t i = 0; i < len; i++) {
+    msg[i] = rand() & 0xFF;
+  }
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t r = 0; r < nof_repetitions; r++) {
+    switch (c) {
+      case BENCH_EEA1_REF:
+        liblte_security_encryption_eea1(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len*8, out);
+        break;
+      case BENCH_EEA1:
+        security_128_eea1(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, out);
+        break;
+      case BENCH_EEA2_LIBLTE:
+        liblte_security_encryption_eea2(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len*8, out);
+        break;
+      case BENCH_EEA2_KEY:
+        security_128_eea2(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, out);
+        break;
+      case BENCH_EEA2_SW:
+      case BENCH_EEA2_AESNI:
+        security_128_eea2(&ctx, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, out);
+        break;
+      case BENCH_EIA1_REF:
+        snow3g_f9(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len*8);
+        break;
+      case BENCH_EIA1:
+        security_128_eia1(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, mac);
+        break;
+      case BENCH_EIA2_LIBLTE:
+        liblte_security_128_eia2(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, mac);
+        break;
+      case BENCH_EIA2_KEY:
+        security_128_eia2(key, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, mac);
+        break;
+      case BENCH_EIA2_SW:
+      case BENCH_EIA2_AESNI:
+        security_128_eia2(&ctx, r, 1, SECURITY_DIRECTION_DOWNLINK, msg, len, mac);
+        break;
+      default:
+        break;
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  float us = t[0].tv_sec * 1e6 + t[0].tv_usec;
+  return us > 0 ? (float) len * 8 * nof_repetitions / us : 0;
+}
+
+int main(int argc, char **argv) {
+  uint8_t key[16];
+
+  parse_args(argc, argv);
+  srand(0);
+  for (int i = 0; i < 16; i++) {
+    key[i] = rand() & 0xFF;
+  }
+
+  int errors = check(key, 300);
+  printf("%d repetitions. AES-NI %ssupported. %d errors against the reference\n", nof_repetitions,
+         security_aesni_supported() ? "" : "not ", errors);
+
+  uint32_t nof_lengths = sdu_length ? 1 : sizeof(lengths) / sizeof(uint32_t);
+  printf("%-14s", "Mbps/core");
+  for (uint32_t l = 0; l < nof_lengths; l++) {
+    printf("%9d", sdu_length ? sdu_length : lengths[l]);
+  }
+  printf("\n");
+  for (int c = 0; c < BENCH_NOF_CASES; c++) {
+    printf("%-14s", case_names[c]);
+    for (uint32_t l = 0; l < nof_lengths; l++) {
+      uint32_t len  = sdu_length ? sdu_length : lengths[l];
+      float    mbps = len <= MAX_SDU ? run_bench((bench_case_t) c, key, len) : -1;
+      if (mbps < 0) {
+        printf("%9s", "-");
+      } else {
+        printf("%9.0f", mbps);
+      }
+      fflush(stdout);
+    }
+    printf("\n");
+  }
+
+  exit(test_errors && errors ? -1 : 0);
+}
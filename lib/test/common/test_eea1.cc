@@ -9,6 +9,7 @@
 
 #include "srslte/srslte.h"
 #include "srslte/common/liblte_security.h"
+#include "srslte/common/snow_3g.h"
 
 /*
  * Prototypes
@@ -65,6 +66,12 @@ void test_set_1()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
       direction, ct, len_bits, out);
@@ -125,6 +132,12 @@ void test_set_2()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
       direction, ct, len_bits, out);
@@ -171,6 +184,12 @@ void test_set_3()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
       direction, ct, len_bits, out);
@@ -237,6 +256,12 @@ void test_set_4()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
       direction, ct, len_bits, out);
@@ -309,6 +334,12 @@ void test_set_5()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
       direction, ct, len_bits, out);
@@ -459,6 +490,12 @@ void test_set_6()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   gettimeofday(&t[1], NULL);
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
@@ -508,6 +545,12 @@ void test_set_1_block_size()
   err_cmp = arrcmp(ct, out, len_bytes);
   assert(err_cmp == 0);
 
+  // word-oriented engine, in place
+  memcpy(out, msg, len_bytes);
+  snow3g_f8_words(key, count, bearer, direction, out, out, len_bits);
+  err_cmp = arrcmp(ct, out, len_bytes);
+  assert(err_cmp == 0);
+
   // decryption
   err_lte = liblte_security_decryption_eea1(key, count, bearer,
       direction, ct, len_bits, out);
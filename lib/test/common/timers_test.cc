@@ -0,0 +1,259 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Checks the timing wheel against the per-timer counters the timers used to
+ * step on every TTI, with random start/stop/reset and timers restarted from
+ * their callback. Then times step_all() with many running timers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <vector>
+#include "srslte/common/timers.h"
+
+using namespace srslte;
+
+uint32_t nof_timers = 16384;
+uint32_t nof_ttis   = 10000;
+uint32_t max_timeout = 4000;
+
+void usage(char *prog) {
+  printf("Usage: %s [ntm]\n", prog);
+  printf("\t-n number of timers [Default %d]\n", nof_timers);
+  printf("\t-t number of TTIs [Default %d]\n", nof_ttis);
+  printf("\t-m maximum timeout in TTIs [Default %d]\n", max_timeout);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ntm")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_timers = (uint32_t) atoi(argv[optind]);
+        break;
+      case 't':
+        nof_ttis = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'm':
+        max_timeout = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+// The previous implementation: every timer counts on every step
+class linear_timers
+{
+public:
+  struct ref_timer {
+    uint32_t counter;
+    uint32_t timeout;
+    bool     running;
+  };
+  linear_timers(uint32_t n) : t(n) {
+    for (uint32_t i = 0; i < n; i++) {
+      t[i].counter = 0;
+      t[i].timeout = 0;
+      t[i].running = false;
+    }
+  }
+  // Returns the expired timers, in id order
+  void step_all(std::vector<uint32_t> &expired) {
+    for (uint32_t i = 0; i < t.size(); i++) {
+      if (t[i].running) {
+        t[i].counter++;
+        if (t[i].timeout > 0 && t[i].counter >= t[i].timeout) {
+          t[i].running = false;
+          expired.push_back(i);
+        }
+      }
+    }
+  }
+  std::vector<ref_timer> t;
+};
+
+class recorder : public timer_callback
+{
+public:
+  recorder(timers *wheel_) : wheel(wheel_), restart(false) {}
+  void timer_expired(uint32_t timer_id) {
+    expired.push_back(timer_id);
+    if (restart) {
+      wheel->get(timer_id)->reset();
+      wheel->get(timer_id)->run();
+    }
+  }
+  timers               *wheel;
+  bool                  restart;
+  std::vector<uint32_t> expired;
+};
+
+bool check_against_linear(uint32_t n, uint32_t ttis) {
+  timers        wheel(n);
+  linear_timers ref(n);
+  recorder      rec(&wheel);
+
+  for (uint32_t i = 0; i < n; i++) {
+    if (wheel.get_unique_id() != i) {
+      printf("Unexpected timer id\n");
+      return false;
+    }
+  }
+
+  for (uint32_t tti = 0; tti < ttis; tti++) {
+    // random operations on a few timers
+    for (uint32_t k = 0; k < n / 16 + 1; k++) {
+      uint32_t i = rand() % n;
+      switch (rand() % 4) {
+        case 0: {
+          // long timeouts go through the upper wheel levels
+          uint32_t timeout = rand() % 8 ? rand() % 300 : rand() % 100000;
+          wheel.get(i)->set(&rec, timeout);
+          ref.t[i].timeout = timeout;
+          ref.t[i].counter = 0;
+          break;
+        }
+        case 1:
+          wheel.get(i)->run();
+          ref.t[i].running = true;
+          break;
+        case 2:
+          wheel.get(i)->stop();
+          ref.t[i].running = false;
+          break;
+        case 3:
+          wheel.get(i)->reset();
+          ref.t[i].counter = 0;
+          break;
+      }
+    }
+
+    std::vector<uint32_t> expected;
+    ref.step_all(expected);
+    rec.expired.clear();
+    wheel.step_all();
+
+    std::vector<bool> fired(n, false);
+    for (uint32_t k = 0; k < rec.expired.size(); k++) {
+      fired[rec.expired[k]] = true;
+    }
+    if (rec.expired.size() != expected.size()) {
+      printf("TTI %d: %d timers expired, expected %d\n", tti, (int) rec.expired.size(), (int) expected.size());
+      return false;
+    }
+    for (uint32_t k = 0; k < expected.size(); k++) {
+      if (!fired[expected[k]]) {
+        printf("TTI %d: timer %d did not expire\n", tti, expected[k]);
+        return false;
+      }
+    }
+    for (uint32_t i = 0; i < n; i++) {
+      timers::timer *t = wheel.get(i);
+      bool ref_running = ref.t[i].running && ref.t[i].counter < ref.t[i].timeout;
+      if (t->value() != ref.t[i].counter || t->is_running() != ref_running) {
+        printf("TTI %d: timer %d value=%d running=%d, expected value=%d running=%d\n",
+               tti, i, t->value(), t->is_running(), ref.t[i].counter, ref_running);
+        return false;
+      }
+    }
+  }
+
+  // ids are reused after release
+  wheel.release_id(n / 2);
+  if (wheel.get_unique_id() != n / 2) {
+    printf("Released timer id not reused\n");
+    return false;
+  }
+  return true;
+}
+
+// All timers running and restarted on expiry, as RLC/RRC timers are
+double bench_wheel(uint32_t n, uint32_t ttis, uint64_t *nof_expired) {
+  timers   wheel(n);
+  recorder rec(&wheel);
+  struct timeval start, end;
+
+  rec.restart = true;
+  for (uint32_t i = 0; i < n; i++) {
+    timers::timer *t = wheel.get(wheel.get_unique_id());
+    t->set(&rec, 1 + rand() % max_timeout);
+    t->run();
+  }
+  gettimeofday(&start, NULL);
+  for (uint32_t tti = 0; tti < ttis; tti++) {
+    wheel.step_all();
+  }
+  gettimeofday(&end, NULL);
+  *nof_expired = rec.expired.size();
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / ttis;
+}
+
+double bench_linear(uint32_t n, uint32_t ttis) {
+  linear_timers ref(n);
+  std::vector<uint32_t> expired;
+  struct timeval start, end;
+
+  for (uint32_t i = 0; i < n; i++) {
+    ref.t[i].timeout = 1 + rand() % max_timeout;
+    ref.t[i].running = true;
+  }
+  gettimeofday(&start, NULL);
+  for (uint32_t tti = 0; tti < ttis; tti++) {
+    expired.clear();
+    ref.step_all(expired);
+    for (uint32_t k = 0; k < expired.size(); k++) {
+      ref.t[expired[k]].counter = 0;
+      ref.t[expired[k]].running = true;
+    }
+  }
+  gettimeofday(&end, NULL);
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / ttis;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  srand(0);
+
+  if (!check_against_linear(256, 20000)) {
+    printf("Failed\n");
+    exit(1);
+  }
+
+  uint64_t nof_expired = 0;
+  double ns_wheel  = bench_wheel(nof_timers, nof_ttis, &nof_expired);
+  double ns_linear = bench_linear(nof_timers, nof_ttis);
+  printf("%d timers, %d TTIs, %ld expiries: step_all() %.0f ns/TTI, linear scan %.0f ns/TTI\n",
+         nof_timers, nof_ttis, (long) nof_expired, ns_wheel, ns_linear);
+
+  printf("Passed\n");
+  exit(0);
+}
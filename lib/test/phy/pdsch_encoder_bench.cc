@@ -0,0 +1,289 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/*
+ * Measures the time taken to encode the PDSCH of all the users of a subframe
+ * into the resource grid, as done by an eNodeB PHY worker. The users are
+ * encoded by a pool of 0 (in the calling thread) to N threads, and the
+ * calling thread helps while it waits. The resource grid must be the same
+ * with any number of threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <vector>
+#include <algorithm>
+
+#include "srslte/srslte.h"
+#include "srslte/common/task_pool.h"
+
+uint32_t nof_prb       = 100;
+uint32_t nof_users     = 8;
+uint32_t mcs           = 20;
+uint32_t max_threads   = 4;
+uint32_t nof_subframes = 200;
+
+void usage(char *prog) {
+  printf("Usage: %s [ptumn]\n", prog);
+  printf("\t-p number of PRB of the cell [Default %d]\n", nof_prb);
+  printf("\t-u number of users per subframe [Default %d]\n", nof_users);
+  printf("\t-m MCS of all users [Default %d]\n", mcs);
+  printf("\t-t maximum number of encoder threads [Default %d]\n", max_threads);
+  printf("\t-n number of subframes [Default %d]\n", nof_subframes);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ptumn")) != -1) {
+    switch (opt) {
+      case 'p':
+        nof_prb = (uint32_t) atoi(argv[optind]);
+        break;
+      case 't':
+        max_threads = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'm':
+        mcs = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'n':
+        nof_subframes = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  uint16_t                rnti;
+  srslte_ra_dl_grant_t    grant;
+  srslte_softbuffer_tx_t  softbuffer;
+  srslte_softbuffer_tx_t *softbuffers[SRSLTE_MAX_CODEWORDS];
+  uint8_t                *data[SRSLTE_MAX_CODEWORDS];
+  int                     rv[SRSLTE_MAX_CODEWORDS];
+  int                     ret;
+} user_t;
+
+srslte_cell_t                              cell;
+srslte_enb_dl_t                            enb_dl;
+std::vector<user_t>                        users;
+srslte::task_pool                         *pool = NULL;
+std::vector<srslte_enb_dl_pdsch_encoder_t> encoders;
+srslte::task_pool::group                   group;
+uint32_t                                   helper_slot = 0;
+
+void encode_user(void *arg, uint32_t slot) {
+  user_t *user = (user_t*) arg;
+  user->ret = srslte_enb_dl_put_pdsch_encoder(&enb_dl, &encoders[slot], 1.0f, &user->grant, user->softbuffers,
+                                              user->rnti, user->rv, 1, user->data,
+                                              SRSLTE_MIMO_TYPE_SINGLE_ANTENNA);
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+// Gives each user the resource block groups i with i % nof_users equal to its index
+void setup_users() {
+  uint32_t nof_rbg = (nof_prb + srslte_ra_type0_P(nof_prb) - 1) / srslte_ra_type0_P(nof_prb);
+  for (uint32_t u = 0; u < nof_users; u++) {
+    user_t *user = &users[u];
+    srslte_ra_dl_dci_t dci;
+    bzero(&dci, sizeof(srslte_ra_dl_dci_t));
+    dci.alloc_type = SRSLTE_RA_ALLOC_TYPE0;
+    for (uint32_t i = u; i < nof_rbg; i += nof_users) {
+      dci.type0_alloc.rbg_bitmask |= 1 << (nof_rbg - i - 1);
+    }
+    dci.mcs_idx  = mcs;
+    dci.tb_en[0] = true;
+
+    user->rnti = (uint16_t) (SRSLTE_CRNTI_START + u);
+    if (srslte_ra_dl_dci_to_grant(&dci, nof_prb, user->rnti, &user->grant)) {
+      fprintf(stderr, "Error computing grant\n");
+      exit(-1);
+    }
+    user->softbuffers[0] = &user->softbuffer;
+    user->softbuffers[1] = NULL;
+    user->data[0] = (uint8_t*) srslte_vec_malloc(user->grant.mcs[0].tbs / 8 + 1);
+    user->data[1] = NULL;
+    for (uint32_t i = 0; i < (uint32_t) user->grant.mcs[0].tbs / 8; i++) {
+      user->data[0][i] = (uint8_t) rand();
+    }
+    user->rv[0] = 0;
+    user->rv[1] = 0;
+    if (srslte_softbuffer_tx_init(&user->softbuffer, nof_prb)) {
+      fprintf(stderr, "Error initiating soft buffer\n");
+      exit(-1);
+    }
+    if (srslte_enb_dl_add_rnti(&enb_dl, user->rnti)) {
+      fprintf(stderr, "Error adding RNTI\n");
+      exit(-1);
+    }
+  }
+}
+
+// Encodes all the users of a subframe. Returns the number of errors
+uint32_t encode_subframe() {
+  uint32_t nof_errors = 0;
+  srslte_enb_dl_clear_sf(&enb_dl);
+  for (uint32_t u = 0; u < nof_users; u++) {
+    user_t *user = &users[u];
+    srslte_softbuffer_tx_reset(&user->softbuffer);
+    if (pool) {
+      pool->push(helper_slot, &group, encode_user, user);
+    } else {
+      user->ret = srslte_enb_dl_put_pdsch(&enb_dl, &user->grant, user->softbuffers, user->rnti, user->rv, 1,
+                                          user->data, SRSLTE_MIMO_TYPE_SINGLE_ANTENNA);
+    }
+  }
+  if (pool) {
+    pool->wait(helper_slot, &group);
+  }
+  for (uint32_t u = 0; u < nof_users; u++) {
+    if (users[u].ret) {
+      nof_errors++;
+    }
+  }
+  return nof_errors;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  bzero(&cell, sizeof(srslte_cell_t));
+  cell.nof_prb         = nof_prb;
+  cell.nof_ports       = 1;
+  cell.id              = 1;
+  cell.cp              = SRSLTE_CP_NORM;
+  cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell.phich_resources = SRSLTE_PHICH_R_1;
+
+  uint32_t nof_rbg = (nof_prb + srslte_ra_type0_P(nof_prb) - 1) / srslte_ra_type0_P(nof_prb);
+  if (nof_users == 0 || nof_users > nof_rbg) {
+    fprintf(stderr, "Invalid number of users\n");
+    exit(-1);
+  }
+
+  cf_t *out_buffer[SRSLTE_MAX_PORTS];
+  for (uint32_t i = 0; i < SRSLTE_MAX_PORTS; i++) {
+    out_buffer[i] = (cf_t*) srslte_vec_malloc(sizeof(cf_t) * SRSLTE_SF_LEN_PRB(nof_prb));
+  }
+  if (srslte_enb_dl_init(&enb_dl, out_buffer, nof_prb) || srslte_enb_dl_set_cell(&enb_dl, cell)) {
+    fprintf(stderr, "Error initiating eNodeB DL\n");
+    exit(-1);
+  }
+  srslte_enb_dl_set_cfi(&enb_dl, 1);
+
+  users.resize(nof_users);
+  srand(0);
+  setup_users();
+
+  uint32_t sf_len = SRSLTE_SF_LEN_RE(nof_prb, cell.cp);
+  cf_t *sf_serial = (cf_t*) srslte_vec_malloc(sizeof(cf_t) * sf_len);
+
+  printf("%d PRB cell, %d users per subframe, MCS %d, TBS %d bits, %d subframes\n",
+         nof_prb, nof_users, mcs, users[0].grant.mcs[0].tbs, nof_subframes);
+  printf("%7s %9s %9s %8s\n", "threads", "p50 us", "p99 us", "speedup");
+
+  double   p50_serial = 0;
+  uint32_t nof_errors = 0;
+  bool     differ     = false;
+
+  for (uint32_t nof_threads = 0; nof_threads <= max_threads; nof_threads++) {
+    if (nof_threads > 0) {
+      pool = new srslte::task_pool;
+      pool->init(nof_threads, 1);
+      helper_slot = pool->get_helper_slot(0);
+      encoders.resize(pool->get_nof_slots());
+      for (uint32_t i = 0; i < encoders.size(); i++) {
+        if (srslte_enb_dl_pdsch_encoder_init(&encoders[i], nof_prb) ||
+            srslte_enb_dl_pdsch_encoder_set_cell(&encoders[i], cell))
+        {
+          fprintf(stderr, "Error initiating PDSCH encoder\n");
+          exit(-1);
+        }
+      }
+    }
+
+    std::vector<uint64_t> elapsed;
+    for (uint32_t sf = 0; sf < nof_subframes; sf++) {
+      uint64_t t0 = now_ns();
+      nof_errors += encode_subframe();
+      elapsed.push_back(now_ns() - t0);
+    }
+    if (nof_threads == 0) {
+      memcpy(sf_serial, enb_dl.sf_symbols[0], sizeof(cf_t) * sf_len);
+    } else if (memcmp(sf_serial, enb_dl.sf_symbols[0], sizeof(cf_t) * sf_len)) {
+      differ = true;
+    }
+
+    std::sort(elapsed.begin(), elapsed.end());
+    double p50 = elapsed[elapsed.size() / 2] / 1000.0;
+    double p99 = elapsed[(elapsed.size() * 99) / 100] / 1000.0;
+    if (nof_threads == 0) {
+      p50_serial = p50;
+    }
+    printf("%7d %9.1f %9.1f %7.2fx\n", nof_threads, p50, p99, p50_serial / p50);
+
+    if (pool) {
+      pool->stop();
+      for (uint32_t i = 0; i < encoders.size(); i++) {
+        srslte_enb_dl_pdsch_encoder_free(&encoders[i]);
+      }
+      encoders.clear();
+      delete pool;
+      pool = NULL;
+    }
+  }
+
+  for (uint32_t u = 0; u < nof_users; u++) {
+    srslte_enb_dl_rem_rnti(&enb_dl, users[u].rnti);
+    srslte_softbuffer_tx_free(&users[u].softbuffer);
+    free(users[u].data[0]);
+  }
+  srslte_enb_dl_free(&enb_dl);
+  for (uint32_t i = 0; i < SRSLTE_MAX_PORTS; i++) {
+    free(out_buffer[i]);
+  }
+  free(sf_serial);
+
+  if (nof_errors || differ) {
+    printf("Encoding failed (%d errors, resource grid %s)\n", nof_errors, differ ? "differs" : "matches");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,364 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Measures the time taken to decode the UL-SCH of all the users of a
+ * subframe, from the deinterleaving to the transport block CRC, as done by
+ * an eNodeB PHY worker. The code blocks are turbo decoded by a pool of 0 (in
+ * the calling thread) to N threads, and the calling thread helps while it
+ * waits. For each number of threads the PRB load is increased until the
+ * median subframe decoding time exceeds the budget, and the maximum load with
+ * the 99th percentile within the budget is reported. Decoded data must be the same with
+ * any number of threads.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <vector>
+#include <algorithm>
+
+#include "srslte/srslte.h"
+#include "srslte/common/task_pool.h"
+
+#define MAX_DATA_LEN  (150000)
+#define LLR_SCALE     100
+
+uint32_t nof_prb       = 100;
+uint32_t nof_users     = 4;
+uint32_t mcs           = 20;
+uint32_t max_threads   = 4;
+uint32_t nof_subframes = 200;
+uint32_t max_its       = 8;
+float    snr_db        = 5.0;
+uint32_t budget_us     = 1000;
+
+void usage(char *prog) {
+  printf("Usage: %s [ptumnisl]\n", prog);
+  printf("\t-p number of PRB of the cell [Default %d]\n", nof_prb);
+  printf("\t-u number of users per subframe [Default %d]\n", nof_users);
+  printf("\t-m MCS of all users [Default %d]\n", mcs);
+  printf("\t-t maximum number of decoder threads [Default %d]\n", max_threads);
+  printf("\t-n number of subframes per load [Default %d]\n", nof_subframes);
+  printf("\t-i maximum number of turbo decoder iterations [Default %d]\n", max_its);
+  printf("\t-s SNR per coded bit in dB [Default %.1f]\n", snr_db);
+  printf("\t-l subframe budget in us [Default %d]\n", budget_us);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ptumnisl")) != -1) {
+    switch (opt) {
+      case 'p':
+        nof_prb = (uint32_t) atoi(argv[optind]);
+        break;
+      case 't':
+        max_threads = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'm':
+        mcs = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'n':
+        nof_subframes = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'i':
+        max_its = (uint32_t) atoi(argv[optind]);
+        break;
+      case 's':
+        snr_db = atof(argv[optind]);
+        break;
+      case 'l':
+        budget_us = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  srslte_pusch_cfg_t     cfg;
+  srslte_softbuffer_rx_t softbuffer;
+  srslte_sch_tb_t        tb;
+  uint8_t               *data_tx;
+  uint8_t               *data_rx;
+  int16_t               *llr;
+  int16_t               *g_bits;
+} user_t;
+
+srslte_sch_t                         sch_tx;
+srslte_sch_t                         sch_rx;
+srslte_softbuffer_tx_t               softbuffer_tx;
+std::vector<user_t>                  users;
+srslte::task_pool                   *pool = NULL;
+std::vector<srslte_sch_cb_decoder_t> decoders;
+srslte::task_pool::group             group;
+uint32_t                             helper_slot = 0;
+
+void decode_cb(void *arg, uint32_t slot) {
+  srslte_sch_decode_cb(&decoders[slot], (srslte_sch_cb_t*) arg);
+}
+
+void decode_tb(void *arg, srslte_sch_tb_t *tb) {
+  for (uint32_t i = 0; i < tb->nof_cb; i++) {
+    pool->push(helper_slot, &group, decode_cb, &tb->cb[i]);
+  }
+}
+
+srslte_sch_executor_t executor = {NULL, decode_tb};
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+// Valid number of PRB of an uplink allocation, 2^a*3^b*5^c
+bool valid_prb(uint32_t L) {
+  while (L % 2 == 0) L /= 2;
+  while (L % 3 == 0) L /= 3;
+  while (L % 5 == 0) L /= 5;
+  return L == 1;
+}
+
+// Encodes a transport block for every user and adds noise to the coded bits
+void setup_users(uint32_t L_prb) {
+  float   *llr_f = (float*) srslte_vec_malloc(sizeof(float) * MAX_DATA_LEN * 8);
+  uint8_t *q_bits = (uint8_t*) srslte_vec_malloc(MAX_DATA_LEN);
+  uint8_t *g_bits = (uint8_t*) srslte_vec_malloc(MAX_DATA_LEN);
+  float    var = sqrtf(powf(10, -snr_db / 10));
+
+  for (uint32_t u = 0; u < nof_users; u++) {
+    user_t *user = &users[u];
+    srslte_ra_ul_dci_t dci;
+    bzero(&dci, sizeof(srslte_ra_ul_dci_t));
+    dci.freq_hop_fl          = srslte_ra_ul_dci_t::SRSLTE_RA_PUSCH_HOP_DISABLED;
+    dci.type2_alloc.RB_start = u * L_prb;
+    dci.type2_alloc.L_crb    = L_prb;
+    dci.mcs_idx              = mcs;
+
+    bzero(&user->cfg, sizeof(srslte_pusch_cfg_t));
+    if (srslte_ra_ul_dci_to_grant(&dci, nof_prb, 0, &user->cfg.grant)) {
+      fprintf(stderr, "Error computing grant of %d PRB\n", L_prb);
+      exit(-1);
+    }
+    srslte_ra_ul_grant_to_nbits(&user->cfg.grant, SRSLTE_CP_NORM, 0, &user->cfg.nbits);
+    if (srslte_cbsegm(&user->cfg.cb_segm, user->cfg.grant.mcs.tbs)) {
+      fprintf(stderr, "Error computing code block segmentation\n");
+      exit(-1);
+    }
+
+    for (uint32_t i = 0; i < (uint32_t) user->cfg.grant.mcs.tbs / 8; i++) {
+      user->data_tx[i] = (uint8_t) rand();
+    }
+    bzero(q_bits, MAX_DATA_LEN);
+    srslte_softbuffer_tx_reset(&softbuffer_tx);
+    if (srslte_ulsch_encode(&sch_tx, &user->cfg, &softbuffer_tx, user->data_tx, g_bits, q_bits)) {
+      fprintf(stderr, "Error encoding UL-SCH\n");
+      exit(-1);
+    }
+
+    uint32_t nof_bits = user->cfg.nbits.nof_bits;
+    for (uint32_t i = 0; i < nof_bits; i++) {
+      llr_f[i] = (q_bits[i / 8] & (1 << (7 - i % 8))) ? 1 : -1;
+    }
+    srslte_ch_awgn_f(llr_f, llr_f, var, nof_bits);
+    for (uint32_t i = 0; i < nof_bits; i++) {
+      user->llr[i] = (int16_t) (LLR_SCALE * llr_f[i]);
+    }
+  }
+  free(llr_f);
+  free(q_bits);
+  free(g_bits);
+}
+
+// Decodes all the users of a subframe. Returns the number of correct transport blocks
+uint32_t decode_subframe(uint32_t *mismatch) {
+  uint32_t nof_ok = 0;
+  for (uint32_t u = 0; u < nof_users; u++) {
+    users[u].tb.pending = false;
+  }
+  for (uint32_t u = 0; u < nof_users; u++) {
+    user_t *user = &users[u];
+    srslte_softbuffer_rx_reset(&user->softbuffer);
+    if (pool) {
+      srslte_sch_set_async(&sch_rx, &executor, &user->tb);
+    }
+    int ret = srslte_ulsch_decode(&sch_rx, &user->cfg, &user->softbuffer, user->llr, user->g_bits, user->data_rx);
+    if (!pool && !ret) {
+      nof_ok++;
+    }
+  }
+  srslte_sch_set_async(&sch_rx, NULL, NULL);
+  if (pool) {
+    pool->wait(helper_slot, &group);
+    for (uint32_t u = 0; u < nof_users; u++) {
+      if (users[u].tb.pending && !srslte_sch_tb_finish(&sch_rx, &users[u].tb)) {
+        nof_ok++;
+      }
+    }
+  }
+  for (uint32_t u = 0; u < nof_users; u++) {
+    if (users[u].softbuffer.tb_crc && memcmp(users[u].data_tx, users[u].data_rx, users[u].cfg.grant.mcs.tbs / 8)) {
+      (*mismatch)++;
+    }
+  }
+  return nof_ok;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  if (nof_users == 0 || nof_users > nof_prb) {
+    fprintf(stderr, "Invalid number of users\n");
+    exit(-1);
+  }
+  if (srslte_sch_init(&sch_tx) || srslte_sch_init(&sch_rx)) {
+    fprintf(stderr, "Error initiating SCH\n");
+    exit(-1);
+  }
+  srslte_sch_set_max_noi(&sch_rx, max_its);
+  if (srslte_softbuffer_tx_init(&softbuffer_tx, nof_prb)) {
+    fprintf(stderr, "Error initiating soft buffer\n");
+    exit(-1);
+  }
+  users.resize(nof_users);
+  for (uint32_t u = 0; u < nof_users; u++) {
+    if (srslte_softbuffer_rx_init(&users[u].softbuffer, nof_prb)) {
+      fprintf(stderr, "Error initiating soft buffer\n");
+      exit(-1);
+    }
+    users[u].data_tx = (uint8_t*) srslte_vec_malloc(MAX_DATA_LEN);
+    users[u].data_rx = (uint8_t*) srslte_vec_malloc(MAX_DATA_LEN);
+    users[u].llr     = (int16_t*) srslte_vec_malloc(sizeof(int16_t) * MAX_DATA_LEN * 8);
+    users[u].g_bits  = (int16_t*) srslte_vec_malloc(sizeof(int16_t) * MAX_DATA_LEN * 8);
+  }
+
+  // Loads to measure, growing by at least 25%
+  std::vector<uint32_t> prb_per_user;
+  for (uint32_t L = 1; L * nof_users <= nof_prb; L++) {
+    if (valid_prb(L) && (prb_per_user.empty() || L * 4 >= prb_per_user.back() * 5)) {
+      prb_per_user.push_back(L);
+    }
+  }
+
+  printf("%d PRB cell, %d users per subframe, MCS %d, %d iterations, SNR %.1f dB, %d subframes per load\n",
+         nof_prb, nof_users, mcs, max_its, snr_db, nof_subframes);
+  printf("%7s %6s %8s %9s %9s %6s\n", "threads", "PRB", "CBs", "p50 us", "p99 us", "CRC OK");
+
+  // Correct transport blocks for each load without threads, others must match
+  std::vector<int>      nof_ok_serial(prb_per_user.size(), -1);
+  std::vector<uint32_t> max_load(max_threads + 1, 0);
+  std::vector<double>   max_rate(max_threads + 1, 0);
+  uint32_t              mismatch = 0;
+  bool                  differ   = false;
+
+  for (uint32_t nof_threads = 0; nof_threads <= max_threads; nof_threads++) {
+    if (nof_threads > 0) {
+      pool = new srslte::task_pool;
+      pool->init(nof_threads, 1);
+      helper_slot = pool->get_helper_slot(0);
+      decoders.resize(pool->get_nof_slots());
+      for (uint32_t i = 0; i < decoders.size(); i++) {
+        srslte_sch_cb_decoder_init(&decoders[i]);
+      }
+    }
+
+    srand(0);
+    for (uint32_t l = 0; l < prb_per_user.size(); l++) {
+      setup_users(prb_per_user[l]);
+
+      std::vector<uint64_t> elapsed;
+      uint32_t nof_ok = 0;
+      for (uint32_t sf = 0; sf < nof_subframes; sf++) {
+        uint64_t t0 = now_ns();
+        nof_ok += decode_subframe(&mismatch);
+        elapsed.push_back(now_ns() - t0);
+      }
+      if (nof_threads == 0) {
+        nof_ok_serial[l] = nof_ok;
+      } else if (nof_ok_serial[l] >= 0 && (int) nof_ok != nof_ok_serial[l]) {
+        differ = true;
+      }
+
+      std::sort(elapsed.begin(), elapsed.end());
+      double   p50  = elapsed[elapsed.size() / 2] / 1000.0;
+      double   p99  = elapsed[(elapsed.size() * 99) / 100] / 1000.0;
+      uint32_t load = prb_per_user[l] * nof_users;
+      printf("%7d %6d %8d %9.1f %9.1f %5.1f%%\n", nof_threads, load, users[0].cfg.cb_segm.C * nof_users,
+             p50, p99, 100.0 * nof_ok / (nof_subframes * nof_users));
+
+      if (p99 <= budget_us) {
+        max_load[nof_threads] = load;
+        max_rate[nof_threads] = load * 1000.0 / p50;
+      } else if (p50 > budget_us) {
+        // Higher loads will not fit either
+        break;
+      }
+    }
+
+    if (pool) {
+      pool->stop();
+      for (uint32_t i = 0; i < decoders.size(); i++) {
+        srslte_sch_cb_decoder_free(&decoders[i]);
+      }
+      decoders.clear();
+      delete pool;
+      pool = NULL;
+    }
+  }
+
+  printf("\nMaximum sustained load within the %d us budget\n", budget_us);
+  printf("%7s %6s %12s\n", "threads", "PRB", "PRB per ms");
+  for (uint32_t nof_threads = 0; nof_threads <= max_threads; nof_threads++) {
+    printf("%7d %6d %12.1f\n", nof_threads, max_load[nof_threads], max_rate[nof_threads]);
+  }
+
+  for (uint32_t u = 0; u < nof_users; u++) {
+    srslte_softbuffer_rx_free(&users[u].softbuffer);
+    free(users[u].data_tx);
+    free(users[u].data_rx);
+    free(users[u].llr);
+    free(users[u].g_bits);
+  }
+  srslte_softbuffer_tx_free(&softbuffer_tx);
+  srslte_sch_free(&sch_tx);
+  srslte_sch_free(&sch_rx);
+
+  if (mismatch || differ) {
+    printf("Decoded data differs (%d wrong transport blocks, CRC OK count %s)\n", mismatch, differ ? "differs" : "matches");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,306 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Pushes a mixed packet size workload (TCP ACKs, signalling sized messages
+ * and full MTU packets) through PDCP -> RLC UM -> MAC -> RLC UM -> PDCP and
+ * reports the resident memory with a burst of SDUs in flight and the
+ * throughput. The SDUs are either taken from the max size class, like all
+ * buffers used to be, or from the smallest size class that fits.
+ */
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/log_filter.h"
+#include "srslte/common/buffer_pool.h"
+#include "srslte/upper/pdcp_entity.h"
+#include "srslte/upper/rlc.h"
+
+#define LCID 3
+#define RLC_QUEUE_CHUNK 64 // below the RLC SDU queue length
+
+using namespace srsue;
+using namespace srslte;
+
+static uint32_t nof_bursts = 50;
+static uint32_t burst_size = 1000;
+static uint32_t grant_size = 1500;
+static bool     size_classes = true;
+
+static const uint32_t sdu_sizes[] = {40, 40, 40, 40, 52, 120, 300, 1400, 1400, 1400};
+static const uint32_t nof_sdu_sizes = sizeof(sdu_sizes) / sizeof(uint32_t);
+
+void usage(char *prog) {
+  printf("Usage: %s [nbgm]\n", prog);
+  printf("\t-n number of bursts [Default %d]\n", nof_bursts);
+  printf("\t-b SDUs per burst [Default %d]\n", burst_size);
+  printf("\t-g MAC grant size in bytes [Default %d]\n", grant_size);
+  printf("\t-m allocate SDUs by size class (1) or at max size (0) [Default %d]\n", size_classes);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nbgm")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_bursts = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'b':
+        burst_size = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'g':
+        grant_size = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'm':
+        size_classes = atoi(argv[optind]) != 0;
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+uint32_t get_rss_kb() {
+  unsigned long size = 0, resident = 0;
+  FILE *f = fopen("/proc/self/statm", "r");
+  if (f) {
+    if (fscanf(f, "%lu %lu", &size, &resident) != 2) {
+      resident = 0;
+    }
+    fclose(f);
+  }
+  return (uint32_t) (resident * sysconf(_SC_PAGESIZE) / 1024);
+}
+
+class mac_dummy_timers
+    :public srslte::mac_interface_timers
+{
+public:
+  mac_dummy_timers() : timers(8) {}
+  srslte::timers::timer* timer_get(uint32_t timer_id) {
+    return timers.get(timer_id);
+  }
+  void timer_release_id(uint32_t timer_id) {
+    timers.release_id(timer_id);
+  }
+  uint32_t timer_get_unique_id() {
+    return timers.get_unique_id();
+  }
+  void step_all() {
+    timers.step_all();
+  }
+private:
+  srslte::timers timers;
+};
+
+// Connects an RLC instance with a PDCP entity and sinks the received SDUs
+class pdcp_gw_tester
+    :public pdcp_interface_rlc
+    ,public rrc_interface_rlc
+    ,public rrc_interface_pdcp
+{
+public:
+  pdcp_gw_tester() : pdcp(NULL), nof_sdus(0), nof_bytes(0) {}
+
+  // PDCP interface for RLC, forwarded to the entity
+  void write_pdu(uint32_t lcid, byte_buffer_t *pdu) {
+    pdcp->write_pdu(pdu);
+  }
+  void write_pdu_bcch_bch(byte_buffer_t *sdu) {}
+  void write_pdu_bcch_dlsch(byte_buffer_t *sdu) {}
+  void write_pdu_pcch(byte_buffer_t *sdu) {}
+  void write_pdu_mch(uint32_t lcid, byte_buffer_t *sdu) {}
+
+  // GW interface for PDCP
+  void gw_write_pdu(byte_buffer_t *sdu) {
+    nof_sdus++;
+    nof_bytes += sdu->N_bytes;
+    byte_buffer_pool::get_instance()->deallocate(sdu);
+  }
+
+  // RRC interface
+  void max_retx_attempted() {}
+  std::string get_rb_name(uint32_t lcid) { return std::string("DRB1"); }
+
+  pdcp_entity *pdcp;
+  uint64_t     nof_sdus;
+  uint64_t     nof_bytes;
+};
+
+// gw_interface_pdcp and pdcp_interface_rlc both have write_pdu(), so the GW is separate
+class gw_sink : public gw_interface_pdcp
+{
+public:
+  gw_sink(pdcp_gw_tester *tester_) : tester(tester_) {}
+  void write_pdu(uint32_t lcid, byte_buffer_t *pdu) { tester->gw_write_pdu(pdu); }
+  void write_pdu_mch(uint32_t lcid, byte_buffer_t *pdu) { tester->gw_write_pdu(pdu); }
+private:
+  pdcp_gw_tester *tester;
+};
+
+// A copy into a smaller size class must either carry the whole payload or leave the buffer empty
+bool test_copy_size_classes(byte_buffer_pool *pool) {
+  byte_buffer_t *large = pool->allocate();
+  byte_buffer_t *small = pool->allocate_bytes(sdu_sizes[0]);
+  bool ok = large != NULL && small != NULL && small->get_capacity() == SRSLTE_SMALL_BUFFER_SIZE_BYTES;
+  if (ok) {
+    for (uint32_t i = 0; i < 1400; i++) {
+      large->msg[i] = (uint8_t) i;
+    }
+    large->N_bytes = 300;
+    *small = *large;
+    ok = small->N_bytes == 300 && !memcmp(small->msg, large->msg, 300);
+    large->N_bytes = 1400;
+    *small = *large;
+    ok = ok && small->N_bytes == 0;
+  }
+  pool->deallocate(large);
+  pool->deallocate(small);
+  return ok;
+}
+
+// Only the max size class may be handed to the liblte codecs
+bool test_liblte_msg_size_classes(byte_buffer_pool *pool) {
+  byte_buffer_t *large = pool->allocate();
+  byte_buffer_t *small = pool->allocate_bytes(sdu_sizes[0]);
+  bool ok = large != NULL && small != NULL && large->liblte_msg() != NULL && small->liblte_msg() == NULL;
+  pool->deallocate(large);
+  pool->deallocate(small);
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  byte_buffer_pool *pool = byte_buffer_pool::get_instance();
+  if (!test_copy_size_classes(pool)) {
+    printf("Failed copying between size classes\n");
+    exit(1);
+  }
+  if (!test_liblte_msg_size_classes(pool)) {
+    printf("Failed checking the liblte message size\n");
+    exit(1);
+  }
+  srslte::log_filter log1("RLC_1");
+  srslte::log_filter log2("RLC_2");
+  log1.set_level(srslte::LOG_LEVEL_ERROR);
+  log2.set_level(srslte::LOG_LEVEL_ERROR);
+  mac_dummy_timers timers;
+
+  pdcp_gw_tester tx_tester, rx_tester;
+  gw_sink        tx_gw(&tx_tester), rx_gw(&rx_tester);
+  rlc            rlc_tx, rlc_rx;
+  pdcp_entity    pdcp_tx, pdcp_rx;
+
+  srslte_rlc_config_t cnfg;
+  cnfg.rlc_mode = RLC_MODE_UM;
+  cnfg.um.t_reordering = 5;
+  cnfg.um.rx_mod = 1024;
+  cnfg.um.rx_sn_field_length = RLC_UMD_SN_SIZE_10_BITS;
+  cnfg.um.rx_window_size = 512;
+  cnfg.um.tx_sn_field_length = RLC_UMD_SN_SIZE_10_BITS;
+  cnfg.um.tx_mod = 1024;
+
+  rlc_tx.init(&tx_tester, &tx_tester, NULL, &log1, &timers, 0);
+  rlc_rx.init(&rx_tester, &rx_tester, NULL, &log2, &timers, 0);
+  rlc_tx.add_bearer(LCID, cnfg);
+  rlc_rx.add_bearer(LCID, cnfg);
+
+  srslte_pdcp_config_t pdcp_cnfg(false, true);
+  pdcp_tx.init(&rlc_tx, &tx_tester, &tx_gw, &log1, LCID, pdcp_cnfg);
+  pdcp_rx.init(&rlc_rx, &rx_tester, &rx_gw, &log2, LCID, pdcp_cnfg);
+  tx_tester.pdcp = &pdcp_tx;
+  rx_tester.pdcp = &pdcp_rx;
+
+  uint8_t *mac_pdu = new uint8_t[grant_size];
+  byte_buffer_t **burst = new byte_buffer_t*[burst_size];
+  uint32_t rss_base = get_rss_kb();
+  uint32_t rss_peak = rss_base;
+  uint64_t nof_tx_bytes = 0;
+  uint32_t sdu_idx = 0;
+  struct timeval t[3];
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t n = 0; n < nof_bursts; n++) {
+    // a burst of SDUs held in flight, as when queued in PDCP/RLC
+    for (uint32_t i = 0; i < burst_size; i++) {
+      uint32_t len = sdu_sizes[sdu_idx++ % nof_sdu_sizes];
+      byte_buffer_t *sdu = size_classes ? pool->allocate_bytes(len) : pool->allocate();
+      if (sdu == NULL) {
+        printf("Failed to allocate SDU\n");
+        exit(1);
+      }
+      memset(sdu->msg, (uint8_t) i, len);
+      sdu->N_bytes = len;
+      nof_tx_bytes += len;
+      burst[i] = sdu;
+    }
+    uint32_t rss = get_rss_kb();
+    if (rss > rss_peak) {
+      rss_peak = rss;
+    }
+
+    // feed the burst without overflowing the RLC queue and drain it through MAC sized grants
+    for (uint32_t i = 0; i < burst_size; i++) {
+      pdcp_tx.write_sdu(burst[i], true);
+      if ((i + 1) % RLC_QUEUE_CHUNK == 0 || i + 1 == burst_size) {
+        while (rlc_tx.get_buffer_state(LCID) > 0) {
+          int len = rlc_tx.read_pdu(LCID, mac_pdu, grant_size);
+          if (len > 0) {
+            rlc_rx.write_pdu(LCID, mac_pdu, (uint32_t) len);
+          }
+        }
+      }
+    }
+    timers.step_all();
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double elapsed_us = t[0].tv_sec * 1e6 + t[0].tv_usec;
+  printf("SDUs by %s: tx=%ld rx=%ld SDUs, %.1f Mbps, %.2f Mpps\n",
+         size_classes ? "size class" : "max size",
+         (long) nof_bursts * burst_size, (long) rx_tester.nof_sdus,
+         (double) nof_tx_bytes * 8 / elapsed_us, nof_bursts * burst_size / elapsed_us);
+  printf("RSS: %d kB before, %d kB peak with %d SDUs in flight\n", rss_base, rss_peak, burst_size);
+
+  delete [] mac_pdu;
+  delete [] burst;
+  rlc_tx.stop();
+  rlc_rx.stop();
+  byte_buffer_pool::cleanup();
+
+  if (rx_tester.nof_sdus != (uint64_t) nof_bursts * burst_size) {
+    printf("Failed: %ld SDUs lost\n", (long) nof_bursts * burst_size - (long) rx_tester.nof_sdus);
+    exit(1);
+  }
+  printf("Passed\n");
+  exit(0);
+}
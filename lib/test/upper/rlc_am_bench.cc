@@ -0,0 +1,267 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/log_filter.h"
+#include "srslte/upper/rlc_am.h"
+
+/* Throughput of a pair of RLC AM entities connected back to back, in SDUs/s
+ * and Mbps of SDU payload on a single core. Each iteration is one TTI: the
+ * transmitter fills a number of MAC grants, the PDUs are dropped with the
+ * given probability in both directions, the receiver answers with a status
+ * PDU and the timers are stepped. SDUs must be delivered in order and intact.
+ */
+
+using namespace srsue;
+using namespace srslte;
+
+uint32_t nof_sdus     = 100000;
+uint32_t sdu_size     = 1500;
+float    loss_rate    = 0.0;
+uint32_t grant_size   = 1500;
+uint32_t nof_grants   = 10;
+
+#define MAX_TTIS_WITHOUT_SDU 1000
+
+void usage(char *prog) {
+  printf("Usage: %s [nslgp]\n", prog);
+  printf("\t-n number of SDUs [Default %d]\n", nof_sdus);
+  printf("\t-s SDU size in bytes [Default %d]\n", sdu_size);
+  printf("\t-l PDU loss rate in %% [Default %.1f]\n", loss_rate);
+  printf("\t-g MAC grant size in bytes [Default %d]\n", grant_size);
+  printf("\t-p number of grants per TTI [Default %d]\n", nof_grants);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nslgp")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_sdus = atoi(argv[optind]);
+      break;
+    case 's':
+      sdu_size = atoi(argv[optind]);
+      break;
+    case 'l':
+      loss_rate = atof(argv[optind]);
+      break;
+    case 'g':
+      grant_size = atoi(argv[optind]);
+      break;
+    case 'p':
+      nof_grants = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (sdu_size < 4 || sdu_size > RLC_MAX_SDU_SIZE) {
+    sdu_size = 1500;
+  }
+  if (grant_size < 8 || grant_size > SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET) {
+    grant_size = 1500;
+  }
+}
+
+class mac_dummy_timers
+    :public srslte::mac_interface_timers
+{
+public:
+  mac_dummy_timers() : timers(8) {}
+  srslte::timers::timer* timer_get(uint32_t timer_id) {
+    return timers.get(timer_id);
+  }
+  void timer_release_id(uint32_t timer_id) {
+    timers.release_id(timer_id);
+  }
+  uint32_t timer_get_unique_id() {
+    return timers.get_unique_id();
+  }
+  void step_all() {
+    timers.step_all();
+  }
+private:
+  srslte::timers timers;
+};
+
+// Checks that the SDUs, which carry their sequence number, arrive in order
+class rlc_am_sink
+    :public pdcp_interface_rlc
+    ,public rrc_interface_rlc
+{
+public:
+  rlc_am_sink() : nof_rx_sdus(0), nof_rx_bytes(0), nof_errors(0), nof_max_retx(0) {}
+
+  // PDCP interface
+  void write_pdu(uint32_t lcid, byte_buffer_t *sdu)
+  {
+    uint32_t sn = 0;
+    if (sdu->N_bytes == sdu_size) {
+      memcpy(&sn, sdu->msg, sizeof(uint32_t));
+    }
+    if (sdu->N_bytes != sdu_size || sn != nof_rx_sdus) {
+      if (nof_errors == 0) {
+        fprintf(stderr, "Received SDU %d (%d B), expected SDU %d (%d B)\n", sn, sdu->N_bytes, nof_rx_sdus, sdu_size);
+      }
+      nof_errors++;
+    }
+    nof_rx_sdus++;
+    nof_rx_bytes += sdu->N_bytes;
+    byte_buffer_pool::get_instance()->deallocate(sdu);
+  }
+  void write_pdu_bcch_bch(byte_buffer_t *sdu) {}
+  void write_pdu_bcch_dlsch(byte_buffer_t *sdu) {}
+  void write_pdu_pcch(byte_buffer_t *sdu) {}
+  void write_pdu_mch(uint32_t lcid, srslte::byte_buffer_t *pdu) {}
+
+  // RRC interface
+  void max_retx_attempted() { nof_max_retx++; }
+  std::string get_rb_name(uint32_t lcid) { return std::string("DRB1"); }
+
+  uint32_t nof_rx_sdus;
+  uint64_t nof_rx_bytes;
+  uint32_t nof_errors;
+  uint32_t nof_max_retx;
+};
+
+bool pdu_lost() {
+  return loss_rate > 0 && rand() < (loss_rate / 100) * RAND_MAX;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  srand(0);
+
+  srslte::log_filter log1("RLC_AM_1");
+  srslte::log_filter log2("RLC_AM_2");
+  log1.set_level(srslte::LOG_LEVEL_ERROR);
+  log2.set_level(srslte::LOG_LEVEL_ERROR);
+  rlc_am_sink      sink;
+  mac_dummy_timers timers;
+
+  rlc_am rlc1;
+  rlc_am rlc2;
+  rlc1.init(&log1, 1, &sink, &sink, &timers);
+  rlc2.init(&log2, 1, &sink, &sink, &timers);
+
+  LIBLTE_RRC_RLC_CONFIG_STRUCT cnfg;
+  cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
+  cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS35;
+  cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS0;
+  cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T32;
+  cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
+  cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS45;
+  if (not rlc1.configure(&cnfg) || not rlc2.configure(&cnfg)) {
+    fprintf(stderr, "Error configuring RLC AM\n");
+    exit(-1);
+  }
+
+  byte_buffer_pool *pool         = byte_buffer_pool::get_instance();
+  uint8_t           pdu[SRSLTE_MAX_BUFFER_SIZE_BYTES];
+  uint32_t          nof_tx_sdus  = 0;
+  uint32_t          nof_tx_pdus  = 0;
+  uint32_t          nof_lost     = 0;
+  uint32_t          tti          = 0;
+  uint32_t          last_rx_tti  = 0;
+  uint32_t          last_rx_sdus = 0;
+  struct timeval    t[3];
+
+  gettimeofday(&t[1], NULL);
+  while (sink.nof_rx_sdus < nof_sdus) {
+    // Keep enough SDUs queued to fill all the grants of the TTI. The queue is
+    // never drained, so that the throughput is measured in steady state.
+    while (rlc1.get_total_buffer_state() < 2 * nof_grants * grant_size) {
+      byte_buffer_t *sdu = pool_allocate_blocking;
+      if (sdu == NULL) {
+        break;
+      }
+      memset(sdu->msg, 0, sdu_size);
+      memcpy(sdu->msg, &nof_tx_sdus, sizeof(uint32_t));
+      sdu->N_bytes = sdu_size;
+      rlc1.write_sdu(sdu);
+      nof_tx_sdus++;
+    }
+
+    // Data PDUs from RLC1 to RLC2
+    for (uint32_t i = 0; i < nof_grants; i++) {
+      int len = rlc1.read_pdu(pdu, grant_size);
+      if (len <= 0) {
+        break;
+      }
+      nof_tx_pdus++;
+      if (pdu_lost()) {
+        nof_lost++;
+      } else {
+        rlc2.write_pdu(pdu, len);
+      }
+    }
+
+    // Status PDUs from RLC2 to RLC1
+    int len = rlc2.read_pdu(pdu, grant_size);
+    if (len > 0) {
+      if (pdu_lost()) {
+        nof_lost++;
+      } else {
+        rlc1.write_pdu(pdu, len);
+      }
+    }
+
+    timers.step_all();
+    tti++;
+
+    if (sink.nof_rx_sdus != last_rx_sdus) {
+      last_rx_sdus = sink.nof_rx_sdus;
+      last_rx_tti  = tti;
+    } else if (tti - last_rx_tti > MAX_TTIS_WITHOUT_SDU) {
+      fprintf(stderr, "No SDU received in %d TTIs\n", MAX_TTIS_WITHOUT_SDU);
+      break;
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double elapsed_us = t[0].tv_sec * 1e6 + t[0].tv_usec;
+  printf("SDU size=%d, grant=%d x %d, loss=%.1f%%: %d SDUs in %d TTIs, %d PDUs (%d lost)\n",
+         sdu_size, grant_size, nof_grants, loss_rate, sink.nof_rx_sdus, tti, nof_tx_pdus, nof_lost);
+  printf("%.1f ms, %.0f SDU/s, %.1f Mbps\n", elapsed_us / 1000, sink.nof_rx_sdus * 1e6 / elapsed_us,
+         sink.nof_rx_bytes * 8 / elapsed_us);
+
+  rlc1.stop();
+  rlc2.stop();
+  pool->cleanup();
+
+  if (sink.nof_rx_sdus < nof_sdus || sink.nof_errors || sink.nof_max_retx) {
+    printf("Error: %d SDUs received, %d wrong, %d max retx\n", sink.nof_rx_sdus, sink.nof_errors, sink.nof_max_retx);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
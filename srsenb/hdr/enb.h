@@ -57,6 +57,7 @@
 #include "srslte/common/buffer_pool.h"
 #include "srslte/interfaces/ue_interfaces.h"
 #include "srslte/common/logger_file.h"
+#include "srslte/common/logger_binary.h"
 #include "srslte/common/log_filter.h"
 #include "srslte/common/mac_pcap.h"
 #include "srslte/interfaces/sched_interface.h"
@@ -102,6 +103,8 @@ typedef struct {
 typedef struct {
   bool          enable;
   std::string   filename;
+  int           file_max_size;
+  int           file_max_time;
 }pcap_args_t;
 
 typedef struct {
@@ -125,6 +128,7 @@ typedef struct {
   int           agent_hex_limit;
   int           all_hex_limit;
   int           file_max_size;
+  bool          binary;
   std::string   filename;
 }log_args_t;
 
@@ -139,6 +143,7 @@ typedef struct {
   float      metrics_period_secs;
   bool       enable_mbsfn;
   bool       print_buffer_state;
+  uint32_t   gtpu_batch_size;
   std::string m1u_multiaddr;
   std::string m1u_if_addr;
 }expert_args_t;
@@ -211,6 +216,7 @@ private:
   
   srslte::logger_stdout logger_stdout;
   srslte::logger_file   logger_file;
+  srslte::logger_binary logger_binary;
   srslte::logger        *logger;
 
   srslte::log_filter  rf_log;
@@ -29,6 +29,7 @@
 
 #include <vector>
 #include "srslte/common/log.h"
+#include "srslte/common/rnti_table.h"
 #include "srslte/common/timers.h"
 #include "srslte/interfaces/enb_interfaces.h"
 #include "srslte/interfaces/sched_interface.h"
@@ -40,6 +41,7 @@
 #include "scheduler_metric.h"
 #include "srslte/interfaces/enb_metrics_interface.h"
 #include "ue.h"
+#include "softbuffer_pool.h"
 
 #ifdef HAVE_RAN_SLICER
 #include "srsenb/hdr/mac/scheduler_RAN.h"
@@ -50,12 +52,14 @@ namespace srsenb {
 class pdu_process_handler
 {
 public: 
-  virtual bool process_pdus() = 0; 
+  virtual bool process_pdus(uint32_t shard) = 0; 
 };
 
 typedef struct {
   sched_interface::sched_args_t sched; 
   int link_failure_nof_err; 
+  int softbuffer_pool_nof_tb;
+  int nof_pdu_threads;
 } mac_args_t; 
 
 class mac
@@ -131,7 +135,8 @@ public:
   // Get a slice MAC details
   int  get_slice(uint64_t id, mac_set_slice_args * args);
 
-  bool process_pdus(); 
+  // Processes the UL PDUs of the users of one shard, see pdu_shard()
+  bool process_pdus(uint32_t shard); 
 
   // Interface for upper-layer timers
   srslte::timers::timer*   timer_get(uint32_t timer_id);
@@ -140,6 +145,7 @@ public:
 
   uint32_t get_current_tti();
   void get_metrics(mac_metrics_t metrics[ENB_METRICS_MAX_USERS]);
+  void get_softbuffer_metrics(mac_softbuffer_metrics_t *metrics);
   void write_mcch(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT *sib2, LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT *sib13, LIBLTE_RRC_MCCH_MSG_STRUCT *mcch);
 private:  
 
@@ -148,6 +154,7 @@ private:
   srslte_dci_location_t locations[MAX_LOCATIONS];
   
   static const int MAC_PDU_THREAD_PRIO  = 60;
+  static const int MAX_PDU_THREADS      = 16;
 
   // We use a rwlock in MAC to allow multiple workers to access MAC simultaneously. No conflicts will happen since access for different TTIs
   pthread_rwlock_t rwlock;
@@ -170,18 +177,24 @@ private:
 #if HAVE_RAN_SLICER
   /* I keep the same name to preserve any reference around */
   dl_metric_ran    sched_metric_dl_ran;
+  ul_metric_ran    sched_metric_ul_ran;
 #else /* HAVE_RAN_SLICER */
   dl_metric_rr     sched_metric_dl_rr;
-#endif /* HAVE_RAN_SLICER */
   ul_metric_rr     sched_metric_ul_rr;
+#endif /* HAVE_RAN_SLICER */
   sched_interface::cell_cfg_t cell_config;
   
   
   sched_interface::dl_pdu_mch_t mch;
   
   
+  /* HARQ soft storage shared by all UEs */
+  softbuffer_pool softbuffers;
+  const static int      SOFTBUFFER_POOL_DEFAULT_NOF_TB = 64;
+  const static uint32_t SOFTBUFFER_SWEEP_PERIOD        = 40;
+
   /* Map of active UEs */
-  std::map<uint16_t, ue*> ue_db;   
+  srslte::rnti_table<ue*> ue_db;
   uint16_t        last_rnti;   
   
   uint8_t* assemble_rar(sched_interface::dl_sched_rar_grant_t *grants, uint32_t nof_grants, int rar_idx, uint32_t pdu_len);
@@ -244,7 +257,7 @@ private:
   /* Class to process MAC PDUs from DEMUX unit */
   class pdu_process : public thread {
   public: 
-    pdu_process(pdu_process_handler *h);
+    pdu_process(pdu_process_handler *h, uint32_t shard);
     void notify();
     void stop();
   private:
@@ -254,8 +267,12 @@ private:
     pthread_mutex_t mutex;
     pthread_cond_t  cvar;
     pdu_process_handler *handler; 
+    uint32_t shard;
   };
-  pdu_process pdu_process_thread;
+
+  /* Users are sharded by RNTI between the PDU threads, so the PDUs of a user are processed in order */
+  std::vector<pdu_process*> pdu_process_threads;
+  uint32_t pdu_shard(uint16_t rnti);
   
 };
 
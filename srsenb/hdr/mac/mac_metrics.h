@@ -49,6 +49,19 @@ struct mac_metrics_t
   float phr; 
 };
 
+// Occupancy of the cell-wide HARQ softbuffer pool, in code blocks
+
+struct mac_softbuffer_metrics_t
+{
+  uint32_t nof_cb;
+  uint32_t rx_cb_used;
+  uint32_t rx_cb_peak;
+  uint32_t tx_cb_used;
+  uint32_t tx_cb_peak;
+  uint32_t nof_leases;
+  uint32_t nof_lease_fail;
+};
+
 } // namespace srsenb
 
 #endif // SRSENB_MAC_METRICS_H
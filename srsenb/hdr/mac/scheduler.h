@@ -29,6 +29,7 @@
 
 #include <map>
 #include "srslte/common/log.h"
+#include "srslte/common/rnti_table.h"
 #include "srslte/interfaces/enb_interfaces.h"
 #include "srslte/interfaces/sched_interface.h"
 #include "scheduler_ue.h"
@@ -37,6 +38,9 @@
 
 namespace srsenb {
 
+// Users of the scheduler, indexed by RNTI
+typedef srslte::rnti_table<sched_ue> sched_ue_db_t;
+
 
 /* Caution: User addition (ue_cfg) and removal (ue_rem) are not thread-safe
  * Rest of operations are thread-safe
@@ -63,7 +67,7 @@ public:
   public: 
 
     /* Virtual methods for user metric calculation */
-    virtual void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti) = 0;
+    virtual void            new_tti(sched_ue_db_t &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti) = 0;
     virtual dl_harq_proc*   get_user_allocation(sched_ue *user) = 0;
   };
 
@@ -74,7 +78,7 @@ public:
 
     /* Virtual methods for user metric calculation */
     virtual void           reset_allocation(uint32_t nof_rb_) = 0;
-    virtual void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti) = 0;
+    virtual void           new_tti(sched_ue_db_t &ue_db, uint32_t nof_rb, uint32_t tti) = 0;
     virtual ul_harq_proc*  get_user_allocation(sched_ue *user) = 0; 
     virtual bool           update_allocation(ul_harq_proc::ul_alloc_t alloc) = 0;
   };
@@ -190,7 +194,7 @@ private:
   bool generate_dci(srslte_dci_location_t *sched_location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, sched_ue *user = NULL); 
  
 
-  std::map<uint16_t, sched_ue>   ue_db;
+  sched_ue_db_t                  ue_db;
 
   sched_sib_t pending_sibs[MAX_SIBS];
   
@@ -141,6 +141,13 @@ class ran_user_scheduler;
 // Single user of the RAN schedulers
 class ran_mac_user {
 public:
+  ran_mac_user() : 
+    self_m(1), last_seen(0), has_data(0), DL_data(0), DL_data_delta(0),
+    DL_rbg_delta(0), UL_rbg_delta(0), cqi(0), rbg_rate(0), rbg_demand(0)
+  {
+    // Nothing
+  }
+
   // Managend locally by the scheduler
   int      self_m;
 
@@ -156,16 +163,34 @@ public:
   uint32_t DL_data_delta;
   // The amount of PRBG used in DL at MAC level during last TTI
   uint32_t DL_rbg_delta;
+  // The amount of PRB groups used in UL at MAC level during last TTI
+  uint32_t UL_rbg_delta;
+
+  /* Channel state of the user in the direction of the metric which owns this
+   * entry; used by the channel-aware user schedulers.
+   */
+
+  // Last wideband CQI reported by the user
+  uint32_t cqi;
+  // Bytes that the user can carry in a single group at the current CQI
+  uint32_t rbg_rate;
+  // Groups needed to serve the data (new or re-tx) of the user in this TTI
+  uint32_t rbg_demand;
 };
 
 /* Type which describes the map of users information stored by the RAN
  * subsystem.
  */
-typedef std::map<uint16_t, ran_mac_user> user_map_t;
+typedef srslte::rnti_table<ran_mac_user> user_map_t;
 
 // How a Slice is organized for the RAN scheduler logic
 class ran_mac_slice {
 public:
+  ran_mac_slice() : sched_user(0), cfg_version(0)
+  {
+    // Nothing
+  }
+
   // User scheduler associated with this slice
   ran_user_scheduler *    sched_user;
 
@@ -177,7 +202,10 @@ public:
    * and no conflicts happens maybe everything is already managed somewhere in 
    * the code, but worth noticing this in case of future errors.
    */
-  std::map<uint16_t, int> users;
+  srslte::rnti_table<int> users;
+
+  // Version of the configuration whose resources have been applied
+  uint32_t                cfg_version;
 };
 
 /* Type which describes the map of slices information stored by the RAN 
@@ -185,6 +213,34 @@ public:
  */
 typedef std::map<uint64_t, ran_mac_slice> slice_map_t;
 
+// Configuration of a slice, as requested by the control plane
+class ran_slice_cfg {
+public:
+  ran_slice_cfg() : 
+    user_sched(RAN_MAC_USER_RR), time(0), rbg(0), version(0)
+  {
+    // Nothing
+  }
+
+  // ID of the user scheduler of the slice
+  uint32_t                user_sched;
+  // Time resources in TTI, as given to the slice scheduler
+  int                     time;
+  // Physical resources, as given to the slice scheduler
+  int                     rbg;
+  /* Incremented at every set of the slice resources; zero means that the
+   * resources have never been set.
+   */
+  uint32_t                version;
+  // Users of the slice, and if they are locked to its configuration
+  std::map<uint16_t, int> users;
+};
+
+/* Type which describes a whole configuration of the slices. Once published to
+ * the scheduler, an instance is never modified again.
+ */
+typedef std::map<uint64_t, ran_slice_cfg> slice_cfg_map_t;
+
 /******************************************************************************
  *                                                                            *
  * Schedulers shapes for all the algorithms:                                  *
@@ -439,27 +495,100 @@ private:
   uint16_t m_last;
 };
 
+/* Common part of the user schedulers which share the groups of the slice
+ * depending on the channel quality of the users.
+ *
+ * Users are served in order of decreasing metric; every user receives the
+ * next free groups (so they are contiguous if possible) until its demand is
+ * satisfied, then the next user is considered.
+ */
+class ran_rate_usched : public ran_user_scheduler {
+public:
+  ran_rate_usched();
+  virtual ~ran_rate_usched();
+
+  // Schedule the Slice users in decreasing metric order
+  void schedule(
+    const uint32_t  tti,
+    ran_mac_slice * slice,
+    user_map_t *    umap,
+    bool            rbg[RAN_DL_MAX_RGB],
+    uint16_t        ret[RAN_DL_MAX_RGB]);
+
+protected:
+  // Priority of an user in this TTI; the higher the better
+  virtual float metric(uint16_t rnti, ran_mac_user * user) = 0;
+
+  // Feedback on the number of groups given to an user during this TTI
+  virtual void  served(uint16_t rnti, ran_mac_user * user, uint32_t nof_rbg);
+
+  // Forget the state of users which left the slice
+  virtual void  purge(ran_mac_slice * slice);
+
+private:
+  // Last user selected first; used to break ties between equal metrics
+  uint16_t m_last;
+};
+
+// Time constant, in TTIs, of the average throughput of Proportional Fair
+#define RAN_PF_WINDOW       100
+
+// Proportional Fair user scheduler; see source for more info
+class ran_pf_usched : public ran_rate_usched {
+public:
+  ran_pf_usched();
+  ~ran_pf_usched();
+
+protected:
+  float metric(uint16_t rnti, ran_mac_user * user);
+  void  served(uint16_t rnti, ran_mac_user * user, uint32_t nof_rbg);
+  void  purge(ran_mac_slice * slice);
+
+private:
+  // Average throughput of the users, in bytes per TTI
+  srslte::rnti_table<float> m_avg;
+};
+
+// Maximum Carrier over Interference user scheduler; see source for more info
+class ran_mci_usched : public ran_rate_usched {
+public:
+  ran_mci_usched();
+  ~ran_mci_usched();
+
+protected:
+  float metric(uint16_t rnti, ran_mac_user * user);
+};
+
+// Creates an user scheduler given its ID; returns a null pointer if unknown
+ran_user_scheduler * ran_new_usched(uint32_t id);
+
+// Creates a slice scheduler given its ID; returns a null pointer if unknown
+ran_slice_scheduler * ran_new_ssched(uint32_t id, srslte::log * log_handle);
+
 /******************************************************************************
  *                                                                            *
  * RAN metric interface:                                                      *
  *                                                                            *
  ******************************************************************************/
 
-/* DL RAN scheduler for MAC.
+/* Slices and users of a RAN metric, common to DL and UL.
+ *
+ * Each direction owns its own instance, so slice schedulers keep separate
+ * credits and user schedulers keep separate state for DL and UL, while the
+ * MAC configures both through the same calls.
+ *
+ * Configuration calls never touch the maps used by the TTI thread; they publish
+ * a new snapshot of the slices which is applied at the next TTI boundary.
  */
-class dl_metric_ran : public sched::metric_dl
+class ran_metric
 {
 public:
+  ran_metric();
+  ~ran_metric();
 
-#ifdef RAN_TRACE
-  // Data useful for tracing operation of the scheduler
-  rt_data  m_rtd;
-#endif // RAN_TRACE
-
-  dl_metric_ran();
-
-  // Perform initial setup of the scheduler
-  void init(srslte::log * log_handle);
+  // Perform initial setup of the scheduler, with the given slice scheduler
+  void init(
+    srslte::log * log_handle, uint32_t slice_sched = RAN_MAC_SLICE_MULTI);
 
   // Adds a new slice inside the MAC scheduler
   int  add_slice(uint64_t id);
@@ -475,13 +604,87 @@ public:
   uint32_t get_slice_sched_id();
   // Returns information about a slice at MAC layer
   int  get_slice_info(uint64_t id,  mac_set_slice_args * args);
+  // Is the slice configured in the MAC scheduler?
+  bool has_slice(uint64_t id);
+
+protected:
+
+  // Take the last configuration published, if any; called at TTI start
+  void apply_cfg();
+
+  // Add or refresh the entry of an user seen in the current TTI
+  void update_user(
+    uint16_t rnti,
+    int      has_data,
+    uint32_t cqi,
+    uint32_t rbg_rate,
+    uint32_t rbg_demand);
+
+  // Pointer to a loc mechanism to use for feedback
+  srslte::log *          m_log;
+
+  /* Absolute TTI starting from when started; this is an always incresing
+   * value, so consider overflows.
+   */
+  uint32_t               m_tti_abs;
+
+  // Slice scheduler currently running
+  ran_slice_scheduler *  m_slice_sched;
+
+  /* Slice and user maps; they are owned by the thread running the TTIs, and
+   * only change when a new configuration is applied at the TTI boundary.
+   */
+
+  // Slice map
+  slice_map_t            m_slice_map;
+
+  // User map
+  user_map_t             m_user_map;
+
+private:
+
+  // Publish a copy of the control plane configuration to the scheduler
+  void publish_cfg();
+
+  /* Configuration as seen by the control plane, which modifies and queries it
+   * under 'm_cfg_lock'. It is never accessed by the TTI thread.
+   */
+  slice_cfg_map_t        m_cfg;
+  // Last version given to a slice configuration
+  uint32_t               m_cfg_version;
+  // Lock serializing the control plane threads
+  pthread_mutex_t        m_cfg_lock;
+
+  /* Last configuration published and still not taken by the TTI thread. It is
+   * exchanged atomically, so the TTI thread never waits for the control plane
+   * and the snapshot in use is never released under its feet.
+   */
+  slice_cfg_map_t * volatile m_cfg_next;
+};
+
+/* DL RAN scheduler for MAC.
+ */
+class dl_metric_ran : public sched::metric_dl, public ran_metric
+{
+public:
+
+#ifdef RAN_TRACE
+  // Data useful for tracing operation of the scheduler
+  rt_data  m_rtd;
+#endif // RAN_TRACE
+
+  dl_metric_ran();
+
+  // Perform initial setup of the scheduler, with the given slice scheduler
+  void init(
+    srslte::log * log_handle, uint32_t slice_sched = RAN_MAC_SLICE_MULTI);
 
   /*
    * metric_dl inherited functionalities
    */
 
   void new_tti(
-    std::map<uint16_t, sched_ue> &ue_db,
+    sched_ue_db_t &ue_db,
     uint32_t                      start_rbg,
     uint32_t                      nof_rbg,
     uint32_t                      nof_ctrl_symbols,
@@ -491,15 +694,8 @@ public:
 
 private:
 
-  // Pointer to a loc mechanism to use for feedback
-  srslte::log *          m_log;
-
   // Current TTI index
   uint32_t               m_tti;
-  /* Absolute TTI starting from when started; this is an always incresing
-   * value, so consider overflows.
-   */
-  uint32_t               m_tti_abs;
   // The RBG to start consider allocation from (reserved by someone else)
   uint32_t               m_tti_rbg_start;
   // Mask of the available PRBG in the current TTI
@@ -516,15 +712,6 @@ private:
   // size of the RBG
   uint32_t               m_rbg_size;
 
-  // Slice scheduler currently running
-  ran_slice_scheduler *  m_slice_sched;
-
-  // Slice map
-  slice_map_t            m_slice_map;
-
-  // User map
-  user_map_t             m_user_map;
-
   /* Array of TTI PRBG organization per user; OUTPUT of the schedulers.
    * It is filled with the organization, in RNTI terms, of the current subframe.
    */
@@ -533,9 +720,6 @@ private:
   // Number of control symbols
   uint32_t               m_ctrl_sym;
 
-  // Lock synchronizing the criticial parts.
-  pthread_spinlock_t     m_lock;
-
   // Compute RBG mask from array of booleans
   uint32_t calc_rbg_mask(bool mask[RAN_DL_MAX_RGB]);
 
@@ -550,6 +734,69 @@ private:
     uint32_t nof_rbg, bool rbg_mask[RAN_DL_MAX_RGB], uint32_t * final_mask);
 
 }; // class dl_metric_ran
+
+/* UL RAN scheduler for MAC.
+ *
+ * PUSCH PRBs are organized in groups of the same size of the DL RBGs, so the
+ * slice and user schedulers work on the same resource units in both
+ * directions and a slice configuration applies to both of them.
+ */
+class ul_metric_ran : public sched::metric_ul, public ran_metric
+{
+public:
+  ul_metric_ran();
+
+  /*
+   * metric_ul inherited functionalities
+   */
+
+  void reset_allocation(uint32_t nof_rb_);
+
+  void new_tti(
+    sched_ue_db_t &ue_db,
+    uint32_t                      nof_rb,
+    uint32_t                      tti);
+
+  ul_harq_proc * get_user_allocation(sched_ue * user);
+
+  bool update_allocation(ul_harq_proc::ul_alloc_t alloc);
+
+private:
+
+  const static int MAX_PRB = 100;
+
+  // Current TTI index
+  uint32_t               m_tti;
+  // Number of PRB of the UL
+  uint32_t               m_nof_rb;
+  // Number of PRB in a group
+  uint32_t               m_grp_size;
+  // Number of groups in the UL
+  uint32_t               m_nof_grp;
+  // PRB status for the current TTI: 'true' in use, 'false' not used
+  bool                   m_used_rb[MAX_PRB];
+  // Group status for the current TTI: 'true' in use, 'false' not used
+  bool                   m_tti_grp[RAN_DL_MAX_RGB];
+
+  /* Array of TTI PRB groups organization per user; OUTPUT of the schedulers.
+   * It is filled with the organization, in RNTI terms, of the current subframe.
+   */
+  uint16_t               m_tti_users[RAN_DL_MAX_RGB];
+
+  // Check if the PRBs of an allocation are still free
+  bool           allocation_is_valid(ul_harq_proc::ul_alloc_t alloc);
+
+  // Find L contiguous free PRBs inside the groups assigned to an user
+  bool           new_allocation(
+    uint16_t rnti, uint32_t L, ul_harq_proc::ul_alloc_t * alloc);
+
+  // Allocate the pending re-transmission of an user, if any
+  ul_harq_proc * allocate_user_retx_prbs(sched_ue * user);
+
+  // Allocate new data of an user in the groups assigned to it
+  ul_harq_proc * allocate_user_newtx_prbs(sched_ue * user);
+
+}; // class ul_metric_ran
   
 }
 
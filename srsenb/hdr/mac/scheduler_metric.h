@@ -35,7 +35,7 @@ class dl_metric_rr : public sched::metric_dl
 {
 public:
   //interface
-  void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rbg, uint32_t nof_rbg, uint32_t nof_ctrl_symbols, uint32_t tti);
+  void            new_tti(sched_ue_db_t &ue_db, uint32_t start_rbg, uint32_t nof_rbg, uint32_t nof_ctrl_symbols, uint32_t tti);
   dl_harq_proc*   get_user_allocation(sched_ue *user); 
 private:
   
@@ -64,7 +64,7 @@ class ul_metric_rr : public sched::metric_ul
 {
 public:
   // interface
-  void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti);
+  void           new_tti(sched_ue_db_t &ue_db, uint32_t nof_rb, uint32_t tti);
   ul_harq_proc*  get_user_allocation(sched_ue *user); 
   bool           update_allocation(ul_harq_proc::ul_alloc_t alloc);
   void           reset_allocation(uint32_t nof_rb_);
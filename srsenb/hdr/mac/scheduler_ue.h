@@ -106,6 +106,11 @@ public:
   uint32_t   prb_to_rbg(uint32_t nof_prb);
   uint32_t   rgb_to_prb(uint32_t nof_rbg);
 
+  uint32_t   get_dl_cqi();
+  uint32_t   get_ul_cqi();
+  uint32_t   get_achievable_bytes_dl(uint32_t nof_prb, uint32_t nof_ctrl_symbols);
+  uint32_t   get_achievable_bytes_ul(uint32_t nof_prb);
+
 
   uint32_t   get_pending_dl_new_data(uint32_t tti);
   uint32_t   get_pending_ul_new_data(uint32_t tti);
@@ -142,6 +147,8 @@ public:
   bool       get_pucch_sched(uint32_t current_tti, uint32_t prb_idx[2]);
   bool       pucch_sr_collision(uint32_t current_tti, uint32_t n_cce);
 
+  static int cqi_to_tbs(uint32_t cqi, uint32_t nof_prb, uint32_t nof_re, uint32_t max_mcs, uint32_t max_Qm, uint32_t *mcs);
+
 private: 
   
   typedef struct {
@@ -155,7 +162,6 @@ private:
   int        alloc_pdu(int tbs, sched_interface::dl_sched_pdu_t* pdu);
 
   static uint32_t format1_count_prb(uint32_t bitmask, uint32_t cell_nof_prb); 
-  static int cqi_to_tbs(uint32_t cqi, uint32_t nof_prb, uint32_t nof_re, uint32_t max_mcs, uint32_t max_Qm, uint32_t *mcs);
   int alloc_tbs_dl(uint32_t nof_prb, uint32_t nof_re, uint32_t req_bytes, int *mcs);
   int alloc_tbs_ul(uint32_t nof_prb, uint32_t nof_re, uint32_t req_bytes, int *mcs);
   int alloc_tbs(uint32_t nof_prb, uint32_t nof_re, uint32_t req_bytes, bool is_ul, int *mcs);
@@ -0,0 +1,96 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        softbuffer_pool.h
+ * Description: Cell-wide pool of HARQ soft storage. UE softbuffers only own
+ *              their code block tables, the soft storage of each code block
+ *              is leased from the pool when a transport block is scheduled
+ *              and returned when it is acknowledged. Leases are sized to the
+ *              number of code blocks of the TBS. A lease fails, and the
+ *              softbuffer is left without storage, when the pool is exhausted.
+ *****************************************************************************/
+
+#ifndef SRSENB_SOFTBUFFER_POOL_H
+#define SRSENB_SOFTBUFFER_POOL_H
+
+#include <pthread.h>
+#include <vector>
+#include "srslte/phy/fec/softbuffer.h"
+#include "srsenb/hdr/mac/mac_metrics.h"
+
+namespace srsenb {
+
+class softbuffer_pool
+{
+public:
+  softbuffer_pool();
+  ~softbuffer_pool();
+
+  // Allocates storage for nof_tb transport blocks of the largest TBS of the cell, per direction
+  bool     init(uint32_t nof_prb, uint32_t nof_tb);
+  void     stop();
+  uint32_t get_max_cb();
+
+  // Allocate and free the code block tables of a softbuffer, no storage is attached
+  bool     init_rx(srslte_softbuffer_rx_t *q);
+  void     free_rx(srslte_softbuffer_rx_t *q);
+  bool     init_tx(srslte_softbuffer_tx_t *q);
+  void     free_tx(srslte_softbuffer_tx_t *q);
+
+  // Attach (and reset) storage for a transport block of tbs bits, a previous lease is returned first
+  bool     lease_rx(srslte_softbuffer_rx_t *q, uint32_t tbs);
+  void     release_rx(srslte_softbuffer_rx_t *q);
+  bool     lease_tx(srslte_softbuffer_tx_t *q, uint32_t tbs);
+  void     release_tx(srslte_softbuffer_tx_t *q);
+
+  // Current occupancy. Peaks and lease counters restart on every read
+  void     get_metrics(mac_softbuffer_metrics_t *metrics);
+
+private:
+  static uint32_t nof_cb_from_tbs(uint32_t tbs);
+
+  static const uint32_t RX_DATA_LEN = 6144/8;
+
+  pthread_mutex_t       mutex;
+  uint32_t              max_cb;
+  uint32_t              nof_cb;
+
+  int16_t              *rx_buffer_f;
+  uint8_t              *rx_data;
+  uint8_t              *tx_buffer_b;
+  std::vector<uint32_t> rx_free;
+  std::vector<uint32_t> tx_free;
+
+  uint32_t              rx_peak;
+  uint32_t              tx_peak;
+  uint32_t              nof_leases;
+  uint32_t              nof_lease_fail;
+};
+
+} // namespace srsenb
+
+#endif // SRSENB_SOFTBUFFER_POOL_H
@@ -35,6 +35,7 @@
 #include "srslte/interfaces/sched_interface.h"
 #include <pthread.h>
 #include "mac_metrics.h"
+#include "softbuffer_pool.h"
 
 namespace srsenb {
   
@@ -55,6 +56,7 @@ public:
     log_h = NULL; 
     rnti  = 0; 
     pcap  = NULL;
+    softbuffers = NULL;
     nof_failures   = 0;
     phr_counter    = 0;
     dl_cqi_counter = 0;
@@ -67,6 +69,8 @@ public:
     bzero(&mutex, sizeof(pthread_mutex_t));
     bzero(softbuffer_tx, sizeof(softbuffer_tx));
     bzero(softbuffer_rx, sizeof(softbuffer_rx));
+    bzero(softbuffer_tx_tti, sizeof(softbuffer_tx_tti));
+    bzero(softbuffer_rx_tti, sizeof(softbuffer_rx_tti));
     for (int i = 0; i < SRSLTE_MAX_TB; ++i) {
       bzero(tx_payload_buffer, sizeof(uint8_t) * payload_buffer_len);
     }
@@ -74,9 +78,13 @@ public:
   }
   
   virtual ~ue() {
-    for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
-      srslte_softbuffer_rx_free(&softbuffer_rx[i]);
-      srslte_softbuffer_tx_free(&softbuffer_tx[i]);
+    if (softbuffers) {
+      for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
+        softbuffers->free_tx(&softbuffer_tx[i]);
+      }
+      for (int i=0;i<NOF_UL_HARQ_PROCESSES;i++) {
+        softbuffers->free_rx(&softbuffer_rx[i]);
+      }
     }
     pthread_mutex_destroy(&mutex);
   }
@@ -86,13 +94,18 @@ public:
   void     start_pcap(srslte::mac_pcap* pcap_);
   void     set_tti(uint32_t tti); 
   
-  void     config(uint16_t rnti, uint32_t nof_prb, sched_interface *sched, rrc_interface_mac *rrc_, rlc_interface_mac *rlc, srslte::log *log_h);
+  void     config(uint16_t rnti, softbuffer_pool *softbuffers, sched_interface *sched, rrc_interface_mac *rrc_, rlc_interface_mac *rlc, srslte::log *log_h);
   uint8_t* generate_pdu(uint32_t tb_idx, sched_interface::dl_sched_pdu_t pdu[sched_interface::MAX_RLC_PDU_LIST],
                     uint32_t nof_pdu_elems, uint32_t grant_size);
   uint8_t* generate_mch_pdu(sched_interface::dl_pdu_mch_t sched, uint32_t nof_pdu_elems, uint32_t grant_size);
   
-  srslte_softbuffer_tx_t* get_tx_softbuffer(uint32_t harq_process, uint32_t tb_idx);
-  srslte_softbuffer_rx_t* get_rx_softbuffer(uint32_t tti);
+  // Softbuffers lease storage for tbs bits from the cell pool. NULL if the pool is exhausted
+  // or, for a DL retransmission, if the first transmission had no storage
+  srslte_softbuffer_tx_t* get_tx_softbuffer(uint32_t tti, uint32_t harq_process, uint32_t tb_idx, uint32_t tbs, bool new_tx);
+  srslte_softbuffer_rx_t* get_rx_softbuffer(uint32_t tti, uint32_t tbs, bool new_tx);
+  void     release_tx_softbuffer(uint32_t tti_ack, uint32_t tb_idx);
+  void     release_rx_softbuffer(uint32_t tti);
+  void     release_stale_softbuffers(uint32_t tti);
   
   bool     process_pdus(); 
   uint8_t *request_buffer(uint32_t tti, uint32_t len); 
@@ -140,9 +153,17 @@ private:
   
   uint32_t nof_failures;
 
-  const static int NOF_HARQ_PROCESSES = 2 * HARQ_DELAY_MS * SRSLTE_MAX_TB;
+  const static int NOF_HARQ_PROCESSES    = 2 * HARQ_DELAY_MS * SRSLTE_MAX_TB;
+  const static int NOF_UL_HARQ_PROCESSES = 2 * HARQ_DELAY_MS;
+
+  // Leases not used for this many TTIs belong to TBs dropped after the last retransmission
+  const static uint32_t SOFTBUFFER_IDLE_TTIS = 100;
+
+  softbuffer_pool       *softbuffers;
   srslte_softbuffer_tx_t softbuffer_tx[NOF_HARQ_PROCESSES];
-  srslte_softbuffer_rx_t softbuffer_rx[NOF_HARQ_PROCESSES];
+  srslte_softbuffer_rx_t softbuffer_rx[NOF_UL_HARQ_PROCESSES];
+  uint32_t               softbuffer_tx_tti[NOF_HARQ_PROCESSES];
+  uint32_t               softbuffer_rx_tti[NOF_UL_HARQ_PROCESSES];
 
   uint8_t *pending_buffers[NOF_HARQ_PROCESSES]; 
   
@@ -33,6 +33,8 @@
 #include "srslte/interfaces/enb_metrics_interface.h"
 #include "srslte/common/gen_mch_tables.h"
 #include "srslte/common/log.h"
+#include "srslte/common/rnti_table.h"
+#include "srslte/common/task_pool.h"
 #include "srslte/common/threads.h"
 #include "srslte/common/thread_pool.h"
 #include "srslte/radio/radio.h"
@@ -46,6 +48,8 @@ typedef struct {
   bool pusch_8bit_decoder;
   float tx_amplitude; 
   int nof_phy_threads;  
+  int nof_pusch_decoder_threads;
+  int nof_pdsch_encoder_threads;
   std::string equalizer_mode; 
   float estimator_fil_w;   
   bool       pregenerate_signals;
@@ -82,6 +86,8 @@ public:
   void set_nof_workers(uint32_t nof_workers);
 
   bool init(srslte_cell_t *cell, srslte::radio *radio_handler, mac_interface_phy *mac);  
+  bool init_pusch_decoder(uint32_t nof_threads, int prio);
+  bool init_pdsch_encoder(uint32_t nof_threads, int prio);
   void reset(); 
   void stop();
   
@@ -97,6 +103,14 @@ public:
 
   srslte::radio     *radio;
   mac_interface_phy *mac; 
+
+  // PUSCH code blocks of all workers are turbo decoded by this pool, if enabled
+  srslte::task_pool        pusch_pool;
+  srslte_sch_cb_decoder_t* get_pusch_decoder(uint32_t slot);
+
+  // PDSCH of the users of a subframe are encoded concurrently by this pool, if enabled
+  srslte::task_pool              pdsch_pool;
+  srslte_enb_dl_pdsch_encoder_t* get_pdsch_encoder(uint32_t slot);
   
   // Common objects for schedulign grants 
   mac_interface_phy::ul_sched_t ul_grants[TTIMOD_SZ];
@@ -116,7 +130,7 @@ public:
     srslte_mod_t last_ul_mod[2*HARQ_DELAY_MS];
   };
 
-  std::map<uint16_t, common_ue> common_ue_db;
+  srslte::rnti_table<common_ue> common_ue_db;
   
   void ue_db_add_rnti(uint16_t rnti);
   void ue_db_rem_rnti(uint16_t rnti);
@@ -145,6 +159,9 @@ private:
   uint32_t        max_workers;
 
   pthread_mutex_t user_mutex;
+
+  std::vector<srslte_sch_cb_decoder_t>       pusch_decoders;
+  std::vector<srslte_enb_dl_pdsch_encoder_t> pdsch_encoders;
   
   phy_interface_rrc::phy_cfg_mbsfn_t  mbsfn;
   bool sib13_configured;
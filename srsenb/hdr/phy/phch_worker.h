@@ -28,8 +28,10 @@
 #define SRSENB_PHCH_WORKER_H
 
 #include <string.h>
+#include <sys/time.h>
 
 #include "srslte/srslte.h"
+#include "srslte/common/rnti_table.h"
 #include "phch_common.h"
 
 #define LOG_EXECTIME
@@ -82,6 +84,10 @@ private:
   int encode_pdcch_dl(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants);
   int encode_pdcch_ul(srslte_enb_ul_pusch_t *grants, uint32_t nof_grants);
   int decode_pucch();
+
+  static void pusch_decode_tb(void *arg, srslte_sch_tb_t *tb);
+  static void pusch_decode_cb(void *arg, uint32_t slot);
+  static void pdsch_encode(void *arg, uint32_t slot);
   
   
   /* Common objects */  
@@ -131,7 +137,47 @@ private:
   private:
     phy_metrics_t metrics; 
   }; 
-  std::map<uint16_t,ue> ue_db;   
+  srslte::rnti_table<ue> ue_db;
+
+  // State of a PUSCH reception between the demodulation and the report to MAC
+  typedef struct {
+    srslte_uci_data_t    uci_data;
+    srslte_cqi_value_t   cqi_value;
+    bool                 cqi_enabled;
+    bool                 acks_pending[SRSLTE_MAX_TB];
+    srslte_ra_ul_grant_t phy_grant;
+    int                  res;
+    float                snr_db;
+    uint32_t             nof_iterations;
+    struct timeval       t[3];
+    srslte_sch_tb_t      tb;
+  } pusch_rx_t;
+  std::vector<pusch_rx_t> pusch_rx;
+
+  // Code blocks handed to the shared PUSCH decoder pool
+  typedef struct {
+    phch_common     *phy;
+    srslte_sch_cb_t *cb;
+  } pusch_cb_task_t;
+  std::vector<pusch_cb_task_t> pusch_cb_tasks;
+  uint32_t                     nof_pusch_cb_tasks;
+  srslte_sch_executor_t        pusch_executor;
+  srslte::task_pool::group     pusch_group;
+
+  // PDSCH handed to the shared PDSCH encoder pool
+  typedef struct {
+    phch_common           *phy;
+    srslte_enb_dl_t       *enb_dl;
+    srslte_enb_dl_pdsch_t *grant;
+    srslte_ra_dl_grant_t   phy_grant;
+    srslte_mimo_type_t     mimo_type;
+    int                    rv[SRSLTE_MAX_CODEWORDS];
+    uint32_t               sf_idx;
+    float                  rho_a;
+    int                    ret;
+  } pdsch_tx_task_t;
+  std::vector<pdsch_tx_task_t> pdsch_tx_tasks;
+  srslte::task_pool::group     pdsch_group;
   
   // mutex to protect worker_imp() from configuration interface 
   pthread_mutex_t mutex;
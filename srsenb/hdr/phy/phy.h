@@ -86,6 +86,8 @@ private:
   const static int PRACH_WORKER_THREAD_PRIO = 3;
   const static int SF_RECV_THREAD_PRIO = 1;
   const static int WORKERS_THREAD_PRIO = 2;
+  const static int PUSCH_DECODER_THREAD_PRIO = 2;
+  const static int PDSCH_ENCODER_THREAD_PRIO = 2;
   
   srslte::radio         *radio_handler;
   srslte::log              *log_h;
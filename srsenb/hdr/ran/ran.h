@@ -72,6 +72,10 @@
 #define RAN_MAC_USER_SCHED      0x80000000
 // RAN slicing MAC User-level Round Robin scheduler
 #define RAN_MAC_USER_RR         0x80000001
+// RAN slicing MAC User-level Proportional Fair scheduler
+#define RAN_MAC_USER_PF         0x80000002
+// RAN slicing MAC User-level Maximum Carrier over Interference scheduler
+#define RAN_MAC_USER_MCI        0x80000003
 
 namespace srsenb {
 
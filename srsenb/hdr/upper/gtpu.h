@@ -25,12 +25,15 @@
  */
 
 #include <string.h>
-#include <map>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <vector>
 
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/log.h"
 #include "common_enb.h"
 #include "srslte/common/threads.h"
+#include "srslte/common/lockfree_queue.h"
 #include "srslte/srslte.h"
 #include "srslte/interfaces/enb_interfaces.h"
 
@@ -48,8 +51,11 @@ class gtpu
 public:
 
   gtpu();
+  ~gtpu();
 
-  bool init(std::string gtp_bind_addr_, std::string mme_addr_, std::string m1u_multiaddr_, std::string m1u_if_addr_, pdcp_interface_gtpu *pdcp_, srslte::log *gtpu_log_, bool enable_mbsfn = false);
+  // With batch_size > 1 the S1-U socket is read with recvmmsg() and UL PDUs are sent with sendmmsg() from a
+  // TX thread, up to batch_size packets per system call
+  bool init(std::string gtp_bind_addr_, std::string mme_addr_, std::string m1u_multiaddr_, std::string m1u_if_addr_, pdcp_interface_gtpu *pdcp_, srslte::log *gtpu_log_, bool enable_mbsfn = false, uint32_t batch_size = 1);
   void stop();
 
   // gtpu_interface_rrc
@@ -61,8 +67,10 @@ public:
   void write_pdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *pdu);
 
 private:
-  static const int THREAD_PRIO = 65;
-  static const int GTPU_PORT   = 2152;
+  static const int THREAD_PRIO    = 65;
+  static const int GTPU_PORT      = 2152;
+  static const int MAX_BATCH_SIZE = 256;
+  static const int TX_QUEUE_SIZE  = 4096;
   srslte::byte_buffer_pool     *pool;
   bool                         running;
   bool                         run_enable;
@@ -70,6 +78,7 @@ private:
   bool                         enable_mbsfn;
   std::string                  gtp_bind_addr;
   std::string                  mme_addr;
+  uint32_t                     batch_size;
   srsenb::pdcp_interface_gtpu *pdcp;
   srslte::log                 *gtpu_log;
 
@@ -101,17 +110,46 @@ private:
   // MCH thread insteance
   mch_thread  mchthread;
 
+  // UL PDU with its GTP-U header, waiting for the TX thread
+  typedef struct {
+    srslte::byte_buffer_t *pdu;
+    uint32_t               addr;
+  } tx_pdu_t;
+
+  // Sends the UL PDUs queued by write_pdu() in batches
+  class tx_thread : public thread {
+  public:
+    tx_thread() : parent(NULL), running(false), queue(TX_QUEUE_SIZE) {}
+    void init(gtpu *parent_);
+    bool push(srslte::byte_buffer_t *pdu, uint32_t addr);
+    void stop();
+  private:
+    void run_thread();
+
+    gtpu                         *parent;
+    volatile bool                 running;
+    srslte::mpsc_queue<tx_pdu_t>  queue;
+  };
+
+  tx_thread   txthread;
+
+  /* TEID table, indexed by RNTI. Entries are created on the first bearer of an user and never freed, so the
+   * RX, TX and PDCP threads read them without locking. A bearer exists while its teid_in is not zero.
+   * Updates are serialized with the mutex. */
   typedef struct{
-    uint32_t teids_in[SRSENB_N_RADIO_BEARERS];
-    uint32_t teids_out[SRSENB_N_RADIO_BEARERS];
-    uint32_t spgw_addrs[SRSENB_N_RADIO_BEARERS];
+    volatile uint32_t teids_in[SRSENB_N_RADIO_BEARERS];
+    volatile uint32_t teids_out[SRSENB_N_RADIO_BEARERS];
+    volatile uint32_t spgw_addrs[SRSENB_N_RADIO_BEARERS];
   }bearer_map;
-  std::map<uint16_t, bearer_map> rnti_bearers;
+  static const int MAX_RNTI = 65536;
+  bearer_map* volatile rnti_bearers[MAX_RNTI];
 
   // Socket file descriptor
   int fd;
 
   void run_thread();
+  void handle_rx_pdu(srslte::byte_buffer_t **pdu, sockaddr_in *client);
+  void send_batch(struct mmsghdr *msgs, uint32_t nof_msgs);
   void echo_response(in_addr_t addr, in_port_t port, uint16_t seq);
 
   pthread_mutex_t mutex;
@@ -344,6 +344,7 @@ private:
   void config_mac();
   void parse_ul_dcch(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *pdu);
   void parse_ul_ccch(uint16_t rnti, srslte::byte_buffer_t *pdu);
+  bool copy_from_pdu(srslte::byte_buffer_t *pdu);
   void configure_security(uint16_t rnti,
                           uint32_t lcid,
                           uint8_t *k_rrc_enc,
@@ -354,8 +355,8 @@ private:
                           srslte::INTEGRITY_ALGORITHM_ID_ENUM integ_algo);
 
   srslte::byte_buffer_pool  *pool;
-  srslte::bit_buffer_t  bit_buf;
-  srslte::bit_buffer_t  bit_buf_paging;
+  LIBLTE_BYTE_MSG_STRUCT     byte_buf;
+  LIBLTE_BYTE_MSG_STRUCT     byte_buf_paging;
 
   phy_interface_rrc    *phy;
   mac_interface_rrc    *mac;
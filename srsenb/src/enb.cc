@@ -88,6 +88,11 @@ bool enb::init(all_args_t *args_)
 
   if (!args->log.filename.compare("stdout")) {
     logger = &logger_stdout;
+  } else if (args->log.binary) {
+    logger_binary.init(args->log.filename);
+    logger_binary.log("\n\n");
+    logger_binary.log(get_build_string().c_str());
+    logger = &logger_binary;
   } else {
     logger_file.init(args->log.filename, args->log.file_max_size);
     logger_file.log("\n\n");
@@ -156,7 +161,7 @@ bool enb::init(all_args_t *args_)
   // Set up pcap and trace
   if(args->pcap.enable)
   {
-    mac_pcap.open(args->pcap.filename.c_str());
+    mac_pcap.open(args->pcap.filename.c_str(), 0, args->pcap.file_max_size, args->pcap.file_max_time);
     mac.start_pcap(&mac_pcap);
   }
   
@@ -272,7 +277,7 @@ bool enb::init(all_args_t *args_)
   rrc.init(&rrc_cfg, &phy, &mac, &rlc, &pdcp, &s1ap, &gtpu, &agent, &ran, &rrc_log);
   agent.init(args->enb.s1ap.enb_id, &rrc, &ran, &agent_log);
   s1ap.init(args->enb.s1ap, &rrc, &s1ap_log);
-  gtpu.init(args->enb.s1ap.gtp_bind_addr, args->enb.s1ap.mme_addr, args->expert.m1u_multiaddr, args->expert.m1u_if_addr, &pdcp, &gtpu_log, args->expert.enable_mbsfn);
+  gtpu.init(args->enb.s1ap.gtp_bind_addr, args->enb.s1ap.mme_addr, args->expert.m1u_multiaddr, args->expert.m1u_if_addr, &pdcp, &gtpu_log, args->expert.enable_mbsfn, args->expert.gtpu_batch_size);
   ran.init(&mac, &ran_log);
   
   started = true;
@@ -325,6 +330,7 @@ bool enb::get_metrics(enb_metrics_t &m)
 
   phy.get_metrics(m.phy);
   mac.get_metrics(m.mac);
+  mac.get_softbuffer_metrics(&m.mac_softbuffer);
   rrc.get_metrics(m.rrc);
   s1ap.get_metrics(m.s1ap);
 
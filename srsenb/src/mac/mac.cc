@@ -33,6 +33,7 @@
 #include <strings.h>
 #include <pthread.h>
 #include <unistd.h>
+#include <inttypes.h>
 #include <srslte/interfaces/sched_interface.h>
 
 #include "srslte/common/log.h"
@@ -43,8 +44,7 @@
 namespace srsenb {
 
 mac::mac() : timers_db(128), timers_thread(&timers_db), tti(0), last_rnti(0),
-             rar_pdu_msg(sched_interface::MAX_RAR_LIST), rar_payload(),
-             pdu_process_thread(this)
+             rar_pdu_msg(sched_interface::MAX_RAR_LIST), rar_payload()
 {
   started = false;  
   pcap = NULL;
@@ -81,8 +81,9 @@ bool mac::init(mac_args_t *args_, srslte_cell_t *cell_, phy_interface_mac *phy,
     scheduler.init(rrc, agent, log_h);
 
 #ifdef HAVE_RAN_SLICER
-    scheduler.set_metric(&sched_metric_dl_ran, &sched_metric_ul_rr);
+    scheduler.set_metric(&sched_metric_dl_ran, &sched_metric_ul_ran);
     sched_metric_dl_ran.init(log_h);
+    sched_metric_ul_ran.init(log_h);
 #else /* HAVE_RAN_SLICER */
     scheduler.set_metric(&sched_metric_dl_rr, &sched_metric_ul_rr);
 #endif /* HAVE_RAN_SLICER */
@@ -100,10 +101,29 @@ bool mac::init(mac_args_t *args_, srslte_cell_t *cell_, phy_interface_mac *phy,
     // Init softbuffer for RAR 
     srslte_softbuffer_tx_init(&rar_softbuffer_tx, cell.nof_prb);
 
+    // Init HARQ soft storage of the UEs
+    if (args.softbuffer_pool_nof_tb <= 0) {
+      args.softbuffer_pool_nof_tb = SOFTBUFFER_POOL_DEFAULT_NOF_TB;
+    }
+    if (!softbuffers.init(cell.nof_prb, (uint32_t) args.softbuffer_pool_nof_tb)) {
+      Error("Allocating softbuffer pool for %d TB\n", args.softbuffer_pool_nof_tb);
+      return false;
+    }
+
     reset();
 
     pthread_rwlock_init(&rwlock, NULL);
 
+    // Start the threads processing the UL PDUs
+    if (args.nof_pdu_threads <= 0) {
+      args.nof_pdu_threads = 1;
+    } else if (args.nof_pdu_threads > MAX_PDU_THREADS) {
+      args.nof_pdu_threads = MAX_PDU_THREADS;
+    }
+    for (int i=0;i<args.nof_pdu_threads;i++) {
+      pdu_process_threads.push_back(new pdu_process(this, (uint32_t) i));
+    }
+
     started = true;
   }
 
@@ -112,19 +132,31 @@ bool mac::init(mac_args_t *args_, srslte_cell_t *cell_, phy_interface_mac *phy,
 
 void mac::stop()
 {
+  // crc_info() stops notifying the PDU threads once started is cleared
   pthread_rwlock_wrlock(&rwlock);
+  started = false;
+  pthread_rwlock_unlock(&rwlock);
+
+  // PDU threads take the lock to process the PDUs, stop them outside of it
+  for (uint32_t i=0;i<pdu_process_threads.size();i++) {
+    pdu_process_threads[i]->stop();
+    delete pdu_process_threads[i];
+  }
+  pdu_process_threads.clear();
 
-  for (uint32_t i=0;i<ue_db.size();i++) {
-    delete ue_db[i];
+  pthread_rwlock_wrlock(&rwlock);
+
+  for (srslte::rnti_table<ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    delete iter->second;
   }
+  ue_db.clear();
+  softbuffers.stop();
   for (int i=0;i<NOF_BCCH_DLSCH_MSG;i++) {
     srslte_softbuffer_tx_free(&bcch_softbuffer_tx[i]);
   }
   srslte_softbuffer_tx_free(&pcch_softbuffer_tx);
   srslte_softbuffer_tx_free(&rar_softbuffer_tx);
-  started = false;
   timers_thread.stop();
-  pdu_process_thread.stop();
 
   pthread_rwlock_unlock(&rwlock);
   pthread_rwlock_destroy(&rwlock);
@@ -149,7 +181,7 @@ void mac::start_pcap(srslte::mac_pcap* pcap_)
 {
   pcap = pcap_;
   // Set pcap in all UEs for UL messages
-  for(std::map<uint16_t, ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(srslte::rnti_table<ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
     ue *u = iter->second;
     u->start_pcap(pcap);
   }
@@ -170,7 +202,19 @@ int  mac::add_slice(uint64_t id)
 #ifndef HAVE_RAN_SLICER
   return 0;
 #else
-  return sched_metric_dl_ran.add_slice(id);
+  // DL and UL keep the same slices, check both before changing any
+  if (sched_metric_dl_ran.has_slice(id) || sched_metric_ul_ran.has_slice(id)) {
+    Error("Slice %" PRIu64 " already existing in the MAC\n", id);
+    return -1;
+  }
+  if (sched_metric_dl_ran.add_slice(id)) {
+    return -1;
+  }
+  if (sched_metric_ul_ran.add_slice(id)) {
+    sched_metric_dl_ran.rem_slice(id);
+    return -1;
+  }
+  return 0;
 #endif
 }
 
@@ -180,6 +224,7 @@ void mac::rem_slice(uint64_t id)
   return;
 #else
   sched_metric_dl_ran.rem_slice(id);
+  sched_metric_ul_ran.rem_slice(id);
 #endif
 }
 
@@ -188,7 +233,16 @@ int mac::set_slice(uint64_t id, mac_set_slice_args * args)
 #ifndef HAVE_RAN_SLICER
   return 0;
 #else
-  return sched_metric_dl_ran.set_slice(id, args);
+  // The same configuration applies to both DL and UL. The DL metric validates the
+  // arguments, so once it accepted them the UL one only fails if the slice is missing
+  if (!sched_metric_dl_ran.has_slice(id) || !sched_metric_ul_ran.has_slice(id)) {
+    Error("Slice %" PRIu64 " not found in the MAC\n", id);
+    return -1;
+  }
+  if (sched_metric_dl_ran.set_slice(id, args)) {
+    return -1;
+  }
+  return sched_metric_ul_ran.set_slice(id, args);
 #endif
 }
 
@@ -197,7 +251,18 @@ int  mac::add_slice_user(uint16_t rnti, uint64_t slice, int lock)
 #ifndef HAVE_RAN_SLICER
   return 0;
 #else
-  return sched_metric_dl_ran.add_slice_user(rnti, slice, lock);
+  if (!sched_metric_dl_ran.has_slice(slice) || !sched_metric_ul_ran.has_slice(slice)) {
+    Error("Slice %" PRIu64 " not found in the MAC\n", slice);
+    return -1;
+  }
+  if (sched_metric_dl_ran.add_slice_user(rnti, slice, lock)) {
+    return -1;
+  }
+  if (sched_metric_ul_ran.add_slice_user(rnti, slice, lock)) {
+    sched_metric_dl_ran.rem_slice_user(rnti, slice);
+    return -1;
+  }
+  return 0;
 #endif
 }
 
@@ -207,6 +272,7 @@ void mac::rem_slice_user(uint16_t rnti, uint64_t slice)
   return;
 #else
   sched_metric_dl_ran.rem_slice_user(rnti, slice);
+  sched_metric_ul_ran.rem_slice_user(rnti, slice);
 #endif
 }
 
@@ -357,7 +423,7 @@ void mac::get_metrics(mac_metrics_t metrics[ENB_METRICS_MAX_USERS])
 {
   pthread_rwlock_rdlock(&rwlock);
   int cnt=0;
-  for(std::map<uint16_t, ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(srslte::rnti_table<ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
     ue *u = iter->second;
     if(iter->first != SRSLTE_MRNTI) {
       u->metrics_read(&metrics[cnt]);
@@ -367,6 +433,11 @@ void mac::get_metrics(mac_metrics_t metrics[ENB_METRICS_MAX_USERS])
   pthread_rwlock_unlock(&rwlock);
 }
 
+void mac::get_softbuffer_metrics(mac_softbuffer_metrics_t *metrics)
+{
+  softbuffers.get_metrics(metrics);
+}
+
 
 /********************************************************
  *
@@ -409,6 +480,8 @@ int mac::ack_info(uint32_t tti, uint16_t rnti, uint32_t tb_idx, bool ack)
   ue_db[rnti]->metrics_tx(ack, nof_bytes);
 
   if (ack) {
+    ue_db[rnti]->release_tx_softbuffer(tti, tb_idx);
+
     if (nof_bytes > 64) { // do not count RLC status messages only
       rrc_h->set_activity_user(rnti);
       log_h->debug("DL activity rnti=0x%x, n_bytes=%d\n", rnti, nof_bytes);
@@ -423,6 +496,11 @@ int mac::crc_info(uint32_t tti, uint16_t rnti, uint32_t nof_bytes, bool crc)
   log_h->step(tti);
   int ret = -1;
   pthread_rwlock_rdlock(&rwlock);
+  if (!started) {
+    // the PDU threads are being stopped
+    pthread_rwlock_unlock(&rwlock);
+    return ret;
+  }
   if (ue_db.count(rnti)) {
     ue_db[rnti]->set_tti(tti);
 
@@ -430,8 +508,9 @@ int mac::crc_info(uint32_t tti, uint16_t rnti, uint32_t nof_bytes, bool crc)
 
     // push the pdu through the queue if received correctly
     if (crc) {
+      ue_db[rnti]->release_rx_softbuffer(tti);
       ue_db[rnti]->push_pdu(tti, nof_bytes);
-      pdu_process_thread.notify();
+      pdu_process_threads[pdu_shard(rnti)]->notify();
     } else {
       ue_db[rnti]->deallocate_pdu(tti);
     }
@@ -557,7 +636,7 @@ int mac::rach_detected(uint32_t tti, uint32_t preamble_idx, uint32_t time_adv)
 
   // Create new UE
   ue_db[last_rnti] = new ue;
-  ue_db[last_rnti]->config(last_rnti, cell.nof_prb, &scheduler, rrc_h, rlc_h, log_h);
+  ue_db[last_rnti]->config(last_rnti, &softbuffers, &scheduler, rrc_h, rlc_h, log_h);
 
   // Set PCAP if available
   if (pcap) {
@@ -628,6 +707,13 @@ int mac::get_dl_sched(uint32_t tti, dl_sched_t *dl_sched_res)
 
   pthread_rwlock_rdlock(&rwlock);
 
+  // Return the soft storage of TBs that were never acknowledged
+  if (tti%SOFTBUFFER_SWEEP_PERIOD == 0) {
+    for (srslte::rnti_table<ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+      iter->second->release_stale_softbuffers(tti);
+    }
+  }
+
   // Copy data grants
   for (uint32_t i=0;i<sched_result.nof_data_elems;i++) {
 
@@ -641,9 +727,22 @@ int mac::get_dl_sched(uint32_t tti, dl_sched_t *dl_sched_res)
       memcpy(&dl_sched_res->sched_grants[n].grant,    &sched_result.data[i].dci,          sizeof(srslte_ra_dl_dci_t));
       memcpy(&dl_sched_res->sched_grants[n].location, &sched_result.data[i].dci_location, sizeof(srslte_dci_location_t));
 
+      bool has_tb = false;
       for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
-        dl_sched_res->sched_grants[n].softbuffers[tb] =
-            ue_db[rnti]->get_tx_softbuffer(sched_result.data[i].dci.harq_process, tb);
+        dl_sched_res->sched_grants[n].softbuffers[tb] = NULL;
+        if (sched_result.data[i].dci.tb_en[tb]) {
+          dl_sched_res->sched_grants[n].softbuffers[tb] =
+              ue_db[rnti]->get_tx_softbuffer(tti, sched_result.data[i].dci.harq_process, tb,
+                                             sched_result.data[i].tbs[tb]*8, sched_result.data[i].nof_pdu_elems[tb] > 0);
+          if (!dl_sched_res->sched_grants[n].softbuffers[tb]) {
+            // No soft storage, the TB is not transmitted and the scheduler retransmits it after the HARQ timeout
+            Debug("No softbuffer for rnti=0x%x, pid=%d, tb=%d\n", rnti, sched_result.data[i].dci.harq_process, tb);
+            dl_sched_res->sched_grants[n].grant.tb_en[tb] = false;
+            dl_sched_res->sched_grants[n].data[tb] = NULL;
+            continue;
+          }
+          has_tb = true;
+        }
 
         if (sched_result.data[i].nof_pdu_elems[tb] > 0) {
           /* Get PDU if it's a new transmission */
@@ -666,7 +765,9 @@ int mac::get_dl_sched(uint32_t tti, dl_sched_t *dl_sched_res)
           dl_sched_res->sched_grants[n].data[tb] = NULL;
         }
       }
-      n++;
+      if (has_tb) {
+        n++;
+      }
     } else {
       Warning("Invalid DL scheduling result. User 0x%x does not exist\n", rnti);
     }
@@ -898,10 +999,13 @@ int mac::get_ul_sched(uint32_t tti, ul_sched_t *ul_sched_res)
         memcpy(&ul_sched_res->sched_grants[n].grant,    &sched_result.pusch[i].dci,          sizeof(srslte_ra_ul_dci_t));
         memcpy(&ul_sched_res->sched_grants[n].location, &sched_result.pusch[i].dci_location, sizeof(srslte_dci_location_t));
 
-        ul_sched_res->sched_grants[n].softbuffer = ue_db[rnti]->get_rx_softbuffer(tti);
-
-        if (sched_result.pusch[n].current_tx_nb == 0) {
-          srslte_softbuffer_rx_reset_tbs(ul_sched_res->sched_grants[n].softbuffer, sched_result.pusch[i].tbs*8);
+        // Leasing new storage resets it
+        ul_sched_res->sched_grants[n].softbuffer = ue_db[rnti]->get_rx_softbuffer(tti, sched_result.pusch[i].tbs*8,
+                                                                                  sched_result.pusch[i].current_tx_nb == 0);
+        if (!ul_sched_res->sched_grants[n].softbuffer) {
+          // No soft storage, the grant is not signalled and the PUSCH not decoded
+          Debug("No softbuffer for rnti=0x%x, tti=%d\n", rnti, tti);
+          continue;
         }
         ul_sched_res->sched_grants[n].data = ue_db[rnti]->request_buffer(tti, sched_result.pusch[i].tbs);
         ul_sched_res->nof_grants++;
@@ -990,8 +1094,9 @@ void mac::timer_thread::tti_clock()
  * DEMUX unit
  *
  *******************************************************/
-mac::pdu_process::pdu_process(pdu_process_handler *h) : running(false) {
+mac::pdu_process::pdu_process(pdu_process_handler *h, uint32_t shard_) : running(false) {
   handler = h;
+  shard   = shard_;
   pthread_mutex_init(&mutex, NULL);
   pthread_cond_init(&cvar, NULL);
   have_data = false;
@@ -1020,7 +1125,7 @@ void mac::pdu_process::run_thread()
 {
   running = true;
   while(running) {
-    have_data = handler->process_pdus();
+    have_data = handler->process_pdus(shard);
     if (!have_data) {
       pthread_mutex_lock(&mutex);
       while(!have_data && running) {
@@ -1031,14 +1136,22 @@ void mac::pdu_process::run_thread()
   }
 }
 
-bool mac::process_pdus()
+uint32_t mac::pdu_shard(uint16_t rnti)
+{
+  // RNTIs are allocated in steps of 3 in rach_detected(), spread consecutive users over the threads
+  return (rnti/3)%pdu_process_threads.size();
+}
+
+bool mac::process_pdus(uint32_t shard)
 {
   pthread_rwlock_rdlock(&rwlock);
   bool ret = false;
-  for(std::map<uint16_t, ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(srslte::rnti_table<ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
     ue *u         = iter->second;
     uint16_t rnti = iter->first;
-    ret = ret | u->process_pdus();
+    if (pdu_shard(rnti) == shard) {
+      ret = ret | u->process_pdus();
+    }
   }
   pthread_rwlock_unlock(&rwlock);
   return ret;
@@ -1050,8 +1163,8 @@ void mac::write_mcch(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT *sib2, LIBLTE_RRC_S
   bzero(&mcch_payload_buffer[0],sizeof(uint8_t)*3000);
   
   
-  LIBLTE_BIT_MSG_STRUCT bitbuffer;
-  liblte_rrc_pack_mcch_msg(mcch, &bitbuffer);
+  LIBLTE_BYTE_MSG_STRUCT bytebuffer;
+  liblte_rrc_pack_mcch_msg(mcch, &bytebuffer);
   memcpy(&this->mcch ,mcch, sizeof(LIBLTE_RRC_MCCH_MSG_STRUCT));
   mch.num_mtch_sched =  this->mcch.pmch_infolist_r9[0].mbms_sessioninfolist_r9_size;
   for(uint32_t i = 0; i < mch.num_mtch_sched; i++){
@@ -1060,15 +1173,11 @@ void mac::write_mcch(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT *sib2, LIBLTE_RRC_S
 
   memcpy(&this->sib2,sib2, sizeof(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT));
   memcpy(&this->sib2,sib13, sizeof(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT)); // TODO: consolidate relevant parts into 1 struct
-  current_mcch_length = floor(bitbuffer.N_bits/8);
-  if(bitbuffer.N_bits%8 != 0) {
-    current_mcch_length++;
-  }
   int rlc_header_len = 1;
-  current_mcch_length =  current_mcch_length + rlc_header_len;
-  srslte_bit_pack_vector(&bitbuffer.msg[0], &mcch_payload_buffer[rlc_header_len], bitbuffer.N_bits);
+  current_mcch_length = bytebuffer.N_bytes + rlc_header_len;
+  memcpy(&mcch_payload_buffer[rlc_header_len], bytebuffer.msg, bytebuffer.N_bytes);
   ue_db[SRSLTE_MRNTI] = new ue;
-  ue_db[SRSLTE_MRNTI]->config(SRSLTE_MRNTI, cell.nof_prb, &scheduler, rrc_h, rlc_h, log_h);
+  ue_db[SRSLTE_MRNTI]->config(SRSLTE_MRNTI, &softbuffers, &scheduler, rrc_h, rlc_h, log_h);
 
   rrc_h->add_user(SRSLTE_MRNTI);
 }
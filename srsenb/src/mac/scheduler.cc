@@ -689,7 +689,7 @@ int sched::dl_sched_data(dl_sched_data_t data[MAX_DATA_LIST])
   dl_metric->new_tti(ue_db, start_rbg, avail_rbg, nof_ctrl_symbols, current_tti); 
   
   int nof_data_elems = 0; 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(sched_ue_db_t::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
     sched_ue *user = (sched_ue*) &iter->second;
     uint16_t rnti  = (uint16_t) iter->first;
 
@@ -805,7 +805,7 @@ int sched::dl_sched(uint32_t tti, sched_interface::dl_sched_res_t* sched_result)
 // Uplink sched 
 int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched_result)
 {
-  typedef std::map<uint16_t, sched_ue>::iterator it_t;
+  typedef sched_ue_db_t::iterator it_t;
 
   if (!configured) {
     return 0; 
@@ -299,7 +299,7 @@ void ran_rr_usched::schedule(
   uint16_t first = 0;
   uint16_t rnti  = 0;
 
-  std::map<uint16_t, int>::iterator i;
+  srslte::rnti_table<int>::iterator i;
   int j;
 
    // Select the next candidate RNTI
@@ -360,6 +360,485 @@ void ran_rr_usched::schedule(
   return;
 }
 
+/*
+ *
+ * CHANNEL-AWARE RESOURCE ALLOCATION FOR SLICE USERS
+ *
+ */
+
+/* Routine:
+ *    ran_rate_usched::ran_rate_usched
+ * 
+ * Abstract:
+ *    Initializes the common part of the channel-aware User-level schedulers
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ * 
+ * Returns:
+ *    ---
+ */
+ran_rate_usched::ran_rate_usched()
+{
+  m_last = 0; // Last RNTI selected first
+}
+
+/* Routine:
+ *    ran_rate_usched::~ran_rate_usched
+ * 
+ * Abstract:
+ *    Releases resources associated with this scheduler
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ * 
+ * Returns:
+ *    ---
+ */
+ran_rate_usched::~ran_rate_usched()
+{
+  // Nothing
+}
+
+/* Routine:
+ *    ran_rate_usched::served
+ * 
+ * Abstract:
+ *    Informs the policy about the groups given to an user in this TTI. Users
+ *    of the slice which have not been selected are reported with zero groups.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - rnti, ID of the user
+ *    - user, RAN information of the user
+ *    - nof_rbg, number of groups assigned to the user
+ * 
+ * Returns:
+ *    ---
+ */
+void ran_rate_usched::served(
+  uint16_t rnti, ran_mac_user * user, uint32_t nof_rbg)
+{
+  // Stateless policies do not care
+}
+
+/* Routine:
+ *    ran_rate_usched::purge
+ * 
+ * Abstract:
+ *    Releases any state kept for users which are no more part of the slice.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - slice, Slice to consider
+ * 
+ * Returns:
+ *    ---
+ */
+void ran_rate_usched::purge(ran_mac_slice * slice)
+{
+  // Stateless policies do not care
+}
+
+/* Routine:
+ *    ran_rate_usched::schedule
+ *
+ * Abstract:
+ *    Selects, between the users of the slice which have something to send,
+ *    the one with the highest metric and gives it the next free groups, up to
+ *    its demand. This is repeated until the groups of the slice are exhausted
+ *    or no user is left. Ties are broken in RR fashion starting from the user
+ *    selected first during the previous TTI.
+ *
+ * Assumptions:
+ *    'rbg_rate' and 'rbg_demand' of the users have been updated for this TTI.
+ * 
+ * Arguments:
+ *    - tti, The TTI where we are operating on
+ *    - slice, Slice to consider
+ *    - umap, map of the currently connected users to consider
+ *    - rbg, array of groups that is possible to allocate
+ *    - ret, array matching rbg with the assigned user
+ *
+ * Returns:
+ *    ---
+ */
+void ran_rate_usched::schedule(
+  const uint32_t     tti,
+  ran_mac_slice *    slice,
+  user_map_t *       umap,
+  bool               rbg[RAN_DL_MAX_RGB],
+  uint16_t           ret[RAN_DL_MAX_RGB])
+{
+  bool     busy[RAN_DL_MAX_RGB];
+  // Users already selected in this TTI, and groups they received
+  uint16_t sel[RAN_DL_MAX_RGB];
+  uint32_t sel_rbg[RAN_DL_MAX_RGB];
+  uint32_t nof_sel  = 0;
+  uint32_t nof_free = 0;
+  uint32_t nof_rbg;
+  uint32_t j;
+  uint32_t k;
+  uint32_t n;
+  uint16_t best;
+  float    best_m = 0;
+  float    m;
+
+  srslte::rnti_table<int>::iterator i;
+  user_map_t::iterator              u;
+  user_map_t::iterator              bu;
+
+  purge(slice);
+
+  if(slice->users.empty()) {
+    return;
+  }
+
+  for(j = 0; j < RAN_DL_MAX_RGB; j++) {
+    busy[j] = rbg[j];
+
+    if(!rbg[j]) {
+      nof_free++;
+    }
+  }
+
+  while(nof_free > 0 && nof_sel < RAN_DL_MAX_RGB) {
+    best = 0;
+    bu   = umap->end();
+    i    = slice->users.find(m_last);
+
+    // The last first one may have left the slice in the meantime
+    if(i == slice->users.end()) {
+      i = slice->users.begin();
+    } else {
+      ++i;
+    }
+
+    // Look for the best candidate, starting after the last first one
+    for(n = 0; n < slice->users.size(); n++, ++i) {
+      if(i == slice->users.end()) {
+        i = slice->users.begin();
+      }
+
+      u = umap->find(i->first);
+
+      // Unknown or with nothing to tx/re-tx
+      if(u == umap->end() || u->second.rbg_demand == 0) {
+        continue;
+      }
+
+      for(k = 0; k < nof_sel && sel[k] != i->first; k++) {
+        // Look if already selected
+      }
+
+      if(k < nof_sel) {
+        continue;
+      }
+
+      m = metric(i->first, &u->second);
+
+      if(!best || m > best_m) {
+        best   = i->first;
+        best_m = m;
+        bu     = u;
+      }
+    }
+
+    // Nobody else needs resources
+    if(!best) {
+      break;
+    }
+
+    if(nof_sel == 0) {
+      m_last = best;
+    }
+
+    // Give the next free groups to the selected user
+    for(j = 0, nof_rbg = 0; 
+      j < RAN_DL_MAX_RGB && nof_rbg < bu->second.rbg_demand; 
+      j++) 
+    {
+      if(!busy[j]) {
+        busy[j] = true;
+        ret[j]  = best;
+        nof_rbg++;
+        nof_free--;
+      }
+    }
+
+    sel[nof_sel]     = best;
+    sel_rbg[nof_sel] = nof_rbg;
+    nof_sel++;
+  }
+
+  // Feedback to the policy, for all the users of the slice
+  for(i = slice->users.begin(); i != slice->users.end(); ++i) {
+    u = umap->find(i->first);
+
+    if(u == umap->end()) {
+      continue;
+    }
+
+    for(k = 0; k < nof_sel && sel[k] != i->first; k++) {
+      // Look if selected
+    }
+
+    served(i->first, &u->second, k < nof_sel ? sel_rbg[k] : 0);
+  }
+
+  return;
+}
+
+/*
+ *
+ * PROPORTIONAL FAIR RESOURCE ALLOCATION FOR SLICE USERS
+ *
+ */
+
+/* Routine:
+ *    ran_pf_usched::ran_pf_usched
+ * 
+ * Abstract:
+ *    Initializes the RAN slice User-level scheduler with Proportional Fair
+ *    policy
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ * 
+ * Returns:
+ *    ---
+ */
+ran_pf_usched::ran_pf_usched()
+{
+  m_id = RAN_MAC_USER_PF;
+}
+
+/* Routine:
+ *    ran_pf_usched::~ran_pf_usched
+ * 
+ * Abstract:
+ *    Releases resources associated with this scheduler
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ * 
+ * Returns:
+ *    ---
+ */
+ran_pf_usched::~ran_pf_usched()
+{
+  // Nothing
+}
+
+/* Routine:
+ *    ran_pf_usched::metric
+ * 
+ * Abstract:
+ *    The priority of an user is the rate it can achieve now over the rate it
+ *    has been served with in the last RAN_PF_WINDOW TTIs. Users in good
+ *    channel conditions are preferred, but not to the point of starving the
+ *    others.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - rnti, ID of the user
+ *    - user, RAN information of the user
+ * 
+ * Returns:
+ *    The metric of the user
+ */
+float ran_pf_usched::metric(uint16_t rnti, ran_mac_user * user)
+{
+  srslte::rnti_table<float>::iterator a = m_avg.find(rnti);
+  float                               avg;
+
+  // New users start as if they always had what they can achieve now
+  if(a == m_avg.end()) {
+    avg = (float)user->rbg_rate;
+  } else {
+    avg = a->second;
+  }
+
+  return (float)user->rbg_rate / (avg > 1.0f ? avg : 1.0f);
+}
+
+/* Routine:
+ *    ran_pf_usched::served
+ * 
+ * Abstract:
+ *    Updates the average throughput of an user with an exponential moving
+ *    average over RAN_PF_WINDOW TTIs.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - rnti, ID of the user
+ *    - user, RAN information of the user
+ *    - nof_rbg, number of groups assigned to the user
+ * 
+ * Returns:
+ *    ---
+ */
+void ran_pf_usched::served(
+  uint16_t rnti, ran_mac_user * user, uint32_t nof_rbg)
+{
+  float   a = 1.0f / RAN_PF_WINDOW;
+  float * avg;
+
+  if(m_avg.count(rnti) == 0) {
+    m_avg[rnti] = (float)(user->rbg_rate > 0 ? user->rbg_rate : 1);
+  }
+
+  avg  = &m_avg[rnti];
+  *avg = (1.0f - a) * (*avg) + a * (float)(nof_rbg * user->rbg_rate);
+}
+
+/* Routine:
+ *    ran_pf_usched::purge
+ * 
+ * Abstract:
+ *    Forgets the average throughput of users which left the slice.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - slice, Slice to consider
+ * 
+ * Returns:
+ *    ---
+ */
+void ran_pf_usched::purge(ran_mac_slice * slice)
+{
+  srslte::rnti_table<float>::iterator a = m_avg.begin();
+
+  while(a != m_avg.end()) {
+    if(slice->users.count(a->first) == 0) {
+      m_avg.erase(a++);
+    } else {
+      ++a;
+    }
+  }
+}
+
+/*
+ *
+ * MAXIMUM C/I RESOURCE ALLOCATION FOR SLICE USERS
+ *
+ */
+
+/* Routine:
+ *    ran_mci_usched::ran_mci_usched
+ * 
+ * Abstract:
+ *    Initializes the RAN slice User-level scheduler with Maximum Carrier over
+ *    Interference policy
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ * 
+ * Returns:
+ *    ---
+ */
+ran_mci_usched::ran_mci_usched()
+{
+  m_id = RAN_MAC_USER_MCI;
+}
+
+/* Routine:
+ *    ran_mci_usched::~ran_mci_usched
+ * 
+ * Abstract:
+ *    Releases resources associated with this scheduler
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ * 
+ * Returns:
+ *    ---
+ */
+ran_mci_usched::~ran_mci_usched()
+{
+  // Nothing
+}
+
+/* Routine:
+ *    ran_mci_usched::metric
+ * 
+ * Abstract:
+ *    The priority of an user is the rate it can achieve now. This maximizes
+ *    the throughput of the slice, but users in bad channel conditions are
+ *    served only when the better ones have nothing to send.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - rnti, ID of the user
+ *    - user, RAN information of the user
+ * 
+ * Returns:
+ *    The metric of the user
+ */
+float ran_mci_usched::metric(uint16_t rnti, ran_mac_user * user)
+{
+  return (float)user->rbg_rate;
+}
+
+/* Routine:
+ *    ran_new_usched
+ * 
+ * Abstract:
+ *    Creates a new instance of an User-level scheduler.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - id, RAN_MAC_USER_* ID of the scheduler
+ * 
+ * Returns:
+ *    The new scheduler, or a null pointer if the ID is not known
+ */
+ran_user_scheduler * ran_new_usched(uint32_t id)
+{
+  switch(id) {
+  case RAN_MAC_USER_RR:
+    return new ran_rr_usched();
+  case RAN_MAC_USER_PF:
+    return new ran_pf_usched();
+  case RAN_MAC_USER_MCI:
+    return new ran_mci_usched();
+  }
+
+  return 0;
+}
+
 /******************************************************************************
  *                                                                            *
  *                         Slice schedulers for RAN                           *
@@ -637,7 +1116,7 @@ int ran_multi_ssched::set_resources(uint64_t id, int tti, int res)
  * "DUO-DYNAMIC" SLICE-ASSIGNMENT SCHEDULER
  *
  */
-#if 0
+
 /* Routine:
  *    ran_duodynamic_ssched::ran_duodynamic_ssched()
  *
@@ -670,16 +1149,16 @@ ran_duodynamic_ssched::ran_duodynamic_ssched()
   m_win      = 10;
   // Slice A ID
   m_tenA     = RAN_SLICE_STARTING; // <----------------------------------------- NOTE: Hardcoded for testing purposes
-  // Slice B ID
-  m_tenB     = 0;
+  // Slice B ID, the first other slice seen
+  m_tenB     = RAN_SLICE_INVALID;
   // Slot of TTIs used for scheduler monitoring
   m_win_slot = 0;
   // Amount of PRBG used by slice A
   m_tenA_rbg = 0;
   // Amount of PRBG used by slice B
   m_tenB_rbg = 0;
-  // Number of PRBG per TTI
-  m_rbg_max  = 13; // <--------------------------------------------------------- NOTE: Hardcoded for testing purposes
+  // Number of PRBG per TTI; 5MHz until the groups of the cell are seen
+  m_rbg_max  = 13;
 }
 
 /* Routine:
@@ -752,9 +1231,18 @@ int ran_duodynamic_ssched::set_resources(uint64_t id, int tti, int res)
   uint32_t rbg = (uint32_t)res;
 
   if(res < 0 || tti < 0) {
+    // Slice removed; the next other slice seen takes the B area
+    if(id == m_tenB) {
+      m_tenB = RAN_SLICE_INVALID;
+    }
+
     return -1;
   }
 
+  if(m_tenB == RAN_SLICE_INVALID && id != m_tenA) {
+    m_tenB = id;
+  }
+
   /* Case Slice A, allocation from 0 to switch:
    *    The allocation requested is the switch itself. This means that checks
    *    can be done directly using the given value 'res'.
@@ -832,13 +1320,22 @@ void ran_duodynamic_ssched::schedule(
 
   slice_map_t::iterator s; // Slice iterator
   user_map_t::iterator  u; // User map iterator
-  std::map<uint16_t, int>::iterator l; // User list iterator
+  srslte::rnti_table<int>::iterator l; // User list iterator
 
   uint32_t              tot_A;     // Total RBG for A
   int                   load_A = 0;// Is A loaded with data?
   uint32_t              tot_B;     // Total RBG for B
   int                   load_B = 0;// Is B loaded with data?
 
+  // Guess the groups of the cell from the last one which can be used
+  for (i = RAN_DL_MAX_RGB; i > m_rbg_max && rbg[i - 1]; i--) {
+    // Skip groups out of the cell
+  }
+
+  if (i > m_rbg_max) {
+    m_rbg_max = i;
+  }
+
   // Skip groups already in use and prepare the map for Slice A
   for (i = 0; i < RAN_DL_MAX_RGB; i++) {
     if (rbg[i]) {
@@ -858,6 +1355,10 @@ void ran_duodynamic_ssched::schedule(
 
   // Perform scheduling slice per slice
   for (s = smap->begin(); s != smap->end(); ++s) {
+    if(m_tenB == RAN_SLICE_INVALID && s->first != m_tenA) {
+      m_tenB = s->first;
+    }
+
     // Monitor the usage of Slice A or B
     if(s->first == m_tenA) {
       for(l = s->second.users.begin(); l != s->second.users.end(); ++l) {
@@ -922,7 +1423,7 @@ void ran_duodynamic_ssched::schedule(
     // A and B are not loaded
     if(!load_A && !load_B) {
       // Reset to 50/50 situation
-      m_switch = 7;
+      m_switch = m_rbg_max / 2;
       // What to do? Stay still?
       goto cont;
     }
@@ -948,7 +1449,7 @@ void ran_duodynamic_ssched::schedule(
     // Both are loaded
     if(load_A && load_B) {
       // Reset to 50/50 situation
-      m_switch = 7;
+      m_switch = m_rbg_max / 2;
     }
 
 cont:
@@ -961,18 +1462,58 @@ cont:
 
   return;
 }
-#endif
+
+/* Routine:
+ *    ran_new_ssched
+ * 
+ * Abstract:
+ *    Creates a new instance of a Slice-level scheduler.
+ * 
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - id, RAN_MAC_SLICE_* ID of the scheduler
+ *    - log_handle, Handle to the logging system used by the scheduler
+ * 
+ * Returns:
+ *    The new scheduler, or a null pointer if the ID is not known
+ */
+ran_slice_scheduler * ran_new_ssched(uint32_t id, srslte::log * log_handle)
+{
+  ran_multi_ssched * multi;
+
+  switch(id) {
+  case RAN_MAC_SLICE_MULTI:
+    multi        = new ran_multi_ssched();
+    multi->m_log = log_handle;
+    return multi;
+  case RAN_MAC_SLICE_DUO:
+    return new ran_duodynamic_ssched();
+  }
+
+  return 0;
+}
+
 /******************************************************************************
  *                                                                            *
- *                        DL part of RAN scheduler                            *
+ *                   Slices and users common to DL and UL                     *
  *                                                                            *
  ******************************************************************************/
 
+/* The control plane (agent, RRC) and the TTI thread never share the slice and
+ * user maps. Control plane calls modify their own copy of the configuration,
+ * 'm_cfg', and publish an immutable snapshot of it with an atomic exchange;
+ * the TTI thread takes the last snapshot at the beginning of the TTI and
+ * merges it into the maps it uses. A snapshot not taken yet is just replaced,
+ * so the TTI thread never waits for the control plane.
+ */
+
 /* Routine:
- *    dl_metric_ran::dl_metric_ran()
+ *    ran_metric::ran_metric()
  *
  * Abstract:
- *    Initializes the static resources needed for the DL metrics.
+ *    Initializes the slices and users bookkeeping of a RAN metric.
  *
  * Assumptions:
  *    ---
@@ -983,60 +1524,252 @@ cont:
  * Returns:
  *    ---
  */
-dl_metric_ran::dl_metric_ran()
+ran_metric::ran_metric()
 {
-  int i;
+  m_log         = 0;
+  m_tti_abs     = 0;
+  m_slice_sched = 0;
+  m_cfg_version = 0;
+  m_cfg_next    = 0;
 
-  m_tti           = 0;
-  m_tti_abs       = 0;
-  m_tti_rbg_mask  = 0;
-  m_tti_rbg_total = 0;
-  m_tti_rbg_left  = 0;
-  m_tti_rbg_start = 0;
-  m_ctrl_sym      = 0;
-  m_log           = 0;
-  m_slice_sched   = 0;
-  m_max_rbg       = 0;
-  m_rbg_size      = 0;
-  
-  for (i = 0; i < RAN_DL_MAX_RGB; i++) {
-    m_tti_rbg[i]  = false;
-    m_tti_users[i]= 0;
+  pthread_mutex_init(&m_cfg_lock, NULL);
+}
+
+/* Routine:
+ *    ran_metric::~ran_metric()
+ *
+ * Abstract:
+ *    Releases the schedulers and any configuration not applied yet.
+ *
+ * Assumptions:
+ *    The metric is no more used by the MAC scheduler.
+ * 
+ * Arguments:
+ *    ---
+ *
+ * Returns:
+ *    ---
+ */
+ran_metric::~ran_metric()
+{
+  slice_map_t::iterator it;
+
+  delete m_cfg_next;
+
+  for(it = m_slice_map.begin(); it != m_slice_map.end(); ++it) {
+    delete it->second.sched_user;
   }
+
+  delete m_slice_sched;
+
+  pthread_mutex_destroy(&m_cfg_lock);
 }
 
 /* Routine:
- *    dl_metric_ran::init()
+ *    ran_metric::init()
  *
  * Abstract:
- *    Creates the resources necessary for logging and synchronizing all the 
- *    elements of the Downlink scheduler.
+ *    Creates the resources necessary for logging and synchronizing the slices
+ *    and users of the RAN metric, and its slice scheduler.
  *
  * Assumptions:
  *    ---
  * 
  * Arguments:
  *    - log_handle, Handle to the logging system bound to the metric
+ *    - slice_sched, RAN_MAC_SLICE_* ID of the slice scheduler to use
  *
  * Returns:
  *    ---
  */
-void dl_metric_ran::init(srslte::log * log_handle)
+void ran_metric::init(srslte::log * log_handle, uint32_t slice_sched)
 {
-  m_log        = log_handle;
-#ifdef RAN_TRACE
-  m_rtd.logger = log_handle;
-#endif // RAN_TRACE
+  m_log = log_handle;
+
+  m_slice_sched = ran_new_ssched(slice_sched, log_handle);
+
+  if(!m_slice_sched) {
+    Error("Slice scheduler %x not known, using multi-slice\n", slice_sched);
+    m_slice_sched = ran_new_ssched(RAN_MAC_SLICE_MULTI, log_handle);
+  }
+}
+
+/* Routine:
+ *    ran_metric::publish_cfg()
+ *
+ * Abstract:
+ *    Makes a copy of the control plane configuration available to the TTI
+ *    thread. If the previous one has not been taken yet, it is discarded.
+ *
+ * Assumptions:
+ *    'm_cfg_lock' is held by the caller.
+ * 
+ * Arguments:
+ *    ---
+ *
+ * Returns:
+ *    ---
+ */
+void ran_metric::publish_cfg()
+{
+  slice_cfg_map_t * cfg = new slice_cfg_map_t(m_cfg);
+  slice_cfg_map_t * old = 0;
+  slice_cfg_map_t * cur;
+
+  // Full barrier: the snapshot must be complete before it becomes visible
+  while((cur = __sync_val_compare_and_swap(&m_cfg_next, old, cfg)) != old) {
+    old = cur;
+  }
+
+  // Never seen by the TTI thread
+  delete old;
+}
+
+/* Routine:
+ *    ran_metric::apply_cfg()
+ *
+ * Abstract:
+ *    Takes the last configuration published by the control plane, if any, and
+ *    merges it into the slice and user maps. User schedulers keep their state
+ *    if the slice does not change policy, and the slice scheduler credits are
+ *    renewed only for slices whose resources have been set again.
+ *
+ * Assumptions:
+ *    Called by the TTI thread before scheduling.
+ * 
+ * Arguments:
+ *    ---
+ *
+ * Returns:
+ *    ---
+ */
+void ran_metric::apply_cfg()
+{
+  slice_cfg_map_t *                 cfg;
+  slice_cfg_map_t::iterator         ci;
+  slice_map_t::iterator             si;
+  srslte::rnti_table<int>::iterator ui;
+  std::map<uint16_t, int>::iterator cu;
+  srslte::rnti_table<int>           left;
+
+  cfg = __sync_lock_test_and_set(&m_cfg_next, (slice_cfg_map_t *)0);
+
+  if(!cfg) {
+    return;
+  }
+
+  // Drop the slices which have been removed
+  si = m_slice_map.begin();
+
+  while(si != m_slice_map.end()) {
+    for(ui = si->second.users.begin(); ui != si->second.users.end(); ++ui) {
+      left[ui->first] = 1;
+    }
+
+    if(cfg->count(si->first) == 0) {
+      if(m_slice_sched) {
+        m_slice_sched->set_resources(si->first, -1, -1);
+      }
+
+      delete si->second.sched_user;
+      m_slice_map.erase(si++);
+    } else {
+      ++si;
+    }
+  }
+
+  // Add or update the others
+  for(ci = cfg->begin(); ci != cfg->end(); ++ci) {
+    ran_mac_slice * slice = &m_slice_map[ci->first];
+
+    if(!slice->sched_user || slice->sched_user->m_id != ci->second.user_sched) {
+      delete slice->sched_user;
+      slice->sched_user = ran_new_usched(ci->second.user_sched);
+    }
+
+    if(m_slice_sched && slice->cfg_version != ci->second.version) {
+      m_slice_sched->set_resources(
+        ci->first, ci->second.time, ci->second.rbg);
+    }
+
+    slice->cfg_version = ci->second.version;
+    slice->users.clear();
+
+    for(cu = ci->second.users.begin(); cu != ci->second.users.end(); ++cu) {
+      slice->users[cu->first] = 1;
+      left.erase(cu->first);
+
+      // The user has been associated by the agent, so do not handle by yourself
+      m_user_map[cu->first].self_m = !cu->second;
+    }
+  }
+
+  // Users which are no more part of any slice start from scratch
+  for(ui = left.begin(); ui != left.end(); ++ui) {
+    m_user_map.erase(ui->first);
+  }
+
+  delete cfg;
+}
 
-  pthread_spin_init(&m_lock, 0);
+/* Routine:
+ *    ran_metric::update_user()
+ *
+ * Abstract:
+ *    Adds or refreshes the RAN entry of an user seen during this TTI, and
+ *    registers if it has something to transmit and its channel state.
+ *
+ * Assumptions:
+ *    Called once per TTI and user by the metric, with 'm_tti_abs' already
+ *    incremented for the current TTI.
+ * 
+ * Arguments:
+ *    - rnti, ID of the user
+ *    - has_data, the user has new or re-tx data?
+ *    - cqi, last wideband CQI reported by the user
+ *    - rbg_rate, bytes which the user can carry in a group at that CQI
+ *    - rbg_demand, groups needed to serve the data of the user
+ *
+ * Returns:
+ *    ---
+ */
+void ran_metric::update_user(
+  uint16_t rnti,
+  int      has_data,
+  uint32_t cqi,
+  uint32_t rbg_rate,
+  uint32_t rbg_demand)
+{
+  // Add or update an UE entry
+  if (m_user_map.count(rnti) == 0) {
+    m_user_map[rnti].self_m        = 1;
+    m_user_map[rnti].last_seen     = m_tti_abs;
+    m_user_map[rnti].DL_data       = 0;
+    m_user_map[rnti].DL_data_delta = 0;
+    m_user_map[rnti].DL_rbg_delta  = 0;
+    m_user_map[rnti].UL_rbg_delta  = 0;
+  } else {
+    // Out for 5 seconds? Consider it as out
+    if (m_tti_abs - m_user_map[rnti].last_seen > 5000) {
+      m_user_map[rnti].self_m        = 1;
+      m_user_map[rnti].last_seen     = m_tti_abs;
+      m_user_map[rnti].DL_data       = 0;
+      m_user_map[rnti].DL_data_delta = 0;
+    } else {
+      // Save the TTI where we saw this user last time
+      m_user_map[rnti].last_seen = m_tti_abs;
+    }
+  }
 
-  //m_slice_sched = new ran_duodynamic_ssched();
-  m_slice_sched = new ran_multi_ssched();
-  ((ran_multi_ssched *)(m_slice_sched))->m_log = log_handle; // <-------------------------------------------------------
+  // Regardless of what happens, register if it has data or not
+  m_user_map[rnti].has_data   = has_data ? 1 : 0;
+  m_user_map[rnti].cqi        = cqi;
+  m_user_map[rnti].rbg_rate   = rbg_rate;
+  m_user_map[rnti].rbg_demand = has_data ? rbg_demand : 0;
 }
 
 /* Routine:
- *    dl_metric_ran::add_slice()
+ *    ran_metric::add_slice()
  *
  * Abstract:
  *    Adds a new slice in a compatible way into the MAC slicing subsystem
@@ -1050,21 +1783,23 @@ void dl_metric_ran::init(srslte::log * log_handle)
  * Returns:
  *    Zero on success, otherwise a negative error number
  */
-int  dl_metric_ran::add_slice(uint64_t id)
+int  ran_metric::add_slice(uint64_t id)
 {
-  pthread_spin_lock(&m_lock);
+  pthread_mutex_lock(&m_cfg_lock);
 
-  if(m_slice_map.count(id) != 0) {
+  if(m_cfg.count(id) != 0) {
     Error("Slice %" PRIu64 " already existing in the MAC scheduler\n", id);
     
-    pthread_spin_unlock(&m_lock);  
+    pthread_mutex_unlock(&m_cfg_lock);
     return -1;
   }
 
-  // Creates the slice and assign a default RR user scheduler to it
-  m_slice_map[id].sched_user = new ran_rr_usched();
+  // Creates the slice, with a default RR user scheduler
+  m_cfg[id].user_sched = RAN_MAC_USER_RR;
+
+  publish_cfg();
 
-  pthread_spin_unlock(&m_lock);
+  pthread_mutex_unlock(&m_cfg_lock);
 
   Info("Slice %" PRIu64 " added to RAN MAC scheduler\n", id);
 
@@ -1072,7 +1807,7 @@ int  dl_metric_ran::add_slice(uint64_t id)
 }
 
 /* Routine:
- *    dl_metric_ran::rem_slice()
+ *    ran_metric::rem_slice()
  *
  * Abstract:
  *    Removes a slice from the MAC slicing subsystem
@@ -1086,34 +1821,25 @@ int  dl_metric_ran::add_slice(uint64_t id)
  * Returns:
  *    ---
  */
-void dl_metric_ran::rem_slice(uint64_t id)
+void ran_metric::rem_slice(uint64_t id)
 {
-  ran_user_scheduler *  us;
-  slice_map_t::iterator it;
-
   if(id == RAN_SLICE_STARTING) {
     Error("Cannot remove the default slice\n");
     return;
   }
 
-  pthread_spin_lock(&m_lock);
+  pthread_mutex_lock(&m_cfg_lock);
 
-  it = m_slice_map.find(id);
-
-  if(it == m_slice_map.end()) {
+  if(m_cfg.erase(id) == 0) {
     Error("Slice %" PRIu64 "not found in the MAC scheduler\n", id);
 
-    pthread_spin_unlock(&m_lock);
+    pthread_mutex_unlock(&m_cfg_lock);
     return;
   }
 
-  us = it->second.sched_user;
-  m_slice_map.erase(it);
-
-  pthread_spin_unlock(&m_lock);
+  publish_cfg();
 
-  // Delete the class instance 
-  delete us;
+  pthread_mutex_unlock(&m_cfg_lock);
 
   Info("Slice %" PRIu64 " removed from RAN MAC scheduler\n", id);
 
@@ -1121,10 +1847,12 @@ void dl_metric_ran::rem_slice(uint64_t id)
 }
 
 /* Routine:
- *    dl_metric_ran::set_slice()
+ *    ran_metric::set_slice()
  *
  * Abstract:
- *    Configures a slice to behave according to a new configuration provided
+ *    Configures a slice to behave according to a new configuration provided.
+ *    A non-zero user scheduler ID replaces the user scheduler of the slice, if
+ *    different from the one in use.
  *
  * Assumptions:
  *    ---
@@ -1136,14 +1864,64 @@ void dl_metric_ran::rem_slice(uint64_t id)
  * Returns:
  *    Zero on success, otherwise a negative error code
  */
-int dl_metric_ran::set_slice(uint64_t id, mac_set_slice_args * args)
+int ran_metric::set_slice(uint64_t id, mac_set_slice_args * args)
 {
-  // Feed the argument to the scheduler 
-  return m_slice_sched->set_resources(id, (int)args->time, (int)args->rbg);
+  ran_user_scheduler *      us;
+  slice_cfg_map_t::iterator it;
+
+  if(id == RAN_SLICE_INVALID) {
+    return -1;
+  }
+
+  // Check that the user scheduler is known before accepting it
+  if(args->user_sched != 0) {
+    us = ran_new_usched(args->user_sched);
+
+    if(!us) {
+      Error("User scheduler %x not supported\n", args->user_sched);
+      return -1;
+    }
+
+    delete us;
+  }
+
+  pthread_mutex_lock(&m_cfg_lock);
+
+  it = m_cfg.find(id);
+
+  if(it == m_cfg.end()) {
+    pthread_mutex_unlock(&m_cfg_lock);
+
+    Error("Slice %" PRIu64 " not found in the MAC scheduler\n", id);
+    return -1;
+  }
+
+  if(args->user_sched != 0 && args->user_sched != it->second.user_sched) {
+    Info("Slice %" PRIu64 " now using user scheduler %x\n", 
+      id, args->user_sched);
+
+    it->second.user_sched = args->user_sched;
+  }
+
+  // New resources renew the slice credits, even if they are the same
+  it->second.time    = (int)args->time;
+  it->second.rbg     = (int)args->rbg;
+  it->second.version = ++m_cfg_version;
+
+  // Zero is reserved for slices never set
+  if(it->second.version == 0) {
+    it->second.version = ++m_cfg_version;
+  }
+
+  publish_cfg();
+
+  pthread_mutex_unlock(&m_cfg_lock);
+
+  return 0;
 }
 
 /* Routine:
- *    dl_metric_ran::add_slice_user()
+ *    ran_metric::add_slice_user()
  *
  * Abstract:
  *    Associate an user with a slice. The user can be associated with a locked
@@ -1161,22 +1939,22 @@ int dl_metric_ran::set_slice(uint64_t id, mac_set_slice_args * args)
  * Returns:
  *    Zero on success, otherwise a negative error code
  */
-int  dl_metric_ran::add_slice_user(uint16_t rnti, uint64_t slice, int lock)
+int  ran_metric::add_slice_user(uint16_t rnti, uint64_t slice, int lock)
 {
-  std::list<uint16_t>::iterator it;
+  slice_cfg_map_t::iterator it;
 
-  pthread_spin_lock(&m_lock);
+  pthread_mutex_lock(&m_cfg_lock);
 
-  if(m_slice_map.count(slice) == 0) {
+  it = m_cfg.find(slice);
+
+  if(it == m_cfg.end()) {
     Error("Slice %" PRIu64 " does not exists in the MAC scheduler\n", slice);
     
-    pthread_spin_unlock(&m_lock);  
+    pthread_mutex_unlock(&m_cfg_lock);
     return -1;
   }
 
-  // The user has been associated by the agent, so do not handle by yourself
-  m_user_map[rnti].self_m        = !lock;
-  m_slice_map[slice].users[rnti] = 1;
+  it->second.users[rnti] = lock;
 
   /* If the element is inserted in the 'default' tenant, also some new resources
    * should be given to the slice, since they are usually consumed for initial
@@ -1191,15 +1969,17 @@ int  dl_metric_ran::add_slice_user(uint16_t rnti, uint64_t slice, int lock)
   //  m_slice_map[RAN_DEFAULT_SLICE].users.erase(rnti);
   //}
 
-  Info("User %d associated to slice %" PRIu64 "\n", rnti, slice);
+  publish_cfg();
 
-  pthread_spin_unlock(&m_lock);
+  pthread_mutex_unlock(&m_cfg_lock);
+
+  Info("User %d associated to slice %" PRIu64 "\n", rnti, slice);
 
   return 0;
 }
 
 /* Routine:
- *    dl_metric_ran::rem_slice_user()
+ *    ran_metric::rem_slice_user()
  *
  * Abstract:
  *    Removes an association of an user with a slice.
@@ -1209,47 +1989,40 @@ int  dl_metric_ran::add_slice_user(uint16_t rnti, uint64_t slice, int lock)
  * 
  * Arguments:
  *    - rnti, ID of the user to remove from the slice
- *    - slice, ID of the slice
+ *    - slice, ID of the slice, or zero to remove it from all the slices
  *
  * Returns:
  *    Zero on success, otherwise a negative error code
  */
-void dl_metric_ran::rem_slice_user(uint16_t rnti, uint64_t slice)
+void ran_metric::rem_slice_user(uint16_t rnti, uint64_t slice)
 {
-  //std::map<uint16_t>::iterator it;
-  slice_map_t::iterator        si;
-  pthread_spin_lock(&m_lock);
-
-  // Remove from any slice
-  if(slice == 0) {
-    // Remove any instance of that user 
-    for(si = m_slice_map.begin(); si != m_slice_map.end(); ++si) {
-      if(si->second.users.count(rnti) > 0) {
-        si->second.users.erase(rnti);
-      }
+  slice_cfg_map_t::iterator it;
+  int                       found = 0;
+
+  pthread_mutex_lock(&m_cfg_lock);
+
+  for(it = m_cfg.begin(); it != m_cfg.end(); ++it) {
+    // Remove from any slice, or from a specific one
+    if(slice == 0 || it->first == slice) {
+      found += it->second.users.erase(rnti);
     }
   }
-  // Remove from a specific slice
-  else {
-    m_slice_map[slice].users.erase(rnti);
+
+  if(found) {
+    publish_cfg();
   }
 
-  if(m_user_map.count(rnti) > 0) {
-    // The user has been associated by the agent, so do not handle by yourself
-    //m_user_map[rnti].self_m = !lock;
-    m_user_map.erase(rnti);
-    m_slice_map[slice].users.erase(rnti);
+  pthread_mutex_unlock(&m_cfg_lock);
 
-    Info("Slice %d removed from slice %" PRIu64 "\n", rnti, slice);
+  if(found) {
+    Info("User %d removed from slice %" PRIu64 "\n", rnti, slice);
   }
 
-  pthread_spin_unlock(&m_lock);
-
   return;
 }
 
 /* Routine:
- *    dl_metric_ran::get_slice_sched_id()
+ *    ran_metric::get_slice_sched_id()
  *
  * Abstract:
  *    Returns the ID of the slicer scheduler currently running in the system
@@ -1263,13 +2036,13 @@ void dl_metric_ran::rem_slice_user(uint16_t rnti, uint64_t slice)
  * Returns:
  *    ID of the scheduler
  */
-uint32_t dl_metric_ran::get_slice_sched_id()
+uint32_t ran_metric::get_slice_sched_id()
 {
   return m_slice_sched->m_id;
 }
 
 /* Routine:
- *    dl_metric_ran::get_slice_info()
+ *    ran_metric::get_slice_info()
  *
  * Abstract:
  *    Query a slice for its current configuration
@@ -1284,18 +2057,25 @@ uint32_t dl_metric_ran::get_slice_sched_id()
  * Returns:
  *    Zero on success, otherwise a negative error code
  */
-int dl_metric_ran::get_slice_info(uint64_t id,  mac_set_slice_args * args)
+int ran_metric::get_slice_info(uint64_t id,  mac_set_slice_args * args)
 {
-  int res = 0;
+  slice_cfg_map_t::iterator it;
+
+  pthread_mutex_lock(&m_cfg_lock);
+
+  it = m_cfg.find(id);
+
+  if(it == m_cfg.end()) {
+    pthread_mutex_unlock(&m_cfg_lock);
 
-  if(m_slice_map.count(id) == 0) {
     Error("Slice %" PRIu64 " not found in the MAC scheduler\n", id);
     return -1;
   }
 
-  args->user_sched = m_slice_map[id].sched_user->m_id;
-  m_slice_sched->get_resources(id, 0, &res);
-  args->rbg = res;
+  args->user_sched = it->second.user_sched;
+  args->rbg        = it->second.rbg;
+
+  pthread_mutex_unlock(&m_cfg_lock);
 
   // Do not handle users; will be set by upper layers
   args->nof_users  = 0;
@@ -1303,6 +2083,97 @@ int dl_metric_ran::get_slice_info(uint64_t id,  mac_set_slice_args * args)
   return 0;
 }
 
+/* Routine:
+ *    ran_metric::has_slice()
+ *
+ * Abstract:
+ *    Checks if a slice exists in the MAC slicing subsystem
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - id, ID of the slice to look for
+ *
+ * Returns:
+ *    True if the slice exists, otherwise false
+ */
+bool ran_metric::has_slice(uint64_t id)
+{
+  bool ret;
+
+  pthread_mutex_lock(&m_cfg_lock);
+  ret = m_cfg.count(id) != 0;
+  pthread_mutex_unlock(&m_cfg_lock);
+
+  return ret;
+}
+
+/******************************************************************************
+ *                                                                            *
+ *                        DL part of RAN scheduler                            *
+ *                                                                            *
+ ******************************************************************************/
+
+/* Routine:
+ *    dl_metric_ran::dl_metric_ran()
+ *
+ * Abstract:
+ *    Initializes the static resources needed for the DL metrics.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ *
+ * Returns:
+ *    ---
+ */
+dl_metric_ran::dl_metric_ran()
+{
+  int i;
+
+  m_tti           = 0;
+  m_tti_rbg_mask  = 0;
+  m_tti_rbg_total = 0;
+  m_tti_rbg_left  = 0;
+  m_tti_rbg_start = 0;
+  m_ctrl_sym      = 0;
+  m_max_rbg       = 0;
+  m_rbg_size      = 0;
+  
+  for (i = 0; i < RAN_DL_MAX_RGB; i++) {
+    m_tti_rbg[i]  = false;
+    m_tti_users[i]= 0;
+  }
+}
+
+/* Routine:
+ *    dl_metric_ran::init()
+ *
+ * Abstract:
+ *    Creates the resources necessary for logging and synchronizing all the 
+ *    elements of the Downlink scheduler.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - log_handle, Handle to the logging system bound to the metric
+ *    - slice_sched, RAN_MAC_SLICE_* ID of the slice scheduler to use
+ *
+ * Returns:
+ *    ---
+ */
+void dl_metric_ran::init(srslte::log * log_handle, uint32_t slice_sched)
+{
+  ran_metric::init(log_handle, slice_sched);
+#ifdef RAN_TRACE
+  m_rtd.logger = log_handle;
+#endif // RAN_TRACE
+}
+
 /* Routine:
  *    dl_metric_ran::new_tti()
  *
@@ -1325,7 +2196,7 @@ int dl_metric_ran::get_slice_info(uint64_t id,  mac_set_slice_args * args)
  *    ---
  */
 void dl_metric_ran::new_tti(
-  std::map<uint16_t, sched_ue> &ue_db,
+  sched_ue_db_t &ue_db,
   uint32_t                      start_rbg,
   uint32_t                      nof_rbg,
   uint32_t                      nof_ctrl_sym,
@@ -1335,13 +2206,18 @@ void dl_metric_ran::new_tti(
 
   uint32_t       has_data = 0;
   dl_harq_proc * has_harq = 0;
+  uint32_t       rate;
+  uint32_t       demand;
 
   slice_map_t::iterator                  ti;
   std::list<uint16_t>::iterator          ui;
-  std::map<uint16_t, sched_ue>::iterator iter;
+  sched_ue_db_t::iterator iter;
 
   sched_ue * user;
 
+  // Slices reconfigured since the previous TTI?
+  apply_cfg();
+
   m_tti_abs++;
   m_tti_rbg_start = start_rbg;
   m_tti_rbg_left  = nof_rbg - start_rbg;
@@ -1403,35 +2279,18 @@ void dl_metric_ran::new_tti(
     has_data = user->get_pending_dl_new_data(m_tti);
     has_harq = user->get_pending_dl_harq(m_tti);
 
-    pthread_spin_lock(&m_lock);
+    // What the user can carry in a group, and how many groups it needs
+    rate   = user->get_achievable_bytes_dl(m_rbg_size, m_ctrl_sym);
+    demand = 0;
 
-    // Add or update an UE entry
-    if (m_user_map.count(user->rnti) == 0) {
-      m_user_map[user->rnti].self_m        = 1;
-      m_user_map[user->rnti].last_seen     = m_tti_abs;
-      m_user_map[user->rnti].DL_data       = 0;
-      m_user_map[user->rnti].DL_data_delta = 0;
-    } else {
-      // Out for 5 seconds? Consider it as out
-      if (m_tti_abs - m_user_map[user->rnti].last_seen > 5000) {
-        m_user_map[user->rnti].self_m        = 1;
-        m_user_map[user->rnti].last_seen     = m_tti_abs;
-        m_user_map[user->rnti].DL_data       = 0;
-        m_user_map[user->rnti].DL_data_delta = 0;
-      } else {
-        // Save the TTI where we saw this user last time
-        m_user_map[user->rnti].last_seen = m_tti_abs;
-      }
+    if (has_harq) {
+      demand = count_rbg(has_harq->get_rbgmask());
+    } else if (has_data > 0) {
+      demand = rate > 0 ? (has_data + rate - 1) / rate : m_tti_rbg_left;
     }
 
-    // Regardless of what happens, register if it has data or not
-    if(has_data > 0 || has_harq) {
-      m_user_map[user->rnti].has_data = 1;
-    } else {
-      m_user_map[user->rnti].has_data = 0;
-    }    
-
-  pthread_spin_unlock(&m_lock);
+    update_user(
+      user->rnti, has_data > 0 || has_harq, user->get_dl_cqi(), rate, demand);
   }
 
   // Has a slice scheduler associated? 
@@ -1751,4 +2610,417 @@ int dl_metric_ran::new_allocation(
   return t;
 }
 
+/******************************************************************************
+ *                                                                            *
+ *                        UL part of RAN scheduler                            *
+ *                                                                            *
+ ******************************************************************************/
+
+/* Routine:
+ *    ul_metric_ran::ul_metric_ran()
+ *
+ * Abstract:
+ *    Initializes the static resources needed for the UL metrics.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    ---
+ *
+ * Returns:
+ *    ---
+ */
+ul_metric_ran::ul_metric_ran()
+{
+  int i;
+
+  m_tti      = 0;
+  m_nof_rb   = 0;
+  m_grp_size = 1;
+  m_nof_grp  = 0;
+
+  for (i = 0; i < MAX_PRB; i++) {
+    m_used_rb[i]   = false;
+  }
+
+  for (i = 0; i < RAN_DL_MAX_RGB; i++) {
+    m_tti_grp[i]   = false;
+    m_tti_users[i] = 0;
+  }
+}
+
+/* Routine:
+ *    ul_metric_ran::reset_allocation()
+ *
+ * Abstract:
+ *    Marks all the PRBs of the UL as free. The MAC scheduler then reserves
+ *    PRACH, Msg3 and PUCCH before calling new_tti.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - nof_rb_, number of PRB of the UL
+ *
+ * Returns:
+ *    ---
+ */
+void ul_metric_ran::reset_allocation(uint32_t nof_rb_)
+{
+  m_nof_rb = nof_rb_ < MAX_PRB ? nof_rb_ : MAX_PRB;
+  bzero(m_used_rb, sizeof(bool) * MAX_PRB);
+}
+
+/* Routine:
+ *    ul_metric_ran::new_tti()
+ *
+ * Abstract:
+ *    Organize this new Uplink TTI. Re-transmissions keep their PRBs if these
+ *    are still free, then the slice scheduler distributes the free PRB groups
+ *    among slices and users, and finally new data (or re-transmissions that
+ *    need to move) is allocated in the groups of each user.
+ *
+ * Assumptions:
+ *    PRACH, Msg3 and PUCCH have already been reserved with update_allocation.
+ * 
+ * Arguments:
+ *    - ue_db, UE database of the MAC layer
+ *    - nof_rb, number of PRB of the UL
+ *    - tti, TTI number
+ *
+ * Returns:
+ *    ---
+ */
+void ul_metric_ran::new_tti(
+  sched_ue_db_t &ue_db,
+  uint32_t                      nof_rb,
+  uint32_t                      tti)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t nof_free;
+
+  uint32_t rate;
+  uint32_t demand;
+
+  ul_harq_proc *                         h;
+  ul_harq_proc::ul_alloc_t               alloc;
+  sched_ue_db_t::iterator iter;
+  user_map_t::iterator                   ui;
+
+  sched_ue * user;
+
+  // Slices reconfigured since the previous TTI?
+  apply_cfg();
+
+  m_tti_abs++;
+  m_tti      = tti;
+  m_grp_size = srslte_ra_type0_P(m_nof_rb);
+  m_nof_grp  = (m_nof_rb + m_grp_size - 1) / m_grp_size;
+
+  if (m_nof_grp > RAN_DL_MAX_RGB) {
+    m_nof_grp = RAN_DL_MAX_RGB;
+  }
+
+  /* Re-transmissions go first and keep their PRBs if still free, wherever they
+   * are; this also updates the RAN view of the users.
+   */
+  for (iter = ue_db.begin(); iter != ue_db.end(); ++iter) {
+    user = (sched_ue *)&iter->second;
+    h    = user->get_ul_harq(m_tti);
+
+    user->ul_next_alloc = allocate_user_retx_prbs(user);
+
+    /* Users re-transmitting in place do not need any group, the ones whose
+     * re-transmission has to move need the same number of PRBs.
+     */
+    rate   = user->get_achievable_bytes_ul(m_grp_size);
+    demand = 0;
+
+    if (user->ul_next_alloc) {
+      demand = 0;
+    } else if (!h->is_empty(0)) {
+      demand = (h->get_alloc().L + m_grp_size - 1) / m_grp_size;
+    } else {
+      demand = user->get_pending_ul_new_data(m_tti);
+      demand = rate > 0 ? (demand + rate - 1) / rate : m_nof_grp;
+    }
+
+    update_user(user->rnti, 
+      user->get_pending_ul_new_data(m_tti) > 0 || !h->is_empty(0),
+      user->get_ul_cqi(), rate, demand);
+  }
+
+  /* Groups without any free PRB (PUCCH, PRACH, Msg3 or re-transmissions) are
+   * not given to the slices.
+   */
+  for (i = 0; i < RAN_DL_MAX_RGB; i++) {
+    m_tti_users[i] = 0;
+
+    if (i >= m_nof_grp) {
+      m_tti_grp[i] = true; // In use
+      continue;
+    }
+
+    nof_free = 0;
+
+    for (j = i * m_grp_size; j < (i + 1) * m_grp_size && j < m_nof_rb; j++) {
+      if (!m_used_rb[j]) {
+        nof_free++;
+      }
+    }
+
+    m_tti_grp[i] = nof_free == 0;
+  }
+
+  // Has a slice scheduler associated? 
+  if (m_slice_sched) {
+    m_slice_sched->schedule(
+      m_tti, &m_slice_map, &m_user_map, m_tti_grp, m_tti_users);
+  }
+
+  // Now allocate new data in the groups given to each user
+  for (iter = ue_db.begin(); iter != ue_db.end(); ++iter) {
+    user = (sched_ue *)&iter->second;
+
+    if (!user->ul_next_alloc) {
+      user->ul_next_alloc = allocate_user_newtx_prbs(user);
+    }
+
+    ui = m_user_map.find(user->rnti);
+
+    if (ui != m_user_map.end()) {
+      ui->second.UL_rbg_delta = 0;
+
+      if (user->ul_next_alloc) {
+        alloc = user->ul_next_alloc->get_alloc();
+        ui->second.UL_rbg_delta = (alloc.L + m_grp_size - 1) / m_grp_size;
+      }
+    }
+  }
+}
+
+/* Routine:
+ *    ul_metric_ran::get_user_allocation()
+ *
+ * Abstract:
+ *    Returns the allocation organized for the user during new_tti.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - user, MAC information of the user
+ *
+ * Returns:
+ *    A valid UL HARQ pointer on success, otherwise a null pointer to inform
+ *    that no allocation for this user has been done.
+ */
+ul_harq_proc * ul_metric_ran::get_user_allocation(sched_ue * user)
+{
+  return user->ul_next_alloc;
+}
+
+/* Routine:
+ *    ul_metric_ran::update_allocation()
+ *
+ * Abstract:
+ *    Marks the PRBs of an allocation as in use.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - alloc, allocation to reserve
+ *
+ * Returns:
+ *    True if all the PRBs were free, otherwise false (they are marked as in use
+ *    anyway).
+ */
+bool ul_metric_ran::update_allocation(ul_harq_proc::ul_alloc_t alloc)
+{
+  uint32_t n;
+  bool     ret = allocation_is_valid(alloc);
+
+  for (n = alloc.RB_start; n < alloc.RB_start + alloc.L && n < MAX_PRB; n++) {
+    m_used_rb[n] = true;
+  }
+
+  return ret;
+}
+
+/* Routine:
+ *    ul_metric_ran::allocation_is_valid()
+ *
+ * Abstract:
+ *    Check if the PRBs of an allocation are inside the UL and still free.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - alloc, allocation to check
+ *
+ * Returns:
+ *    True or false depending if the allocation is valid or not
+ */
+bool ul_metric_ran::allocation_is_valid(ul_harq_proc::ul_alloc_t alloc)
+{
+  uint32_t n;
+
+  if (alloc.RB_start + alloc.L > m_nof_rb) {
+    return false;
+  }
+
+  for (n = alloc.RB_start; n < alloc.RB_start + alloc.L; n++) {
+    if (m_used_rb[n]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* Routine:
+ *    ul_metric_ran::new_allocation()
+ *
+ * Abstract:
+ *    Look for contiguous free PRBs inside the groups assigned to an user. The
+ *    first run long enough is taken, otherwise the longest one. The length is
+ *    then reduced to one valid for SC-FDMA.
+ *
+ * Assumptions:
+ *    'm_tti_users' has been filled by the slice scheduler.
+ * 
+ * Arguments:
+ *    - rnti, user to allocate
+ *    - L, number of PRB requested
+ *    - alloc, pointer to the resulting allocation
+ *
+ * Returns:
+ *    True if some PRB have been found, otherwise false
+ */
+bool ul_metric_ran::new_allocation(
+  uint16_t rnti, uint32_t L, ul_harq_proc::ul_alloc_t * alloc)
+{
+  uint32_t n;
+  uint32_t start = 0;
+  uint32_t len   = 0;
+
+  bzero(alloc, sizeof(ul_harq_proc::ul_alloc_t));
+
+  for (n = 0; n <= m_nof_rb && alloc->L < L; n++) {
+    // Free and in a group of this user?
+    if (n < m_nof_rb && !m_used_rb[n] && m_tti_users[n / m_grp_size] == rnti) {
+      if (len == 0) {
+        start = n;
+      }
+      len++;
+      continue;
+    }
+
+    // End of a run; keep it if longer than the best so far
+    if (len > alloc->L) {
+      alloc->RB_start = start;
+      alloc->L        = len;
+    }
+
+    len = 0;
+  }
+
+  if (alloc->L > L) {
+    alloc->L = L;
+  }
+
+  // Make sure L is allowed by SC-FDMA modulation 
+  while (alloc->L > 0 && !srslte_dft_precoding_valid_prb(alloc->L)) {
+    alloc->L--;
+  }
+
+  return alloc->L > 0;
+}
+
+/* Routine:
+ *    ul_metric_ran::allocate_user_retx_prbs()
+ *
+ * Abstract:
+ *    If the user has a pending re-transmission and its PRBs are still free,
+ *    keep them for this TTI.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - user, MAC information of the user
+ *
+ * Returns:
+ *    The HARQ process to re-transmit, or a null pointer.
+ */
+ul_harq_proc * ul_metric_ran::allocate_user_retx_prbs(sched_ue * user)
+{
+  ul_harq_proc * h = user->get_ul_harq(m_tti);
+
+  if (!h->is_empty(0) && update_allocation(h->get_alloc())) {
+    return h;
+  }
+
+  return NULL;
+}
+
+/* Routine:
+ *    ul_metric_ran::allocate_user_newtx_prbs()
+ *
+ * Abstract:
+ *    Allocates PRBs in the groups assigned to the user. A pending 
+ *    re-transmission which could not keep its PRBs is moved here with the same
+ *    size, otherwise the user pending data is allocated.
+ *
+ * Assumptions:
+ *    ---
+ * 
+ * Arguments:
+ *    - user, MAC information of the user
+ *
+ * Returns:
+ *    The HARQ process scheduled, or a null pointer.
+ */
+ul_harq_proc * ul_metric_ran::allocate_user_newtx_prbs(sched_ue * user)
+{
+  uint32_t                 pending_data;
+  ul_harq_proc *           h = user->get_ul_harq(m_tti);
+  ul_harq_proc::ul_alloc_t alloc;
+
+  // Re-transmission which has to move
+  if (!h->is_empty(0)) {
+    alloc = h->get_alloc();
+
+    if (new_allocation(user->rnti, alloc.L, &alloc) && 
+      alloc.L == h->get_alloc().L) 
+    {
+      update_allocation(alloc);
+      h->set_alloc(alloc);
+
+      return h;
+    }
+
+    return NULL;
+  }
+
+  pending_data = user->get_pending_ul_new_data(m_tti);
+
+  if (pending_data == 0) {
+    return NULL;
+  }
+
+  if (new_allocation(user->rnti, user->get_required_prb_ul(pending_data), &alloc)) {
+    update_allocation(alloc);
+    h->set_alloc(alloc);
+
+    return h;
+  }
+
+  return NULL;
+}
+
 } // namespace srsenb 
@@ -76,7 +76,7 @@ uint32_t dl_metric_rr::get_required_rbg(sched_ue *user, uint32_t tti)
   return user->prb_to_rbg(user->get_required_prb_dl(pending_data, nof_ctrl_symbols));
 }
 
-void dl_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rbg, uint32_t nof_rbg, uint32_t nof_ctrl_symbols_, uint32_t tti)
+void dl_metric_rr::new_tti(sched_ue_db_t &ue_db, uint32_t start_rbg, uint32_t nof_rbg, uint32_t nof_ctrl_symbols_, uint32_t tti)
 {
   total_rbg = start_rbg+nof_rbg;
   for (uint32_t i=0;i<total_rbg;i++) {
@@ -96,7 +96,7 @@ void dl_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb
 
   // give priority in a time-domain RR basis
   uint32_t priority_idx = current_tti % ue_db.size();
-  std::map<uint16_t, sched_ue>::iterator iter = ue_db.begin();
+  sched_ue_db_t::iterator iter = ue_db.begin();
   std::advance(iter,priority_idx);
   for(uint32_t ue_count = 0 ; ue_count < ue_db.size() ; ++iter, ++ue_count) {
     if(iter==ue_db.end()) {
@@ -216,9 +216,9 @@ void ul_metric_rr::reset_allocation(uint32_t nof_rb_)
   bzero(used_rb, nof_rb*sizeof(bool));
 }
 
-void ul_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb_, uint32_t tti)
+void ul_metric_rr::new_tti(sched_ue_db_t &ue_db, uint32_t nof_rb_, uint32_t tti)
 {
-  typedef std::map<uint16_t, sched_ue>::iterator it_t;
+  typedef sched_ue_db_t::iterator it_t;
   current_tti  = tti; 
 
   if(ue_db.size()==0)
@@ -1000,6 +1000,52 @@ uint32_t sched_ue::get_required_prb_ul(uint32_t req_bytes)
   return n; 
 }
 
+uint32_t sched_ue::get_dl_cqi()
+{
+  return dl_cqi;
+}
+
+uint32_t sched_ue::get_ul_cqi()
+{
+  return ul_cqi;
+}
+
+/* Bytes carried by nof_prb PRBs at the MCS selected for the last reported CQI,
+ * without changing the MCS of the user */
+uint32_t sched_ue::get_achievable_bytes_dl(uint32_t nof_prb, uint32_t nof_ctrl_symbols)
+{
+  int tbs = 0;
+
+  pthread_mutex_lock(&mutex);
+
+  if (fixed_mcs_dl < 0) {
+    tbs = alloc_tbs_dl(nof_prb, srslte_ra_dl_approx_nof_re(cell, nof_prb, nof_ctrl_symbols), 0, NULL);
+  } else {
+    tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_dl), nof_prb)/8;
+  }
+
+  pthread_mutex_unlock(&mutex);
+
+  return tbs > 0 ? (uint32_t) tbs : 0;
+}
+
+uint32_t sched_ue::get_achievable_bytes_ul(uint32_t nof_prb)
+{
+  int tbs = 0;
+
+  pthread_mutex_lock(&mutex);
+
+  if (fixed_mcs_ul < 0) {
+    tbs = alloc_tbs_ul(nof_prb, 2*(SRSLTE_CP_NSYMB(cell.cp)-1)*nof_prb*SRSLTE_NRE, 0, NULL);
+  } else {
+    tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_ul), nof_prb)/8;
+  }
+
+  pthread_mutex_unlock(&mutex);
+
+  return tbs > 0 ? (uint32_t) tbs : 0;
+}
+
 bool sched_ue::is_sr_triggered()
 {
   return sr; 
@@ -0,0 +1,282 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <string.h>
+#include <strings.h>
+
+#include "srslte/srslte.h"
+#include "srsenb/hdr/mac/softbuffer_pool.h"
+
+namespace srsenb {
+
+softbuffer_pool::softbuffer_pool()
+{
+  max_cb         = 0;
+  nof_cb         = 0;
+  rx_buffer_f    = NULL;
+  rx_data        = NULL;
+  tx_buffer_b    = NULL;
+  rx_peak        = 0;
+  tx_peak        = 0;
+  nof_leases     = 0;
+  nof_lease_fail = 0;
+  pthread_mutex_init(&mutex, NULL);
+}
+
+softbuffer_pool::~softbuffer_pool()
+{
+  stop();
+  pthread_mutex_destroy(&mutex);
+}
+
+bool softbuffer_pool::init(uint32_t nof_prb, uint32_t nof_tb)
+{
+  stop();
+
+  int tbs = srslte_ra_tbs_from_idx(26, nof_prb);
+  if (tbs < 0 || nof_tb == 0) {
+    return false;
+  }
+  // Same number of code blocks srslte_softbuffer_rx_init() allocates
+  max_cb = (uint32_t) tbs / (SRSLTE_TCOD_MAX_LEN_CB - 24) + 1;
+  nof_cb = max_cb * nof_tb;
+
+  rx_buffer_f = (int16_t*) srslte_vec_malloc(sizeof(int16_t) * SOFTBUFFER_SIZE * nof_cb);
+  rx_data     = (uint8_t*) srslte_vec_malloc(sizeof(uint8_t) * RX_DATA_LEN * nof_cb);
+  tx_buffer_b = (uint8_t*) srslte_vec_malloc(sizeof(uint8_t) * SOFTBUFFER_SIZE * nof_cb);
+  if (!rx_buffer_f || !rx_data || !tx_buffer_b) {
+    perror("malloc");
+    stop();
+    return false;
+  }
+
+  // Pop from the back, so the first code blocks are leased first
+  rx_free.resize(nof_cb);
+  tx_free.resize(nof_cb);
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    rx_free[i] = nof_cb - 1 - i;
+    tx_free[i] = nof_cb - 1 - i;
+  }
+  rx_peak        = 0;
+  tx_peak        = 0;
+  nof_leases     = 0;
+  nof_lease_fail = 0;
+  return true;
+}
+
+void softbuffer_pool::stop()
+{
+  if (rx_buffer_f) {
+    free(rx_buffer_f);
+    rx_buffer_f = NULL;
+  }
+  if (rx_data) {
+    free(rx_data);
+    rx_data = NULL;
+  }
+  if (tx_buffer_b) {
+    free(tx_buffer_b);
+    tx_buffer_b = NULL;
+  }
+  rx_free.clear();
+  tx_free.clear();
+  nof_cb = 0;
+}
+
+uint32_t softbuffer_pool::get_max_cb()
+{
+  return max_cb;
+}
+
+uint32_t softbuffer_pool::nof_cb_from_tbs(uint32_t tbs)
+{
+  // Same as srslte_softbuffer_rx_reset_tbs()
+  return (tbs + 24) / (SRSLTE_TCOD_MAX_LEN_CB - 24) + 1;
+}
+
+bool softbuffer_pool::init_rx(srslte_softbuffer_rx_t *q)
+{
+  bzero(q, sizeof(srslte_softbuffer_rx_t));
+  q->buffer_f = (int16_t**) calloc(max_cb, sizeof(int16_t*));
+  q->data     = (uint8_t**) calloc(max_cb, sizeof(uint8_t*));
+  q->cb_crc   = (bool*)     calloc(max_cb, sizeof(bool));
+  if (!q->buffer_f || !q->data || !q->cb_crc) {
+    perror("calloc");
+    free_rx(q);
+    return false;
+  }
+  return true;
+}
+
+void softbuffer_pool::free_rx(srslte_softbuffer_rx_t *q)
+{
+  release_rx(q);
+  if (q->buffer_f) {
+    free(q->buffer_f);
+  }
+  if (q->data) {
+    free(q->data);
+  }
+  if (q->cb_crc) {
+    free(q->cb_crc);
+  }
+  bzero(q, sizeof(srslte_softbuffer_rx_t));
+}
+
+bool softbuffer_pool::init_tx(srslte_softbuffer_tx_t *q)
+{
+  bzero(q, sizeof(srslte_softbuffer_tx_t));
+  q->buffer_b = (uint8_t**) calloc(max_cb, sizeof(uint8_t*));
+  if (!q->buffer_b) {
+    perror("calloc");
+    return false;
+  }
+  return true;
+}
+
+void softbuffer_pool::free_tx(srslte_softbuffer_tx_t *q)
+{
+  release_tx(q);
+  if (q->buffer_b) {
+    free(q->buffer_b);
+  }
+  bzero(q, sizeof(srslte_softbuffer_tx_t));
+}
+
+bool softbuffer_pool::lease_rx(srslte_softbuffer_rx_t *q, uint32_t tbs)
+{
+  uint32_t n = nof_cb_from_tbs(tbs);
+  if (n > max_cb) {
+    n = max_cb;
+  }
+
+  pthread_mutex_lock(&mutex);
+  for (uint32_t i = 0; i < q->max_cb; i++) {
+    rx_free.push_back((uint32_t) ((q->buffer_f[i] - rx_buffer_f) / SOFTBUFFER_SIZE));
+  }
+  q->max_cb = 0;
+  if (rx_free.size() < n || !q->buffer_f) {
+    nof_lease_fail++;
+    pthread_mutex_unlock(&mutex);
+    return false;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t idx = rx_free.back();
+    rx_free.pop_back();
+    q->buffer_f[i] = &rx_buffer_f[idx * SOFTBUFFER_SIZE];
+    q->data[i]     = &rx_data[idx * RX_DATA_LEN];
+  }
+  q->max_cb = n;
+  if (nof_cb - rx_free.size() > rx_peak) {
+    rx_peak = nof_cb - rx_free.size();
+  }
+  nof_leases++;
+  pthread_mutex_unlock(&mutex);
+
+  // Storage is reset like srslte_softbuffer_rx_reset_tbs() does for a new transmission
+  for (uint32_t i = 0; i < n; i++) {
+    bzero(q->buffer_f[i], sizeof(int16_t) * SOFTBUFFER_SIZE);
+  }
+  bzero(q->cb_crc, sizeof(bool) * max_cb);
+  q->tb_crc = false;
+  return true;
+}
+
+void softbuffer_pool::release_rx(srslte_softbuffer_rx_t *q)
+{
+  if (q->max_cb) {
+    pthread_mutex_lock(&mutex);
+    for (uint32_t i = 0; i < q->max_cb; i++) {
+      rx_free.push_back((uint32_t) ((q->buffer_f[i] - rx_buffer_f) / SOFTBUFFER_SIZE));
+    }
+    q->max_cb = 0;
+    pthread_mutex_unlock(&mutex);
+  }
+}
+
+bool softbuffer_pool::lease_tx(srslte_softbuffer_tx_t *q, uint32_t tbs)
+{
+  uint32_t n = nof_cb_from_tbs(tbs);
+  if (n > max_cb) {
+    n = max_cb;
+  }
+
+  pthread_mutex_lock(&mutex);
+  for (uint32_t i = 0; i < q->max_cb; i++) {
+    tx_free.push_back((uint32_t) ((q->buffer_b[i] - tx_buffer_b) / SOFTBUFFER_SIZE));
+  }
+  q->max_cb = 0;
+  if (tx_free.size() < n || !q->buffer_b) {
+    nof_lease_fail++;
+    pthread_mutex_unlock(&mutex);
+    return false;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t idx = tx_free.back();
+    tx_free.pop_back();
+    q->buffer_b[i] = &tx_buffer_b[idx * SOFTBUFFER_SIZE];
+  }
+  q->max_cb = n;
+  if (nof_cb - tx_free.size() > tx_peak) {
+    tx_peak = nof_cb - tx_free.size();
+  }
+  nof_leases++;
+  pthread_mutex_unlock(&mutex);
+
+  // The first transmission writes the whole circular buffer, no need to reset it
+  return true;
+}
+
+void softbuffer_pool::release_tx(srslte_softbuffer_tx_t *q)
+{
+  if (q->max_cb) {
+    pthread_mutex_lock(&mutex);
+    for (uint32_t i = 0; i < q->max_cb; i++) {
+      tx_free.push_back((uint32_t) ((q->buffer_b[i] - tx_buffer_b) / SOFTBUFFER_SIZE));
+    }
+    q->max_cb = 0;
+    pthread_mutex_unlock(&mutex);
+  }
+}
+
+void softbuffer_pool::get_metrics(mac_softbuffer_metrics_t *metrics)
+{
+  pthread_mutex_lock(&mutex);
+  metrics->nof_cb         = nof_cb;
+  metrics->rx_cb_used     = nof_cb - rx_free.size();
+  metrics->rx_cb_peak     = rx_peak;
+  metrics->tx_cb_used     = nof_cb - tx_free.size();
+  metrics->tx_cb_peak     = tx_peak;
+  metrics->nof_leases     = nof_leases;
+  metrics->nof_lease_fail = nof_lease_fail;
+  rx_peak        = metrics->rx_cb_used;
+  tx_peak        = metrics->tx_cb_used;
+  nof_leases     = 0;
+  nof_lease_fail = 0;
+  pthread_mutex_unlock(&mutex);
+}
+
+} // namespace srsenb
@@ -38,20 +38,23 @@
 
 namespace srsenb {
   
-void ue::config(uint16_t rnti_, uint32_t nof_prb, sched_interface *sched_, rrc_interface_mac *rrc_, rlc_interface_mac *rlc_, srslte::log *log_h_)
+void ue::config(uint16_t rnti_, softbuffer_pool *softbuffers_, sched_interface *sched_, rrc_interface_mac *rrc_, rlc_interface_mac *rlc_, srslte::log *log_h_)
 {
   rnti  = rnti_; 
   rlc   = rlc_; 
   rrc   = rrc_; 
   log_h = log_h_; 
   sched = sched_; 
+  softbuffers = softbuffers_;
   pdus.init(this, log_h);
   
+  // Only the code block tables, soft storage is leased when a grant is scheduled
   for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
-    srslte_softbuffer_rx_init(&softbuffer_rx[i], nof_prb);
-    srslte_softbuffer_tx_init(&softbuffer_tx[i], nof_prb);
+    softbuffers->init_tx(&softbuffer_tx[i]);
+  }
+  for (int i=0;i<NOF_UL_HARQ_PROCESSES;i++) {
+    softbuffers->init_rx(&softbuffer_rx[i]);
   }
-  // don't need to reset because just initiated the buffers
   bzero(&metrics, sizeof(mac_metrics_t));  
   nof_failures = 0; 
   
@@ -71,10 +74,14 @@ void ue::reset()
   bzero(&metrics, sizeof(mac_metrics_t));  
 
   nof_failures = 0; 
+  pthread_mutex_lock(&mutex);
   for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
-    srslte_softbuffer_rx_reset(&softbuffer_rx[i]);
-    srslte_softbuffer_tx_reset(&softbuffer_tx[i]);
+    softbuffers->release_tx(&softbuffer_tx[i]);
+  }
+  for (int i=0;i<NOF_UL_HARQ_PROCESSES;i++) {
+    softbuffers->release_rx(&softbuffer_rx[i]);
   }
+  pthread_mutex_unlock(&mutex);
 }
 
 void ue::start_pcap(srslte::mac_pcap* pcap_)
@@ -102,14 +109,79 @@ void ue::set_lcg(uint32_t lcid, uint32_t lcg)
   lc_groups[lcg].push_back(lcid);
 }
 
-srslte_softbuffer_rx_t* ue::get_rx_softbuffer(uint32_t tti)
+srslte_softbuffer_rx_t* ue::get_rx_softbuffer(uint32_t tti, uint32_t tbs, bool new_tx)
+{
+  // Retransmissions of an UL HARQ process come 2*HARQ_DELAY_MS later, so they combine on the same softbuffer
+  uint32_t pid = tti%NOF_UL_HARQ_PROCESSES;
+  srslte_softbuffer_rx_t *ret = &softbuffer_rx[pid];
+
+  pthread_mutex_lock(&mutex);
+  // Without storage from the first transmission, a retransmission is decoded on its own
+  if (new_tx || ret->max_cb == 0) {
+    if (!softbuffers->lease_rx(ret, tbs)) {
+      ret = NULL;
+    }
+  }
+  softbuffer_rx_tti[pid] = tti;
+  pthread_mutex_unlock(&mutex);
+  return ret;
+}
+
+srslte_softbuffer_tx_t* ue::get_tx_softbuffer(uint32_t tti, uint32_t harq_process, uint32_t tb_idx, uint32_t tbs, bool new_tx)
+{
+  uint32_t idx = (harq_process * SRSLTE_MAX_TB + tb_idx)%NOF_HARQ_PROCESSES;
+  srslte_softbuffer_tx_t *ret = &softbuffer_tx[idx];
+
+  pthread_mutex_lock(&mutex);
+  if (new_tx) {
+    if (!softbuffers->lease_tx(ret, tbs)) {
+      ret = NULL;
+    }
+  } else if (ret->max_cb == 0) {
+    // A retransmission needs the circular buffer written by the first transmission
+    ret = NULL;
+  }
+  softbuffer_tx_tti[idx] = tti;
+  pthread_mutex_unlock(&mutex);
+  return ret;
+}
+
+void ue::release_tx_softbuffer(uint32_t tti_ack, uint32_t tb_idx)
 {
-  return &softbuffer_rx[tti%NOF_HARQ_PROCESSES];
+  pthread_mutex_lock(&mutex);
+  for (uint32_t pid=0;pid<NOF_HARQ_PROCESSES/SRSLTE_MAX_TB;pid++) {
+    uint32_t idx = pid * SRSLTE_MAX_TB + tb_idx;
+    if (softbuffer_tx[idx].max_cb && TTI_TX(softbuffer_tx_tti[idx]) == tti_ack) {
+      softbuffers->release_tx(&softbuffer_tx[idx]);
+    }
+  }
+  pthread_mutex_unlock(&mutex);
 }
 
-srslte_softbuffer_tx_t* ue::get_tx_softbuffer(uint32_t harq_process, uint32_t tb_idx)
+void ue::release_rx_softbuffer(uint32_t tti)
 {
-  return &softbuffer_tx[(harq_process * SRSLTE_MAX_TB + tb_idx  )%NOF_HARQ_PROCESSES];
+  pthread_mutex_lock(&mutex);
+  softbuffers->release_rx(&softbuffer_rx[tti%NOF_UL_HARQ_PROCESSES]);
+  pthread_mutex_unlock(&mutex);
+}
+
+void ue::release_stale_softbuffers(uint32_t tti)
+{
+  pthread_mutex_lock(&mutex);
+  for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
+    uint32_t interval = srslte_tti_interval(tti, softbuffer_tx_tti[i]);
+    // Grants are scheduled a few TTIs ahead, a lease used "later" than tti is not stale
+    if (softbuffer_tx[i].max_cb && interval > SOFTBUFFER_IDLE_TTIS && interval < 10240/2) {
+      softbuffers->release_tx(&softbuffer_tx[i]);
+    }
+  }
+  for (int i=0;i<NOF_UL_HARQ_PROCESSES;i++) {
+    uint32_t interval = srslte_tti_interval(tti, softbuffer_rx_tti[i]);
+    if (softbuffer_rx[i].max_cb && interval > SOFTBUFFER_IDLE_TTIS && interval < 10240/2) {
+      softbuffers->release_rx(&softbuffer_rx[i]);
+    }
+  }
+  pthread_mutex_unlock(&mutex);
 }
 
 uint8_t* ue::request_buffer(uint32_t tti, uint32_t len)
@@ -107,6 +107,8 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
 
     ("pcap.enable",       bpo::value<bool>(&args->pcap.enable)->default_value(false),           "Enable MAC packet captures for wireshark")
     ("pcap.filename",     bpo::value<string>(&args->pcap.filename)->default_value("ue.pcap"),   "MAC layer capture filename")
+    ("pcap.file_max_size", bpo::value<int>(&args->pcap.file_max_size)->default_value(-1),       "Start a new capture file after this many kilobytes (-1 disables)")
+    ("pcap.file_max_time", bpo::value<int>(&args->pcap.file_max_time)->default_value(-1),       "Start a new capture file after this many seconds (-1 disables)")
 
     ("gui.enable",        bpo::value<bool>(&args->gui.enable)->default_value(false),            "Enable GUI plots")
 
@@ -133,6 +135,7 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
 
     ("log.filename",      bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"),"Log filename")
     ("log.file_max_size", bpo::value<int>(&args->log.file_max_size)->default_value(-1), "Maximum file size (in kilobytes). When passed, multiple files are created. Default -1 (single file)")
+    ("log.binary",        bpo::value<bool>(&args->log.binary)->default_value(false), "Write a binary log, rendered offline with log_decode")
 
     /* MCS section */
     ("scheduler.pdsch_mcs",
@@ -176,10 +179,26 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         bpo::value<int>(&args->expert.phy.nof_phy_threads)->default_value(2),
         "Number of PHY threads")
 
+    ("expert.nof_pusch_decoder_threads",
+        bpo::value<int>(&args->expert.phy.nof_pusch_decoder_threads)->default_value(0),
+        "Number of threads turbo decoding PUSCH code blocks of all PHY threads (0 decodes in the PHY thread)")
+
+    ("expert.nof_pdsch_encoder_threads",
+        bpo::value<int>(&args->expert.phy.nof_pdsch_encoder_threads)->default_value(0),
+        "Number of threads encoding the PDSCH of the users of all PHY threads (0 encodes in the PHY thread)")
+
     ("expert.link_failure_nof_err",
         bpo::value<int>(&args->expert.mac.link_failure_nof_err)->default_value(100),
         "Number of PUSCH failures after which a radio-link failure is triggered")
 
+    ("expert.nof_mac_pdu_threads",
+        bpo::value<int>(&args->expert.mac.nof_pdu_threads)->default_value(1),
+        "Number of threads processing the UL MAC PDUs, users are sharded between them by RNTI")
+
+    ("expert.softbuffer_pool_nof_tb",
+        bpo::value<int>(&args->expert.mac.softbuffer_pool_nof_tb)->default_value(64),
+        "HARQ soft storage shared by all users, in transport blocks of the largest TBS per direction")
+
     ("expert.max_prach_offset_us",
         bpo::value<float>(&args->expert.phy.max_prach_offset_us)->default_value(30),
         "Maximum allowed RACH offset (in us)")
@@ -200,6 +219,10 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         bpo::value<bool>(&args->expert.enable_mbsfn)->default_value(false),
         "Enables MBMS in the eNB")
 
+    ("expert.gtpu_batch_size",
+        bpo::value<uint32_t>(&args->expert.gtpu_batch_size)->default_value(32),
+        "Maximum number of S1-U packets sent or received per system call, 1 disables the GTP-U TX thread")
+
     ("expert.print_buffer_state",
         bpo::value<bool>(&args->expert.print_buffer_state)->default_value(false),
        "Prints on the console the buffer state every 10 seconds")
@@ -174,6 +174,11 @@ void metrics_stdout::print_metrics()
   if(metrics.rf.rf_error) {
     printf("RF status: O=%d, U=%d, L=%d\n", metrics.rf.rf_o, metrics.rf.rf_u, metrics.rf.rf_l);
   }
+  if(metrics.mac_softbuffer.nof_lease_fail) {
+    printf("Softbuffer pool exhausted: %d grants dropped, peak CB DL=%d, UL=%d of %d\n",
+           metrics.mac_softbuffer.nof_lease_fail, metrics.mac_softbuffer.tx_cb_peak,
+           metrics.mac_softbuffer.rx_cb_peak, metrics.mac_softbuffer.nof_cb);
+  }
 
   cout.flags(f); // For avoiding Coverity defect: Not restoring ostream format
 }
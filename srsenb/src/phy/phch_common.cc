@@ -91,10 +91,63 @@ bool phch_common::init(srslte_cell_t *cell_, srslte::radio* radio_h_, mac_interf
   return true; 
 }
 
+bool phch_common::init_pusch_decoder(uint32_t nof_threads, int prio)
+{
+  // Each worker waits for its code blocks from its own helper slot
+  if (!pusch_pool.init(nof_threads, max_workers, prio)) {
+    return false;
+  }
+  pusch_decoders.resize(pusch_pool.get_nof_slots());
+  for (uint32_t i=0;i<pusch_decoders.size();i++) {
+    if (srslte_sch_cb_decoder_init(&pusch_decoders[i])) {
+      fprintf(stderr, "Error initiating PUSCH decoder\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+srslte_sch_cb_decoder_t* phch_common::get_pusch_decoder(uint32_t slot)
+{
+  return &pusch_decoders[slot];
+}
+
+bool phch_common::init_pdsch_encoder(uint32_t nof_threads, int prio)
+{
+  if (!pdsch_pool.init(nof_threads, max_workers, prio)) {
+    return false;
+  }
+  pdsch_encoders.resize(pdsch_pool.get_nof_slots());
+  for (uint32_t i=0;i<pdsch_encoders.size();i++) {
+    if (srslte_enb_dl_pdsch_encoder_init(&pdsch_encoders[i], cell.nof_prb) ||
+        srslte_enb_dl_pdsch_encoder_set_cell(&pdsch_encoders[i], cell))
+    {
+      fprintf(stderr, "Error initiating PDSCH encoder\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+srslte_enb_dl_pdsch_encoder_t* phch_common::get_pdsch_encoder(uint32_t slot)
+{
+  return &pdsch_encoders[slot];
+}
+
 void phch_common::stop() {
   for (uint32_t i=0;i<max_workers;i++) {
     sem_post(&tx_sem[i]);
   }
+  pusch_pool.stop();
+  for (uint32_t i=0;i<pusch_decoders.size();i++) {
+    srslte_sch_cb_decoder_free(&pusch_decoders[i]);
+  }
+  pusch_decoders.clear();
+  pdsch_pool.stop();
+  for (uint32_t i=0;i<pdsch_encoders.size();i++) {
+    srslte_enb_dl_pdsch_encoder_free(&pdsch_encoders[i]);
+  }
+  pdsch_encoders.clear();
 }
 
 /* The transmission of UL subframes must be in sequence. The correct sequence is guaranteed by a chain of N semaphores,
@@ -130,7 +183,7 @@ void phch_common::worker_end(uint32_t tti, cf_t* buffer[SRSLTE_MAX_PORTS], uint3
 
 void phch_common::ue_db_clear(uint32_t sf_idx)
 {
-  for(std::map<uint16_t,common_ue>::iterator iter=common_ue_db.begin(); iter!=common_ue_db.end(); ++iter) {
+  for(srslte::rnti_table<common_ue>::iterator iter=common_ue_db.begin(); iter!=common_ue_db.end(); ++iter) {
     pending_ack_t *p = &((common_ue*)&iter->second)->pending_ack;
     for (uint32_t tb_idx = 0; tb_idx < SRSLTE_MAX_TB; tb_idx++) {
       p->is_pending[sf_idx][tb_idx] = false;
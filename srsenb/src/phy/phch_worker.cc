@@ -158,6 +158,13 @@ void phch_worker::init(phch_common* phy_, srslte::log *log_h_)
     enb_ul.pusch.llr_is_8bit = true;
     enb_ul.pusch.ul_sch.llr_is_8bit = true;
   }
+
+  pusch_rx.resize(mac_interface_phy::MAX_GRANTS);
+  pusch_cb_tasks.resize(mac_interface_phy::MAX_GRANTS*SRSLTE_MAX_CODEBLOCKS);
+  nof_pusch_cb_tasks = 0;
+  pusch_executor.arg = this;
+  pusch_executor.run = pusch_decode_tb;
+  pdsch_tx_tasks.resize(mac_interface_phy::MAX_GRANTS);
   initiated = true; 
   running   = true;
 
@@ -388,9 +395,8 @@ void phch_worker::work_imp()
 
   Debug("Worker %d running\n", get_id());
 
-  for(std::map<uint16_t, ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    uint16_t rnti = (uint16_t) iter->first;
-    ue_db[rnti].has_grant_tti = -1;
+  for(srslte::rnti_table<ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    iter->second.has_grant_tti = -1;
   }
 
   // Process UL signal
@@ -514,25 +520,50 @@ unlock:
 }
 
 
+/* The turbo decoding of the code blocks of all the users is handed to the shared pool. Each user is demodulated
+ * (and its UCI decoded) in this thread, which then decodes code blocks itself while waiting for the rest.
+ */
+void phch_worker::pusch_decode_tb(void *arg, srslte_sch_tb_t *tb)
+{
+  phch_worker *w = (phch_worker*) arg;
+  uint32_t slot = w->phy->pusch_pool.get_helper_slot(w->get_id());
+  for (uint32_t i=0;i<tb->nof_cb;i++) {
+    pusch_cb_task_t *task = &w->pusch_cb_tasks[w->nof_pusch_cb_tasks++];
+    task->phy = w->phy;
+    task->cb  = &tb->cb[i];
+    w->phy->pusch_pool.push(slot, &w->pusch_group, pusch_decode_cb, task);
+  }
+}
+
+void phch_worker::pusch_decode_cb(void *arg, uint32_t slot)
+{
+  pusch_cb_task_t *task = (pusch_cb_task_t*) arg;
+  srslte_sch_decode_cb(task->phy->get_pusch_decoder(slot), task->cb);
+}
+
 int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
 {
   uint32_t wideband_cqi_value = 0, wideband_pmi = 0;
   bool wideband_pmi_present = false;
+  bool pusch_async = phy->pusch_pool.get_nof_threads() > 0;
+  int ret = SRSLTE_SUCCESS;
+
+  nof_pusch_cb_tasks = 0;
 
   uint32_t n_rb_ho = 0;
-  for (uint32_t i=0;i<nof_pusch;i++) {
-    uint16_t rnti = grants[i].rnti;
+  uint32_t nof_rx = 0;
+  for (nof_rx=0;nof_rx<nof_pusch;nof_rx++) {
+    uint16_t rnti = grants[nof_rx].rnti;
+    pusch_rx_t *rx = &pusch_rx[nof_rx];
     if (rnti) {
-      srslte_uci_data_t uci_data;
+      srslte_uci_data_t &uci_data = rx->uci_data;
       ZERO_OBJECT(uci_data);
 
     #ifdef LOG_EXECTIME
-      char timestr[64];
-      struct timeval t[3];
-      gettimeofday(&t[1], NULL);
+      gettimeofday(&rx->t[1], NULL);
     #endif
 
-      bool acks_pending[SRSLTE_MAX_TB] = {false};
+      bool *acks_pending = rx->acks_pending;
 
       // Get pending ACKs with an associated PUSCH transmission
       for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
@@ -543,22 +574,22 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
       }
 
       // Configure PUSCH CQI channel
-      srslte_cqi_value_t cqi_value;
+      srslte_cqi_value_t &cqi_value = rx->cqi_value;
       ZERO_OBJECT(cqi_value);
 
-      bool cqi_enabled = false;
+      rx->cqi_enabled = false;
 
       if (ue_db[rnti].cqi_en && ue_db[rnti].ri_en && srslte_ri_send(ue_db[rnti].pmi_idx, ue_db[rnti].ri_idx, tti_rx) ) {
         uci_data.uci_ri_len = 1; /* Asumes only 1 bit for RI */
         uci_data.ri_periodic_report = true;
       } else if (ue_db[rnti].cqi_en && srslte_cqi_send(ue_db[rnti].pmi_idx, tti_rx)) {
         cqi_value.type = SRSLTE_CQI_TYPE_WIDEBAND;
-        cqi_enabled = true;
+        rx->cqi_enabled = true;
         if (ue_db[rnti].dedicated.antenna_info_explicit_value.tx_mode == LIBLTE_RRC_TRANSMISSION_MODE_4) {
           cqi_value.wideband.pmi_present = true;
           cqi_value.wideband.rank_is_not_one = phy->ue_db_get_ri(rnti) > 0;
         }
-      } else if (grants[i].grant.cqi_request) {
+      } else if (grants[nof_rx].grant.cqi_request) {
         cqi_value.type = SRSLTE_CQI_TYPE_SUBBAND_HL;
         if (ue_db[rnti].dedicated.antenna_info_present && (
             ue_db[rnti].dedicated.antenna_info_explicit_value.tx_mode == LIBLTE_RRC_TRANSMISSION_MODE_3 ||
@@ -570,15 +601,15 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
         cqi_value.subband_hl.four_antenna_ports = (phy->cell.nof_ports == 4);
         cqi_value.subband_hl.pmi_present = (ue_db[rnti].dedicated.cqi_report_cnfg.report_mode_aperiodic == LIBLTE_RRC_CQI_REPORT_MODE_APERIODIC_RM31);
         cqi_value.subband_hl.rank_is_not_one = phy->ue_db_get_ri(rnti) > 0;
-        cqi_enabled = true;
+        rx->cqi_enabled = true;
       }
 
       // mark this tti as having an ul grant to avoid pucch
       ue_db[rnti].has_grant_tti = tti_rx;
 
-      srslte_ra_ul_grant_t phy_grant;
-      int res = -1;
-      if (!srslte_ra_ul_dci_to_grant(&grants[i].grant, enb_ul.cell.nof_prb, n_rb_ho, &phy_grant)) {
+      srslte_ra_ul_grant_t &phy_grant = rx->phy_grant;
+      rx->res = -1;
+      if (!srslte_ra_ul_dci_to_grant(&grants[nof_rx].grant, enb_ul.cell.nof_prb, n_rb_ho, &phy_grant)) {
 
         // Handle Format0 adaptive retx
         // Use last TBS for this TB in case of mcs>28
@@ -599,32 +630,73 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
           phy_grant.mcs.mod = SRSLTE_MOD_16QAM;
         }
         phy_grant.Qm = SRSLTE_MIN(phy_grant.Qm, 4);
-        res = srslte_enb_ul_get_pusch(&enb_ul, &phy_grant, grants[i].softbuffer,
-                                                rnti, grants[i].rv_idx,
-                                                grants[i].current_tx_nb,
-                                                grants[i].data,
-                                                (cqi_enabled) ? &cqi_value : NULL,
+        if (pusch_async) {
+          srslte_sch_set_async(&enb_ul.pusch.ul_sch, &pusch_executor, &rx->tb);
+        }
+        rx->res = srslte_enb_ul_get_pusch(&enb_ul, &phy_grant, grants[nof_rx].softbuffer,
+                                                rnti, grants[nof_rx].rv_idx,
+                                                grants[nof_rx].current_tx_nb,
+                                                grants[nof_rx].data,
+                                                (rx->cqi_enabled) ? &cqi_value : NULL,
                                                 &uci_data,
                                                 sf_rx);
+        if (pusch_async) {
+          srslte_sch_set_async(&enb_ul.pusch.ul_sch, NULL, NULL);
+        }
+        rx->nof_iterations = srslte_pusch_last_noi(&enb_ul.pusch);
       } else {
         Error("Computing PUSCH grant\n");
-        return SRSLTE_ERROR;
+        ret = SRSLTE_ERROR;
+        break;
       }
 
+      // Save PHICH scheduling for this user. Each user can have just 1 PUSCH grant per TTI
+      ue_db[rnti].phich_info.n_prb_lowest = enb_ul.pusch_cfg.grant.n_prb_tilde[0];
+      ue_db[rnti].phich_info.n_dmrs       = phy_grant.ncs_dmrs;
+
+      rx->snr_db = 10*log10(srslte_chest_ul_get_snr(&enb_ul.chest));
+
     #ifdef LOG_EXECTIME
-      gettimeofday(&t[2], NULL);
-      get_time_interval(t);
-      snprintf(timestr, 64, ", dec_time=%4d us", (int) t[0].tv_usec);
+      gettimeofday(&rx->t[2], NULL);
     #endif
+    }
+  }
 
-      bool crc_res = (res == 0);
+  // Wait for the code blocks of all users before reporting to MAC
+  if (pusch_async) {
+    phy->pusch_pool.wait(phy->pusch_pool.get_helper_slot(get_id()), &pusch_group);
+  }
 
-      // Save PHICH scheduling for this user. Each user can have just 1 PUSCH grant per TTI
-      ue_db[rnti].phich_info.n_prb_lowest = enb_ul.pusch_cfg.grant.n_prb_tilde[0];
-      ue_db[rnti].phich_info.n_dmrs       = phy_grant.ncs_dmrs;
+  for (uint32_t i=0;i<nof_rx;i++) {
+    uint16_t rnti = grants[i].rnti;
+    pusch_rx_t *rx = &pusch_rx[i];
+    if (rnti) {
+      srslte_uci_data_t &uci_data = rx->uci_data;
+      srslte_cqi_value_t &cqi_value = rx->cqi_value;
+      srslte_ra_ul_grant_t &phy_grant = rx->phy_grant;
+      bool *acks_pending = rx->acks_pending;
+      float snr_db = rx->snr_db;
+
+      if (pusch_async && rx->tb.pending) {
+        rx->res = srslte_sch_tb_finish(&enb_ul.pusch.ul_sch, &rx->tb);
+        rx->nof_iterations = srslte_pusch_last_noi(&enb_ul.pusch);
+      #ifdef LOG_EXECTIME
+        gettimeofday(&rx->t[2], NULL);
+      #endif
+      }
+
+      char timestr[64];
+      timestr[0] = '\0';
+    #ifdef LOG_EXECTIME
+      get_time_interval(rx->t);
+      snprintf(timestr, 64, ", dec_time=%4d us", (int) rx->t[0].tv_usec);
+    #endif
+
+      int res = rx->res;
+      bool crc_res = (res == 0);
 
       char cqi_str[SRSLTE_CQI_STR_MAX_CHAR];
-      if (cqi_enabled) {
+      if (rx->cqi_enabled) {
         if (ue_db[rnti].cqi_en) {
           wideband_cqi_value = cqi_value.wideband.wideband_cqi;
           if (cqi_value.wideband.pmi_present) {
@@ -653,8 +725,6 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
         srslte_cqi_value_tostring(&cqi_value, cqi_str, SRSLTE_CQI_STR_MAX_CHAR);
       }
 
-      float snr_db  = 10*log10(srslte_chest_ul_get_snr(&enb_ul.chest));
-
       /*
       if (!crc_res && enb_ul.pusch_cfg.grant.L_prb == 1 && enb_ul.pusch_cfg.grant.n_prb[0] == 0 && snr_db > 5) {
         srslte_vec_save_file("sf_symbols", enb_ul.sf_symbols, sizeof(cf_t)*SRSLTE_SF_LEN_RE(25, SRSLTE_CP_NORM));
@@ -672,7 +742,7 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
                       rnti, phy_grant.n_prb[0], phy_grant.n_prb[0]+phy_grant.L_prb,
                       phy_grant.mcs.tbs / 8, phy_grant.mcs.idx, grants[i].grant.rv_idx,
                       snr_db,
-                      srslte_pusch_last_noi(&enb_ul.pusch),
+                      rx->nof_iterations,
                       crc_res ? "OK" : "KO",
                       (acks_pending[0] || acks_pending[1]) ? ", ack=" : "",
                       (acks_pending[0]) ? (uci_data.uci_ack ? "1" : "0") : "",
@@ -718,10 +788,10 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
       }
 
       // Save metrics stats
-      ue_db[rnti].metrics_ul(phy_grant.mcs.idx, 0, snr_db, srslte_pusch_last_noi(&enb_ul.pusch));
+      ue_db[rnti].metrics_ul(phy_grant.mcs.idx, 0, snr_db, rx->nof_iterations);
     }
   }
-  return SRSLTE_SUCCESS;
+  return ret;
 }
 
 
@@ -729,17 +799,18 @@ int phch_worker::decode_pucch()
 {
   srslte_uci_data_t uci_data;
 
-  for(std::map<uint16_t, ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(srslte::rnti_table<ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
     uint16_t rnti = (uint16_t) iter->first;
+    ue *u = &iter->second;
 
-    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END && ue_db[rnti].has_grant_tti != (int) tti_rx) {
+    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END && u->has_grant_tti != (int) tti_rx) {
       // Check if user needs to receive PUCCH
       bool needs_pucch = false, needs_ack[SRSLTE_MAX_TB] = {false}, needs_sr = false, needs_cqi = false;
       uint32_t last_n_pdcch = 0;
       bzero(&uci_data, sizeof(srslte_uci_data_t));
 
-      if (ue_db[rnti].I_sr_en) {
-        if (srslte_ue_ul_sr_send_tti(ue_db[rnti].I_sr, tti_rx)) {
+      if (u->I_sr_en) {
+        if (srslte_ue_ul_sr_send_tti(u->I_sr, tti_rx)) {
           needs_pucch = true;
           needs_sr = true;
           uci_data.scheduling_request = true;
@@ -756,15 +827,15 @@ int phch_worker::decode_pucch()
       srslte_cqi_value_t cqi_value;
       ZERO_OBJECT(cqi_value);
 
-      LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT *dedicated = &ue_db[rnti].dedicated;
+      LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT *dedicated = &u->dedicated;
       LIBLTE_RRC_TRANSMISSION_MODE_ENUM tx_mode = dedicated->antenna_info_explicit_value.tx_mode;
 
-      if (ue_db[rnti].cqi_en && (ue_db[rnti].pucch_cqi_ack || !needs_ack[0] || !needs_ack[1])) {
-        if (ue_db[rnti].ri_en && srslte_ri_send(ue_db[rnti].pmi_idx, ue_db[rnti].ri_idx, tti_rx)) {
+      if (u->cqi_en && (u->pucch_cqi_ack || !needs_ack[0] || !needs_ack[1])) {
+        if (u->ri_en && srslte_ri_send(u->pmi_idx, u->ri_idx, tti_rx)) {
           needs_pucch = true;
           uci_data.uci_ri_len = 1;
           uci_data.ri_periodic_report = true;
-        } else if (srslte_cqi_send(ue_db[rnti].pmi_idx, tti_rx)) {
+        } else if (srslte_cqi_send(u->pmi_idx, tti_rx)) {
           needs_pucch = true;
           needs_cqi = true;
           cqi_value.type = SRSLTE_CQI_TYPE_WIDEBAND;
@@ -913,8 +984,23 @@ int phch_worker::encode_pmch(srslte_enb_dl_pdsch_t *grant, srslte_ra_dl_grant_t
   return SRSLTE_SUCCESS;
 }
 
+/* The PDSCH of each user is written to its own resource elements, so the users of the subframe are encoded
+ * concurrently by the shared pool, each with the scratch buffers of the thread running it.
+ */
+void phch_worker::pdsch_encode(void *arg, uint32_t slot)
+{
+  pdsch_tx_task_t *task = (pdsch_tx_task_t*) arg;
+  task->ret = srslte_enb_dl_put_pdsch_encoder(task->enb_dl, task->phy->get_pdsch_encoder(slot), task->rho_a,
+                                              &task->phy_grant, task->grant->softbuffers, task->grant->rnti,
+                                              task->rv, task->sf_idx, task->grant->data, task->mimo_type);
+}
+
 int phch_worker::encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants) {
 
+  bool pdsch_async = phy->pdsch_pool.get_nof_threads() > 0;
+  uint32_t slot    = pdsch_async ? phy->pdsch_pool.get_helper_slot(get_id()) : 0;
+  int ret = SRSLTE_SUCCESS;
+
   /* Scales the Resources Elements affected by the power allocation (p_b) */
   srslte_enb_dl_prepare_power_allocation(&enb_dl);
 
@@ -1024,7 +1110,20 @@ int phch_worker::encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants
         rho_b = sqrtf(cell_specific_ratio);
       }
       srslte_enb_dl_set_power_allocation(&enb_dl, rho_a, rho_b);
-      if (srslte_enb_dl_put_pdsch(&enb_dl, &phy_grant, grants[i].softbuffers, rnti, rv, sf_tx, grants[i].data, mimo_type)) {
+      if (pdsch_async) {
+        pdsch_tx_task_t *task = &pdsch_tx_tasks[i];
+        task->phy       = phy;
+        task->enb_dl    = &enb_dl;
+        task->grant     = &grants[i];
+        task->phy_grant = phy_grant;
+        task->mimo_type = mimo_type;
+        task->rv[0]     = rv[0];
+        task->rv[1]     = rv[1];
+        task->sf_idx    = sf_tx;
+        task->rho_a     = rho_a;
+        task->ret       = SRSLTE_SUCCESS;
+        phy->pdsch_pool.push(slot, &pdsch_group, pdsch_encode, task);
+      } else if (srslte_enb_dl_put_pdsch(&enb_dl, &phy_grant, grants[i].softbuffers, rnti, rv, sf_tx, grants[i].data, mimo_type)) {
         fprintf(stderr, "Error putting PDSCH %d\n", i);
         return SRSLTE_ERROR;
       }
@@ -1034,9 +1133,19 @@ int phch_worker::encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants
     }
   }
 
+  if (pdsch_async) {
+    phy->pdsch_pool.wait(slot, &pdsch_group);
+    for (uint32_t i = 0; i < nof_grants; i++) {
+      if (grants[i].rnti && pdsch_tx_tasks[i].ret) {
+        fprintf(stderr, "Error putting PDSCH %d\n", i);
+        ret = SRSLTE_ERROR;
+      }
+    }
+  }
+
   srslte_enb_dl_apply_power_allocation(&enb_dl);
 
-  return SRSLTE_SUCCESS;
+  return ret;
 }
 
 
@@ -1045,7 +1154,7 @@ int phch_worker::encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants
 uint32_t phch_worker::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
 {
   uint32_t cnt=0;
-  for(std::map<uint16_t, ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(srslte::rnti_table<ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
     ue *u = (ue*) &iter->second;
     uint16_t rnti = iter->first; 
     if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END) {
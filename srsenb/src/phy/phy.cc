@@ -120,6 +120,20 @@ bool phy::init(phy_args_t *args,
   workers_common.params = *args; 
 
   workers_common.init(&cfg->cell, radio_handler, mac);
+
+  if (args->nof_pusch_decoder_threads > 0) {
+    if (!workers_common.init_pusch_decoder(args->nof_pusch_decoder_threads, PUSCH_DECODER_THREAD_PRIO)) {
+      log_h->error("Error initiating %d PUSCH decoder threads\n", args->nof_pusch_decoder_threads);
+      return false;
+    }
+  }
+
+  if (args->nof_pdsch_encoder_threads > 0) {
+    if (!workers_common.init_pdsch_encoder(args->nof_pdsch_encoder_threads, PDSCH_ENCODER_THREAD_PRIO)) {
+      log_h->error("Error initiating %d PDSCH encoder threads\n", args->nof_pdsch_encoder_threads);
+      return false;
+    }
+  }
   
   parse_config(cfg);
   
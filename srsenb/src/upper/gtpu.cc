@@ -33,22 +33,34 @@
 using namespace srslte;
 namespace srsenb {
 
-gtpu::gtpu():mchthread()
+gtpu::gtpu():mchthread(),txthread()
 {
   pdcp          = NULL;
   gtpu_log      = NULL;
   pool          = NULL;
+  batch_size    = 1;
+  fd            = 0;
 
+  bzero((void*) rnti_bearers, sizeof(rnti_bearers));
   pthread_mutex_init(&mutex, NULL);
 
 }
 
-bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, std::string m1u_multiaddr_, std::string m1u_if_addr_, srsenb::pdcp_interface_gtpu* pdcp_, srslte::log* gtpu_log_, bool enable_mbsfn)
+gtpu::~gtpu()
+{
+  for (int i=0;i<MAX_RNTI;i++) {
+    delete rnti_bearers[i];
+  }
+  pthread_mutex_destroy(&mutex);
+}
+
+bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, std::string m1u_multiaddr_, std::string m1u_if_addr_, srsenb::pdcp_interface_gtpu* pdcp_, srslte::log* gtpu_log_, bool enable_mbsfn, uint32_t batch_size_)
 {
   pdcp          = pdcp_;
   gtpu_log      = gtpu_log_;
   gtp_bind_addr = gtp_bind_addr_;
   mme_addr      = mme_addr_;
+  batch_size    = SRSLTE_MAX(1, SRSLTE_MIN(MAX_BATCH_SIZE, batch_size_));
   pool          = byte_buffer_pool::get_instance();
 
   // Set up socket
@@ -82,6 +94,11 @@ bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, std::string m
   // Setup a thread to receive packets from the src socket
   start(THREAD_PRIO);
 
+  // UL PDUs are sent from the caller thread unless batching is enabled
+  if (batch_size > 1) {
+    txthread.init(this);
+  }
+
   // Start MCH thread if enabled
   this->enable_mbsfn = enable_mbsfn;
   if(enable_mbsfn) {
@@ -96,6 +113,10 @@ void gtpu::stop()
     mchthread.stop();
   }
 
+  if (batch_size > 1) {
+    txthread.stop();
+  }
+
   if (run_enable) {
     run_enable = false;
     // Wait thread to exit gracefully otherwise might leave a mutex locked
@@ -123,17 +144,42 @@ void gtpu::write_pdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t* pdu)
   header.flags        = GTPU_FLAGS_VERSION_V1 | GTPU_FLAGS_GTP_PROTOCOL;
   header.message_type = GTPU_MSG_DATA_PDU;
   header.length       = pdu->N_bytes;
-  header.teid         = rnti_bearers[rnti].teids_out[lcid];
 
-  struct sockaddr_in servaddr;
-  servaddr.sin_family      = AF_INET;
-  servaddr.sin_addr.s_addr = htonl(rnti_bearers[rnti].spgw_addrs[lcid]);
-  servaddr.sin_port        = htons(GTPU_PORT);
+  bearer_map *user = rnti_bearers[rnti];
+  if (!user || lcid >= SRSENB_N_RADIO_BEARERS || !user->teids_in[lcid]) {
+    gtpu_log->warning("Unrecognized bearer for UL PDU rnti=0x%x, lcid=%d - dropping packet\n", rnti, lcid);
+    pool->deallocate(pdu);
+    return;
+  }
+  SRSLTE_QUEUE_BARRIER();
+  // Read once, rem_bearer() may clear it meanwhile
+  uint32_t teid_out   = user->teids_out[lcid];
+  uint32_t addr       = user->spgw_addrs[lcid];
+  if (!teid_out) {
+    gtpu_log->warning("Bearer removed for UL PDU rnti=0x%x, lcid=%d - dropping packet\n", rnti, lcid);
+    pool->deallocate(pdu);
+    return;
+  }
+  header.teid         = teid_out;
 
   if(!gtpu_write_header(&header, pdu, gtpu_log)){
     gtpu_log->error("Error writing GTP-U Header. Flags 0x%x, Message Type 0x%x\n", header.flags, header.message_type);
     return;
   }
+
+  if (batch_size > 1) {
+    if (!txthread.push(pdu, addr)) {
+      gtpu_log->warning("GTP-U TX queue full - dropping packet\n");
+      pool->deallocate(pdu);
+    }
+    return;
+  }
+
+  struct sockaddr_in servaddr;
+  servaddr.sin_family      = AF_INET;
+  servaddr.sin_addr.s_addr = htonl(addr);
+  servaddr.sin_port        = htons(GTPU_PORT);
+
   if (sendto(fd, pdu->msg, pdu->N_bytes, MSG_EOR, (struct sockaddr*)&servaddr, sizeof(struct sockaddr_in))<0) {
     perror("sendto");
   }
@@ -153,18 +199,23 @@ void gtpu::add_bearer(uint16_t rnti, uint32_t lcid, uint32_t addr, uint32_t teid
     gtpu_log->info("Adding bearer for rnti: 0x%x, lcid: %d, addr: 0x%x, teid_out: 0x%x, teid_in: 0x%x\n", rnti, lcid, addr, teid_out, *teid_in);
   }
 
+  pthread_mutex_lock(&mutex);
+
   // Initialize maps if it's a new RNTI
-  if(rnti_bearers.count(rnti) == 0) {
-    for(int i=0;i<SRSENB_N_RADIO_BEARERS;i++) {
-      rnti_bearers[rnti].teids_in[i]  = 0;
-      rnti_bearers[rnti].teids_out[i] = 0;
-      rnti_bearers[rnti].spgw_addrs[i] = 0;
-    }
+  bearer_map *user = rnti_bearers[rnti];
+  if (!user) {
+    user = new bearer_map;
+    bzero((void*) user, sizeof(bearer_map));
+    rnti_bearers[rnti] = user;
   }
 
-  rnti_bearers[rnti].teids_in[lcid]  = *teid_in;
-  rnti_bearers[rnti].teids_out[lcid] = teid_out;
-  rnti_bearers[rnti].spgw_addrs[lcid] = addr;
+  // The bearer becomes visible to the other threads with its teid_in
+  user->teids_out[lcid]  = teid_out;
+  user->spgw_addrs[lcid] = addr;
+  __sync_synchronize();
+  user->teids_in[lcid]   = *teid_in;
+
+  pthread_mutex_unlock(&mutex);
 }
 
 void gtpu::rem_bearer(uint16_t rnti, uint32_t lcid)
@@ -172,18 +223,12 @@ void gtpu::rem_bearer(uint16_t rnti, uint32_t lcid)
   pthread_mutex_lock(&mutex);
   gtpu_log->info("Removing bearer for rnti: 0x%x, lcid: %d\n", rnti, lcid);
 
-  rnti_bearers[rnti].teids_in[lcid]  = 0;
-  rnti_bearers[rnti].teids_out[lcid] = 0;
-
-  // Remove RNTI if all bearers are removed
-  bool rem = true;
-  for(int i=0;i<SRSENB_N_RADIO_BEARERS; i++) {
-    if(rnti_bearers[rnti].teids_in[i] != 0) {
-      rem = false;
-    }
-  }
-  if(rem) {
-    rnti_bearers.erase(rnti);
+  bearer_map *user = rnti_bearers[rnti];
+  if (user) {
+    // Hide the bearer before clearing its teid_out, see write_pdu()
+    user->teids_in[lcid]  = 0;
+    __sync_synchronize();
+    user->teids_out[lcid] = 0;
   }
   pthread_mutex_unlock(&mutex);
 }
@@ -191,88 +236,115 @@ void gtpu::rem_bearer(uint16_t rnti, uint32_t lcid)
 void gtpu::rem_user(uint16_t rnti)
 {
   pthread_mutex_lock(&mutex);
-  rnti_bearers.erase(rnti);
+  bearer_map *user = rnti_bearers[rnti];
+  if (user) {
+    for(int i=0;i<SRSENB_N_RADIO_BEARERS; i++) {
+      user->teids_in[i]  = 0;
+    }
+    __sync_synchronize();
+    for(int i=0;i<SRSENB_N_RADIO_BEARERS; i++) {
+      user->teids_out[i] = 0;
+    }
+  }
   pthread_mutex_unlock(&mutex);
 }
 
 void gtpu::run_thread()
 {
-  byte_buffer_t *pdu = pool_allocate;
+  std::vector<byte_buffer_t*> pdus(batch_size, (byte_buffer_t*) NULL);
+  std::vector<struct mmsghdr> msgs(batch_size);
+  std::vector<struct iovec>   iovs(batch_size);
+  std::vector<sockaddr_in>    clients(batch_size);
+  size_t                      buflen = SRSENB_MAX_BUFFER_SIZE_BYTES - SRSENB_BUFFER_HEADER_OFFSET;
 
-  if (!pdu) {
-    gtpu_log->error("Fatal Error: Couldn't allocate buffer in gtpu::run_thread().\n");
-    return;
-  }
   run_enable = true;
 
-  sockaddr_in client;
-  socklen_t   client_len = sizeof(client);
-  size_t      buflen = SRSENB_MAX_BUFFER_SIZE_BYTES - SRSENB_BUFFER_HEADER_OFFSET;
-
   running=true;
   while(run_enable) {
 
-    pdu->reset();
+    // Replace the buffers passed to PDCP in the previous batch
+    for (uint32_t i=0;i<batch_size;i++) {
+      while (!pdus[i]) {
+        pdus[i] = pool_allocate;
+        if (!pdus[i]) {
+          gtpu_log->console("GTPU Buffer pool empty. Trying again...\n");
+          usleep(10000);
+        }
+      }
+      pdus[i]->reset();
+      iovs[i].iov_base            = pdus[i]->msg;
+      iovs[i].iov_len             = buflen;
+      bzero(&msgs[i].msg_hdr, sizeof(struct msghdr));
+      msgs[i].msg_hdr.msg_iov     = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen  = 1;
+      msgs[i].msg_hdr.msg_name    = &clients[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    }
+
     gtpu_log->debug("Waiting for read...\n");
     int n = 0;
     do{
-      n = recvfrom(fd, pdu->msg, buflen, 0, (struct sockaddr *)&client, &client_len);
-    } while (n == -1 && errno == EAGAIN);
+      n = recvmmsg(fd, &msgs[0], batch_size, MSG_WAITFORONE, NULL);
+    } while (n == -1 && (errno == EAGAIN || errno == EINTR));
 
     if (n < 0) {
-        gtpu_log->error("Failed to read from socket\n");
+      gtpu_log->error("Failed to read from socket\n");
+      continue;
     }
 
-    gtpu_log->debug("Received %d bytes from S1-U interface\n", n);
-    pdu->N_bytes = (uint32_t) n;
-
-    gtpu_header_t header;
-    if(!gtpu_read_header(pdu, &header,gtpu_log)){
-      continue;
+    for (int i=0;i<n;i++) {
+      gtpu_log->debug("Received %d bytes from S1-U interface\n", msgs[i].msg_len);
+      pdus[i]->N_bytes = msgs[i].msg_len;
+      handle_rx_pdu(&pdus[i], &clients[i]);
     }
+  }
 
-    switch(header.message_type) {
+  for (uint32_t i=0;i<batch_size;i++) {
+    if (pdus[i]) {
+      pool->deallocate(pdus[i]);
+    }
+  }
+  running = false;
+}
 
-      case GTPU_MSG_ECHO_REQUEST:
-        // Echo request - send response
-        echo_response(client.sin_addr.s_addr, client.sin_port, header.seq_number);
-        break;
+// Sets *pdu to NULL if the buffer is passed to PDCP
+void gtpu::handle_rx_pdu(byte_buffer_t **pdu, sockaddr_in *client)
+{
+  gtpu_header_t header;
+  if(!gtpu_read_header(*pdu, &header,gtpu_log)){
+    return;
+  }
 
-      case GTPU_MSG_DATA_PDU:
+  switch(header.message_type) {
 
-        uint16_t rnti = 0;
-        uint16_t lcid = 0;
-        teidin_to_rntilcid(header.teid, &rnti, &lcid);
+    case GTPU_MSG_ECHO_REQUEST:
+      // Echo request - send response
+      echo_response(client->sin_addr.s_addr, client->sin_port, header.seq_number);
+      break;
 
-        pthread_mutex_lock(&mutex);
-        bool user_exists = (rnti_bearers.count(rnti) > 0);
-        pthread_mutex_unlock(&mutex);
+    case GTPU_MSG_DATA_PDU:
 
-        if(!user_exists) {
-          gtpu_log->error("Unrecognized RNTI for DL PDU: 0x%x - dropping packet\n", rnti);
-          continue;
-        }
+      uint16_t rnti = 0;
+      uint16_t lcid = 0;
+      teidin_to_rntilcid(header.teid, &rnti, &lcid);
 
-        if(lcid < SRSENB_N_SRB || lcid >= SRSENB_N_RADIO_BEARERS) {
-          gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid);
-          continue;
-        }
+      if(lcid < SRSENB_N_SRB || lcid >= SRSENB_N_RADIO_BEARERS) {
+        gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid);
+        return;
+      }
 
-        gtpu_log->info_hex(pdu->msg, pdu->N_bytes, "RX GTPU PDU rnti=0x%x, lcid=%d, n_bytes=%d", rnti, lcid, pdu->N_bytes);
+      bearer_map *user = rnti_bearers[rnti];
+      if(!user || !user->teids_in[lcid]) {
+        gtpu_log->error("Unrecognized RNTI for DL PDU: 0x%x - dropping packet\n", rnti);
+        return;
+      }
 
-        pdcp->write_sdu(rnti, lcid, pdu);
+      gtpu_log->info_hex((*pdu)->msg, (*pdu)->N_bytes, "RX GTPU PDU rnti=0x%x, lcid=%d, n_bytes=%d", rnti, lcid, (*pdu)->N_bytes);
 
-        do {
-          pdu = pool_allocate;
-          if (!pdu) {
-            gtpu_log->console("GTPU Buffer pool empty. Trying again...\n");
-            usleep(10000);
-          }
-        } while(!pdu);
-        break;
-    }
+      pdcp->write_sdu(rnti, lcid, *pdu);
+      *pdu = NULL;
+      break;
   }
-  running = false;
 }
 
 void gtpu::echo_response(in_addr_t addr, in_port_t port, uint16_t seq)
@@ -317,6 +389,100 @@ void gtpu::rntilcid_to_teidin(uint16_t rnti, uint16_t lcid, uint32_t *teidin)
 }
 
 
+/****************************************************************************
+* Class to run the TX thread
+***************************************************************************/
+void gtpu::tx_thread::init(gtpu *parent_)
+{
+  parent  = parent_;
+  running = true;
+  start(THREAD_PRIO);
+}
+
+bool gtpu::tx_thread::push(byte_buffer_t *pdu, uint32_t addr)
+{
+  tx_pdu_t tx = {pdu, addr};
+  return queue.try_push(tx);
+}
+
+void gtpu::tx_thread::stop()
+{
+  if (running) {
+    running = false;
+    // Wake up the thread with an empty entry
+    tx_pdu_t tx = {NULL, 0};
+    queue.push(tx);
+    wait_thread_finish();
+  }
+}
+
+void gtpu::tx_thread::run_thread()
+{
+  uint32_t                    batch_size = parent->batch_size;
+  std::vector<tx_pdu_t>       pdus(batch_size);
+  std::vector<struct mmsghdr> msgs(batch_size);
+  std::vector<struct iovec>   iovs(batch_size);
+  std::vector<sockaddr_in>    addrs(batch_size);
+
+  while (running) {
+    // Block for the first PDU and take the ones already queued behind it
+    uint32_t n = 0;
+    pdus[n] = queue.wait_pop();
+    if (pdus[n].pdu) {
+      n++;
+    }
+    while (n < batch_size && queue.try_pop(&pdus[n])) {
+      if (pdus[n].pdu) {
+        n++;
+      }
+    }
+
+    for (uint32_t i=0;i<n;i++) {
+      addrs[i].sin_family         = AF_INET;
+      addrs[i].sin_addr.s_addr    = htonl(pdus[i].addr);
+      addrs[i].sin_port           = htons(GTPU_PORT);
+      iovs[i].iov_base            = pdus[i].pdu->msg;
+      iovs[i].iov_len             = pdus[i].pdu->N_bytes;
+      bzero(&msgs[i].msg_hdr, sizeof(struct msghdr));
+      msgs[i].msg_hdr.msg_iov     = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen  = 1;
+      msgs[i].msg_hdr.msg_name    = &addrs[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    }
+    if (n > 0) {
+      parent->send_batch(&msgs[0], n);
+    }
+    for (uint32_t i=0;i<n;i++) {
+      parent->pool->deallocate(pdus[i].pdu);
+    }
+  }
+
+  // Drop what is left in the queue
+  tx_pdu_t tx;
+  while (queue.try_pop(&tx)) {
+    if (tx.pdu) {
+      parent->pool->deallocate(tx.pdu);
+    }
+  }
+}
+
+void gtpu::send_batch(struct mmsghdr *msgs, uint32_t nof_msgs)
+{
+  uint32_t sent = 0;
+  while (sent < nof_msgs) {
+    int n = sendmmsg(fd, &msgs[sent], nof_msgs - sent, 0);
+    if (n < 0) {
+      if (errno == EINTR || errno == EAGAIN) {
+        continue;
+      }
+      perror("sendmmsg");
+      // Skip the packet that failed
+      n = 1;
+    }
+    sent += (uint32_t) n;
+  }
+}
+
 /****************************************************************************
 * Class to run the MCH thread
 ***************************************************************************/
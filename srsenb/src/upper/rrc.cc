@@ -34,7 +34,6 @@
 #include "srslte/common/int_helpers.h"
 
 using srslte::byte_buffer_t;
-using srslte::bit_buffer_t;
 using srslte::uint32_to_uint8;
 using srslte::uint8_to_uint32;
 
@@ -66,6 +65,8 @@ void rrc::init(rrc_cfg_t *cfg_,
   running = false;
   pool    = srslte::byte_buffer_pool::get_instance();
 
+  byte_buf_paging.N_bytes = 0;
+
   memcpy(&cfg, cfg_, sizeof(rrc_cfg_t));
 
   if(cfg.sibs[12].sib_type == LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13 && cfg_->enable_mbsfn) {
@@ -492,14 +493,14 @@ bool rrc::is_paging_opportunity(uint32_t tti, uint32_t *payload_len)
   
   if (n > 0) {
     pcch_msg.paging_record_list_size = n;
-    liblte_rrc_pack_pcch_msg(&pcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf_paging);
-    uint32_t N_bytes = (bit_buf_paging.N_bits-1)/8+1;
+    liblte_rrc_pack_pcch_msg(&pcch_msg, &byte_buf_paging);
+    uint32_t N_bytes = byte_buf_paging.N_bytes;
 
     if (payload_len) {
       *payload_len = N_bytes;
     }
-    rrc_log->info("Assembling PCCH payload with %d UE identities, payload_len=%d bytes, nbits=%d\n", 
-                  pcch_msg.paging_record_list_size, N_bytes, bit_buf_paging.N_bits);  
+    rrc_log->info("Assembling PCCH payload with %d UE identities, payload_len=%d bytes\n", 
+                  pcch_msg.paging_record_list_size, N_bytes);  
     return true; 
   } 
   
@@ -509,9 +510,9 @@ bool rrc::is_paging_opportunity(uint32_t tti, uint32_t *payload_len)
 void rrc::read_pdu_pcch(uint8_t *payload, uint32_t buffer_size)
 {
   pthread_mutex_lock(&paging_mutex);
-  uint32_t N_bytes = (bit_buf_paging.N_bits-1)/8+1;
+  uint32_t N_bytes = byte_buf_paging.N_bytes;
   if (N_bytes <= buffer_size) {
-    srslte_bit_pack_vector(bit_buf_paging.msg, payload, bit_buf_paging.N_bits);    
+    memcpy(payload, byte_buf_paging.msg, N_bytes);
   }
   pthread_mutex_unlock(&paging_mutex);
 }
@@ -528,12 +529,15 @@ void rrc::parse_ul_ccch(uint16_t rnti, byte_buffer_t *pdu)
   uint16_t old_rnti = 0; 
 
   if (pdu) {
+    if (!copy_from_pdu(pdu)) {
+      pool->deallocate(pdu);
+      return;
+    }
+
     LIBLTE_RRC_UL_CCCH_MSG_STRUCT ul_ccch_msg;
     bzero(&ul_ccch_msg, sizeof(LIBLTE_RRC_UL_CCCH_MSG_STRUCT));
 
-    srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-    bit_buf.N_bits = pdu->N_bytes * 8;
-    liblte_rrc_unpack_ul_ccch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &ul_ccch_msg);
+    liblte_rrc_unpack_ul_ccch_msg(&byte_buf, &ul_ccch_msg);
 
     rrc_log->info_hex(pdu->msg, pdu->N_bytes,
                       "SRB0 - Rx: %s",
@@ -591,6 +595,19 @@ void rrc::parse_ul_dcch(uint16_t rnti, uint32_t lcid, byte_buffer_t *pdu)
   }
 }
 
+// Copies a received PDU to byte_buf for the unpack functions, pooled buffers
+// of the smaller size classes can not be passed to them in place
+bool rrc::copy_from_pdu(byte_buffer_t *pdu)
+{
+  if (pdu->N_bytes > LIBLTE_MAX_MSG_SIZE_BYTES) {
+    rrc_log->error("Dropping RRC PDU of %d bytes, the maximum is %d bytes\n", pdu->N_bytes, LIBLTE_MAX_MSG_SIZE_BYTES);
+    return false;
+  }
+  memcpy(byte_buf.msg, pdu->msg, pdu->N_bytes);
+  byte_buf.N_bytes = pdu->N_bytes;
+  return true;
+}
+
 void rrc::process_rl_failure(uint16_t rnti)
 {
   if (users.count(rnti) == 1) {
@@ -737,10 +754,7 @@ uint32_t rrc::generate_sibs()
 
   // Pack payload for all messages
   for (uint32_t msg_index = 0; msg_index < nof_messages; msg_index++) {
-    LIBLTE_BIT_MSG_STRUCT bitbuffer;
-    liblte_rrc_pack_bcch_dlsch_msg(&msg[msg_index], &bitbuffer);
-    srslte_bit_pack_vector(bitbuffer.msg, sib_buffer[msg_index].msg, bitbuffer.N_bits);
-    sib_buffer[msg_index].N_bytes = (bitbuffer.N_bits-1)/8+1;
+    liblte_rrc_pack_bcch_dlsch_msg(&msg[msg_index], &sib_buffer[msg_index]);
   }
 
   free(msg);
@@ -1037,9 +1051,11 @@ void rrc::ue::parse_ul_dcch(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_RRC_UL_DCCH_MSG_STRUCT ul_dcch_msg;
   bzero(&ul_dcch_msg, sizeof(LIBLTE_RRC_UL_DCCH_MSG_STRUCT));
   
-  srslte_bit_unpack_vector(pdu->msg, parent->bit_buf.msg, pdu->N_bytes*8);
-  parent->bit_buf.N_bits = pdu->N_bytes*8;
-  liblte_rrc_unpack_ul_dcch_msg((LIBLTE_BIT_MSG_STRUCT*)&parent->bit_buf, &ul_dcch_msg);
+  if (!parent->copy_from_pdu(pdu)) {
+    pool->deallocate(pdu);
+    return;
+  }
+  liblte_rrc_unpack_ul_dcch_msg(&parent->byte_buf, &ul_dcch_msg);
 
   parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                       "%s - Rx %s\n", 
@@ -2051,9 +2067,9 @@ void rrc::ue::send_dl_ccch(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
   // Allocate a new PDU buffer, pack the message and send to PDCP 
   byte_buffer_t *pdu = pool_allocate;
   if (pdu) {
-    liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, (LIBLTE_BIT_MSG_STRUCT*) &parent->bit_buf);
-    srslte_bit_pack_vector(parent->bit_buf.msg, pdu->msg, parent->bit_buf.N_bits);
-    pdu->N_bytes = 1+(parent->bit_buf.N_bits-1)/8;
+    liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, &parent->byte_buf);
+    memcpy(pdu->msg, parent->byte_buf.msg, parent->byte_buf.N_bytes);
+    pdu->N_bytes = parent->byte_buf.N_bytes;
     parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                           "SRB0 - rnti=0x%x, Sending: %s\n",
                           rnti,
@@ -2068,13 +2084,18 @@ void rrc::ue::send_dl_ccch(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
 
 void rrc::ue::send_dl_dcch(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg, byte_buffer_t *pdu)
 {  
+  liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, &parent->byte_buf);
+  // A reused PDU of one of the smaller size classes may be too short for the message
+  if (pdu && pdu->get_tailroom() < parent->byte_buf.N_bytes) {
+    pool->deallocate(pdu);
+    pdu = NULL;
+  }
   if (!pdu) {
     pdu = pool_allocate;
   }
   if (pdu) {
-    liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*) &parent->bit_buf);
-    srslte_bit_pack_vector(parent->bit_buf.msg, pdu->msg, parent->bit_buf.N_bits);
-    pdu->N_bytes = 1+(parent->bit_buf.N_bits-1)/8;
+    memcpy(pdu->msg, parent->byte_buf.msg, parent->byte_buf.N_bytes);
+    pdu->N_bytes = parent->byte_buf.N_bytes;
     parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                           "SRB1 - rnti=0x%x, Sending: %s\n",
                           rnti,
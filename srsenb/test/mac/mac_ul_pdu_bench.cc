@@ -0,0 +1,327 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Feeds synthetic UL MAC PDUs of many users through mac::crc_info and the PDU
+ * processing threads. Every TTI the grants of mac::get_ul_sched are filled
+ * with a PDU carrying a BSR, which keeps the users scheduled, and one SDU
+ * whose first bytes are a per-user sequence number. The RLC stub checks that
+ * the SDUs of every user arrive in order and can emulate the cost of the
+ * upper layers. The aggregate PDU rate is printed for the number of threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sched.h>
+#include <time.h>
+#include <vector>
+
+#include "srslte/common/log_filter.h"
+#include "srslte/common/pdu.h"
+#include "srsenb/hdr/mac/mac.h"
+
+using namespace srsenb;
+
+#define MAX_RNTI        65536
+#define MAX_PDU_LEN     (150*1024/8)
+#define MAX_OUTSTANDING 16  // PDUs per user waiting to be processed, the PDU queue of an user holds 64
+
+uint32_t nof_tti     = 2000;
+uint32_t nof_users   = 16;
+uint32_t nof_threads = 1;
+uint32_t work        = 0;
+uint32_t nof_prb     = 50;
+uint32_t mcs         = 20;
+
+srslte::log_filter log_out("MAC");
+mac                mac_h;
+
+// Written by the main thread only
+uint32_t pushed_seq[MAX_RNTI];
+// Written by the PDU thread of the user only
+uint32_t next_seq[MAX_RNTI];
+
+uint64_t nof_sdus     = 0;
+uint64_t nof_bytes    = 0;
+uint64_t nof_errors   = 0;
+uint64_t nof_pushed   = 0;
+uint64_t nof_dropped  = 0;
+uint32_t checksum     = 0;
+
+class phy_dummy : public phy_interface_mac
+{
+public:
+  int  add_rnti(uint16_t rnti) { return 0; }
+  void rem_rnti(uint16_t rnti) {}
+};
+
+class rrc_dummy : public rrc_interface_mac
+{
+public:
+  std::vector<uint16_t> rntis;
+
+  void rl_failure(uint16_t rnti) {}
+  void add_user(uint16_t rnti) { rntis.push_back(rnti); }
+  void upd_user(uint16_t new_rnti, uint16_t old_rnti) {}
+  void set_activity_user(uint16_t rnti) {}
+  bool is_paging_opportunity(uint32_t tti, uint32_t *payload_len) { return false; }
+};
+
+class rlc_dummy : public rlc_interface_mac
+{
+public:
+  int  read_pdu(uint16_t rnti, uint32_t lcid, uint8_t *payload, uint32_t nof_bytes) { return 0; }
+  void read_pdu_bcch_dlsch(uint32_t sib_index, uint8_t *payload) {}
+  void read_pdu_pcch(uint8_t *payload, uint32_t buffer_size) {}
+
+  void write_pdu(uint16_t rnti, uint32_t lcid, uint8_t *payload, uint32_t nof_bytes_) {
+    if (nof_bytes_ < 4) {
+      return;
+    }
+    uint32_t seq = (uint32_t) payload[0] << 24 | (uint32_t) payload[1] << 16 | (uint32_t) payload[2] << 8 | payload[3];
+    if (seq != next_seq[rnti]) {
+      printf("Error rnti=0x%x: received SDU %d, expected %d\n", rnti, seq, next_seq[rnti]);
+      __sync_fetch_and_add(&nof_errors, 1);
+    }
+    next_seq[rnti] = seq + 1;
+
+    // Emulate the RLC, PDCP and GTP-U copies and checks
+    uint32_t sum = 0;
+    for (uint32_t w = 0; w < work; w++) {
+      for (uint32_t i = 0; i < nof_bytes_; i++) {
+        sum = (sum << 1 | sum >> 31) ^ payload[i];
+      }
+    }
+    __sync_fetch_and_xor(&checksum, sum);
+    __sync_fetch_and_add(&nof_bytes, (uint64_t) nof_bytes_);
+    __sync_fetch_and_add(&nof_sdus, 1);
+  }
+};
+
+phy_dummy phy;
+rrc_dummy rrc;
+rlc_dummy rlc;
+
+void usage(char *prog) {
+  printf("Usage: %s [nutwpm]\n", prog);
+  printf("\t-n number of TTIs [Default %d]\n", nof_tti);
+  printf("\t-u number of users [Default %d]\n", nof_users);
+  printf("\t-t number of PDU processing threads [Default %d]\n", nof_threads);
+  printf("\t-w passes over every SDU emulating the upper layers [Default %d]\n", work);
+  printf("\t-p number of PRB of the cell [Default %d]\n", nof_prb);
+  printf("\t-m PUSCH MCS [Default %d]\n", mcs);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nutwpm")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_tti = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 't':
+        nof_threads = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'w':
+        work = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'p':
+        nof_prb = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'm':
+        mcs = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (nof_users < 1 || nof_users > 1024) {
+    nof_users = 16;
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+uint64_t nof_outstanding() {
+  return nof_pushed - __sync_fetch_and_add(&nof_sdus, 0);
+}
+
+// Writes a PDU with a BSR and a numbered SDU in the grant, returns false if no SDU fits
+bool build_pdu(uint16_t rnti, uint8_t *data, uint32_t tbs) {
+  static uint8_t   buffer[MAX_PDU_LEN];
+  static uint8_t   sdu[MAX_PDU_LEN];
+  srslte::sch_pdu  pdu(20);
+  uint32_t         buff_size[4] = {100000, 0, 0, 0};
+
+  pdu.init_tx(buffer, tbs, true);
+  if (pdu.new_subh()) {
+    pdu.get()->set_bsr(buff_size, srslte::sch_subh::SHORT_BSR);
+  }
+  bool has_sdu = false;
+  if (pdu.get_sdu_space() >= 4 && pdu.new_subh()) {
+    uint32_t len = (uint32_t) pdu.get_sdu_space();
+    uint32_t seq = pushed_seq[rnti];
+    for (uint32_t i = 0; i < len; i++) {
+      sdu[i] = (uint8_t) i;
+    }
+    sdu[0] = (uint8_t) (seq >> 24);
+    sdu[1] = (uint8_t) (seq >> 16);
+    sdu[2] = (uint8_t) (seq >> 8);
+    sdu[3] = (uint8_t) seq;
+    has_sdu = pdu.get()->set_sdu(3, len, sdu) > 0;
+  }
+  uint8_t *ptr = pdu.write_packet(&log_out);
+  if (!ptr) {
+    return false;
+  }
+  memcpy(data, ptr, tbs);
+  return has_sdu;
+}
+
+// Runs the DL and UL schedulers 4 TTIs ahead of the RX TTI, as the PHY workers do
+void run_tti(uint32_t tti_rx) {
+  mac_interface_phy::dl_sched_t dl_sched;
+  mac_interface_phy::ul_sched_t ul_sched;
+  uint32_t                      tti = (tti_rx + 4) % 10240;
+
+  mac_h.get_dl_sched(tti, &dl_sched);
+  mac_h.get_ul_sched(tti, &ul_sched);
+
+  for (uint32_t i = 0; i < ul_sched.nof_grants; i++) {
+    srslte_enb_ul_pusch_t *grant = &ul_sched.sched_grants[i];
+    srslte_ra_ul_grant_t   phy_grant;
+    if (srslte_ra_ul_dci_to_grant(&grant->grant, nof_prb, 0, &phy_grant) || phy_grant.mcs.tbs <= 0) {
+      nof_dropped++;
+      mac_h.crc_info(tti, grant->rnti, 0, false);
+      continue;
+    }
+    uint32_t tbs = (uint32_t) phy_grant.mcs.tbs / 8;
+    if (!grant->data) {
+      nof_dropped++;
+      mac_h.crc_info(tti, grant->rnti, tbs, false);
+      continue;
+    }
+    if (build_pdu(grant->rnti, grant->data, tbs)) {
+      pushed_seq[grant->rnti]++;
+      nof_pushed++;
+    }
+    mac_h.crc_info(tti, grant->rnti, tbs, true);
+  }
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  log_out.set_level(srslte::LOG_LEVEL_NONE);
+
+  srslte_cell_t cell = {nof_prb, 1, 1, SRSLTE_CP_NORM, SRSLTE_PHICH_NORM, SRSLTE_PHICH_R_1};
+
+  mac_args_t args;
+  bzero(&args, sizeof(mac_args_t));
+  args.sched.pdsch_mcs             = -1;
+  args.sched.pdsch_max_mcs         = -1;
+  args.sched.pusch_mcs             = (int) mcs;
+  args.sched.pusch_max_mcs         = -1;
+  args.sched.nof_ctrl_symbols      = 3;
+  args.link_failure_nof_err        = 100;
+  args.softbuffer_pool_nof_tb      = (int) (24 * nof_users);
+  args.nof_pdu_threads             = (int) nof_threads;
+  if (!mac_h.init(&args, &cell, &phy, &rlc, &rrc, NULL, &log_out)) {
+    fprintf(stderr, "Error initiating MAC\n");
+    exit(-1);
+  }
+
+  sched_interface::cell_cfg_t cell_cfg;
+  bzero(&cell_cfg, sizeof(sched_interface::cell_cfg_t));
+  memcpy(&cell_cfg.cell, &cell, sizeof(srslte_cell_t));
+  cell_cfg.sibs[0].len       = 18;
+  cell_cfg.sibs[0].period_rf = 8;
+  cell_cfg.sibs[1].len       = 41;
+  cell_cfg.sibs[1].period_rf = 16;
+  cell_cfg.si_window_ms      = 40;
+  cell_cfg.nrb_pucch         = 2;
+  cell_cfg.prach_rar_window  = 10;
+  mac_h.cell_cfg(&cell_cfg);
+
+  // Attach the users one per TTI, then let them request UL resources
+  uint32_t tti = 0;
+  for (uint32_t u = 0; u < nof_users; u++, tti++) {
+    mac_h.rach_detected(tti, u % 64, 0);
+    run_tti(tti);
+  }
+  for (uint32_t u = 0; u < rrc.rntis.size(); u++) {
+    mac_h.phy_config_enabled(rrc.rntis[u], true);
+    mac_h.sr_detected(tti, rrc.rntis[u]);
+  }
+  for (uint32_t i = 0; i < 100; i++, tti++) {
+    run_tti(tti % 10240);
+  }
+  while (nof_outstanding() > 0) {
+    usleep(1000);
+  }
+
+  uint64_t sdus_start  = nof_sdus;
+  uint64_t bytes_start = nof_bytes;
+  uint64_t t_start     = now_ns();
+  for (uint32_t i = 0; i < nof_tti; i++, tti++) {
+    // Do not overflow the PDU queues of the users if the threads fall behind
+    while (nof_outstanding() > MAX_OUTSTANDING * rrc.rntis.size()) {
+      sched_yield();
+    }
+    run_tti(tti % 10240);
+  }
+  while (nof_outstanding() > 0) {
+    usleep(100);
+  }
+  uint64_t elapsed = now_ns() - t_start;
+  uint64_t sdus    = nof_sdus - sdus_start;
+  uint64_t bytes   = nof_bytes - bytes_start;
+
+  mac_h.stop();
+
+  printf("%d users, %d threads: %d TTIs, %ld PDUs in %.1f ms, %.0f PDU/s, %.1f Mbps\n",
+         (int) rrc.rntis.size(), nof_threads, nof_tti, (long) sdus, (double) elapsed / 1e6,
+         (double) sdus * 1e9 / elapsed, (double) bytes * 8e3 / elapsed);
+
+  if (rrc.rntis.size() != nof_users || sdus == 0) {
+    printf("Error: %d of %d users attached, %ld PDUs processed\n", (int) rrc.rntis.size(), nof_users, (long) sdus);
+    exit(-1);
+  }
+  if (nof_errors || nof_dropped) {
+    printf("Error: %ld SDUs out of order, %ld grants without buffer\n", (long) nof_errors, (long) nof_dropped);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,321 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Reconfigures the RAN slices at 1 kHz from a control thread, as the agent
+ * would do, while another thread runs the MAC scheduler with the RAN metrics
+ * as fast as possible. Checks that DL and UL allocations never overlap, that
+ * the last configuration is the one applied, and reports the time spent by
+ * the scheduler in every TTI.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <vector>
+#include <algorithm>
+
+#include "srslte/common/log_filter.h"
+#include "srsenb/hdr/mac/scheduler.h"
+#include "srsenb/hdr/mac/scheduler_RAN.h"
+
+using namespace srsenb;
+
+#define NOF_USERS   8
+#define RNTI_START  0x46
+#define SLICE_A     2
+#define SLICE_B     3
+#define SLICE_C     4
+
+uint32_t nof_reconf = 2000;
+
+srslte::log_filter log_out("MAC");
+sched              sch;
+dl_metric_ran      dlm;
+ul_metric_ran      ulm;
+
+volatile bool running = true;
+uint32_t      nof_errors = 0;
+
+void usage(char *prog) {
+  printf("Usage: %s [n]\n", prog);
+  printf("\t-n number of reconfigurations, one per ms [Default %d]\n", nof_reconf);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "n")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_reconf = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+// The MAC applies every slice operation to both metrics
+void add_slice(uint64_t id) {
+  dlm.add_slice(id);
+  ulm.add_slice(id);
+}
+
+void rem_slice(uint64_t id) {
+  dlm.rem_slice(id);
+  ulm.rem_slice(id);
+}
+
+void set_slice(uint64_t id, uint32_t user_sched, uint32_t rbg) {
+  mac_set_slice_args args;
+  bzero(&args, sizeof(mac_set_slice_args));
+  args.user_sched = user_sched;
+  args.time       = 1;
+  args.rbg        = rbg;
+  dlm.set_slice(id, &args);
+  ulm.set_slice(id, &args);
+}
+
+void add_slice_user(uint16_t rnti, uint64_t id) {
+  dlm.add_slice_user(rnti, id, 1);
+  ulm.add_slice_user(rnti, id, 1);
+}
+
+void rem_slice_user(uint16_t rnti, uint64_t id) {
+  dlm.rem_slice_user(rnti, id);
+  ulm.rem_slice_user(rnti, id);
+}
+
+void *control_thread(void *arg) {
+  uint32_t policies[3] = {RAN_MAC_USER_RR, RAN_MAC_USER_PF, RAN_MAC_USER_MCI};
+  uint64_t slice_of[NOF_USERS];
+  bool     has_c = false;
+
+  for (uint32_t i = 0; i < NOF_USERS; i++) {
+    slice_of[i] = i % 2 ? SLICE_B : SLICE_A;
+  }
+
+  srand(1234);
+  for (uint32_t n = 0; n < nof_reconf; n++) {
+    uint32_t u = rand() % NOF_USERS;
+    switch (rand() % 4) {
+      case 0:
+        set_slice(rand() % 2 ? SLICE_A : SLICE_B, policies[rand() % 3], 1 + rand() % 6);
+        break;
+      case 1:
+        // Move an user to another slice
+        rem_slice_user(RNTI_START + u, slice_of[u]);
+        slice_of[u] = slice_of[u] == SLICE_A ? SLICE_B : SLICE_A;
+        add_slice_user(RNTI_START + u, slice_of[u]);
+        break;
+      case 2:
+        // A slice comes and goes, taking an user with it
+        if (has_c) {
+          rem_slice(SLICE_C);
+          add_slice_user(RNTI_START + u, slice_of[u]);
+        } else {
+          add_slice(SLICE_C);
+          set_slice(SLICE_C, policies[rand() % 3], 2);
+          rem_slice_user(RNTI_START + u, slice_of[u]);
+          add_slice_user(RNTI_START + u, SLICE_C);
+        }
+        has_c = !has_c;
+        break;
+      default:
+        // Same configuration again, this only renews the credits
+        set_slice(SLICE_A, 0, 4);
+        break;
+    }
+    usleep(1000);
+  }
+
+  /* Final configuration: even users in slice A, odd users in slice B which has
+   * no resources at all */
+  if (has_c) {
+    rem_slice(SLICE_C);
+  }
+  for (uint32_t i = 0; i < NOF_USERS; i++) {
+    rem_slice_user(RNTI_START + i, 0);
+    add_slice_user(RNTI_START + i, i % 2 ? SLICE_B : SLICE_A);
+  }
+  set_slice(SLICE_A, RAN_MAC_USER_PF, 6);
+  set_slice(SLICE_B, RAN_MAC_USER_RR, 0);
+
+  running = false;
+  return NULL;
+}
+
+// Runs a TTI; returns the number of DL and UL allocations of each user
+bool run_tti(uint32_t tti, uint32_t dl_allocs[NOF_USERS], uint32_t ul_allocs[NOF_USERS], uint64_t *elapsed) {
+  sched_interface::dl_sched_res_t dl;
+  sched_interface::ul_sched_res_t ul;
+  bool                            used_prb[100] = {false};
+  uint32_t                        used_rbg      = 0;
+
+  log_out.step(tti);
+  for (uint32_t i = 0; i < NOF_USERS; i++) {
+    sch.ul_bsr(RNTI_START + i, 0, 100000);
+    sch.dl_rlc_buffer_state(RNTI_START + i, 0, 100000, 0);
+  }
+
+  uint64_t t0 = now_ns();
+  sch.dl_sched(tti, &dl);
+  sch.ul_sched(tti, &ul);
+  *elapsed = now_ns() - t0;
+
+  for (uint32_t i = 0; i < dl.nof_data_elems; i++) {
+    if (dl.data[i].dci.alloc_type == SRSLTE_RA_ALLOC_TYPE0) {
+      if (used_rbg & dl.data[i].dci.type0_alloc.rbg_bitmask) {
+        printf("DL overlap at tti %d\n", tti);
+        return false;
+      }
+      used_rbg |= dl.data[i].dci.type0_alloc.rbg_bitmask;
+    }
+    if (dl.data[i].rnti >= RNTI_START && dl.data[i].rnti < RNTI_START + NOF_USERS) {
+      dl_allocs[dl.data[i].rnti - RNTI_START]++;
+    }
+    sch.dl_ack_info(tti + 4, dl.data[i].rnti, 0, true);
+  }
+  for (uint32_t i = 0; i < ul.nof_dci_elems; i++) {
+    uint32_t s = ul.pusch[i].dci.type2_alloc.RB_start;
+    uint32_t L = ul.pusch[i].dci.type2_alloc.L_crb;
+    for (uint32_t n = s; n < s + L && n < 100; n++) {
+      if (used_prb[n]) {
+        printf("UL overlap at tti %d\n", tti);
+        return false;
+      }
+      used_prb[n] = true;
+    }
+    if (ul.pusch[i].rnti >= RNTI_START && ul.pusch[i].rnti < RNTI_START + NOF_USERS) {
+      ul_allocs[ul.pusch[i].rnti - RNTI_START]++;
+    }
+  }
+  for (uint32_t i = 0; i < NOF_USERS; i++) {
+    sch.ul_crc_info(tti, RNTI_START + i, true);
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  log_out.set_level(srslte::LOG_LEVEL_NONE);
+
+  srslte_cell_t cell = {25, 1, 1, SRSLTE_CP_NORM, SRSLTE_PHICH_NORM, SRSLTE_PHICH_R_1};
+  sched_interface::cell_cfg_t cell_cfg;
+  bzero(&cell_cfg, sizeof(sched_interface::cell_cfg_t));
+  memcpy(&cell_cfg.cell, &cell, sizeof(srslte_cell_t));
+  cell_cfg.sibs[0].len       = 18;
+  cell_cfg.sibs[0].period_rf = 8;
+  cell_cfg.sibs[1].len       = 41;
+  cell_cfg.sibs[1].period_rf = 16;
+  cell_cfg.si_window_ms      = 40;
+  cell_cfg.nrb_pucch         = 2;
+
+  sch.init(NULL, NULL, &log_out);
+  dlm.init(&log_out);
+  ulm.init(&log_out);
+  sch.set_metric(&dlm, &ulm);
+  sch.cell_cfg(&cell_cfg);
+
+  sched_interface::ue_cfg_t ue_cfg;
+  bzero(&ue_cfg, sizeof(sched_interface::ue_cfg_t));
+  ue_cfg.maxharq_tx           = 5;
+  ue_cfg.aperiodic_cqi_period = 40;
+  sched_interface::ue_bearer_cfg_t bearer;
+  bzero(&bearer, sizeof(sched_interface::ue_bearer_cfg_t));
+  bearer.direction = sched_interface::ue_bearer_cfg_t::BOTH;
+
+  add_slice(SLICE_A);
+  add_slice(SLICE_B);
+  set_slice(SLICE_A, RAN_MAC_USER_RR, 4);
+  set_slice(SLICE_B, RAN_MAC_USER_RR, 4);
+  for (uint32_t i = 0; i < NOF_USERS; i++) {
+    sch.ue_cfg(RNTI_START + i, &ue_cfg);
+    sch.bearer_ue_cfg(RNTI_START + i, 0, &bearer);
+    sch.phy_config_enabled(RNTI_START + i, true);
+    sch.dl_cqi_info(0, RNTI_START + i, 4 + i);
+    sch.ul_cqi_info(0, RNTI_START + i, 4 + i, 0);
+    add_slice_user(RNTI_START + i, i % 2 ? SLICE_B : SLICE_A);
+  }
+
+  pthread_t control;
+  pthread_create(&control, NULL, control_thread, NULL);
+
+  std::vector<uint64_t> elapsed;
+  uint32_t              dl_allocs[NOF_USERS] = {0};
+  uint32_t              ul_allocs[NOF_USERS] = {0};
+  uint32_t              tti = 0;
+  uint64_t              t;
+
+  elapsed.reserve(1000000);
+  while (running) {
+    if (!run_tti(tti % 10240, dl_allocs, ul_allocs, &t)) {
+      exit(-1);
+    }
+    elapsed.push_back(t);
+    tti++;
+  }
+  pthread_join(control, NULL);
+
+  // Let the last configuration settle, then check it is the one in use
+  for (uint32_t n = 0; n < 20; n++, tti++) {
+    run_tti(tti % 10240, dl_allocs, ul_allocs, &t);
+  }
+  bzero(dl_allocs, sizeof(dl_allocs));
+  bzero(ul_allocs, sizeof(ul_allocs));
+  for (uint32_t n = 0; n < 200; n++, tti++) {
+    if (!run_tti(tti % 10240, dl_allocs, ul_allocs, &t)) {
+      exit(-1);
+    }
+  }
+  for (uint32_t i = 0; i < NOF_USERS; i++) {
+    printf("rnti 0x%x: %d DL and %d UL allocations in the last configuration\n",
+           RNTI_START + i, dl_allocs[i], ul_allocs[i]);
+    if ((i % 2 == 1) != (dl_allocs[i] == 0 && ul_allocs[i] == 0)) {
+      printf("Last configuration not applied\n");
+      exit(-1);
+    }
+  }
+
+  std::sort(elapsed.begin(), elapsed.end());
+  printf("%d reconfigurations during %d TTIs, scheduling time p50=%.1f us, p99=%.1f us, max=%.1f us\n",
+         nof_reconf, (uint32_t) elapsed.size(),
+         (float) elapsed[elapsed.size() / 2] / 1000,
+         (float) elapsed[elapsed.size() * 99 / 100] / 1000,
+         (float) elapsed[elapsed.size() - 1] / 1000);
+
+  printf("Ok\n");
+  exit(0);
+}
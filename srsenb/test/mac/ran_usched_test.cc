@@ -0,0 +1,301 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Trace-driven simulation of the RAN user schedulers. A single slice owns the
+ * whole cell and its users always have data to send; the wideband CQI of
+ * every user follows a trace, either generated or read from a file with one
+ * line per TTI and one CQI per user. For each policy the cell throughput and
+ * the Jain fairness index of the user throughputs are reported.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include "srslte/common/log_filter.h"
+#include "srsenb/hdr/mac/scheduler_RAN.h"
+
+using namespace srsenb;
+
+#define MAX_USERS   64
+#define RNTI_START  0x46
+
+uint32_t nof_tti   = 10000;
+uint32_t nof_users = 8;
+uint32_t seed      = 1234;
+char    *trace     = NULL;
+
+srslte_cell_t cell = {25, 1, 1, SRSLTE_CP_NORM, SRSLTE_PHICH_NORM, SRSLTE_PHICH_R_1};
+
+// CQI of every user for every TTI of the trace
+std::vector<std::vector<uint32_t> > cqi_trace;
+
+void usage(char *prog) {
+  printf("Usage: %s [nusf]\n", prog);
+  printf("\t-n number of TTIs [Default %d]\n", nof_tti);
+  printf("\t-u number of users [Default %d]\n", nof_users);
+  printf("\t-s seed of the generated trace [Default %d]\n", seed);
+  printf("\t-f CQI trace file, one line per TTI and one CQI per user [Default generated]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nusf")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_tti = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 's':
+        seed = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'f':
+        trace = argv[optind];
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (nof_users < 2 || nof_users > MAX_USERS) {
+    nof_users = 8;
+  }
+}
+
+float gauss() {
+  float u1 = ((float) rand() + 1) / ((float) RAND_MAX + 2);
+  float u2 = ((float) rand() + 1) / ((float) RAND_MAX + 2);
+  return sqrtf(-2 * logf(u1)) * cosf(2 * M_PI * u2);
+}
+
+/* Users are spread between cell edge and cell center; on top of the mean CQI
+ * a slow shadowing and a fast fading component are added */
+void generate_trace() {
+  std::vector<float> shadow(nof_users, 0);
+  std::vector<float> fading(nof_users, 0);
+
+  srand(seed);
+  cqi_trace.resize(nof_tti);
+  for (uint32_t t = 0; t < nof_tti; t++) {
+    cqi_trace[t].resize(nof_users);
+    for (uint32_t u = 0; u < nof_users; u++) {
+      float mean = 3 + 11 * (float) u / (nof_users - 1);
+      shadow[u]  = 0.99 * shadow[u] + 0.14 * gauss();
+      fading[u]  = 0.7 * fading[u] + 1.4 * gauss();
+      int cqi    = (int) roundf(mean + shadow[u] + fading[u]);
+      cqi_trace[t][u] = (uint32_t) SRSLTE_MAX(1, SRSLTE_MIN(15, cqi));
+    }
+  }
+}
+
+bool read_trace() {
+  FILE *f = fopen(trace, "r");
+  if (!f) {
+    perror("fopen");
+    return false;
+  }
+  std::vector<uint32_t> line(nof_users);
+  while (cqi_trace.size() < nof_tti) {
+    uint32_t u;
+    for (u = 0; u < nof_users && fscanf(f, "%u", &line[u]) == 1; u++) {
+      line[u] = SRSLTE_MAX(1, SRSLTE_MIN(15, line[u]));
+    }
+    if (u < nof_users) {
+      break;
+    }
+    cqi_trace.push_back(line);
+  }
+  fclose(f);
+  if (cqi_trace.empty()) {
+    fprintf(stderr, "No complete line in %s\n", trace);
+    return false;
+  }
+  return true;
+}
+
+typedef struct {
+  float throughput; // Mbps
+  float fairness;
+} result_t;
+
+// Runs the whole trace on a policy; the trace is replayed if shorter
+result_t simulate(ran_user_scheduler *us) {
+  uint32_t   P       = srslte_ra_type0_P(cell.nof_prb);
+  uint32_t   nof_rbg = (cell.nof_prb + P - 1) / P;
+  uint32_t   rate[16];
+  uint64_t   bytes[MAX_USERS];
+  bool       rbg[RAN_DL_MAX_RGB];
+  uint16_t   ret[RAN_DL_MAX_RGB];
+  user_map_t    umap;
+  ran_mac_slice slice;
+  result_t      r;
+
+  // Bytes carried by a group at each CQI, as sched_ue computes them
+  for (uint32_t c = 0; c < 16; c++) {
+    rate[c] = sched_ue::cqi_to_tbs(c, P, srslte_ra_dl_approx_nof_re(cell, P, 2), 28, 6, NULL) / 8;
+  }
+
+  slice.sched_user = us;
+  for (uint32_t u = 0; u < nof_users; u++) {
+    slice.users[RNTI_START + u] = 1;
+    bytes[u] = 0;
+  }
+
+  for (uint32_t t = 0; t < nof_tti; t++) {
+    std::vector<uint32_t> &cqi = cqi_trace[t % cqi_trace.size()];
+
+    // Full buffer, every user would take the whole cell
+    for (uint32_t u = 0; u < nof_users; u++) {
+      ran_mac_user *m = &umap[RNTI_START + u];
+      m->has_data   = 1;
+      m->cqi        = cqi[u];
+      m->rbg_rate   = rate[cqi[u]];
+      m->rbg_demand = nof_rbg;
+    }
+    for (uint32_t i = 0; i < RAN_DL_MAX_RGB; i++) {
+      rbg[i] = i >= nof_rbg;
+      ret[i] = 0;
+    }
+
+    us->schedule(t, &slice, &umap, rbg, ret);
+
+    for (uint32_t i = 0; i < nof_rbg; i++) {
+      if (ret[i]) {
+        uint32_t u = ret[i] - RNTI_START;
+        bytes[u] += rate[cqi[u]];
+      }
+    }
+  }
+
+  double sum = 0, sum2 = 0;
+  for (uint32_t u = 0; u < nof_users; u++) {
+    double x = (double) bytes[u];
+    sum  += x;
+    sum2 += x * x;
+  }
+  r.throughput = (float) (sum * 8 / nof_tti / 1000);
+  r.fairness   = sum2 > 0 ? (float) (sum * sum / (nof_users * sum2)) : 0;
+
+  printf("%-4s: cell throughput %6.2f Mbps, Jain fairness %.3f, per user Mbps:",
+         us->m_id == RAN_MAC_USER_RR ? "RR" : us->m_id == RAN_MAC_USER_PF ? "PF" : "MCI",
+         r.throughput, r.fairness);
+  for (uint32_t u = 0; u < nof_users; u++) {
+    printf(" %.2f", (float) bytes[u] * 8 / nof_tti / 1000);
+  }
+  printf("\n");
+
+  return r;
+}
+
+// The user scheduler of a slice can be changed through set_slice
+int test_set_slice() {
+  srslte::log_filter log("MAC");
+  dl_metric_ran      metric;
+  mac_set_slice_args args;
+
+  log.set_level(srslte::LOG_LEVEL_NONE);
+  metric.init(&log);
+
+  bzero(&args, sizeof(mac_set_slice_args));
+  if (metric.add_slice(RAN_DEFAULT_SLICE)) {
+    return -1;
+  }
+  if (metric.get_slice_info(RAN_DEFAULT_SLICE, &args) || args.user_sched != RAN_MAC_USER_RR) {
+    return -1;
+  }
+
+  uint32_t policies[3] = {RAN_MAC_USER_PF, RAN_MAC_USER_MCI, RAN_MAC_USER_RR};
+  for (uint32_t i = 0; i < 3; i++) {
+    bzero(&args, sizeof(mac_set_slice_args));
+    args.user_sched = policies[i];
+    args.rbg        = 13;
+    args.time       = 1;
+    metric.set_slice(RAN_DEFAULT_SLICE, &args);
+    if (metric.get_slice_info(RAN_DEFAULT_SLICE, &args) || args.user_sched != policies[i]) {
+      fprintf(stderr, "Slice is using user scheduler %x instead of %x\n", args.user_sched, policies[i]);
+      return -1;
+    }
+  }
+
+  // Unknown policies are refused and the current one is kept
+  args.user_sched = RAN_MAC_USER_SCHED | 0xff;
+  if (metric.set_slice(RAN_DEFAULT_SLICE, &args) == 0) {
+    return -1;
+  }
+  metric.get_slice_info(RAN_DEFAULT_SLICE, &args);
+  if (args.user_sched != RAN_MAC_USER_RR) {
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  if (test_set_slice()) {
+    fprintf(stderr, "Selecting the user scheduler of a slice failed\n");
+    exit(-1);
+  }
+
+  if (trace) {
+    if (!read_trace()) {
+      exit(-1);
+    }
+  } else {
+    generate_trace();
+  }
+
+  ran_rr_usched  rr;
+  ran_pf_usched  pf;
+  ran_mci_usched mci;
+
+  result_t r_rr  = simulate(&rr);
+  result_t r_pf  = simulate(&pf);
+  result_t r_mci = simulate(&mci);
+
+  // Only report on external traces, they may not show any channel diversity
+  if (trace) {
+    exit(0);
+  }
+
+  // Channel-aware policies must exploit the channel, PF must stay fair
+  if (r_pf.throughput < r_rr.throughput || r_mci.throughput < r_pf.throughput) {
+    fprintf(stderr, "Unexpected throughput ordering\n");
+    exit(-1);
+  }
+  if (r_pf.fairness < r_mci.fairness) {
+    fprintf(stderr, "PF is less fair than MCI\n");
+    exit(-1);
+  }
+
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,354 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Measures the time taken by sched::dl_sched and sched::ul_sched in every TTI
+ * with a configurable number of users, bearers and buffer states, and a CQI
+ * trace. The metric is plugged in from the command line: the round-robin one
+ * or the RAN one with the multi-slice or the two-slice (duo-dynamic) slice
+ * scheduler, with the users spread between the slices. A histogram of the
+ * TTI latency is printed. When a TTI budget is given with -l, the run fails
+ * if the 99th percentile exceeds it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include <vector>
+#include <algorithm>
+
+#include "srslte/common/log_filter.h"
+#include "srsenb/hdr/mac/scheduler.h"
+#include "srsenb/hdr/mac/scheduler_metric.h"
+#include "srsenb/hdr/mac/scheduler_RAN.h"
+
+using namespace srsenb;
+
+#define METRIC_RR       0
+#define METRIC_RAN      1
+#define METRIC_RAN_DUO  2
+
+#define MAX_USERS       1024
+#define MAX_SLICES      8
+#define RNTI_START      0x46
+#define CQI_PERIOD      5   // TTIs between two CQI reports of an user
+
+uint32_t nof_tti     = 10000;
+uint32_t nof_users   = 16;
+uint32_t nof_bearers = 1;
+uint32_t buffer      = 100000;
+uint32_t metric      = METRIC_RR;
+uint32_t nof_slices  = 2;
+uint32_t nof_prb     = 25;
+uint32_t budget_us   = 1000;
+bool     check_p99   = false;
+char    *trace       = NULL;
+
+srslte::log_filter log_out("MAC");
+sched              sch;
+dl_metric_rr       dl_rr;
+ul_metric_rr       ul_rr;
+dl_metric_ran      dl_ran;
+ul_metric_ran      ul_ran;
+
+// CQI of every user for every TTI of the trace
+std::vector<std::vector<uint32_t> > cqi_trace;
+
+void usage(char *prog) {
+  printf("Usage: %s [nubqmspfl]\n", prog);
+  printf("\t-n number of TTIs [Default %d]\n", nof_tti);
+  printf("\t-u number of users [Default %d]\n", nof_users);
+  printf("\t-b number of data bearers per user [Default %d]\n", nof_bearers);
+  printf("\t-q DL and UL buffer state of every bearer, in bytes [Default %d]\n", buffer);
+  printf("\t-m metric, 0: round-robin, 1: RAN multi-slice, 2: RAN duo-dynamic [Default %d]\n", metric);
+  printf("\t-s number of slices of the RAN metrics [Default %d]\n", nof_slices);
+  printf("\t-p number of PRB of the cell [Default %d]\n", nof_prb);
+  printf("\t-f CQI trace file, one line per TTI and one CQI per user [Default fixed CQI]\n");
+  printf("\t-l TTI budget in us, fail if the 99th percentile exceeds it [Default %d, not checked]\n", budget_us);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nubqmspfl")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_tti = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'b':
+        nof_bearers = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'q':
+        buffer = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'm':
+        metric = (uint32_t) atoi(argv[optind]);
+        break;
+      case 's':
+        nof_slices = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'p':
+        nof_prb = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'f':
+        trace = argv[optind];
+        break;
+      case 'l':
+        budget_us = (uint32_t) atoi(argv[optind]);
+        check_p99 = true;
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (nof_users < 1 || nof_users > MAX_USERS) {
+    nof_users = 16;
+  }
+  if (nof_bearers < 1 || nof_bearers > sched_interface::MAX_LC - 3) {
+    nof_bearers = 1;
+  }
+  if (metric > METRIC_RAN_DUO) {
+    metric = METRIC_RR;
+  }
+  if (nof_slices < 1 || nof_slices > MAX_SLICES) {
+    nof_slices = 2;
+  }
+  if (metric == METRIC_RAN_DUO) {
+    nof_slices = 2;
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+uint16_t user_rnti(uint32_t u) {
+  // The MAC allocates C-RNTIs with a step of 3
+  return (uint16_t) (RNTI_START + 3 * u);
+}
+
+bool read_trace() {
+  FILE *f = fopen(trace, "r");
+  if (!f) {
+    perror("fopen");
+    return false;
+  }
+  std::vector<uint32_t> line(nof_users);
+  while (cqi_trace.size() < nof_tti) {
+    uint32_t u;
+    for (u = 0; u < nof_users && fscanf(f, "%u", &line[u]) == 1; u++) {
+      line[u] = SRSLTE_MAX(1, SRSLTE_MIN(15, line[u]));
+    }
+    if (u < nof_users) {
+      break;
+    }
+    cqi_trace.push_back(line);
+  }
+  fclose(f);
+  if (cqi_trace.empty()) {
+    fprintf(stderr, "No complete line in %s\n", trace);
+    return false;
+  }
+  return true;
+}
+
+// Users are spread between cell edge and cell center
+void fixed_trace() {
+  cqi_trace.resize(1);
+  for (uint32_t u = 0; u < nof_users; u++) {
+    cqi_trace[0].push_back(3 + (12 * u) / SRSLTE_MAX(1, nof_users - 1));
+  }
+}
+
+void setup_slices() {
+  uint32_t           P       = srslte_ra_type0_P(nof_prb);
+  uint32_t           nof_rbg = (nof_prb + P - 1) / P;
+  mac_set_slice_args args;
+
+  for (uint32_t s = 0; s < nof_slices; s++) {
+    uint64_t id = RAN_DEFAULT_SLICE + s;
+    bzero(&args, sizeof(mac_set_slice_args));
+    args.user_sched = RAN_MAC_USER_RR;
+    args.time       = 1;
+    args.rbg        = SRSLTE_MAX(1, nof_rbg / nof_slices);
+    dl_ran.add_slice(id);
+    ul_ran.add_slice(id);
+    dl_ran.set_slice(id, &args);
+    ul_ran.set_slice(id, &args);
+  }
+  for (uint32_t u = 0; u < nof_users; u++) {
+    dl_ran.add_slice_user(user_rnti(u), RAN_DEFAULT_SLICE + u % nof_slices, 1);
+    ul_ran.add_slice_user(user_rnti(u), RAN_DEFAULT_SLICE + u % nof_slices, 1);
+  }
+}
+
+void print_histogram(std::vector<uint64_t> &elapsed) {
+  const uint32_t nof_bins      = 8;
+  uint32_t       edges[nof_bins] = {50, 100, 200, 300, 500, 750, 1000, 2000};
+  uint32_t       count[nof_bins + 1];
+
+  bzero(count, sizeof(count));
+  for (uint32_t i = 0; i < elapsed.size(); i++) {
+    uint32_t b = 0;
+    while (b < nof_bins && elapsed[i] >= (uint64_t) edges[b] * 1000) {
+      b++;
+    }
+    count[b]++;
+  }
+  for (uint32_t b = 0; b <= nof_bins; b++) {
+    if (b < nof_bins) {
+      printf("  < %4d us: ", edges[b]);
+    } else {
+      printf(" >= %4d us: ", edges[nof_bins - 1]);
+    }
+    printf("%7d (%5.1f%%)\n", count[b], 100.0 * count[b] / elapsed.size());
+  }
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  log_out.set_level(srslte::LOG_LEVEL_NONE);
+
+  if (trace) {
+    if (!read_trace()) {
+      exit(-1);
+    }
+  } else {
+    fixed_trace();
+  }
+
+  srslte_cell_t cell = {nof_prb, 1, 1, SRSLTE_CP_NORM, SRSLTE_PHICH_NORM, SRSLTE_PHICH_R_1};
+  sched_interface::cell_cfg_t cell_cfg;
+  bzero(&cell_cfg, sizeof(sched_interface::cell_cfg_t));
+  memcpy(&cell_cfg.cell, &cell, sizeof(srslte_cell_t));
+  cell_cfg.sibs[0].len       = 18;
+  cell_cfg.sibs[0].period_rf = 8;
+  cell_cfg.sibs[1].len       = 41;
+  cell_cfg.sibs[1].period_rf = 16;
+  cell_cfg.si_window_ms      = 40;
+  cell_cfg.nrb_pucch         = 2;
+
+  sch.init(NULL, NULL, &log_out);
+  if (metric == METRIC_RR) {
+    sch.set_metric(&dl_rr, &ul_rr);
+  } else {
+    uint32_t ssched = metric == METRIC_RAN_DUO ? RAN_MAC_SLICE_DUO : RAN_MAC_SLICE_MULTI;
+    dl_ran.init(&log_out, ssched);
+    ul_ran.init(&log_out, ssched);
+    sch.set_metric(&dl_ran, &ul_ran);
+  }
+  sch.cell_cfg(&cell_cfg);
+
+  sched_interface::ue_cfg_t ue_cfg;
+  bzero(&ue_cfg, sizeof(sched_interface::ue_cfg_t));
+  ue_cfg.maxharq_tx           = 5;
+  ue_cfg.aperiodic_cqi_period = 40;
+  sched_interface::ue_bearer_cfg_t bearer;
+  bzero(&bearer, sizeof(sched_interface::ue_bearer_cfg_t));
+  bearer.direction = sched_interface::ue_bearer_cfg_t::BOTH;
+
+  for (uint32_t u = 0; u < nof_users; u++) {
+    sch.ue_cfg(user_rnti(u), &ue_cfg);
+    sch.bearer_ue_cfg(user_rnti(u), 0, &bearer);
+    for (uint32_t b = 0; b < nof_bearers; b++) {
+      sch.bearer_ue_cfg(user_rnti(u), 3 + b, &bearer);
+    }
+    sch.phy_config_enabled(user_rnti(u), true);
+  }
+  if (metric != METRIC_RR) {
+    setup_slices();
+  }
+
+  std::vector<uint64_t> elapsed;
+  uint64_t              nof_dl = 0, nof_ul = 0;
+
+  elapsed.reserve(nof_tti);
+  for (uint32_t t = 0; t < nof_tti; t++) {
+    uint32_t                        tti = t % 10240;
+    std::vector<uint32_t>          &cqi = cqi_trace[t % cqi_trace.size()];
+    sched_interface::dl_sched_res_t dl;
+    sched_interface::ul_sched_res_t ul;
+
+    log_out.step(tti);
+    for (uint32_t u = 0; u < nof_users; u++) {
+      uint16_t rnti = user_rnti(u);
+      for (uint32_t b = 0; b < nof_bearers; b++) {
+        sch.dl_rlc_buffer_state(rnti, 3 + b, buffer, 0);
+      }
+      sch.ul_bsr(rnti, 0, buffer * nof_bearers);
+      if ((t + u) % CQI_PERIOD == 0) {
+        sch.dl_cqi_info(tti, rnti, cqi[u]);
+        sch.ul_cqi_info(tti, rnti, cqi[u], 0);
+      }
+    }
+
+    uint64_t t0 = now_ns();
+    sch.dl_sched(tti, &dl);
+    sch.ul_sched(tti, &ul);
+    elapsed.push_back(now_ns() - t0);
+
+    nof_dl += dl.nof_data_elems;
+    nof_ul += ul.nof_dci_elems;
+    for (uint32_t i = 0; i < dl.nof_data_elems; i++) {
+      for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
+        if (dl.data[i].nof_pdu_elems[tb] > 0) {
+          sch.dl_ack_info(tti + 4, dl.data[i].rnti, tb, true);
+        }
+      }
+    }
+    for (uint32_t i = 0; i < ul.nof_dci_elems; i++) {
+      sch.ul_crc_info(tti, ul.pusch[i].rnti, true);
+    }
+  }
+
+  std::vector<uint64_t> sorted(elapsed);
+  std::sort(sorted.begin(), sorted.end());
+  double   p50      = sorted[sorted.size() / 2] / 1000.0;
+  double   p99      = sorted[(sorted.size() * 99) / 100] / 1000.0;
+  double   max      = sorted.back() / 1000.0;
+  uint32_t nof_late = (uint32_t) (sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), (uint64_t) budget_us * 1000));
+
+  const char *names[3] = {"round-robin", "RAN multi-slice", "RAN duo-dynamic"};
+  printf("%s metric, %d PRB, %d users, %d bearers each, %d TTIs\n",
+         names[metric], nof_prb, nof_users, nof_bearers, nof_tti);
+  printf("%.1f DL and %.1f UL grants per TTI\n", (float) nof_dl / nof_tti, (float) nof_ul / nof_tti);
+  print_histogram(elapsed);
+  printf("TTI time p50=%.1f us, p99=%.1f us, max=%.1f us; %d TTIs (%.2f%%) over the %d us budget\n",
+         p50, p99, max, nof_late, 100.0 * nof_late / nof_tti, budget_us);
+
+  if (check_p99 && p99 > budget_us) {
+    printf("99th percentile over budget\n");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
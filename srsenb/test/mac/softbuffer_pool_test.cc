@@ -0,0 +1,148 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Creates the softbuffers of many users against a small softbuffer pool and
+ * checks that leases are sized to the TBS, that they fail without side effects
+ * once the pool is exhausted, that released storage is reused and reset, and
+ * that the pool metrics follow the occupancy.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <strings.h>
+#include <vector>
+
+#include "srslte/srslte.h"
+#include "srsenb/hdr/mac/softbuffer_pool.h"
+
+using namespace srsenb;
+
+#define NOF_PRB 25
+#define NOF_TB  4
+
+uint32_t nof_users = 100;
+
+void usage(char *prog) {
+  printf("Usage: %s [n]\n", prog);
+  printf("\t-n number of users [Default %d]\n", nof_users);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "n")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+#define CHECK(cond) do { if (!(cond)) { printf("Error line %d: %s\n", __LINE__, #cond); exit(-1); } } while (0)
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  softbuffer_pool          pool;
+  mac_softbuffer_metrics_t m;
+
+  CHECK(pool.init(NOF_PRB, NOF_TB));
+  uint32_t max_cb = pool.get_max_cb();
+  uint32_t nof_cb = max_cb * NOF_TB;
+  uint32_t max_tbs = (uint32_t) srslte_ra_tbs_from_idx(26, NOF_PRB);
+
+  std::vector<srslte_softbuffer_rx_t> rx(nof_users);
+  std::vector<srslte_softbuffer_tx_t> tx(nof_users);
+  for (uint32_t i = 0; i < nof_users; i++) {
+    CHECK(pool.init_rx(&rx[i]));
+    CHECK(pool.init_tx(&tx[i]));
+    CHECK(rx[i].max_cb == 0 && tx[i].max_cb == 0);
+  }
+
+  // Small TBs take one code block each, until the pool is exhausted
+  uint32_t n = 0;
+  while (n < nof_users && pool.lease_rx(&rx[n], 1000)) {
+    CHECK(rx[n].max_cb == 1);
+    n++;
+  }
+  CHECK(n == (nof_users < nof_cb ? nof_users : nof_cb));
+  if (n < nof_users) {
+    CHECK(rx[n].max_cb == 0);
+  }
+  pool.get_metrics(&m);
+  CHECK(m.nof_cb == nof_cb && m.rx_cb_used == n && m.rx_cb_peak == n && m.tx_cb_used == 0);
+  CHECK(m.nof_leases == n && m.nof_lease_fail == (n < nof_users ? 1u : 0u));
+
+  // Released storage is reused and reset for the next transmission
+  rx[0].buffer_f[0][10] = 7;
+  rx[0].cb_crc[0]       = true;
+  pool.release_rx(&rx[0]);
+  CHECK(rx[0].max_cb == 0);
+  CHECK(pool.lease_rx(&rx[1], 1000));
+  CHECK(rx[1].max_cb == 1 && rx[1].buffer_f[0][10] == 0 && !rx[1].cb_crc[0]);
+
+  // A largest TBS needs max_cb code blocks
+  for (uint32_t i = 0; i < n; i++) {
+    pool.release_rx(&rx[i]);
+  }
+  pool.get_metrics(&m);
+  CHECK(m.rx_cb_used == 0);
+  for (uint32_t i = 0; i < NOF_TB && i < nof_users; i++) {
+    CHECK(pool.lease_tx(&tx[i], max_tbs));
+    CHECK(tx[i].max_cb == max_cb);
+  }
+  if (nof_users > NOF_TB) {
+    CHECK(!pool.lease_tx(&tx[NOF_TB], max_tbs));
+    CHECK(tx[NOF_TB].max_cb == 0);
+    // Leasing again for a smaller TBS returns the previous lease first
+    CHECK(pool.lease_tx(&tx[0], 1000));
+    CHECK(tx[0].max_cb == 1);
+    pool.get_metrics(&m);
+    CHECK(m.tx_cb_used == (NOF_TB - 1) * max_cb + 1);
+  }
+
+  for (uint32_t i = 0; i < nof_users; i++) {
+    pool.free_rx(&rx[i]);
+    pool.free_tx(&tx[i]);
+  }
+  pool.get_metrics(&m);
+  CHECK(m.rx_cb_used == 0 && m.tx_cb_used == 0);
+  pool.stop();
+
+  // Storage of the previous per-user allocation, 16 HARQ softbuffers per direction
+  float per_user_mb = 16.0f * max_cb * SOFTBUFFER_SIZE * (sizeof(int16_t) + sizeof(float)) / 1e6;
+  float pool_mb     = (float) nof_cb * (SOFTBUFFER_SIZE * (sizeof(int16_t) + sizeof(uint8_t)) + 6144/8) / 1e6;
+  printf("%d users, %d PRB: %.1f MB per-user storage, %.1f MB pool storage\n",
+         nof_users, NOF_PRB, per_user_mb * nof_users, pool_mb);
+  printf("Ok\n");
+  exit(0);
+}
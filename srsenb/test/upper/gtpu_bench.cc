@@ -0,0 +1,209 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Loopback throughput of the S1-U path. The bearers of the users point their
+ * UL tunnel to the local GTP-U socket with the TEID of their own DL tunnel, so
+ * every PDU written by the stub PDCP goes through gtpu::write_pdu, the socket
+ * and the GTP-U RX thread back into the stub PDCP. The number of outstanding
+ * packets is limited to stay within the socket buffer. Prints the packet rate
+ * for the configured batch size, 1 being one system call per packet.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sched.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+#include "srslte/common/buffer_pool.h"
+#include "srslte/common/log_filter.h"
+#include "srsenb/hdr/upper/gtpu.h"
+
+using namespace srsenb;
+
+#define LCID       3
+#define RNTI_START 0x46
+#define MAX_USERS  1024
+
+uint32_t nof_packets = 100000;
+uint32_t nof_users   = 16;
+uint32_t pdu_size    = 512;
+uint32_t batch_size  = 32;
+uint32_t window      = 128;
+const char *address  = "127.0.0.1";
+
+uint64_t nof_received = 0;
+uint64_t nof_errors   = 0;
+
+uint32_t next_seq[MAX_USERS];
+
+class pdcp_dummy : public pdcp_interface_gtpu
+{
+public:
+  srslte::byte_buffer_pool *pool;
+
+  void write_sdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *sdu) {
+    uint32_t u = (rnti - RNTI_START) / 3;
+    if (lcid != LCID || u >= nof_users || sdu->N_bytes != pdu_size) {
+      __sync_fetch_and_add(&nof_errors, 1);
+    } else {
+      // Only the GTP-U RX thread writes SDUs
+      uint32_t seq = (uint32_t) sdu->msg[0] << 24 | (uint32_t) sdu->msg[1] << 16 | (uint32_t) sdu->msg[2] << 8 | sdu->msg[3];
+      if (seq != next_seq[u]) {
+        __sync_fetch_and_add(&nof_errors, 1);
+      }
+      next_seq[u] = seq + 1;
+    }
+    pool->deallocate(sdu);
+    __sync_fetch_and_add(&nof_received, 1);
+  }
+};
+
+void usage(char *prog) {
+  printf("Usage: %s [nusbwa]\n", prog);
+  printf("\t-n number of packets [Default %d]\n", nof_packets);
+  printf("\t-u number of users [Default %d]\n", nof_users);
+  printf("\t-s packet size in bytes [Default %d]\n", pdu_size);
+  printf("\t-b packets per system call [Default %d]\n", batch_size);
+  printf("\t-w maximum number of packets in flight [Default %d]\n", window);
+  printf("\t-a local address the GTP-U socket binds to and the tunnels point to [Default %s]\n", address);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nusbwa")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_packets = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 's':
+        pdu_size = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'b':
+        batch_size = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'w':
+        window = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'a':
+        address = argv[optind];
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (nof_users < 1 || nof_users > MAX_USERS) {
+    nof_users = 16;
+  }
+  if (pdu_size < 4 || pdu_size > 1500) {
+    pdu_size = 512;
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+uint16_t user_rnti(uint32_t u) {
+  return (uint16_t) (RNTI_START + 3 * u);
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  srslte::log_filter        log_out("GTPU");
+  srslte::byte_buffer_pool *pool = srslte::byte_buffer_pool::get_instance();
+  pdcp_dummy                pdcp;
+  gtpu                      gtpu_h;
+
+  log_out.set_level(srslte::LOG_LEVEL_ERROR);
+  pdcp.pool = pool;
+
+  if (!gtpu_h.init(address, address, "", "", &pdcp, &log_out, false, batch_size)) {
+    fprintf(stderr, "Error initiating GTP-U\n");
+    exit(-1);
+  }
+
+  // The UL tunnel of every bearer is the DL tunnel of the same bearer
+  for (uint32_t u = 0; u < nof_users; u++) {
+    uint32_t teid_in;
+    gtpu_h.add_bearer(user_rnti(u), LCID, ntohl(inet_addr(address)), ((uint32_t) user_rnti(u) << 16) | LCID, &teid_in);
+  }
+
+  uint64_t nof_sent = 0;
+  uint64_t t_start  = now_ns();
+  for (uint32_t i = 0; i < nof_packets; i++) {
+    while (nof_sent - __sync_fetch_and_add(&nof_received, 0) >= window) {
+      sched_yield();
+    }
+    srslte::byte_buffer_t *pdu = pool->allocate();
+    while (!pdu) {
+      sched_yield();
+      pdu = pool->allocate();
+    }
+    uint32_t u   = i % nof_users;
+    uint32_t seq = i / nof_users;
+    for (uint32_t j = 0; j < pdu_size; j++) {
+      pdu->msg[j] = (uint8_t) j;
+    }
+    pdu->msg[0]  = (uint8_t) (seq >> 24);
+    pdu->msg[1]  = (uint8_t) (seq >> 16);
+    pdu->msg[2]  = (uint8_t) (seq >> 8);
+    pdu->msg[3]  = (uint8_t) seq;
+    pdu->N_bytes = pdu_size;
+    gtpu_h.write_pdu(user_rnti(u), LCID, pdu);
+    nof_sent++;
+  }
+
+  // Wait for the packets in flight, lost ones never arrive
+  uint64_t t_wait = now_ns();
+  while (__sync_fetch_and_add(&nof_received, 0) < nof_sent && now_ns() - t_wait < 1000000000) {
+    usleep(100);
+  }
+  uint64_t elapsed  = now_ns() - t_start;
+  uint64_t received = __sync_fetch_and_add(&nof_received, 0);
+
+  gtpu_h.stop();
+
+  printf("%d users, batch %d: %ld of %ld packets of %d bytes in %.1f ms, %.0f packet/s, %.1f Mbps\n",
+         nof_users, batch_size, (long) received, (long) nof_sent, pdu_size, (double) elapsed / 1e6,
+         (double) received * 1e9 / elapsed, (double) received * pdu_size * 8e3 / elapsed);
+
+  if (received != nof_sent || nof_errors) {
+    printf("Error: %ld packets lost, %ld invalid or out of order\n", (long) (nof_sent - received), (long) nof_errors);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -588,6 +588,8 @@ int main(int argc, char *argv[])
   phy_args.estimator_fil_w = 0.2;
   phy_args.max_prach_offset_us = 50; 
   phy_args.nof_phy_threads = 1; 
+  phy_args.nof_pusch_decoder_threads = 0;
+  phy_args.nof_pdsch_encoder_threads = 0;
   phy_args.pusch_max_its   = 5; 
   
   generate_cell_configuration(&mac_cfg, &phy_cfg);
@@ -18,32 +18,32 @@ void rrc_plmn_test()
   plmn_in.mcc = 0xF123;
   plmn_in.mnc = 0xFF45;
 
-  // 2-digit MNC test
-  uint8_t bit_buf[32];
-  uint8_t *ie_ptr = bit_buf;
+  // 2-digit MNC test, 22 bits
+  uint8_t byte_buf[4];
+  LIBLTE_BIT_PTR_STRUCT ie_ptr;
+  liblte_bit_ptr_init(&ie_ptr, byte_buf);
 
   liblte_rrc_pack_plmn_identity_ie(&plmn_in, &ie_ptr);
-  uint8_t byte_buf[4];
-  liblte_pack(bit_buf, 22, byte_buf);
-  uint8_t ref[3] = {0x89, 0x19, 0x05};
+  assert(ie_ptr.N_bits == 22);
+  uint8_t ref[3] = {0x89, 0x19, 0x14};
   for(int i=0;i<3;i++) {
     assert(ref[i] == byte_buf[i]);
   }
-  ie_ptr = bit_buf;
+  liblte_bit_ptr_init(&ie_ptr, byte_buf);
   liblte_rrc_unpack_plmn_identity_ie(&ie_ptr, &plmn_out);
   assert(plmn_in.mcc == plmn_out.mcc);
   assert(plmn_in.mnc == plmn_out.mnc);
 
   // 3-digit MNC test
   plmn_in.mnc = 0xF456;
-  ie_ptr = bit_buf;
+  liblte_bit_ptr_init(&ie_ptr, byte_buf);
   liblte_rrc_pack_plmn_identity_ie(&plmn_in, &ie_ptr);
-  liblte_pack(bit_buf, 26, byte_buf);
+  assert(ie_ptr.N_bits == 26);
   uint8_t ref2[4] = {0x89, 0x1D, 0x15, 0x02};
   for(int i=0;i<3;i++) {
     assert(ref2[i] == byte_buf[i]);
   }
-  ie_ptr = bit_buf;
+  liblte_bit_ptr_init(&ie_ptr, byte_buf);
   liblte_rrc_unpack_plmn_identity_ie(&ie_ptr, &plmn_out);
   assert(plmn_in.mcc == plmn_out.mcc);
   assert(plmn_in.mnc == plmn_out.mnc);
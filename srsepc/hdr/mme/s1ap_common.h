@@ -95,6 +95,8 @@ typedef struct{
   std::string   mme_apn;
   bool          pcap_enable;
   std::string   pcap_filename;
+  int           pcap_file_max_size;
+  int           pcap_file_max_time;
 } s1ap_args_t;
 
 typedef struct{
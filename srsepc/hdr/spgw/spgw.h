@@ -34,12 +34,15 @@
 #define SRSEPC_SPGW_H
 
 #include <cstddef>
+#include <vector>
+#include <sys/socket.h>
 #include "srslte/common/log.h"
 #include "srslte/common/logger_file.h"
 #include "srslte/common/log_filter.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/threads.h"
 #include "srslte/asn1/gtpc.h"
+#include "srsepc/hdr/spgw/ue_ip_table.h"
 
 namespace srsepc{
 
@@ -47,10 +50,14 @@ class mme_gtpc;
 
 const uint16_t GTPU_RX_PORT = 2152;
 
+const uint32_t SPGW_MAX_WORKERS = 16;
+const uint32_t SPGW_BATCH_SIZE  = 32;  // Packets read or sent per system call
+
 typedef struct {
   std::string gtpu_bind_addr;
   std::string sgi_if_addr;
   std::string sgi_if_name;
+  uint32_t    nof_workers;
 } spgw_args_t;
 
 
@@ -79,8 +86,12 @@ public:
   void handle_delete_session_request(struct srslte::gtpc_pdu *del_req_pdu, struct srslte::gtpc_pdu *del_resp_pdu);
   void handle_release_access_bearers_request(struct srslte::gtpc_pdu *rel_req_pdu, struct srslte::gtpc_pdu *rel_resp_pdu);
 
-  void handle_sgi_pdu(srslte::byte_buffer_t *msg);
-  void handle_s1u_pdu(srslte::byte_buffer_t *msg);
+  // Downlink user plane tunnel of an UE, readable by the data plane workers without locking
+  bool set_dl_tunnel(in_addr_t ue_ipv4, srslte::gtpc_f_teid_ie *enb_fteid);
+  void rem_dl_tunnel(in_addr_t ue_ipv4);
+
+  bool handle_sgi_pdu(srslte::byte_buffer_t *msg, sockaddr_in *enb_addr);
+  void handle_s1u_pdu(srslte::byte_buffer_t *msg, int sgi_if);
 
 private:
 
@@ -91,6 +102,25 @@ private:
   srslte::error_t init_sgi_if(spgw_args_t *args);
   srslte::error_t init_s1u(spgw_args_t *args);
   srslte::error_t init_ue_ip(spgw_args_t *args);
+  void close_sgi_queues();
+  void close_s1u_socks();
+
+  /* Each worker owns one queue of the SGi TUN device and one of the S1-U sockets sharing the port.
+   * The kernel spreads the flows between them. The SP-GW thread runs the worker 0. */
+  class worker : public thread {
+  public:
+    worker(spgw *parent_, uint32_t idx_) : parent(parent_), idx(idx_) {}
+  private:
+    void run_thread() { parent->run_worker(idx); }
+    spgw    *parent;
+    uint32_t idx;
+  };
+  void run_worker(uint32_t idx);
+  void recv_s1u_batch(uint32_t idx, std::vector<srslte::byte_buffer_t*> &bufs, std::vector<struct mmsghdr> &msgs,
+                      std::vector<struct iovec> &iovs);
+  void recv_sgi_batch(uint32_t idx, std::vector<srslte::byte_buffer_t*> &bufs, std::vector<struct mmsghdr> &msgs,
+                      std::vector<struct iovec> &iovs, std::vector<sockaddr_in> &addrs);
+  bool wait_s1u_writable(uint32_t idx);
 
   uint64_t get_new_ctrl_teid();
   uint64_t get_new_user_teid();
@@ -112,6 +142,11 @@ private:
   bool m_s1u_up;
   int m_s1u;
 
+  uint32_t m_nof_workers;
+  std::vector<int> m_sgi_queues;          // One TUN queue per worker, m_sgi_if is the first one
+  std::vector<int> m_s1u_socks;           // One S1-U socket per worker, m_s1u is the first one
+  int m_stop_fd;                          // Signalled by stop() to wake up the workers
+
   uint64_t m_next_ctrl_teid;
   uint64_t m_next_user_teid;
 
@@ -121,7 +156,7 @@ private:
 
   std::map<uint64_t,uint32_t> m_imsi_to_ctr_teid;                   //IMSI to control TEID map. Important to check if UE is previously connected
   std::map<uint32_t,spgw_tunnel_ctx*> m_teid_to_tunnel_ctx;         //Map control TEID to tunnel ctx. Usefull to get reply ctrl TEID, UE IP, etc.
-  std::map<in_addr_t,srslte::gtpc_f_teid_ie> m_ip_to_teid;          //Map IP to User-plane TEID for downlink traffic
+  ue_ip_table m_ip_to_teid;                                         //Map IP to User-plane TEID for downlink traffic
 
   uint32_t m_h_next_ue_ip;
 
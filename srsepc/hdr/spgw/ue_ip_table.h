@@ -0,0 +1,189 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        ue_ip_table.h
+ * Description: UE IP address to eNB user plane F-TEID table of the SP-GW,
+ *              read by all the data plane workers for every SGi packet.
+ *              Open addressing over a fixed number of slots, indexed by the
+ *              low bits of the address since UE IPs are allocated
+ *              sequentially. A slot is never emptied again once used, so
+ *              probe chains never break and lookups need no lock. Erased
+ *              slots are reused by later inserts on the same chain. The
+ *              address and F-TEID of a slot are protected by a sequence
+ *              number that writers make odd while updating them, readers
+ *              retry if it changed. Writers are serialized by the caller.
+ *****************************************************************************/
+
+#ifndef SRSEPC_UE_IP_TABLE_H
+#define SRSEPC_UE_IP_TABLE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// Orders the accesses to the F-TEID with respect to the sequence number.
+// x86 does not reorder loads with loads nor stores with stores.
+#if defined(__i386__) || defined(__x86_64__)
+#define SPGW_TABLE_BARRIER() asm volatile("" ::: "memory")
+#else
+#define SPGW_TABLE_BARRIER() __sync_synchronize()
+#endif
+
+namespace srsepc{
+
+class ue_ip_table
+{
+public:
+  explicit ue_ip_table(uint32_t capacity_ = 4096)
+  {
+    capacity = 1;
+    while (capacity < capacity_) {
+      capacity <<= 1;
+    }
+    slots = new slot_t[capacity];
+    bzero((void*) slots, capacity*sizeof(slot_t));
+    nof_valid = 0;
+  }
+  ~ue_ip_table()
+  {
+    delete [] slots;
+  }
+
+  // Adds or replaces the F-TEID of an UE. Returns false if the table is full
+  bool insert(in_addr_t ue_ip, uint32_t teid, in_addr_t enb_ip)
+  {
+    slot_t *s = probe(ue_ip, true);
+    if (s == NULL) {
+      return false;
+    }
+    if (!s->valid) {
+      nof_valid++;
+    }
+    s->seq++;
+    SPGW_TABLE_BARRIER();
+    s->ue_ip  = ue_ip;
+    s->teid   = teid;
+    s->enb_ip = enb_ip;
+    s->valid  = true;
+    SPGW_TABLE_BARRIER();
+    s->seq++;
+    return true;
+  }
+
+  bool erase(in_addr_t ue_ip)
+  {
+    slot_t *s = probe(ue_ip, false);
+    if (s == NULL || !s->valid) {
+      return false;
+    }
+    s->seq++;
+    SPGW_TABLE_BARRIER();
+    s->valid = false;
+    SPGW_TABLE_BARRIER();
+    s->seq++;
+    nof_valid--;
+    return true;
+  }
+
+  // Can be called from any thread
+  bool find(in_addr_t ue_ip, uint32_t *teid, in_addr_t *enb_ip)
+  {
+    slot_t *s = probe(ue_ip, false);
+    if (s == NULL) {
+      return false;
+    }
+    while (true) {
+      uint32_t seq = s->seq;
+      SPGW_TABLE_BARRIER();
+      in_addr_t addr  = s->ue_ip;
+      bool      valid = s->valid;
+      uint32_t  t     = s->teid;
+      in_addr_t ip    = s->enb_ip;
+      SPGW_TABLE_BARRIER();
+      if ((seq & 1) == 0 && seq == s->seq) {
+        // The slot may have been reused for another address meanwhile
+        valid = valid && addr == ue_ip;
+        if (valid) {
+          *teid   = t;
+          *enb_ip = ip;
+        }
+        return valid;
+      }
+    }
+  }
+
+  uint32_t size()
+  {
+    return nof_valid;
+  }
+
+private:
+  typedef struct {
+    volatile uint32_t  seq;
+    volatile in_addr_t ue_ip; // 0 while the slot has never been used
+    volatile bool      valid;
+    volatile uint32_t  teid;
+    volatile in_addr_t enb_ip;
+  } slot_t;
+
+  ue_ip_table(const ue_ip_table &other);
+  ue_ip_table& operator=(const ue_ip_table &other);
+
+  // Returns the slot of the address. If it is not found and claim is set, returns
+  // the first erased slot of its chain, or else the unused slot ending the chain
+  slot_t* probe(in_addr_t ue_ip, bool claim)
+  {
+    uint32_t idx    = ntohl(ue_ip) & (capacity - 1);
+    slot_t  *erased = NULL;
+    for (uint32_t i = 0; i < capacity; i++) {
+      slot_t *s = &slots[(idx + i) & (capacity - 1)];
+      if (s->ue_ip == ue_ip) {
+        SPGW_TABLE_BARRIER();
+        return s;
+      }
+      if (s->ue_ip == 0) {
+        if (!claim) {
+          return NULL;
+        }
+        return erased ? erased : s;
+      }
+      if (claim && erased == NULL && !s->valid) {
+        erased = s;
+      }
+    }
+    return claim ? erased : NULL;
+  }
+
+  slot_t  *slots;
+  uint32_t capacity;
+  uint32_t nof_valid;
+};
+
+} // namespace srsepc
+
+#endif // SRSEPC_UE_IP_TABLE_H
@@ -118,9 +118,12 @@ parse_args(all_args_t *args, int argc, char* argv[]) {
     ("spgw.gtpu_bind_addr", bpo::value<string>(&spgw_bind_addr)->default_value("127.0.0.1"), "IP address of SP-GW for the S1-U connection")
     ("spgw.sgi_if_addr",    bpo::value<string>(&sgi_if_addr)->default_value("176.16.0.1"),   "IP address of TUN interface for the SGi connection")
     ("spgw.sgi_if_name",    bpo::value<string>(&sgi_if_name)->default_value("srs_spgw_sgi"), "Name of TUN interface for the SGi connection")
+    ("spgw.nof_workers",    bpo::value<uint32_t>(&args->spgw_args.nof_workers)->default_value(1), "Number of user plane threads, each with its own TUN queue and S1-U socket")
 
     ("pcap.enable",         bpo::value<bool>(&args->mme_args.s1ap_args.pcap_enable)->default_value(false),         "Enable S1AP PCAP")
     ("pcap.filename",       bpo::value<string>(&args->mme_args.s1ap_args.pcap_filename)->default_value("/tmp/epc.pcap"), "PCAP filename")
+    ("pcap.file_max_size",  bpo::value<int>(&args->mme_args.s1ap_args.pcap_file_max_size)->default_value(-1), "Start a new capture file after this many kilobytes (-1 disables)")
+    ("pcap.file_max_time",  bpo::value<int>(&args->mme_args.s1ap_args.pcap_file_max_time)->default_value(-1), "Start a new capture file after this many seconds (-1 disables)")
 
     ("log.s1ap_level",      bpo::value<string>(&args->log_args.s1ap_level),   "MME S1AP log level")
     ("log.s1ap_hex_limit",  bpo::value<int>(&args->log_args.s1ap_hex_limit),  "MME S1AP log hex dump limit")
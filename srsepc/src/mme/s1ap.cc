@@ -102,7 +102,7 @@ s1ap::init(s1ap_args_t s1ap_args, srslte::log_filter *s1ap_log, hss_interface_s1
   //Init PCAP
   m_pcap_enable = s1ap_args.pcap_enable;
   if(m_pcap_enable){
-    m_pcap.open(s1ap_args.pcap_filename.c_str());
+    m_pcap.open(s1ap_args.pcap_filename.c_str(), s1ap_args.pcap_file_max_size, s1ap_args.pcap_file_max_time);
   }
   m_s1ap_log->info("S1AP Initialized\n");
   return 0;
@@ -228,7 +228,7 @@ s1ap::handle_s1ap_rx_pdu(srslte::byte_buffer_t *pdu, struct sctp_sndrcvinfo *enb
 {
   LIBLTE_S1AP_S1AP_PDU_STRUCT rx_pdu;
 
-  if(liblte_s1ap_unpack_s1ap_pdu((LIBLTE_BYTE_MSG_STRUCT*)pdu, &rx_pdu) != LIBLTE_SUCCESS) {
+  if(liblte_s1ap_unpack_s1ap_pdu((LIBLTE_BYTE_MSG_STRUCT*)pdu->liblte_msg(), &rx_pdu) != LIBLTE_SUCCESS) {
     m_s1ap_log->error("Failed to unpack received PDU\n");
     return false;
   }
@@ -203,7 +203,7 @@ s1ap_mngmt_proc::pack_s1_setup_failure(LIBLTE_S1AP_CAUSEMISC_ENUM cause, srslte:
   s1_fail->Cause.choice.misc.ext=false;
   s1_fail->Cause.choice.misc.e=cause;
   
-  liblte_s1ap_pack_s1ap_pdu(&pdu, (LIBLTE_BYTE_MSG_STRUCT*)msg);
+  liblte_s1ap_pack_s1ap_pdu(&pdu, (LIBLTE_BYTE_MSG_STRUCT*)msg->liblte_msg());
   return true;
  }
 
@@ -263,7 +263,7 @@ s1ap_mngmt_proc::pack_s1_setup_response(s1ap_args_t s1ap_args, srslte::byte_buff
 
   s1_resp->CriticalityDiagnostics_present = false;
 
-  liblte_s1ap_pack_s1ap_pdu(&pdu, (LIBLTE_BYTE_MSG_STRUCT*)msg);
+  liblte_s1ap_pack_s1ap_pdu(&pdu, (LIBLTE_BYTE_MSG_STRUCT*)msg->liblte_msg());
   
  return true;
 }
@@ -28,6 +28,9 @@
 #include <algorithm>
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <poll.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <linux/if.h>
@@ -49,6 +52,8 @@ spgw::spgw():
   m_running(false),
   m_sgi_up(false),
   m_s1u_up(false),
+  m_nof_workers(1),
+  m_stop_fd(-1),
   m_next_ctrl_teid(1),
   m_next_user_teid(1)
 {
@@ -92,6 +97,8 @@ spgw::init(spgw_args_t* args, srslte::log_filter *spgw_log)
   m_spgw_log = spgw_log;
   m_mme_gtpc = mme_gtpc::get_instance();
 
+  m_nof_workers = std::max((uint32_t) 1, std::min(SPGW_MAX_WORKERS, args->nof_workers));
+
   //Init SGi interface
   err = init_sgi_if(args);
   if (err != srslte::ERROR_NONE)
@@ -107,6 +114,14 @@ spgw::init(spgw_args_t* args, srslte::log_filter *spgw_log)
     m_spgw_log->console("Could not initialize the S1-U interface.\n");
     return -1;
   }
+
+  //Used by stop() to wake up the workers
+  m_stop_fd = eventfd(0, EFD_NONBLOCK);
+  if (m_stop_fd < 0)
+  {
+    m_spgw_log->console("Could not create the SP-GW stop event: %s\n", strerror(errno));
+    return -1;
+  }
   //Initialize UE ip pool
   err = init_ue_ip(args);
   if (err != srslte::ERROR_NONE)
@@ -128,19 +143,26 @@ spgw::stop()
   if(m_running)
   {
     m_running = false;
-    thread_cancel();
+    //The workers leave their loop once the event is signalled, the SP-GW thread joins them
+    uint64_t one = 1;
+    if (write(m_stop_fd, &one, sizeof(one)) != sizeof(one)) {
+      m_spgw_log->error("Failed to signal the SP-GW stop event: %s\n", strerror(errno));
+    }
     wait_thread_finish();
+    close(m_stop_fd);
 
     //Clean up SGi interface
     if(m_sgi_up)
     {
-      close(m_sgi_if);
+      for (uint32_t i=0;i<m_sgi_queues.size();i++) {
+        close(m_sgi_queues[i]);
+      }
       close(m_sgi_sock);
     }
-    //Clean up S1-U socket
+    //Clean up S1-U sockets
     if(m_s1u_up)
     {
-      close(m_s1u);
+      close_s1u_socks();
     }
   }
   std::map<uint32_t,spgw_tunnel_ctx*>::iterator it = m_teid_to_tunnel_ctx.begin();         //Map control TEID to tunnel ctx. Usefull to get reply ctrl TEID, UE IP, etc.
@@ -165,26 +187,36 @@ spgw::init_sgi_if(spgw_args_t *args)
   }
 
 
-  // Construct the TUN device
-  m_sgi_if = open("/dev/net/tun", O_RDWR);
-  m_spgw_log->info("TUN file descriptor = %d\n", m_sgi_if);
-  if(m_sgi_if < 0)
+  // Construct the TUN device, with one queue per worker
+  for (uint32_t i=0;i<m_nof_workers;i++)
   {
+    int fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
+    m_spgw_log->info("TUN file descriptor = %d\n", fd);
+    if(fd < 0)
+    {
       m_spgw_log->error("Failed to open TUN device: %s\n", strerror(errno));
+      close_sgi_queues();
       return(srslte::ERROR_CANT_START);
-  }
+    }
 
-  memset(&ifr, 0, sizeof(ifr));
-  ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
-  strncpy(ifr.ifr_ifrn.ifrn_name, args->sgi_if_name.c_str(), std::min(args->sgi_if_name.length(), (size_t)(IFNAMSIZ-1)));
-  ifr.ifr_ifrn.ifrn_name[IFNAMSIZ-1]='\0';
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+    if (m_nof_workers > 1) {
+      ifr.ifr_flags |= IFF_MULTI_QUEUE;
+    }
+    strncpy(ifr.ifr_ifrn.ifrn_name, args->sgi_if_name.c_str(), std::min(args->sgi_if_name.length(), (size_t)(IFNAMSIZ-1)));
+    ifr.ifr_ifrn.ifrn_name[IFNAMSIZ-1]='\0';
 
-  if(ioctl(m_sgi_if, TUNSETIFF, &ifr) < 0)
-  {
+    if(ioctl(fd, TUNSETIFF, &ifr) < 0)
+    {
       m_spgw_log->error("Failed to set TUN device name: %s\n", strerror(errno));
-      close(m_sgi_if);
+      close(fd);
+      close_sgi_queues();
       return(srslte::ERROR_CANT_START);
+    }
+    m_sgi_queues.push_back(fd);
   }
+  m_sgi_if = m_sgi_queues[0];
 
   // Bring up the interface
   m_sgi_sock = socket(AF_INET, SOCK_DGRAM, 0);
@@ -192,14 +224,14 @@ spgw::init_sgi_if(spgw_args_t *args)
   if(ioctl(m_sgi_sock, SIOCGIFFLAGS, &ifr) < 0)
   {
       m_spgw_log->error("Failed to bring up socket: %s\n", strerror(errno));
-      close(m_sgi_if);
+      close_sgi_queues();
       return(srslte::ERROR_CANT_START);
   }
   ifr.ifr_flags |= IFF_UP | IFF_RUNNING;
   if(ioctl(m_sgi_sock, SIOCSIFFLAGS, &ifr) < 0)
   {
       m_spgw_log->error("Failed to set socket flags: %s\n", strerror(errno));
-      close(m_sgi_if);
+      close_sgi_queues();
       return(srslte::ERROR_CANT_START);
   }
 
@@ -211,7 +243,7 @@ spgw::init_sgi_if(spgw_args_t *args)
 
   if (ioctl(m_sgi_sock, SIOCSIFADDR, &ifr) < 0) {
     m_spgw_log->error("Failed to set TUN interface IP. Address: %s, Error: %s\n", args->sgi_if_addr.c_str(), strerror(errno));
-    close(m_sgi_if);
+    close_sgi_queues();
     close(m_sgi_sock);
     return srslte::ERROR_CANT_START;
   }
@@ -220,7 +252,7 @@ spgw::init_sgi_if(spgw_args_t *args)
   ((struct sockaddr_in *)&ifr.ifr_netmask)->sin_addr.s_addr = inet_addr("255.255.255.0");
   if (ioctl(m_sgi_sock, SIOCSIFNETMASK, &ifr) < 0) {
     m_spgw_log->error("Failed to set TUN interface Netmask. Error: %s\n", strerror(errno));
-    close(m_sgi_if);
+    close_sgi_queues();
     close(m_sgi_sock);
     return srslte::ERROR_CANT_START;
   }
@@ -232,33 +264,65 @@ spgw::init_sgi_if(spgw_args_t *args)
   return(srslte::ERROR_NONE);
 }
 
-srslte::error_t
-spgw::init_s1u(spgw_args_t *args)
+void
+spgw::close_sgi_queues()
 {
-  //Open S1-U socket
-  m_s1u = socket(AF_INET,SOCK_DGRAM,0);
-  if (m_s1u == -1)
-  {
-    m_spgw_log->error("Failed to open socket: %s\n", strerror(errno));
-    return srslte::ERROR_CANT_START;
+  for (uint32_t i=0;i<m_sgi_queues.size();i++) {
+    close(m_sgi_queues[i]);
   }
-  m_s1u_up = true;
+  m_sgi_queues.clear();
+}
 
-  //Bind the socket
+srslte::error_t
+spgw::init_s1u(spgw_args_t *args)
+{
   m_s1u_addr.sin_family = AF_INET;
   m_s1u_addr.sin_addr.s_addr=inet_addr(args->gtpu_bind_addr.c_str());
   m_s1u_addr.sin_port=htons(GTPU_RX_PORT);
 
-  if (bind(m_s1u,(struct sockaddr *)&m_s1u_addr,sizeof(struct sockaddr_in))) {
-    m_spgw_log->error("Failed to bind socket: %s\n", strerror(errno));
-    return srslte::ERROR_CANT_START;
+  //Open one S1-U socket per worker, bound to the same port
+  for (uint32_t i=0;i<m_nof_workers;i++)
+  {
+    int fd = socket(AF_INET,SOCK_DGRAM | SOCK_NONBLOCK,0);
+    if (fd == -1)
+    {
+      m_spgw_log->error("Failed to open socket: %s\n", strerror(errno));
+      close_s1u_socks();
+      return srslte::ERROR_CANT_START;
+    }
+    m_s1u_socks.push_back(fd);
+
+    int enable = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(int)) < 0) {
+      m_spgw_log->error("setsockopt(SO_REUSEPORT) failed: %s\n", strerror(errno));
+      close_s1u_socks();
+      return srslte::ERROR_CANT_START;
+    }
+
+    //Bind the socket
+    if (bind(fd,(struct sockaddr *)&m_s1u_addr,sizeof(struct sockaddr_in))) {
+      m_spgw_log->error("Failed to bind socket: %s\n", strerror(errno));
+      close_s1u_socks();
+      return srslte::ERROR_CANT_START;
+    }
   }
+  m_s1u = m_s1u_socks[0];
+  m_s1u_up = true;
   m_spgw_log->info("S1-U socket = %d\n", m_s1u);
   m_spgw_log->info("S1-U IP = %s, Port = %d \n", inet_ntoa(m_s1u_addr.sin_addr),ntohs(m_s1u_addr.sin_port));
 
   return srslte::ERROR_NONE;
 }
 
+void
+spgw::close_s1u_socks()
+{
+  for (uint32_t i=0;i<m_s1u_socks.size();i++) {
+    close(m_s1u_socks[i]);
+  }
+  m_s1u_socks.clear();
+}
+
 srslte::error_t
 spgw::init_ue_ip(spgw_args_t *args)
 {
@@ -271,128 +335,236 @@ spgw::run_thread()
 {
   //Mark the thread as running
   m_running=true;
-  srslte::byte_buffer_t *msg;
-  msg = m_pool->allocate();
-
-  struct sockaddr src_addr;
-  socklen_t addrlen;
-  struct iphdr   *ip_pkt;
-  int sgi = m_sgi_if;
-
-  fd_set set;
-  //struct timeval to;
-  int max_fd = std::max(m_s1u,sgi);
-  while (m_running)
-  {
-    msg->reset();
-    FD_ZERO(&set);
-    FD_SET(m_s1u, &set);
-    FD_SET(sgi, &set);
-
-    //m_spgw_log->info("Waiting for S1-U or SGi packets.\n");
-    int n = select(max_fd+1, &set, NULL, NULL, NULL);
-    if (n == -1)
-    { 
-      m_spgw_log->error("Error from select\n");
+
+  std::vector<worker*> workers;
+  for (uint32_t i=1;i<m_nof_workers;i++) {
+    workers.push_back(new worker(this, i));
+    workers.back()->start();
+  }
+  run_worker(0);
+
+  //Returns once stop() has woken up all the workers
+  for (uint32_t i=0;i<workers.size();i++) {
+    workers[i]->wait_thread_finish();
+    delete workers[i];
+  }
+  return;
+}
+
+void
+spgw::run_worker(uint32_t idx)
+{
+  std::vector<srslte::byte_buffer_t*> bufs(SPGW_BATCH_SIZE);
+  std::vector<struct mmsghdr>         msgs(SPGW_BATCH_SIZE);
+  std::vector<struct iovec>           iovs(SPGW_BATCH_SIZE);
+  std::vector<sockaddr_in>            addrs(SPGW_BATCH_SIZE);
+
+  //The buffers are reused for every batch
+  uint32_t nof_bufs = 0;
+  for (;nof_bufs<SPGW_BATCH_SIZE;nof_bufs++) {
+    bufs[nof_bufs] = m_pool->allocate();
+    if (bufs[nof_bufs] == NULL) {
+      m_spgw_log->error("Fatal Error: Couldn't allocate buffers for SP-GW worker %d\n", idx);
+      break;
     }
-    else if (n)
+  }
+
+  int epfd = -1;
+  if (nof_bufs == SPGW_BATCH_SIZE) {
+    epfd = epoll_create(3);
+    if (epfd < 0) {
+      m_spgw_log->error("Fatal Error: Couldn't create epoll instance for SP-GW worker %d\n", idx);
+    }
+  }
+  if (epfd >= 0) {
+    struct epoll_event ev;
+    bzero(&ev, sizeof(ev));
+    ev.events  = EPOLLIN;
+    ev.data.fd = m_s1u_socks[idx];
+    epoll_ctl(epfd, EPOLL_CTL_ADD, m_s1u_socks[idx], &ev);
+    ev.data.fd = m_sgi_queues[idx];
+    epoll_ctl(epfd, EPOLL_CTL_ADD, m_sgi_queues[idx], &ev);
+    //Never read, so that it stays readable for all the workers once signalled
+    ev.data.fd = m_stop_fd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, m_stop_fd, &ev);
+
+    struct epoll_event events[3];
+    bool running = true;
+    while (running)
     {
-      //m_spgw_log->info("Data is available now.\n");
-      if (FD_ISSET(m_s1u, &set))
+      int n = epoll_wait(epfd, events, 3, -1);
+      if (n == -1)
       {
-        msg->N_bytes = recvfrom(m_s1u, msg->msg, SRSLTE_MAX_BUFFER_SIZE_BYTES, 0, &src_addr, &addrlen );
-        handle_s1u_pdu(msg);
+        if (errno != EINTR) {
+          m_spgw_log->error("Error from epoll_wait\n");
+        }
+        continue;
       }
-      if (FD_ISSET(m_sgi_if, &set))
+      //Each ready descriptor is drained by at most one batch, so that the other is not starved
+      for (int i=0;i<n;i++)
       {
-        msg->N_bytes = read(sgi, msg->msg, SRSLTE_MAX_BUFFER_SIZE_BYTES);
-        handle_sgi_pdu(msg);
+        if (events[i].data.fd == m_stop_fd) {
+          running = false;
+        } else if (events[i].data.fd == m_s1u_socks[idx]) {
+          recv_s1u_batch(idx, bufs, msgs, iovs);
+        } else {
+          recv_sgi_batch(idx, bufs, msgs, iovs, addrs);
+        }
       }
     }
-    else
-    {
-      m_spgw_log->debug("No data from select.\n");
-    }
+    close(epfd);
+  }
+
+  for (uint32_t i=0;i<nof_bufs;i++) {
+    m_pool->deallocate(bufs[i]);
+  }
+}
+
+void
+spgw::recv_s1u_batch(uint32_t idx, std::vector<srslte::byte_buffer_t*> &bufs, std::vector<struct mmsghdr> &msgs,
+                     std::vector<struct iovec> &iovs)
+{
+  for (uint32_t i=0;i<SPGW_BATCH_SIZE;i++) {
+    bufs[i]->reset();
+    iovs[i].iov_base = bufs[i]->msg;
+    iovs[i].iov_len  = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+    bzero(&msgs[i].msg_hdr, sizeof(struct msghdr));
+    msgs[i].msg_hdr.msg_iov    = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  int n = recvmmsg(m_s1u_socks[idx], &msgs[0], SPGW_BATCH_SIZE, MSG_DONTWAIT, NULL);
+  for (int i=0;i<n;i++) {
+    bufs[i]->N_bytes = msgs[i].msg_len;
+    handle_s1u_pdu(bufs[i], m_sgi_queues[idx]);
   }
-  m_pool->deallocate(msg);
-  return;
 }
 
 void
-spgw::handle_sgi_pdu(srslte::byte_buffer_t *msg)
+spgw::recv_sgi_batch(uint32_t idx, std::vector<srslte::byte_buffer_t*> &bufs, std::vector<struct mmsghdr> &msgs,
+                     std::vector<struct iovec> &iovs, std::vector<sockaddr_in> &addrs)
 {
-  uint8_t version=0;
-  uint32_t dest_ip;
-  struct in_addr dest_addr;
-  std::map<uint32_t,srslte::gtpc_f_teid_ie>::iterator gtp_fteid_it;
-  bool ip_found = false;
-  srslte::gtpc_f_teid_ie enb_fteid;
+  //The TUN device returns one packet per read, the GTP-U packets are sent in one call
+  uint32_t nof_msgs = 0;
+  for (uint32_t i=0;i<SPGW_BATCH_SIZE;i++) {
+    srslte::byte_buffer_t *msg = bufs[nof_msgs];
+    msg->reset();
+    int n = read(m_sgi_queues[idx], msg->msg, SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET);
+    if (n <= 0) {
+      break;
+    }
+    msg->N_bytes = n;
+    if (handle_sgi_pdu(msg, &addrs[nof_msgs])) {
+      iovs[nof_msgs].iov_base = msg->msg;
+      iovs[nof_msgs].iov_len  = msg->N_bytes;
+      bzero(&msgs[nof_msgs].msg_hdr, sizeof(struct msghdr));
+      msgs[nof_msgs].msg_hdr.msg_iov     = &iovs[nof_msgs];
+      msgs[nof_msgs].msg_hdr.msg_iovlen  = 1;
+      msgs[nof_msgs].msg_hdr.msg_name    = &addrs[nof_msgs];
+      msgs[nof_msgs].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      nof_msgs++;
+    }
+  }
+
+  uint32_t sent = 0;
+  while (sent < nof_msgs) {
+    int n = sendmmsg(m_s1u_socks[idx], &msgs[sent], nof_msgs - sent, 0);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        //The socket is non-blocking, wait for room in its send buffer as a blocking send would
+        if (!wait_s1u_writable(idx)) {
+          break;
+        }
+        continue;
+      }
+      m_spgw_log->error("Error sending packet to eNB: %s\n", strerror(errno));
+      n = 1;
+    }
+    sent += n;
+  }
+}
+
+bool
+spgw::wait_s1u_writable(uint32_t idx)
+{
+  struct pollfd fds[2];
+  fds[0].fd     = m_s1u_socks[idx];
+  fds[0].events = POLLOUT;
+  fds[1].fd     = m_stop_fd;
+  fds[1].events = POLLIN;
+  while (true) {
+    fds[0].revents = 0;
+    fds[1].revents = 0;
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      m_spgw_log->error("Error waiting for the S1-U socket: %s\n", strerror(errno));
+      return false;
+    }
+    //Give up on the batch when stopping
+    if (fds[1].revents) {
+      return false;
+    }
+    if (fds[0].revents) {
+      return true;
+    }
+  }
+}
+
+bool
+spgw::handle_sgi_pdu(srslte::byte_buffer_t *msg, sockaddr_in *enb_addr)
+{
+  uint32_t  enb_teid;
+  in_addr_t enb_ipv4;
 
   struct iphdr *iph = (struct iphdr *) msg->msg;
   if (iph->version != 4) {
     m_spgw_log->warning("IPv6 not supported yet.\n");
-    return;
+    return false;
   }
-  if (iph->tot_len < 20) {
+  if (ntohs(iph->tot_len) < 20) {
     m_spgw_log->warning("Invalid IP header length.\n");
-    return;
-  }
-
-  pthread_mutex_lock(&m_mutex);
-  gtp_fteid_it = m_ip_to_teid.find(iph->daddr);
-  if (gtp_fteid_it != m_ip_to_teid.end()) {
-    ip_found = true;
-    enb_fteid = gtp_fteid_it->second;
+    return false;
   }
-  pthread_mutex_unlock(&m_mutex);
 
-  if (ip_found == false) {
+  if (!m_ip_to_teid.find(iph->daddr, &enb_teid, &enb_ipv4)) {
     //m_spgw_log->console("IP Packet is not for any UE\n");
-    return;
+    return false;
   }
-  struct sockaddr_in enb_addr;
-  enb_addr.sin_family = AF_INET;
-  enb_addr.sin_port = htons(GTPU_RX_PORT);
-  enb_addr.sin_addr.s_addr = enb_fteid.ipv4;
-  //m_spgw_log->console("UE F-TEID found, TEID 0x%x, eNB IP %s\n", enb_fteid.teid, inet_ntoa(enb_addr.sin_addr));
+  enb_addr->sin_family = AF_INET;
+  enb_addr->sin_port = htons(GTPU_RX_PORT);
+  enb_addr->sin_addr.s_addr = enb_ipv4;
 
   //Setup GTP-U header
   srslte::gtpu_header_t header;
   header.flags        = GTPU_FLAGS_VERSION_V1 | GTPU_FLAGS_GTP_PROTOCOL;
   header.message_type = GTPU_MSG_DATA_PDU;
   header.length       = msg->N_bytes;
-  header.teid         = enb_fteid.teid;
+  header.teid         = enb_teid;
 
   //Write header into packet
   if (!srslte::gtpu_write_header(&header, msg, m_spgw_log)) {
     m_spgw_log->console("Error writing GTP-U header on PDU\n");
+    return false;
   }
-
-
-  //Send packet to destination
-  int n = sendto(m_s1u,msg->msg,msg->N_bytes,0,(struct sockaddr*) &enb_addr,sizeof(enb_addr));
-  if(n<0)
-  {
-    m_spgw_log->error("Error sending packet to eNB\n");
-    return;
-  }
-  else if((unsigned int) n!=msg->N_bytes)
-  {
-    m_spgw_log->error("Mis-match between packet bytes and sent bytes: Sent: %d, Packet: %d \n",n,msg->N_bytes);
-  }
-  return;
+  return true;
 }
 
 
 void
-spgw::handle_s1u_pdu(srslte::byte_buffer_t *msg)
+spgw::handle_s1u_pdu(srslte::byte_buffer_t *msg, int sgi_if)
 {
   //m_spgw_log->console("Received PDU from S1-U. Bytes=%d\n",msg->N_bytes);
   srslte::gtpu_header_t header;
-  srslte::gtpu_read_header(msg, &header, m_spgw_log);
+  if (!srslte::gtpu_read_header(msg, &header, m_spgw_log)) {
+    return;
+  }
  
   //m_spgw_log->console("TEID 0x%x. Bytes=%d\n", header.teid, msg->N_bytes);
-  int n = write(m_sgi_if, msg->msg, msg->N_bytes);
+  int n = write(sgi_if, msg->msg, msg->N_bytes);
   if(n<0)
   {
     m_spgw_log->error("Could not write to TUN interface.\n");
@@ -404,6 +576,26 @@ spgw::handle_s1u_pdu(srslte::byte_buffer_t *msg)
   return;
 }
 
+bool
+spgw::set_dl_tunnel(in_addr_t ue_ipv4, srslte::gtpc_f_teid_ie *enb_fteid)
+{
+  pthread_mutex_lock(&m_mutex);
+  bool ret = m_ip_to_teid.insert(ue_ipv4, enb_fteid->teid, enb_fteid->ipv4);
+  pthread_mutex_unlock(&m_mutex);
+  if (!ret) {
+    m_spgw_log->error("Could not add the user plane tunnel, %d tunnels active\n", m_ip_to_teid.size());
+  }
+  return ret;
+}
+
+void
+spgw::rem_dl_tunnel(in_addr_t ue_ipv4)
+{
+  pthread_mutex_lock(&m_mutex);
+  m_ip_to_teid.erase(ue_ipv4);
+  pthread_mutex_unlock(&m_mutex);
+}
+
 /*
  * Helper Functions
  */
@@ -474,12 +666,7 @@ spgw::delete_gtp_ctx(uint32_t ctrl_teid)
   tunnel_ctx = m_teid_to_tunnel_ctx[ctrl_teid];
 
   //Remove GTP-U connections, if any.
-  if(m_ip_to_teid.count(tunnel_ctx->ue_ipv4))
-  {
-    pthread_mutex_lock(&m_mutex);
-    m_ip_to_teid.erase(tunnel_ctx->ue_ipv4);
-    pthread_mutex_unlock(&m_mutex);   
-  }
+  rem_dl_tunnel(tunnel_ctx->ue_ipv4);
   //Remove Ctrl TEID from IMSI to control TEID map
   m_imsi_to_ctr_teid.erase(tunnel_ctx->imsi);
 
@@ -580,11 +767,7 @@ spgw::handle_modify_bearer_request(struct srslte::gtpc_pdu *mb_req_pdu, struct s
   m_spgw_log->info("eNB Rx User TEID 0x%x, eNB Rx User IP %s\n", tunnel_ctx->dw_user_fteid.teid, inet_ntoa(addr3));
 
   //Setup IP to F-TEID map
-  //bool ret = false;
-  pthread_mutex_lock(&m_mutex);
-  m_ip_to_teid[tunnel_ctx->ue_ipv4]=tunnel_ctx->dw_user_fteid;
-  //ret = m_ip_to_teid.insert(std::pair<uint32_t,srslte::gtpc_f_teid_ie>(tunnel_ctx->ue_ipv4, tunnel_ctx->dw_user_fteid));
-  pthread_mutex_unlock(&m_mutex);
+  set_dl_tunnel(tunnel_ctx->ue_ipv4, &tunnel_ctx->dw_user_fteid);
 
   //Setting up Modify bearer response PDU
   //Header
@@ -617,13 +800,7 @@ spgw::handle_delete_session_request(struct srslte::gtpc_pdu *del_req_pdu, struct
   in_addr_t ue_ipv4 = tunnel_ctx->ue_ipv4;
 
   //Delete data tunnel
-  pthread_mutex_lock(&m_mutex);
-  std::map<in_addr_t,srslte::gtp_fteid_t>::iterator data_it = m_ip_to_teid.find(tunnel_ctx->ue_ipv4);
-  if(data_it != m_ip_to_teid.end())
-  {
-    m_ip_to_teid.erase(data_it);
-  }
-  pthread_mutex_unlock(&m_mutex);
+  rem_dl_tunnel(tunnel_ctx->ue_ipv4);
   m_teid_to_tunnel_ctx.erase(tunnel_it);
 
   delete tunnel_ctx; 
@@ -645,13 +822,7 @@ spgw::handle_release_access_bearers_request(struct srslte::gtpc_pdu *rel_req_pdu
   in_addr_t ue_ipv4 = tunnel_ctx->ue_ipv4;
 
   //Delete data tunnel
-  pthread_mutex_lock(&m_mutex);
-  std::map<in_addr_t,srslte::gtpc_f_teid_ie>::iterator data_it = m_ip_to_teid.find(tunnel_ctx->ue_ipv4);
-  if(data_it != m_ip_to_teid.end())
-  {
-    m_ip_to_teid.erase(data_it);
-  }
-  pthread_mutex_unlock(&m_mutex);
+  rem_dl_tunnel(tunnel_ctx->ue_ipv4);
 
   //Do NOT delete control tunnel
   return;
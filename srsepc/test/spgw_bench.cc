@@ -0,0 +1,318 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Packet rate of the SP-GW user plane over its SGi TUN interface and the
+ * loopback. Emulated eNBs send GTP-U packets carrying UDP datagrams from the
+ * UEs to a socket bound to the SGi address (uplink), then that socket sends
+ * datagrams to the UE addresses, which the SP-GW tunnels back to the eNBs
+ * (downlink). Each eNB has its own address, so that the uplink flows are
+ * spread between the S1-U sockets of the workers. The number of packets in
+ * flight is limited to stay within the socket buffers. Requires the
+ * privileges to create a TUN interface.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+
+#include "srslte/common/log_filter.h"
+#include "srslte/upper/gtpu.h"
+#include "srsepc/hdr/spgw/spgw.h"
+
+using namespace srsepc;
+
+#define SGI_NET    "172.16.200."
+#define ENB_NET    "127.0.1."
+#define SPGW_ADDR  "127.0.1.100"
+#define UDP_PORT   9000
+#define BATCH      32
+#define MAX_USERS  200
+#define MAX_ENBS   16
+#define TIMEOUT_MS 1000
+
+uint32_t nof_packets = 100000;
+uint32_t nof_users   = 16;
+uint32_t nof_enbs    = 4;
+uint32_t nof_workers = 1;
+uint32_t pdu_size    = 512;
+uint32_t window      = 128;
+
+void usage(char *prog) {
+  printf("Usage: %s [nuetsw]\n", prog);
+  printf("\t-n number of packets per direction [Default %d]\n", nof_packets);
+  printf("\t-u number of UEs [Default %d]\n", nof_users);
+  printf("\t-e number of eNBs [Default %d]\n", nof_enbs);
+  printf("\t-t number of SP-GW user plane workers [Default %d]\n", nof_workers);
+  printf("\t-s UDP payload size in bytes [Default %d]\n", pdu_size);
+  printf("\t-w maximum number of packets in flight [Default %d]\n", window);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nuetsw")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_packets = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'u':
+        nof_users = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'e':
+        nof_enbs = (uint32_t) atoi(argv[optind]);
+        break;
+      case 't':
+        nof_workers = (uint32_t) atoi(argv[optind]);
+        break;
+      case 's':
+        pdu_size = (uint32_t) atoi(argv[optind]);
+        break;
+      case 'w':
+        window = (uint32_t) atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (nof_users < 1 || nof_users > MAX_USERS) {
+    nof_users = 16;
+  }
+  if (nof_enbs < 1 || nof_enbs > MAX_ENBS) {
+    nof_enbs = 4;
+  }
+  if (pdu_size < 1 || pdu_size > 1400) {
+    pdu_size = 512;
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+in_addr_t addr(const char *net, uint32_t host) {
+  char str[32];
+  snprintf(str, sizeof(str), "%s%d", net, host);
+  return inet_addr(str);
+}
+
+int open_socket(in_addr_t ip, uint16_t port) {
+  int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  int size = 4 * 1024 * 1024;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(int));
+  struct sockaddr_in a;
+  bzero(&a, sizeof(a));
+  a.sin_family      = AF_INET;
+  a.sin_addr.s_addr = ip;
+  a.sin_port        = htons(port);
+  if (fd < 0 || bind(fd, (struct sockaddr*) &a, sizeof(a))) {
+    perror("bind");
+    exit(-1);
+  }
+  return fd;
+}
+
+uint16_t ip_checksum(uint16_t *hdr, uint32_t len) {
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < len / 2; i++) {
+    sum += hdr[i];
+  }
+  while (sum >> 16) {
+    sum = (sum & 0xffff) + (sum >> 16);
+  }
+  return (uint16_t) ~sum;
+}
+
+// GTP-U packet of an UE carrying an IPv4/UDP datagram to the SGi address
+uint32_t build_ul_packet(uint32_t u, uint8_t *buf) {
+  uint32_t ip_len = sizeof(struct iphdr) + sizeof(struct udphdr) + pdu_size;
+  uint8_t *p      = buf;
+
+  *p++ = GTPU_FLAGS_VERSION_V1 | GTPU_FLAGS_GTP_PROTOCOL;
+  *p++ = GTPU_MSG_DATA_PDU;
+  *p++ = (uint8_t) (ip_len >> 8);
+  *p++ = (uint8_t) ip_len;
+  uint32_t teid = 0x100 + u;
+  *p++ = (uint8_t) (teid >> 24);
+  *p++ = (uint8_t) (teid >> 16);
+  *p++ = (uint8_t) (teid >> 8);
+  *p++ = (uint8_t) teid;
+
+  struct iphdr *ip = (struct iphdr*) p;
+  bzero(ip, sizeof(struct iphdr));
+  ip->version  = 4;
+  ip->ihl      = 5;
+  ip->ttl      = 64;
+  ip->protocol = IPPROTO_UDP;
+  ip->tot_len  = htons(ip_len);
+  ip->saddr    = addr(SGI_NET, 2 + u);
+  ip->daddr    = addr(SGI_NET, 1);
+  ip->check    = ip_checksum((uint16_t*) ip, sizeof(struct iphdr));
+
+  struct udphdr *udp = (struct udphdr*) (p + sizeof(struct iphdr));
+  udp->source = htons(UDP_PORT);
+  udp->dest   = htons(UDP_PORT);
+  udp->len    = htons(sizeof(struct udphdr) + pdu_size);
+  udp->check  = 0;
+  memset(p + sizeof(struct iphdr) + sizeof(struct udphdr), 0x5a, pdu_size);
+  return 8 + ip_len;
+}
+
+/* Sends nof_packets packets from the tx sockets and counts them on the rx
+ * sockets. packets[i] is sent from tx_fds[i % tx_fds.size()] to dst[i]. */
+uint64_t run(const char *name, std::vector<int> &tx_fds, std::vector<std::vector<uint8_t> > &packets,
+             std::vector<sockaddr_in> &dst, std::vector<int> &rx_fds) {
+  std::vector<struct pollfd> pfds(rx_fds.size());
+  for (uint32_t i = 0; i < rx_fds.size(); i++) {
+    pfds[i].fd     = rx_fds[i];
+    pfds[i].events = POLLIN;
+  }
+  uint8_t            rx_buf[BATCH][2048];
+  struct mmsghdr     rx_msgs[BATCH];
+  struct iovec       rx_iovs[BATCH];
+  uint64_t           sent     = 0;
+  uint64_t           received = 0;
+  uint64_t           t_start  = now_ns();
+  uint64_t           t_last   = t_start;
+
+  while (received < nof_packets) {
+    // One batch per eNB or per SGi socket while the window allows it
+    while (sent < nof_packets && sent - received + BATCH <= window) {
+      for (uint32_t s = 0; s < tx_fds.size() && sent < nof_packets; s++, sent++) {
+        uint32_t i = (uint32_t) (sent % packets.size());
+        sendto(tx_fds[s], &packets[i][0], packets[i].size(), 0, (struct sockaddr*) &dst[i], sizeof(sockaddr_in));
+      }
+    }
+    bool progress = false;
+    for (uint32_t f = 0; f < rx_fds.size(); f++) {
+      for (uint32_t i = 0; i < BATCH; i++) {
+        rx_iovs[i].iov_base = rx_buf[i];
+        rx_iovs[i].iov_len  = sizeof(rx_buf[i]);
+        bzero(&rx_msgs[i].msg_hdr, sizeof(struct msghdr));
+        rx_msgs[i].msg_hdr.msg_iov    = &rx_iovs[i];
+        rx_msgs[i].msg_hdr.msg_iovlen = 1;
+      }
+      int n = recvmmsg(rx_fds[f], rx_msgs, BATCH, MSG_DONTWAIT, NULL);
+      if (n > 0) {
+        received += n;
+        progress  = true;
+      }
+    }
+    if (progress) {
+      t_last = now_ns();
+    } else if (now_ns() - t_last > (uint64_t) TIMEOUT_MS * 1000000) {
+      break;
+    } else if (sent == nof_packets || sent - received + BATCH > window) {
+      poll(&pfds[0], pfds.size(), 1);
+    }
+  }
+  uint64_t elapsed = (received < nof_packets ? t_last : now_ns()) - t_start;
+  printf("%s: %ld of %ld packets of %d bytes in %.1f ms, %.0f packet/s, %.1f Mbps\n", name, (long) received, (long) sent,
+         pdu_size, (double) elapsed / 1e6, (double) received * 1e9 / elapsed, (double) received * pdu_size * 8e3 / elapsed);
+  return sent - received;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  srslte::log_filter log_out("SPGW");
+  log_out.set_level(srslte::LOG_LEVEL_ERROR);
+
+  spgw_args_t args;
+  args.gtpu_bind_addr = SPGW_ADDR;
+  args.sgi_if_addr    = SGI_NET "1";
+  args.sgi_if_name    = "srs_spgw_bench";
+  args.nof_workers    = nof_workers;
+
+  spgw *gw = spgw::get_instance();
+  if (gw->init(&args, &log_out)) {
+    fprintf(stderr, "Error initiating the SP-GW, a TUN interface can not be created without privileges\n");
+    exit(-1);
+  }
+  gw->start();
+
+  // The eNBs and the server on the SGi side
+  std::vector<int> enb_fds;
+  for (uint32_t e = 0; e < nof_enbs; e++) {
+    enb_fds.push_back(open_socket(addr(ENB_NET, 1 + e), GTPU_RX_PORT));
+  }
+  std::vector<int> sgi_fds(1, open_socket(addr(SGI_NET, 1), UDP_PORT));
+
+  std::vector<std::vector<uint8_t> > ul_packets(nof_users), dl_packets(nof_users);
+  std::vector<sockaddr_in>           ul_dst(nof_users), dl_dst(nof_users);
+  std::vector<int>                   ul_fds;
+  for (uint32_t u = 0; u < nof_users; u++) {
+    srslte::gtpc_f_teid_ie enb_fteid;
+    bzero(&enb_fteid, sizeof(enb_fteid));
+    enb_fteid.teid = 0x1000 + u;
+    enb_fteid.ipv4 = addr(ENB_NET, 1 + u % nof_enbs);
+    gw->set_dl_tunnel(addr(SGI_NET, 2 + u), &enb_fteid);
+
+    uint8_t buf[2048];
+    ul_packets[u].assign(buf, buf + build_ul_packet(u, buf));
+    dl_packets[u].assign(pdu_size, 0xa5);
+
+    bzero(&ul_dst[u], sizeof(sockaddr_in));
+    ul_dst[u].sin_family      = AF_INET;
+    ul_dst[u].sin_addr.s_addr = inet_addr(SPGW_ADDR);
+    ul_dst[u].sin_port        = htons(GTPU_RX_PORT);
+    bzero(&dl_dst[u], sizeof(sockaddr_in));
+    dl_dst[u].sin_family      = AF_INET;
+    dl_dst[u].sin_addr.s_addr = addr(SGI_NET, 2 + u);
+    dl_dst[u].sin_port        = htons(UDP_PORT);
+  }
+  // Packet i goes from the eNB of user i
+  for (uint32_t u = 0; u < nof_users && u < nof_enbs; u++) {
+    ul_fds.push_back(enb_fds[u]);
+  }
+
+  printf("%d UEs, %d eNBs, %d workers\n", nof_users, nof_enbs, nof_workers);
+  uint64_t lost = run("Uplink", ul_fds, ul_packets, ul_dst, sgi_fds);
+  lost += run("Downlink", sgi_fds, dl_packets, dl_dst, enb_fds);
+
+  gw->stop();
+  spgw::cleanup();
+  for (uint32_t e = 0; e < nof_enbs; e++) {
+    close(enb_fds[e]);
+  }
+  close(sgi_fds[0]);
+
+  if (lost) {
+    printf("Error: %ld packets lost\n", (long) lost);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,128 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "srsepc/hdr/spgw/ue_ip_table.h"
+
+using namespace srsepc;
+
+#define CAPACITY     64
+#define NOF_ATTACHED 40
+#define NOF_ATTACHES (20*CAPACITY)
+
+// Addresses are handed out sequentially from this one, as spgw::get_new_ue_ipv4() does
+#define FIRST_UE_IP  0xAC100002
+
+// The F-TEID of each UE is derived from its address so readers can check it
+static uint32_t teid_of(uint32_t h_ip)   { return h_ip ^ 0x5A5A0000; }
+static in_addr_t enb_of(uint32_t h_ip)   { return htonl(0x7F000000 | (h_ip & 0xFFFF)); }
+
+static volatile bool     running = true;
+static volatile uint32_t last_attached;
+static volatile bool     reader_error = false;
+
+void* reader_thread(void *a)
+{
+  ue_ip_table *table = (ue_ip_table*) a;
+  while (running) {
+    uint32_t last = last_attached;
+    for (uint32_t h_ip = FIRST_UE_IP; h_ip <= last; h_ip++) {
+      uint32_t  teid;
+      in_addr_t enb_ip;
+      if (table->find(htonl(h_ip), &teid, &enb_ip)) {
+        if (teid != teid_of(h_ip) || enb_ip != enb_of(h_ip)) {
+          reader_error = true;
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv)
+{
+  ue_ip_table table(CAPACITY);
+  pthread_t   reader;
+  bool        result = true;
+
+  last_attached = FIRST_UE_IP - 1;
+  pthread_create(&reader, NULL, reader_thread, &table);
+
+  // Attach more distinct addresses than the table capacity, detaching the oldest
+  // UE once NOF_ATTACHED are connected
+  for (uint32_t i = 0; i < NOF_ATTACHES; i++) {
+    uint32_t h_ip = FIRST_UE_IP + i;
+    if (!table.insert(htonl(h_ip), teid_of(h_ip), enb_of(h_ip))) {
+      printf("Insert of UE %d failed with %d UEs attached\n", i, table.size());
+      result = false;
+      break;
+    }
+    last_attached = h_ip;
+    if (i >= NOF_ATTACHED) {
+      if (!table.erase(htonl(h_ip - NOF_ATTACHED))) {
+        printf("Erase of UE %d failed\n", i - NOF_ATTACHED);
+        result = false;
+        break;
+      }
+    }
+    if (table.size() != (i < NOF_ATTACHED ? i + 1 : NOF_ATTACHED)) {
+      printf("Wrong table size %d after %d attaches\n", table.size(), i + 1);
+      result = false;
+      break;
+    }
+  }
+
+  running = false;
+  pthread_join(reader, NULL);
+
+  // Only the last NOF_ATTACHED addresses must be found
+  for (uint32_t i = 0; i < NOF_ATTACHES && result; i++) {
+    uint32_t  h_ip = FIRST_UE_IP + i;
+    uint32_t  teid;
+    in_addr_t enb_ip;
+    bool      found    = table.find(htonl(h_ip), &teid, &enb_ip);
+    bool      attached = i >= NOF_ATTACHES - NOF_ATTACHED;
+    if (found != attached || (found && (teid != teid_of(h_ip) || enb_ip != enb_of(h_ip)))) {
+      printf("Wrong lookup of UE %d\n", i);
+      result = false;
+    }
+  }
+
+  if (reader_error) {
+    printf("Reader found a wrong F-TEID\n");
+    result = false;
+  }
+
+  if (result) {
+    printf("Passed\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(1);
+  }
+}
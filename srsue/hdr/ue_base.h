@@ -73,6 +73,8 @@ typedef struct {
   std::string   filename;
   bool          nas_enable;
   std::string   nas_filename;
+  int           file_max_size;
+  int           file_max_time;
 }pcap_args_t;
 
 typedef struct {
@@ -102,6 +104,7 @@ typedef struct {
   int           usim_hex_limit;
   int           all_hex_limit;
   int           file_max_size;
+  bool          binary;
   std::string   filename;
 }log_args_t;
 
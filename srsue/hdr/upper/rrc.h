@@ -357,10 +357,11 @@ private:
 
   byte_buffer_t *dedicatedInfoNAS;
 
-  byte_buffer_t* byte_align_and_pack();
+  byte_buffer_t* copy_to_pdu();
+  bool copy_from_pdu(byte_buffer_t *pdu);
   void send_ul_ccch_msg();
   void send_ul_dcch_msg();
-  srslte::bit_buffer_t          bit_buf;
+  LIBLTE_BYTE_MSG_STRUCT        byte_buf;
 
   pthread_mutex_t mutex;
 
@@ -94,6 +94,8 @@ void parse_args(all_args_t *args, int argc, char *argv[]) {
     ("pcap.filename", bpo::value<string>(&args->pcap.filename)->default_value("ue.pcap"), "MAC layer capture filename")
     ("pcap.nas_enable",   bpo::value<bool>(&args->pcap.nas_enable)->default_value(false), "Enable NAS packet captures for wireshark")
     ("pcap.nas_filename", bpo::value<string>(&args->pcap.nas_filename)->default_value("ue_nas.pcap"), "NAS layer capture filename (useful when NAS encryption is enabled)")
+    ("pcap.file_max_size", bpo::value<int>(&args->pcap.file_max_size)->default_value(-1), "Start a new capture file after this many kilobytes (-1 disables)")
+    ("pcap.file_max_time", bpo::value<int>(&args->pcap.file_max_time)->default_value(-1), "Start a new capture file after this many seconds (-1 disables)")
 
     ("trace.enable", bpo::value<bool>(&args->trace.enable)->default_value(false), "Enable PHY and radio timing traces")
     ("trace.phy_filename", bpo::value<string>(&args->trace.phy_filename)->default_value("ue.phy_trace"),
@@ -126,6 +128,7 @@ void parse_args(all_args_t *args, int argc, char *argv[]) {
 
     ("log.filename", bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"), "Log filename")
     ("log.file_max_size", bpo::value<int>(&args->log.file_max_size)->default_value(-1), "Maximum file size (in kilobytes). When passed, multiple files are created. Default -1 (single file)")
+    ("log.binary", bpo::value<bool>(&args->log.binary)->default_value(false), "Write a binary log, rendered offline with log_decode")
 
     ("usim.mode", bpo::value<string>(&args->usim.mode)->default_value("soft"), "USIM mode (soft or pcsc)")
     ("usim.algo", bpo::value<string>(&args->usim.algo), "USIM authentication algorithm")
@@ -64,6 +64,11 @@ bool ue::init(all_args_t *args_) {
 
   if (!args->log.filename.compare("stdout")) {
     logger = &logger_stdout;
+  } else if (args->log.binary) {
+    logger_binary.init(args->log.filename);
+    logger_binary.log("\n\n");
+    logger_binary.log(get_build_string().c_str());
+    logger = &logger_binary;
   } else {
     logger_file.init(args->log.filename, args->log.file_max_size);
     logger_file.log("\n\n");
@@ -136,11 +141,11 @@ bool ue::init(all_args_t *args_) {
 
   // Set up pcap and trace
   if(args->pcap.enable) {
-    mac_pcap.open(args->pcap.filename.c_str());
+    mac_pcap.open(args->pcap.filename.c_str(), 0, args->pcap.file_max_size, args->pcap.file_max_time);
     mac.start_pcap(&mac_pcap);
   }
   if(args->pcap.nas_enable) {
-    nas_pcap.open(args->pcap.nas_filename.c_str());
+    nas_pcap.open(args->pcap.nas_filename.c_str(), 0, args->pcap.file_max_size, args->pcap.file_max_time);
     nas.start_pcap(&nas_pcap);
   }
   if(args->trace.enable) {
@@ -311,8 +311,15 @@ void nas::write_pdu(uint32_t lcid, byte_buffer_t *pdu) {
 
   nas_log->info_hex(pdu->msg, pdu->N_bytes, "DL %s PDU", rrc->get_rb_name(lcid).c_str());
 
+  // The parsers below see the buffer as a LIBLTE_BYTE_MSG_STRUCT
+  if (pdu->liblte_msg() == NULL) {
+    nas_log->error("Not handling NAS message in a %d byte buffer\n", pdu->get_capacity());
+    pool->deallocate(pdu);
+    return;
+  }
+
   // Parse the message security header
-  liblte_mme_parse_msg_sec_header((LIBLTE_BYTE_MSG_STRUCT*)pdu, &pd, &sec_hdr_type);
+  liblte_mme_parse_msg_sec_header((LIBLTE_BYTE_MSG_STRUCT*)pdu->liblte_msg(), &pd, &sec_hdr_type);
   switch (sec_hdr_type)
   {
     case LIBLTE_MME_SECURITY_HDR_TYPE_PLAIN_NAS:
@@ -345,7 +352,7 @@ void nas::write_pdu(uint32_t lcid, byte_buffer_t *pdu) {
   }
 
   // Parse the message header
-  liblte_mme_parse_msg_header((LIBLTE_BYTE_MSG_STRUCT *) pdu, &pd, &msg_type);
+  liblte_mme_parse_msg_header((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &pd, &msg_type);
   nas_log->info_hex(pdu->msg, pdu->N_bytes, "DL %s Decrypted PDU", rrc->get_rb_name(lcid).c_str());
   // TODO: Check if message type requieres specical security header type and if it isvalid
 
@@ -601,7 +608,7 @@ void nas::parse_attach_accept(uint32_t lcid, byte_buffer_t *pdu) {
 
   nas_log->info("Received Attach Accept\n");
 
-  liblte_mme_unpack_attach_accept_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &attach_accept);
+  liblte_mme_unpack_attach_accept_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &attach_accept);
 
   if (attach_accept.eps_attach_result == LIBLTE_MME_EPS_ATTACH_RESULT_EPS_ONLY) {
     //FIXME: Handle t3412.unit
@@ -711,7 +718,7 @@ void nas::parse_attach_accept(uint32_t lcid, byte_buffer_t *pdu) {
     liblte_mme_pack_attach_complete_msg(&attach_complete,
                                         LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
                                         ctxt.tx_count,
-                                        (LIBLTE_BYTE_MSG_STRUCT *) pdu);
+                                        (LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg());
     // Write NAS pcap
     if (pcap != NULL) {
       pcap->write_nas(pdu->msg, pdu->N_bytes);
@@ -743,7 +750,7 @@ void nas::parse_attach_reject(uint32_t lcid, byte_buffer_t *pdu) {
   LIBLTE_MME_ATTACH_REJECT_MSG_STRUCT attach_rej;
   ZERO_OBJECT(attach_rej);
 
-  liblte_mme_unpack_attach_reject_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &attach_rej);
+  liblte_mme_unpack_attach_reject_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &attach_rej);
   nas_log->warning("Received Attach Reject. Cause= %02X\n", attach_rej.emm_cause);
   nas_log->console("Received Attach Reject. Cause= %02X\n", attach_rej.emm_cause);
   state = EMM_STATE_DEREGISTERED;
@@ -756,7 +763,7 @@ void nas::parse_authentication_request(uint32_t lcid, byte_buffer_t *pdu, const
   bzero(&auth_req, sizeof(LIBLTE_MME_AUTHENTICATION_REQUEST_MSG_STRUCT));
 
   nas_log->info("Received Authentication Request\n");
-  liblte_mme_unpack_authentication_request_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &auth_req);
+  liblte_mme_unpack_authentication_request_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &auth_req);
 
   // Deallocate PDU after parsing
   pool->deallocate(pdu);
@@ -811,7 +818,7 @@ void nas::parse_identity_request(uint32_t lcid, byte_buffer_t *pdu) {
   LIBLTE_MME_ID_RESPONSE_MSG_STRUCT id_resp;
   ZERO_OBJECT(id_resp);
 
-  liblte_mme_unpack_identity_request_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &id_req);
+  liblte_mme_unpack_identity_request_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &id_req);
 
   // Deallocate PDU after parsing
   pool->deallocate(pdu);
@@ -840,7 +847,7 @@ void nas::parse_security_mode_command(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_MME_SECURITY_MODE_COMPLETE_MSG_STRUCT sec_mode_comp;
   bzero(&sec_mode_comp, sizeof(LIBLTE_MME_SECURITY_MODE_COMPLETE_MSG_STRUCT));
 
-  liblte_mme_unpack_security_mode_command_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &sec_mode_cmd);
+  liblte_mme_unpack_security_mode_command_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &sec_mode_cmd);
   nas_log->info("Received Security Mode Command ksi: %d, eea: %s, eia: %s\n",
                 sec_mode_cmd.nas_ksi.nas_ksi,
                 ciphering_algorithm_id_text[sec_mode_cmd.selected_nas_sec_algs.type_of_eea],
@@ -927,7 +934,7 @@ void nas::parse_security_mode_command(uint32_t lcid, byte_buffer_t *pdu)
   liblte_mme_pack_security_mode_complete_msg(&sec_mode_comp,
                                              LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED_WITH_NEW_EPS_SECURITY_CONTEXT,
                                              ctxt.tx_count,
-                                             (LIBLTE_BYTE_MSG_STRUCT *) pdu);
+                                             (LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg());
   if(pcap != NULL) {
     pcap->write_nas(pdu->msg, pdu->N_bytes);
   }
@@ -952,7 +959,7 @@ void nas::parse_service_reject(uint32_t lcid, byte_buffer_t *pdu) {
 
 void nas::parse_esm_information_request(uint32_t lcid, byte_buffer_t *pdu) {
   LIBLTE_MME_ESM_INFORMATION_REQUEST_MSG_STRUCT esm_info_req;
-  liblte_mme_unpack_esm_information_request_msg((LIBLTE_BYTE_MSG_STRUCT *)pdu, &esm_info_req);
+  liblte_mme_unpack_esm_information_request_msg((LIBLTE_BYTE_MSG_STRUCT *)pdu->liblte_msg(), &esm_info_req);
 
   nas_log->info("ESM information request received for beaser=%d, transaction_id=%d\n", esm_info_req.eps_bearer_id, esm_info_req.proc_transaction_id);
   ctxt.rx_count++;
@@ -963,7 +970,7 @@ void nas::parse_esm_information_request(uint32_t lcid, byte_buffer_t *pdu) {
 }
 
 void nas::parse_emm_information(uint32_t lcid, byte_buffer_t *pdu) {
-  liblte_mme_unpack_emm_information_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &emm_info);
+  liblte_mme_unpack_emm_information_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &emm_info);
   std::string str = emm_info_str(&emm_info);
   nas_log->info("Received EMM Information: %s\n", str.c_str());
   nas_log->console("%s\n", str.c_str());
@@ -974,7 +981,7 @@ void nas::parse_emm_information(uint32_t lcid, byte_buffer_t *pdu) {
 void nas::parse_detach_request(uint32_t lcid, byte_buffer_t *pdu)
 {
   LIBLTE_MME_DETACH_REQUEST_MSG_STRUCT detach_request;
-  liblte_mme_unpack_detach_request_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &detach_request);
+  liblte_mme_unpack_detach_request_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg(), &detach_request);
   ctxt.rx_count++;
   pool->deallocate(pdu);
 
@@ -1048,7 +1055,7 @@ void nas::gen_attach_request(byte_buffer_t *msg) {
     liblte_mme_pack_attach_request_msg(&attach_req,
                                        LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY,
                                        ctxt.tx_count,
-                                       (LIBLTE_BYTE_MSG_STRUCT *) msg);
+                                       (LIBLTE_BYTE_MSG_STRUCT *) msg->liblte_msg());
 
     // Add MAC
     if (msg->N_bytes > 5) {
@@ -1067,7 +1074,7 @@ void nas::gen_attach_request(byte_buffer_t *msg) {
     attach_req.nas_ksi.nas_ksi       = 0;
     usim->get_imsi_vec(attach_req.eps_mobile_id.imsi, 15);
     nas_log->info("Requesting IMSI attach (IMSI=%s)\n", usim->get_imsi_str().c_str());
-    liblte_mme_pack_attach_request_msg(&attach_req, (LIBLTE_BYTE_MSG_STRUCT *) msg);
+    liblte_mme_pack_attach_request_msg(&attach_req, (LIBLTE_BYTE_MSG_STRUCT *) msg->liblte_msg());
   }
 
   if(pcap != NULL) {
@@ -1153,7 +1160,7 @@ void nas::send_security_mode_reject(uint8_t cause) {
 
   LIBLTE_MME_SECURITY_MODE_REJECT_MSG_STRUCT sec_mode_rej = {0};
   sec_mode_rej.emm_cause = cause;
-  liblte_mme_pack_security_mode_reject_msg(&sec_mode_rej, (LIBLTE_BYTE_MSG_STRUCT *) msg);
+  liblte_mme_pack_security_mode_reject_msg(&sec_mode_rej, (LIBLTE_BYTE_MSG_STRUCT *) msg->liblte_msg());
   if(pcap != NULL) {
     pcap->write_nas(msg->msg, msg->N_bytes);
   }
@@ -1189,7 +1196,7 @@ void nas::send_detach_request(bool switch_off)
     liblte_mme_pack_detach_request_msg(&detach_request,
                                        LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
                                        ctxt.tx_count,
-                                       (LIBLTE_BYTE_MSG_STRUCT *) pdu);
+                                       (LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg());
 
     if(pcap != NULL) {
       pcap->write_nas(pdu->msg, pdu->N_bytes);
@@ -1213,7 +1220,7 @@ void nas::send_detach_request(bool switch_off)
     detach_request.nas_ksi.nas_ksi       = 0;
     usim->get_imsi_vec(detach_request.eps_mobile_id.imsi, 15);
     nas_log->info("Requesting IMSI detach (IMSI=%s)\n", usim->get_imsi_str().c_str());
-    liblte_mme_pack_detach_request_msg(&detach_request, LIBLTE_MME_SECURITY_HDR_TYPE_PLAIN_NAS, ctxt.tx_count, (LIBLTE_BYTE_MSG_STRUCT *) pdu);
+    liblte_mme_pack_detach_request_msg(&detach_request, LIBLTE_MME_SECURITY_HDR_TYPE_PLAIN_NAS, ctxt.tx_count, (LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg());
 
     if(pcap != NULL) {
       pcap->write_nas(pdu->msg, pdu->N_bytes);
@@ -1237,7 +1244,7 @@ void nas::send_detach_accept()
   liblte_mme_pack_detach_accept_msg(&detach_accept,
                                     LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
                                     ctxt.tx_count,
-                                    (LIBLTE_BYTE_MSG_STRUCT *) pdu);
+                                    (LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg());
 
   if(pcap != NULL) {
     pcap->write_nas(pdu->msg, pdu->N_bytes);
@@ -1275,7 +1282,7 @@ void nas::send_authentication_response(const uint8_t* res, const size_t res_len,
     auth_res.res[i] = res[i];
   }
   auth_res.res_len = res_len;
-  liblte_mme_pack_authentication_response_msg(&auth_res, sec_hdr_type, ctxt.tx_count, (LIBLTE_BYTE_MSG_STRUCT *)pdu);
+  liblte_mme_pack_authentication_response_msg(&auth_res, sec_hdr_type, ctxt.tx_count, (LIBLTE_BYTE_MSG_STRUCT *)pdu->liblte_msg());
 
   if(pcap != NULL) {
     pcap->write_nas(pdu->msg, pdu->N_bytes);
@@ -1313,7 +1320,7 @@ void nas::send_authentication_failure(const uint8_t cause, const uint8_t* auth_f
     auth_failure.auth_fail_param_present = false;
   }
 
-  liblte_mme_pack_authentication_failure_msg(&auth_failure, (LIBLTE_BYTE_MSG_STRUCT *)msg);
+  liblte_mme_pack_authentication_failure_msg(&auth_failure, (LIBLTE_BYTE_MSG_STRUCT *)msg->liblte_msg());
   if(pcap != NULL) {
     pcap->write_nas(msg->msg, msg->N_bytes);
   }
@@ -1347,7 +1354,7 @@ void nas::send_identity_response(uint32_t lcid, uint8 id_type)
     return;
   }
 
-  liblte_mme_pack_identity_response_msg(&id_resp, (LIBLTE_BYTE_MSG_STRUCT *) pdu);
+  liblte_mme_pack_identity_response_msg(&id_resp, (LIBLTE_BYTE_MSG_STRUCT *) pdu->liblte_msg());
 
   if(pcap != NULL) {
     pcap->write_nas(pdu->msg, pdu->N_bytes);
@@ -1499,7 +1506,7 @@ void nas::send_esm_information_response(const uint8 proc_transaction_id) {
   if (liblte_mme_pack_esm_information_response_msg(&esm_info_resp,
                                                    LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
                                                    ctxt.tx_count,
-                                                   (LIBLTE_BYTE_MSG_STRUCT *)pdu)) {
+                                                   (LIBLTE_BYTE_MSG_STRUCT *)pdu->liblte_msg())) {
     nas_log->error("Error packing ESM information response.\n");
     return;
   }
@@ -1276,10 +1276,10 @@ void rrc::send_con_restablish_request(LIBLTE_RRC_CON_REEST_REQ_CAUSE_ENUM cause)
   }
 
   // Compute shortMAC-I
-  uint8_t varShortMAC[128], varShortMAC_packed[16];
-  bzero(varShortMAC, 128);
+  uint8_t varShortMAC_packed[16];
   bzero(varShortMAC_packed, 16);
-  uint8_t *msg_ptr = varShortMAC;
+  LIBLTE_BIT_PTR_STRUCT msg_ptr;
+  liblte_bit_ptr_init(&msg_ptr, varShortMAC_packed);
 
   // ASN.1 encode VarShortMAC-Input
   liblte_rrc_pack_cell_identity_ie(cellid, &msg_ptr);
@@ -1287,9 +1287,8 @@ void rrc::send_con_restablish_request(LIBLTE_RRC_CON_REEST_REQ_CAUSE_ENUM cause)
   liblte_rrc_pack_c_rnti_ie(crnti, &msg_ptr);
 
   // byte align (already zero-padded)
-  uint32_t N_bits  = (uint32_t) (msg_ptr-varShortMAC);
+  uint32_t N_bits  = msg_ptr.N_bits;
   uint32_t N_bytes = ((N_bits-1)/8+1);
-  srslte_bit_pack_vector(varShortMAC, varShortMAC_packed, N_bytes*8);
 
   rrc_log->info("Encoded varShortMAC: cellId=0x%x, PCI=%d, rnti=0x%x (%d bytes, %d bits)\n",
                 cellid, pci, crnti, N_bytes, N_bits);
@@ -1344,7 +1343,7 @@ void rrc::send_con_restablish_request(LIBLTE_RRC_CON_REEST_REQ_CAUSE_ENUM cause)
       if (mac_timers->timer_get(t311)->is_running()) {
         // Actions following cell reselection while T311 is running 5.3.7.3
         rrc_log->info("Cell Selection finished. Initiating transmission of RRC Connection Reestablishment Request\n");
-        liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, (LIBLTE_BIT_MSG_STRUCT *) &bit_buf);
+        liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, &byte_buf);
 
         mac_timers->timer_get(t301)->reset();
         mac_timers->timer_get(t301)->run();
@@ -1694,10 +1693,12 @@ void rrc::write_pdu_bcch_dlsch(byte_buffer_t *pdu) {
   LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT dlsch_msg;
   ZERO_OBJECT(dlsch_msg);
 
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-  bit_buf.N_bits = pdu->N_bytes * 8;
+  bool valid = copy_from_pdu(pdu);
   pool->deallocate(pdu);
-  liblte_rrc_unpack_bcch_dlsch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &dlsch_msg);
+  if (!valid) {
+    return;
+  }
+  liblte_rrc_unpack_bcch_dlsch_msg(&byte_buf, &dlsch_msg);
 
   for(uint32_t i=0; i<dlsch_msg.N_sibs; i++) {
     rrc_log->info("Processing SIB%d (%d/%d)\n", liblte_rrc_sys_info_block_type_num[dlsch_msg.sibs[i].sib_type], i, dlsch_msg.N_sibs);
@@ -1809,10 +1810,12 @@ void rrc::process_pcch(byte_buffer_t *pdu) {
 
     LIBLTE_RRC_PCCH_MSG_STRUCT pcch_msg;
     ZERO_OBJECT(pcch_msg);
-    srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-    bit_buf.N_bits = pdu->N_bytes * 8;
+    bool valid = copy_from_pdu(pdu);
     pool->deallocate(pdu);
-    liblte_rrc_unpack_pcch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &pcch_msg);
+    if (!valid) {
+      return;
+    }
+    liblte_rrc_unpack_pcch_msg(&byte_buf, &pcch_msg);
 
     if (pcch_msg.paging_record_list_size > LIBLTE_RRC_MAX_PAGE_REC) {
       pcch_msg.paging_record_list_size = LIBLTE_RRC_MAX_PAGE_REC;
@@ -1850,10 +1853,8 @@ void rrc::write_pdu_mch(uint32_t lcid, srslte::byte_buffer_t *pdu)
     rrc_log->info_hex(pdu->msg, pdu->N_bytes, "MCH message received %d bytes on lcid:%d\n", pdu->N_bytes, lcid);
     rrc_log->info("MCH message Stack latency: %ld us\n", pdu->get_latency_us());
     //TODO: handle MCCH notifications and update MCCH
-    if(0 == lcid && !serving_cell->has_mcch) {
-      srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-      bit_buf.N_bits = pdu->N_bytes * 8;
-      liblte_rrc_unpack_mcch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &serving_cell->mcch);
+    if(0 == lcid && !serving_cell->has_mcch && copy_from_pdu(pdu)) {
+      liblte_rrc_unpack_mcch_msg(&byte_buf, &serving_cell->mcch);
       serving_cell->has_mcch = true;
       phy->set_config_mbsfn_mcch(&serving_cell->mcch);
     }
@@ -1877,31 +1878,37 @@ void rrc::write_pdu_mch(uint32_t lcid, srslte::byte_buffer_t *pdu)
 *
 *
 *******************************************************************************/
-byte_buffer_t* rrc::byte_align_and_pack()
+byte_buffer_t* rrc::copy_to_pdu()
 {
-  // Byte align and pack the message bits for PDCP
-  if ((bit_buf.N_bits % 8) != 0) {
-    for (uint32_t i = 0; i < 8 - (bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-
-  // Reset and reuse sdu buffer if provided
-  byte_buffer_t *pdcp_buf = pool_allocate_blocking;
+  // The message is already byte aligned by the pack functions, leave room for the PDCP MAC-I
+  byte_buffer_t *pdcp_buf = pool_allocate_bytes_blocking(byte_buf.N_bytes + 4);
   if (pdcp_buf) {
-    srslte_bit_pack_vector(bit_buf.msg, pdcp_buf->msg, bit_buf.N_bits);
-    pdcp_buf->N_bytes = bit_buf.N_bits / 8;
+    memcpy(pdcp_buf->msg, byte_buf.msg, byte_buf.N_bytes);
+    pdcp_buf->N_bytes = byte_buf.N_bytes;
     pdcp_buf->set_timestamp();
   } else {
-    rrc_log->error("Fatal Error: Couldn't allocate PDU in byte_align_and_pack().\n");
+    rrc_log->error("Fatal Error: Couldn't allocate PDU in copy_to_pdu().\n");
   }
   return pdcp_buf;
 }
 
+// Copies a received PDU to byte_buf for the unpack functions, pooled buffers
+// of the smaller size classes can not be passed to them in place
+bool rrc::copy_from_pdu(byte_buffer_t *pdu)
+{
+  if (pdu->N_bytes > LIBLTE_MAX_MSG_SIZE_BYTES) {
+    rrc_log->error("Dropping RRC PDU of %d bytes, the maximum is %d bytes\n", pdu->N_bytes, LIBLTE_MAX_MSG_SIZE_BYTES);
+    return false;
+  }
+  memcpy(byte_buf.msg, pdu->msg, pdu->N_bytes);
+  byte_buf.N_bytes = pdu->N_bytes;
+  return true;
+}
+
 void rrc::send_ul_ccch_msg()
 {
-  liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, (LIBLTE_BIT_MSG_STRUCT *) &bit_buf);
-  byte_buffer_t *pdu = byte_align_and_pack();
+  liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, &byte_buf);
+  byte_buffer_t *pdu = copy_to_pdu();
   if (pdu) {
     // Set UE contention resolution ID in MAC
     uint64_t uecri = 0;
@@ -1921,8 +1928,8 @@ void rrc::send_ul_ccch_msg()
 
 void rrc::send_ul_dcch_msg()
 {
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT *) &bit_buf);
-  byte_buffer_t *pdu = byte_align_and_pack();
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &byte_buf);
+  byte_buffer_t *pdu = copy_to_pdu();
   if (pdu) {
     rrc_log->info("Sending %s\n", liblte_rrc_ul_dcch_msg_type_text[ul_dcch_msg.msg_type]);
     pdcp->write_sdu(RB_ID_SRB1, pdu);
@@ -1943,12 +1950,10 @@ void rrc::write_pdu(uint32_t lcid, byte_buffer_t *pdu) {
   rrc_log->info_hex(pdu->msg, pdu->N_bytes, "RX %s PDU", get_rb_name(lcid).c_str());
 
   // If the message contains a ConnectionSetup, acknowledge the transmission to avoid blocking of paging procedure
-  if (lcid == 0) {
+  if (lcid == 0 && copy_from_pdu(pdu)) {
     // FIXME: We unpack and process this message twice to check if it's ConnectionSetup
-    srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-    bit_buf.N_bits = pdu->N_bytes * 8;
     bzero(&dl_ccch_msg, sizeof(LIBLTE_RRC_DL_CCCH_MSG_STRUCT));
-    liblte_rrc_unpack_dl_ccch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &dl_ccch_msg);
+    liblte_rrc_unpack_dl_ccch_msg(&byte_buf, &dl_ccch_msg);
     if (dl_ccch_msg.msg_type == LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP) {
       // Must enter CONNECT before stopping T300
       state = RRC_STATE_CONNECTED;
@@ -1986,11 +1991,13 @@ void rrc::process_pdu(uint32_t lcid, byte_buffer_t *pdu)
 }
 
 void rrc::parse_dl_ccch(byte_buffer_t *pdu) {
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-  bit_buf.N_bits = pdu->N_bytes * 8;
+  bool valid = copy_from_pdu(pdu);
   pool->deallocate(pdu);
+  if (!valid) {
+    return;
+  }
   bzero(&dl_ccch_msg, sizeof(LIBLTE_RRC_DL_CCCH_MSG_STRUCT));
-  liblte_rrc_unpack_dl_ccch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &dl_ccch_msg);
+  liblte_rrc_unpack_dl_ccch_msg(&byte_buf, &dl_ccch_msg);
 
   rrc_log->info("SRB0 - Received %s\n",
                 liblte_rrc_dl_ccch_msg_type_text[dl_ccch_msg.msg_type]);
@@ -2038,10 +2045,12 @@ void rrc::parse_dl_ccch(byte_buffer_t *pdu) {
 }
 
 void rrc::parse_dl_dcch(uint32_t lcid, byte_buffer_t *pdu) {
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-  bit_buf.N_bits = pdu->N_bytes * 8;
+  if (!copy_from_pdu(pdu)) {
+    pool->deallocate(pdu);
+    return;
+  }
   bzero(&dl_dcch_msg, sizeof(dl_dcch_msg));
-  liblte_rrc_unpack_dl_dcch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &dl_dcch_msg);
+  liblte_rrc_unpack_dl_dcch_msg(&byte_buf, &dl_dcch_msg);
 
   rrc_log->info("%s - Received %s\n",
                 get_rb_name(lcid).c_str(),